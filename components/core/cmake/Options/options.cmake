@@ -152,6 +152,7 @@ endfunction()
 
 function(validate_clp_binaries_dependencies)
     validate_clp_dependencies_for_target(CLP_BUILD_EXECUTABLES
+        CLP_BUILD_CLP_REGEX_UTILS
         CLP_BUILD_CLP_STRING_UTILS
         CLP_BUILD_CLP_S_ARCHIVEREADER
         CLP_BUILD_CLP_S_ARCHIVEWRITER
@@ -247,6 +248,7 @@ endfunction()
 function(set_utils_profiling_dependencies)
     set_clp_need_flags(
         CLP_NEED_ABSL
+        CLP_NEED_NLOHMANN_JSON
         CLP_NEED_SPDLOG
     )
 endfunction()
@@ -258,6 +260,7 @@ function(validate_clp_s_archivereader_dependencies)
         CLP_BUILD_CLP_S_IO
         CLP_BUILD_CLP_S_TIMESTAMP_PARSER
         CLP_BUILD_CLP_S_TIMESTAMPPATTERN
+        CLP_BUILD_UTILS_PROFILING
     )
 endfunction()
 
@@ -297,6 +300,7 @@ endfunction()
 
 function(validate_clp_s_clp_dependencies_dependencies)
     validate_clp_dependencies_for_target(CLP_BUILD_CLP_S_CLP_DEPENDENCIES
+        CLP_BUILD_CLP_REGEX_UTILS
         CLP_BUILD_CLP_STRING_UTILS
         CLP_BUILD_UTILS_PROFILING
     )
@@ -402,6 +406,7 @@ endfunction()
 
 function(validate_clp_s_search_dependencies)
     validate_clp_dependencies_for_target(CLP_BUILD_CLP_S_SEARCH
+        CLP_BUILD_CLP_REGEX_UTILS
         CLP_BUILD_CLP_STRING_UTILS
         CLP_BUILD_CLP_S_ARCHIVEREADER
         CLP_BUILD_CLP_S_CLP_DEPENDENCIES
@@ -421,6 +426,12 @@ function(set_clp_s_search_dependencies)
     )
 endfunction()
 
+function(validate_clp_s_search_ast_dependencies)
+    validate_clp_dependencies_for_target(CLP_BUILD_CLP_S_SEARCH_AST
+        CLP_BUILD_CLP_REGEX_UTILS
+    )
+endfunction()
+
 function(set_clp_s_search_ast_dependencies)
     set_clp_need_flags(
         CLP_NEED_SIMDJSON
@@ -562,6 +573,7 @@ function(validate_and_setup_all_clp_dependency_flags)
     endif()
 
     if (CLP_BUILD_CLP_S_SEARCH_AST)
+        validate_clp_s_search_ast_dependencies()
         set_clp_s_search_ast_dependencies()
     endif()
 
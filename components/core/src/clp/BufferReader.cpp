@@ -103,4 +103,12 @@ BufferReader::try_read_to_delimiter(char delim, bool keep_delimiter, bool append
     size_t num_bytes_read{0};
     return try_read_to_delimiter(delim, keep_delimiter, str, found_delim, num_bytes_read);
 }
+
+auto BufferReader::try_peek_buffered_data(char const*& buf, size_t& buf_size) -> ErrorCode {
+    peek_buffer(buf, buf_size);
+    if (0 == buf_size) {
+        return ErrorCode_EndOfFile;
+    }
+    return ErrorCode_Success;
+}
 }  // namespace clp
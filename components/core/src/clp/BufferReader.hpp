@@ -94,6 +94,15 @@ public:
     try_read_to_delimiter(char delim, bool keep_delimiter, bool append, std::string& str)
             -> ErrorCode override;
 
+    /**
+     * @param buf Returns a pointer to the remaining content in the buffer
+     * @param buf_size Returns the size of the remaining content in the buffer
+     * @return ErrorCode_EndOfFile if the buffer doesn't contain any more data
+     * @return ErrorCode_Success on success
+     */
+    [[nodiscard]] auto try_peek_buffered_data(char const*& buf, size_t& buf_size)
+            -> ErrorCode override;
+
 private:
     // Methods
     [[nodiscard]] auto get_remaining_data_size() const -> size_t {
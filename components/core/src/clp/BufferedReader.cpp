@@ -201,6 +201,14 @@ BufferedReader::try_read_to_delimiter(char delim, bool keep_delimiter, bool appe
     return ErrorCode_Success;
 }
 
+auto BufferedReader::try_peek_buffered_data(char const*& buf, size_t& buf_size) -> ErrorCode {
+    if (auto const error_code{try_refill_buffer_if_empty()}; ErrorCode_Success != error_code) {
+        return error_code;
+    }
+    peek_buffered_data(buf, buf_size);
+    return ErrorCode_Success;
+}
+
 auto BufferedReader::refill_reader_buffer(size_t num_bytes_to_refill) -> ErrorCode {
     auto const buffer_end_in_src_pos = get_buffer_end_in_src_pos();
     auto const data_size = m_buffer_reader.get_buffer_size();
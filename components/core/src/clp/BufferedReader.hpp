@@ -171,6 +171,18 @@ public:
     try_read_to_delimiter(char delim, bool keep_delimiter, bool append, std::string& str)
             -> ErrorCode override;
 
+    /**
+     * Tries to peek the remaining buffered content, refilling the buffer first if it's empty.
+     *
+     * NOTE: Any subsequent read or seek operations may invalidate the returned buffer.
+     * @param buf Returns a pointer to the remaining content in the buffer.
+     * @param buf_size Returns the size of the remaining content in the buffer.
+     * @return ErrorCode_Success on success.
+     * @return Forwards `try_refill_buffer_if_empty`'s return values on failure.
+     */
+    [[nodiscard]] auto try_peek_buffered_data(char const*& buf, size_t& buf_size)
+            -> ErrorCode override;
+
 private:
     // Methods
     /**
@@ -1,9 +1,12 @@
 #ifndef CLP_DICTIONARYREADER_HPP
 #define CLP_DICTIONARYREADER_HPP
 
-#include <iterator>
+#include <cstdint>
+#include <cstring>
+#include <memory>
 #include <string>
 #include <string_view>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -20,6 +23,13 @@
 namespace clp {
 /**
  * Template class for reading dictionaries from disk and performing operations on them
+ *
+ * To keep opening large dictionaries cheap, entries are only decoded when they're first accessed.
+ * `read_new_entries` copies each entry's serialized form into a single buffer and records its
+ * offset in an ID -> offset index. Since an entry's value is stored verbatim in its serialized
+ * form, lookups match values in place and only decode the entries that match. Case-sensitive
+ * lookups use a value -> ID index that's built on first use. Since decoded entries and the index
+ * are cached by const methods, the reader isn't thread-safe.
  * @tparam DictionaryIdType
  * @tparam EntryType
  */
@@ -66,13 +76,12 @@ public:
     void read_new_entries();
 
     /**
-     * Gets the dictionary's entries
-     * @return All dictionary entries
+     * @return The number of entries in the dictionary
      */
-    std::vector<EntryType> const& get_entries() const { return m_entries; }
+    size_t get_num_entries() const { return m_entries.size(); }
 
     /**
-     * Gets the entry with the given ID
+     * Gets the entry with the given ID, decoding it if it hasn't been accessed yet
      * @param id
      * @return The entry with the given ID
      */
@@ -106,10 +115,36 @@ public:
 
 protected:
     // Methods
+    /**
+     * Reads the next entry from the dictionary and appends its serialized form to
+     * `m_serialized_entries`
+     */
+    void read_serialized_entry();
     /**
      * Reads a segment's worth of IDs from the segment index
      */
     void read_segment_ids();
+    /**
+     * Decodes the serialized entry with the given ID
+     * @param id
+     * @param entry Returns the decoded entry, without the IDs of the segments containing it
+     */
+    void decode_entry(size_t id, EntryType& entry) const;
+    /**
+     * Gets the entry with the given ID, decoding and caching it if it hasn't been accessed yet
+     * @param id
+     * @return The entry with the given ID
+     */
+    EntryType const& get_or_decode_entry(size_t id) const;
+    /**
+     * @param id
+     * @return A view of the value of the entry with the given ID, within its serialized form
+     */
+    std::string_view get_serialized_value(size_t id) const;
+    /**
+     * Adds any entries that aren't in the value -> ID index to it
+     */
+    void update_value_index() const;
 
     // Variables
     bool m_is_open;
@@ -125,7 +160,18 @@ protected:
     static_assert(false, "Unsupported compression mode.");
 #endif
     size_t m_num_segments_read_from_index;
-    std::vector<EntryType> m_entries;
+    // The serialized entries, in ID order, followed by a padding byte (see `decode_entry`)
+    std::string m_serialized_entries;
+    // The offset of each entry in `m_serialized_entries`, followed by the end of the last entry
+    std::vector<size_t> m_serialized_entry_offsets;
+    // The entries that have been decoded, or null for those that haven't been accessed yet
+    mutable std::vector<std::unique_ptr<EntryType>> m_entries;
+    // The IDs of the segments containing each entry that hasn't been decoded yet
+    mutable std::vector<std::vector<segment_id_t>> m_pending_segment_ids;
+    // Each value's ID, for the first `m_num_indexed_entries` entries. The values are views into
+    // `m_serialized_entries`, so the index is discarded whenever the buffer is reallocated.
+    mutable std::unordered_map<std::string_view, DictionaryIdType> m_value_index;
+    mutable size_t m_num_indexed_entries{0};
 };
 
 template <typename DictionaryIdType, typename EntryType>
@@ -154,6 +200,9 @@ void DictionaryReader<DictionaryIdType, EntryType>::open(
             cDecompressorFileReadBufferCapacity
     );
 
+    m_serialized_entries.push_back('\0');
+    m_serialized_entry_offsets.push_back(0);
+
     m_is_open = true;
 }
 
@@ -169,7 +218,12 @@ void DictionaryReader<DictionaryIdType, EntryType>::close() {
     m_dictionary_file_reader.reset();
 
     m_num_segments_read_from_index = 0;
+    m_serialized_entries.clear();
+    m_serialized_entry_offsets.clear();
     m_entries.clear();
+    m_pending_segment_ids.clear();
+    m_value_index.clear();
+    m_num_indexed_entries = 0;
 
     m_is_open = false;
 }
@@ -192,11 +246,17 @@ void DictionaryReader<DictionaryIdType, EntryType>::read_new_entries() {
     if (num_dictionary_entries > m_entries.size()) {
         auto prev_num_dictionary_entries = m_entries.size();
         m_entries.resize(num_dictionary_entries);
+        m_pending_segment_ids.resize(num_dictionary_entries);
+        m_serialized_entry_offsets.reserve(num_dictionary_entries + 1);
 
+        auto const* prev_serialized_entries_buf = m_serialized_entries.data();
         for (size_t i = prev_num_dictionary_entries; i < num_dictionary_entries; ++i) {
-            auto& entry = m_entries[i];
-
-            entry.read_from_file(m_dictionary_decompressor);
+            read_serialized_entry();
+        }
+        if (m_serialized_entries.data() != prev_serialized_entries_buf) {
+            // The index's views are now dangling
+            m_value_index.clear();
+            m_num_indexed_entries = 0;
         }
     }
 
@@ -213,6 +273,7 @@ void DictionaryReader<DictionaryIdType, EntryType>::read_new_entries() {
         for (size_t i = m_num_segments_read_from_index; i < num_segments; ++i) {
             read_segment_ids();
         }
+        m_num_segments_read_from_index = num_segments;
     }
 }
 
@@ -226,7 +287,7 @@ DictionaryReader<DictionaryIdType, EntryType>::get_entry(DictionaryIdType id) co
         throw OperationFailed(ErrorCode_BadParam, __FILENAME__, __LINE__);
     }
 
-    return m_entries[id];
+    return get_or_decode_entry(id);
 }
 
 template <typename DictionaryIdType, typename EntryType>
@@ -235,7 +296,7 @@ DictionaryReader<DictionaryIdType, EntryType>::get_value(DictionaryIdType id) co
     if (id >= m_entries.size()) {
         throw OperationFailed(ErrorCode_Corrupt, __FILENAME__, __LINE__);
     }
-    return m_entries[id].get_value();
+    return get_or_decode_entry(id).get_value();
 }
 
 template <typename DictionaryIdType, typename EntryType>
@@ -246,26 +307,18 @@ DictionaryReader<DictionaryIdType, EntryType>::get_entry_matching_value(
 ) const {
     if (false == ignore_case) {
         // In case-sensitive match, there can be only one matched entry.
-        if (auto const it = std::ranges::find_if(
-                    m_entries,
-                    [&](auto const& entry) { return entry.get_value() == search_string; }
-            );
-            m_entries.cend() != it)
-        {
-            return {&(*it)};
+        update_value_index();
+        auto const it = m_value_index.find(search_string);
+        if (m_value_index.end() == it) {
+            return {};
         }
-        return {};
+        return {&get_or_decode_entry(it->second)};
     }
 
     std::vector<EntryType const*> entries;
-    std::string search_string_uppercase;
-    std::ignore = boost::algorithm::to_upper_copy(
-            std::back_inserter(search_string_uppercase),
-            search_string
-    );
-    for (auto const& entry : m_entries) {
-        if (boost::algorithm::to_upper_copy(entry.get_value()) == search_string_uppercase) {
-            entries.push_back(&entry);
+    for (size_t id = 0; id < m_entries.size(); ++id) {
+        if (boost::algorithm::iequals(get_serialized_value(id), search_string)) {
+            entries.push_back(&get_or_decode_entry(id));
         }
     }
     return entries;
@@ -277,18 +330,41 @@ void DictionaryReader<DictionaryIdType, EntryType>::get_entries_matching_wildcar
         bool ignore_case,
         std::unordered_set<EntryType const*>& entries
 ) const {
-    for (auto const& entry : m_entries) {
+    for (size_t id = 0; id < m_entries.size(); ++id) {
         if (string_utils::wildcard_match_unsafe(
-                    entry.get_value(),
+                    get_serialized_value(id),
                     wildcard_string,
                     false == ignore_case
             ))
         {
-            entries.insert(&entry);
+            entries.insert(&get_or_decode_entry(id));
         }
     }
 }
 
+template <typename DictionaryIdType, typename EntryType>
+void DictionaryReader<DictionaryIdType, EntryType>::read_serialized_entry() {
+    DictionaryIdType id;
+    m_dictionary_decompressor.read_numeric_value(id, false);
+    uint64_t value_length;
+    m_dictionary_decompressor.read_numeric_value(value_length, false);
+
+    // Store the entry exactly as it was serialized so that it can be decoded by
+    // `EntryType::read_from_file`. The entry overwrites the padding byte, which is then re-added
+    // after it.
+    auto const entry_begin_pos = m_serialized_entry_offsets.back();
+    auto const entry_end_pos = entry_begin_pos + sizeof(id) + sizeof(value_length) + value_length;
+    m_serialized_entries.resize(entry_end_pos + 1, '\0');
+    auto* buf = m_serialized_entries.data() + entry_begin_pos;
+    std::memcpy(buf, &id, sizeof(id));
+    buf += sizeof(id);
+    std::memcpy(buf, &value_length, sizeof(value_length));
+    buf += sizeof(value_length);
+    m_dictionary_decompressor.read_exact_length(buf, value_length, false);
+
+    m_serialized_entry_offsets.push_back(entry_end_pos);
+}
+
 template <typename DictionaryIdType, typename EntryType>
 void DictionaryReader<DictionaryIdType, EntryType>::read_segment_ids() {
     segment_id_t segment_id;
@@ -303,7 +379,69 @@ void DictionaryReader<DictionaryIdType, EntryType>::read_segment_ids() {
             throw OperationFailed(ErrorCode_Corrupt, __FILENAME__, __LINE__);
         }
 
-        m_entries[id].add_segment_containing_entry(segment_id);
+        if (auto* entry = m_entries[id].get(); nullptr != entry) {
+            entry->add_segment_containing_entry(segment_id);
+        } else {
+            m_pending_segment_ids[id].push_back(segment_id);
+        }
+    }
+}
+
+template <typename DictionaryIdType, typename EntryType>
+void
+DictionaryReader<DictionaryIdType, EntryType>::decode_entry(size_t id, EntryType& entry) const {
+    auto const entry_begin_pos = m_serialized_entry_offsets[id];
+    auto const entry_end_pos = m_serialized_entry_offsets[id + 1];
+
+    // The decompressor reports EOF for any read at the end of its buffer, even an empty one (e.g.,
+    // when reading an empty value), so include the byte after the entry, which always exists
+    // thanks to the padding byte.
+    streaming_compression::passthrough::Decompressor entry_decompressor;
+    entry_decompressor.open(
+            m_serialized_entries.data() + entry_begin_pos,
+            entry_end_pos - entry_begin_pos + 1
+    );
+    entry.read_from_file(entry_decompressor);
+    entry_decompressor.close();
+}
+
+template <typename DictionaryIdType, typename EntryType>
+EntryType const&
+DictionaryReader<DictionaryIdType, EntryType>::get_or_decode_entry(size_t id) const {
+    auto& entry = m_entries[id];
+    if (nullptr == entry) {
+        entry = std::make_unique<EntryType>();
+        decode_entry(id, *entry);
+
+        auto& pending_segment_ids = m_pending_segment_ids[id];
+        for (auto const segment_id : pending_segment_ids) {
+            entry->add_segment_containing_entry(segment_id);
+        }
+        std::vector<segment_id_t>().swap(pending_segment_ids);
+    }
+    return *entry;
+}
+
+template <typename DictionaryIdType, typename EntryType>
+std::string_view
+DictionaryReader<DictionaryIdType, EntryType>::get_serialized_value(size_t id) const {
+    // Skip the ID and value length that precede the value
+    constexpr size_t cValueOffset = sizeof(DictionaryIdType) + sizeof(uint64_t);
+    auto const value_begin_pos = m_serialized_entry_offsets[id] + cValueOffset;
+    auto const value_end_pos = m_serialized_entry_offsets[id + 1];
+    return {m_serialized_entries.data() + value_begin_pos, value_end_pos - value_begin_pos};
+}
+
+template <typename DictionaryIdType, typename EntryType>
+void DictionaryReader<DictionaryIdType, EntryType>::update_value_index() const {
+    auto const num_entries = m_entries.size();
+    m_value_index.reserve(num_entries);
+    for (; m_num_indexed_entries < num_entries; ++m_num_indexed_entries) {
+        // Like a linear search, duplicate values resolve to the entry with the lowest ID
+        m_value_index.emplace(
+                get_serialized_value(m_num_indexed_entries),
+                static_cast<DictionaryIdType>(m_num_indexed_entries)
+        );
     }
 }
 }  // namespace clp
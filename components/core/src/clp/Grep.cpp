@@ -3,6 +3,7 @@
 #include <string>
 #include <vector>
 
+#include <regex_utils/RegexMatcher.hpp>
 #include <string_utils/string_utils.hpp>
 
 #include "streaming_archive/reader/Archive.hpp"
@@ -35,6 +36,25 @@ bool find_matching_message(
         Message& compressed_msg
 );
 
+/**
+ * @param query
+ * @param matching_sub_query The sub-query that matched the message, if any.
+ * @return Whether the decompressed message must be verified against the query's search string or
+ * regex.
+ */
+bool decompressed_message_verification_required(
+        Query const& query,
+        SubQuery const* matching_sub_query
+);
+
+/**
+ * @param query
+ * @param decompressed_msg
+ * @return Whether the decompressed message matches the query's regex, if any, or the query's search
+ * string otherwise.
+ */
+bool decompressed_message_matches(Query const& query, string const& decompressed_msg);
+
 bool find_matching_message(
         Query const& query,
         Archive& archive,
@@ -69,6 +89,31 @@ bool find_matching_message(
 
     return true;
 }
+
+bool decompressed_message_verification_required(
+        Query const& query,
+        SubQuery const* matching_sub_query
+) {
+    // Check if:
+    // - the query has a regex, which the search string only over-approximates, or
+    // - Sub-query requires wildcard match, or
+    // - no subqueries exist and the search string is not a match-all
+    return query.regex_match_required()
+           || (query.contains_sub_queries() && matching_sub_query->wildcard_match_required())
+           || (query.contains_sub_queries() == false
+               && query.search_string_matches_all() == false);
+}
+
+bool decompressed_message_matches(Query const& query, string const& decompressed_msg) {
+    if (query.regex_match_required()) {
+        return query.get_regex_matcher()->matches(decompressed_msg);
+    }
+    return wildcard_match_unsafe(
+            decompressed_msg,
+            query.get_search_string(),
+            query.get_ignore_case() == false
+    );
+}
 }  // namespace
 
 void
@@ -113,19 +158,9 @@ size_t Grep::search_and_output(
             break;
         }
 
-        // Perform wildcard match if required
-        // Check if:
-        // - Sub-query requires wildcard match, or
-        // - no subqueries exist and the search string is not a match-all
-        if ((query.contains_sub_queries() && matching_sub_query->wildcard_match_required())
-            || (query.contains_sub_queries() == false
-                && query.search_string_matches_all() == false))
-        {
-            bool matched = wildcard_match_unsafe(
-                    decompressed_msg,
-                    query.get_search_string(),
-                    query.get_ignore_case() == false
-            );
+        // Perform wildcard or regex match if required
+        if (decompressed_message_verification_required(query, matching_sub_query)) {
+            bool matched = decompressed_message_matches(query, decompressed_msg);
             if (!matched) {
                 continue;
             }
@@ -170,19 +205,9 @@ bool Grep::search_and_decompress(
             return false;
         }
 
-        // Perform wildcard match if required
-        // Check if:
-        // - Sub-query requires wildcard match, or
-        // - no subqueries exist and the search string is not a match-all
-        if ((query.contains_sub_queries() && matching_sub_query->wildcard_match_required())
-            || (query.contains_sub_queries() == false
-                && query.search_string_matches_all() == false))
-        {
-            matched = wildcard_match_unsafe(
-                    decompressed_msg,
-                    query.get_search_string(),
-                    query.get_ignore_case() == false
-            );
+        // Perform wildcard or regex match if required
+        if (decompressed_message_verification_required(query, matching_sub_query)) {
+            matched = decompressed_message_matches(query, decompressed_msg);
         } else {
             matched = true;
         }
@@ -212,14 +237,8 @@ size_t Grep::search(Query const& query, size_t limit, Archive& archive, File& co
             break;
         }
 
-        // Perform wildcard match if required
-        // Check if:
-        // - Sub-query requires wildcard match, or
-        // - no subqueries exist and the search string is not a match-all
-        if ((query.contains_sub_queries() && matching_sub_query->wildcard_match_required())
-            || (query.contains_sub_queries() == false
-                && query.search_string_matches_all() == false))
-        {
+        // Perform wildcard or regex match if required
+        if (decompressed_message_verification_required(query, matching_sub_query)) {
             // Decompress match
             bool decompress_successful
                     = archive.decompress_message(compressed_file, compressed_msg, decompressed_msg);
@@ -227,11 +246,7 @@ size_t Grep::search(Query const& query, size_t limit, Archive& archive, File& co
                 break;
             }
 
-            bool matched = wildcard_match_unsafe(
-                    decompressed_msg,
-                    query.get_search_string(),
-                    query.get_ignore_case() == false
-            );
+            bool matched = decompressed_message_matches(query, decompressed_msg);
             if (!matched) {
                 continue;
             }
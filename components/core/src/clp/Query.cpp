@@ -1,5 +1,7 @@
 #include "Query.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <functional>
 #include <set>
 #include <string>
@@ -178,11 +180,25 @@ void Query::make_sub_queries_relevant_to_segment(segment_id_t segment_id) {
 
     // Make sub-queries relevant to segment
     m_relevant_sub_queries.clear();
+    m_relevant_logtypes_bitmap.clear();
     for (auto& sub_query : m_sub_queries) {
         if (sub_query.get_ids_of_matching_segments().count(segment_id)) {
             m_relevant_sub_queries.push_back(&sub_query);
         }
     }
+
+    // Build a dense bitmap of the logtypes the relevant sub-queries could match, so that readers
+    // can filter a segment's logtype column without hashing each logtype ID
+    for (auto const* sub_query : m_relevant_sub_queries) {
+        for (auto const logtype_id : sub_query->get_possible_logtypes()) {
+            auto const bit_ix{static_cast<uint64_t>(logtype_id)};
+            auto const word_ix{static_cast<size_t>(bit_ix / cNumLogtypesPerBitmapWord)};
+            if (word_ix >= m_relevant_logtypes_bitmap.size()) {
+                m_relevant_logtypes_bitmap.resize(word_ix + 1, 0);
+            }
+            m_relevant_logtypes_bitmap[word_ix] |= 1ULL << (bit_ix % cNumLogtypesPerBitmapWord);
+        }
+    }
     m_prev_segment_id = segment_id;
 }
 
@@ -1,14 +1,22 @@
 #ifndef CLP_QUERY_HPP
 #define CLP_QUERY_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <set>
 #include <string>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include <clp/Defs.h>
 
+namespace clp::regex_utils {
+class RegexMatcher;
+}  // namespace clp::regex_utils
+
 namespace clp {
 /**
  * Class representing a variable in a subquery. It can represent a precise encoded variable or an
@@ -167,6 +175,9 @@ private:
  */
 class Query {
 public:
+    // Constants
+    static constexpr size_t cNumLogtypesPerBitmapWord{64};
+
     // Constructors
     Query(epochtime_t search_begin_timestamp,
           epochtime_t search_end_timestamp,
@@ -206,6 +217,25 @@ public:
      */
     bool search_string_matches_all() const { return m_search_string_matches_all; }
 
+    /**
+     * Sets the regex that matching messages must also match. The search string should be a
+     * wildcard superset of the regex (see `regex_utils::RegexMatcher::get_wildcard_superset`), so
+     * that the sub-queries can prune messages before they're verified against the regex.
+     * @param regex_matcher
+     */
+    void set_regex_matcher(std::shared_ptr<regex_utils::RegexMatcher const> regex_matcher) {
+        m_regex_matcher = std::move(regex_matcher);
+    }
+
+    std::shared_ptr<regex_utils::RegexMatcher const> const& get_regex_matcher() const {
+        return m_regex_matcher;
+    }
+
+    /**
+     * @return Whether matching messages must be verified against a regex.
+     */
+    bool regex_match_required() const { return nullptr != m_regex_matcher; }
+
     std::vector<SubQuery> const& get_sub_queries() const { return m_sub_queries; }
 
     bool contains_sub_queries() const { return m_sub_queries.empty() == false; }
@@ -214,6 +244,15 @@ public:
         return m_relevant_sub_queries;
     }
 
+    /**
+     * @return A bitmap of the logtypes that could match any of the relevant sub-queries, where
+     * logtype `i` is bit `i % cNumLogtypesPerBitmapWord` of word `i / cNumLogtypesPerBitmapWord`.
+     * Logtypes beyond the end of the bitmap can't match.
+     */
+    std::vector<uint64_t> const& get_relevant_logtypes_bitmap() const {
+        return m_relevant_logtypes_bitmap;
+    }
+
     /**
      * Calculates the segment IDs that should contain a match for each subquery's logtypes and
      * QueryVars.
@@ -236,8 +275,10 @@ private:
     bool m_ignore_case{false};
     std::string m_search_string;
     bool m_search_string_matches_all{true};
+    std::shared_ptr<regex_utils::RegexMatcher const> m_regex_matcher;
     std::vector<SubQuery> m_sub_queries;
     std::vector<SubQuery const*> m_relevant_sub_queries;
+    std::vector<uint64_t> m_relevant_logtypes_bitmap;
     segment_id_t m_prev_segment_id{cInvalidSegmentId};
 };
 
@@ -42,6 +42,12 @@ ErrorCode ReaderInterface::try_read_to_delimiter(
     return ErrorCode_Success;
 }
 
+ErrorCode ReaderInterface::try_peek_buffered_data(char const*& buf, size_t& buf_size) {
+    buf = nullptr;
+    buf_size = 0;
+    return ErrorCode_Unsupported;
+}
+
 bool ReaderInterface::read(char* buf, size_t num_bytes_to_read, size_t& num_bytes_read) {
     ErrorCode error_code = try_read(buf, num_bytes_to_read, num_bytes_read);
     if (ErrorCode_EndOfFile == error_code) {
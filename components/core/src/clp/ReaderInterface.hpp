@@ -43,6 +43,21 @@ public:
     virtual ErrorCode
     try_read_to_delimiter(char delim, bool keep_delimiter, bool append, std::string& str);
 
+    /**
+     * Tries to peek the data that the reader has already buffered after the read head, refilling
+     * the buffer first if it's empty. The read head isn't advanced, so callers that consume the
+     * data should seek past it.
+     * NOTE: Implementations that buffer their content should override this so that callers can
+     * parse the buffered data directly instead of through a virtual call per read. Any subsequent
+     * read or seek operations may invalidate the returned buffer.
+     * @param buf Returns a pointer to the buffered data
+     * @param buf_size Returns the size of the buffered data
+     * @return ErrorCode_Success on success
+     * @return ErrorCode_EndOfFile if the reader doesn't contain any more data
+     * @return ErrorCode_Unsupported if the reader doesn't buffer its content
+     */
+    virtual ErrorCode try_peek_buffered_data(char const*& buf, size_t& buf_size);
+
     /**
      * Reads up to a given number of bytes
      * @param buf
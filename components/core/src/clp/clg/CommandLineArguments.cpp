@@ -99,6 +99,11 @@ CommandLineArguments::parse_arguments(int argc, char const* argv[]) {
             "ignore-case,i",
             po::bool_switch(&m_ignore_case),
             "Ignore case distinctions in both WILDCARD STRING and the input files"
+    )(
+            "regex,E",
+            po::bool_switch(&m_use_regex),
+            "Interpret WILDCARD STRING (and each line of the search strings file) as a regular"
+            " expression"
     );
 
     // Define visible options
@@ -23,6 +23,7 @@ public:
     explicit CommandLineArguments(std::string const& program_name)
             : CommandLineArgumentsBase(program_name),
               m_ignore_case(false),
+              m_use_regex(false),
               m_output_method(OutputMethod::StdoutText),
               m_search_begin_ts(cEpochTimeMin),
               m_search_end_ts(cEpochTimeMax) {}
@@ -34,6 +35,8 @@ public:
 
     bool ignore_case() const { return m_ignore_case; }
 
+    bool use_regex() const { return m_use_regex; }
+
     std::string const& get_archives_dir() const { return m_archives_dir; }
 
     std::string const& get_search_string() const { return m_search_string; }
@@ -57,6 +60,7 @@ private:
     // Variables
     std::string m_search_strings_file_path;
     bool m_ignore_case;
+    bool m_use_regex;
     std::string m_archives_dir;
     std::string m_search_string;
     std::string m_file_path;
@@ -3,9 +3,11 @@
 #include <cstring>
 #include <filesystem>
 #include <iostream>
+#include <memory>
 #include <set>
 
 #include <log_surgeon/Lexer.hpp>
+#include <regex_utils/RegexMatcher.hpp>
 #include <spdlog/sinks/stdout_sinks.h>
 #include <string_utils/string_utils.hpp>
 #include <utils/profiling/Reporter.hpp>
@@ -33,6 +35,7 @@ using clp::GrepCore;
 using clp::load_lexer_from_file;
 using clp::logtype_dictionary_id_t;
 using clp::Query;
+using clp::regex_utils::RegexMatcher;
 using clp::segment_id_t;
 using clp::streaming_archive::MetadataDB;
 using clp::streaming_archive::reader::Archive;
@@ -197,6 +200,7 @@ static bool open_archive(string const& archive_path, Archive& archive_reader) {
 
 static bool search(
         vector<string> const& search_strings,
+        vector<std::shared_ptr<RegexMatcher const>> const& regex_matchers,
         CommandLineArguments& command_line_args,
         Archive& archive,
         log_surgeon::lexers::ByteLexer& lexer,
@@ -211,7 +215,8 @@ static bool search(
         bool no_queries_match = true;
         std::set<segment_id_t> ids_of_segments_to_search;
         bool is_superseding_query = false;
-        for (auto const& search_string : search_strings) {
+        for (size_t i = 0; i < search_strings.size(); ++i) {
+            auto const& search_string = search_strings[i];
             auto const& logtype_dict{archive.get_logtype_dictionary()};
             auto const& var_dict{archive.get_var_dictionary()};
             auto query_processing_result = GrepCore::process_raw_query(
@@ -228,7 +233,16 @@ static bool search(
                 auto& query = query_processing_result.value();
                 no_queries_match = false;
 
-                if (false == query.contains_sub_queries()) {
+                if (false == regex_matchers.empty()) {
+                    query.set_regex_matcher(regex_matchers[i]);
+                    if (false == query.contains_sub_queries()) {
+                        // The regex's wildcard superset matches all messages, so every file must
+                        // be searched, but the regex itself doesn't supersede other queries
+                        is_superseding_query = true;
+                        queries.push_back(query);
+                        continue;
+                    }
+                } else if (false == query.contains_sub_queries()) {
                     // Search string supersedes all other possible search strings
                     is_superseding_query = true;
                     // Remove existing queries since they are superseded by this one
@@ -506,16 +520,44 @@ int main(int argc, char const* argv[]) {
         return clean_up_wildcard_search_string('*' + search_string + '*');
     };
 
-    // Create vector of search strings
+    // Create vector of search strings, and when searching for regexes, the corresponding regex
+    // matchers. Each regex is searched for using its wildcard superset, and the messages matching
+    // the superset are then verified against the regex.
     vector<string> search_strings;
+    vector<std::shared_ptr<RegexMatcher const>> regex_matchers;
+    auto add_search_string = [&](string const& search_string) -> bool {
+        if (false == command_line_args.use_regex()) {
+            search_strings.emplace_back(add_implicit_wildcards(search_string));
+            return true;
+        }
+        auto regex_matcher_result
+                = RegexMatcher::create(search_string, command_line_args.ignore_case());
+        if (regex_matcher_result.has_error()) {
+            SPDLOG_ERROR(
+                    "Invalid regex '{}' - {}",
+                    search_string,
+                    regex_matcher_result.error().message()
+            );
+            return false;
+        }
+        auto regex_matcher
+                = std::make_shared<RegexMatcher const>(std::move(regex_matcher_result.value()));
+        search_strings.emplace_back(regex_matcher->get_wildcard_superset());
+        regex_matchers.emplace_back(std::move(regex_matcher));
+        return true;
+    };
     if (command_line_args.get_search_strings_file_path().empty()) {
-        search_strings.emplace_back(add_implicit_wildcards(command_line_args.get_search_string()));
+        if (false == add_search_string(command_line_args.get_search_string())) {
+            return -1;
+        }
     } else {
         FileReader file_reader{command_line_args.get_search_strings_file_path()};
         string line;
         while (file_reader.read_to_delimiter('\n', false, false, line)) {
             if (!line.empty()) {
-                search_strings.emplace_back(add_implicit_wildcards(line));
+                if (false == add_search_string(line)) {
+                    return -1;
+                }
             }
         }
     }
@@ -606,7 +648,13 @@ int main(int argc, char const* argv[]) {
         }
 
         // Perform search
-        if (!search(search_strings, command_line_args, archive_reader, *lexer_ptr, use_heuristic)) {
+        if (!search(search_strings,
+                    regex_matchers,
+                    command_line_args,
+                    archive_reader,
+                    *lexer_ptr,
+                    use_heuristic))
+        {
             return -1;
         }
         archive_reader.close();
@@ -323,6 +323,10 @@ auto CommandLineArguments::parse_search_arguments(
             "ignore-case,i",
             po::bool_switch(&m_ignore_case),
             "Ignore case distinctions in both WILDCARD STRING and the input files"
+    )(
+            "regex,E",
+            po::bool_switch(&m_use_regex),
+            "Interpret WILDCARD STRING as a regular expression"
     )(
             "file-path",
             po::value<string>(&m_file_path)->value_name("PATH"),
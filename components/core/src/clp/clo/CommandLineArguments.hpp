@@ -35,6 +35,7 @@ public:
     explicit CommandLineArguments(std::string const& program_name)
             : CommandLineArgumentsBase(program_name),
               m_ignore_case(false),
+              m_use_regex(false),
               m_search_begin_ts(cEpochTimeMin),
               m_search_end_ts(cEpochTimeMax),
               m_batch_size(1000),
@@ -65,6 +66,8 @@ public:
     // Search arguments
     bool ignore_case() const { return m_ignore_case; }
 
+    bool use_regex() const { return m_use_regex; }
+
     std::string const& get_search_string() const { return m_search_string; }
 
     std::string const& get_file_path() const { return m_file_path; }
@@ -191,6 +194,7 @@ private:
 
     // Variables for search
     bool m_ignore_case;
+    bool m_use_regex;
     std::string m_search_string;
     std::string m_file_path;
     epochtime_t m_search_begin_ts, m_search_end_ts;
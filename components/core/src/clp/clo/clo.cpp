@@ -7,6 +7,7 @@
 
 #include <mongocxx/instance.hpp>
 #include <nlohmann/json.hpp>
+#include <regex_utils/RegexMatcher.hpp>
 #include <spdlog/sinks/stdout_sinks.h>
 #include <string_utils/string_utils.hpp>
 #include <utils/profiling/Reporter.hpp>
@@ -45,6 +46,7 @@ using clp::ir::cIrFileExtension;
 using clp::load_lexer_from_file;
 using clp::logtype_dictionary_id_t;
 using clp::Query;
+using clp::regex_utils::RegexMatcher;
 using clp::segment_id_t;
 using clp::streaming_archive::MetadataDB;
 using clp::streaming_archive::reader::Archive;
@@ -502,8 +504,31 @@ static bool search_archive(
     auto const& logtype_dict{archive_reader.get_logtype_dictionary()};
     auto const& var_dict{archive_reader.get_var_dictionary()};
 
-    std::string wildcard_search_string
-            = clean_up_wildcard_search_string('*' + command_line_args.get_search_string() + '*');
+    // A regex is searched for using its wildcard superset, and the messages matching the superset
+    // are then verified against the regex.
+    std::string wildcard_search_string;
+    std::shared_ptr<RegexMatcher const> regex_matcher;
+    if (command_line_args.use_regex()) {
+        auto regex_matcher_result = RegexMatcher::create(
+                command_line_args.get_search_string(),
+                command_line_args.ignore_case()
+        );
+        if (regex_matcher_result.has_error()) {
+            SPDLOG_ERROR(
+                    "Invalid regex '{}' - {}",
+                    command_line_args.get_search_string(),
+                    regex_matcher_result.error().message()
+            );
+            return false;
+        }
+        regex_matcher
+                = std::make_shared<RegexMatcher const>(std::move(regex_matcher_result.value()));
+        wildcard_search_string = regex_matcher->get_wildcard_superset();
+    } else {
+        wildcard_search_string = clean_up_wildcard_search_string(
+                '*' + command_line_args.get_search_string() + '*'
+        );
+    }
     auto query_processing_result = GrepCore::process_raw_query(
             logtype_dict,
             var_dict,
@@ -519,6 +544,7 @@ static bool search_archive(
     }
 
     auto& query = query_processing_result.value();
+    query.set_regex_matcher(regex_matcher);
     // Calculate the IDs of the segments that may contain results for each sub-query.
     auto get_segments_containing_logtype_dict_id
             = [&logtype_dict](logtype_dictionary_id_t logtype_id) -> std::set<segment_id_t> const& {
@@ -8,6 +8,7 @@
 
 #include "../Defs.h"
 #include "../spdlog_with_specializations.hpp"
+#include "../streaming_compression/zstd/SeekTable.hpp"
 #include "../Utils.hpp"
 #include "../version.hpp"
 
@@ -335,6 +336,13 @@ CommandLineArguments::parse_arguments(int argc, char const* argv[]) {
                             ->value_name("SIZE")
                             ->default_value(m_target_segment_uncompressed_size),
                     "Target uncompressed size (B) of a segment before a new one is created"
+            )(
+                    "segment-frame-size",
+                    po::value<size_t>(&m_segment_frame_uncompressed_size)
+                            ->value_name("SIZE")
+                            ->default_value(m_segment_frame_uncompressed_size),
+                    "Uncompressed size (B) of each independently decompressible frame in a"
+                    " segment, or 0 to compress each segment as a single frame"
             )(
                     "target-dictionaries-size",
                     po::value<size_t>(&m_target_data_size_of_dictionaries)
@@ -412,6 +420,12 @@ CommandLineArguments::parse_arguments(int argc, char const* argv[]) {
                 throw invalid_argument("segment-size-threshold must be non-zero.");
             }
 
+            if (m_segment_frame_uncompressed_size
+                > streaming_compression::zstd::SeekTable::cMaxFrameSize)
+            {
+                throw invalid_argument("segment-frame-size is too large.");
+            }
+
             if (m_target_data_size_of_dictionaries < 1) {
                 throw invalid_argument("target-data-size-of-dictionaries must be non-zero.");
             }
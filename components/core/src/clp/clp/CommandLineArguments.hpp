@@ -27,6 +27,7 @@ public:
               m_sort_input_files(true),
               m_print_archive_stats_progress(false),
               m_target_segment_uncompressed_size(1L * 1024 * 1024 * 1024),
+              m_segment_frame_uncompressed_size(4L * 1024 * 1024),
               m_target_encoded_file_size(512L * 1024 * 1024),
               m_target_data_size_of_dictionaries(100L * 1024 * 1024),
               m_compression_level(3) {}
@@ -56,6 +57,10 @@ public:
         return m_target_segment_uncompressed_size;
     }
 
+    size_t get_segment_frame_uncompressed_size() const {
+        return m_segment_frame_uncompressed_size;
+    }
+
     size_t get_target_data_size_of_dictionaries() const {
         return m_target_data_size_of_dictionaries;
     }
@@ -98,6 +103,7 @@ private:
     bool m_print_archive_stats_progress;
     size_t m_target_encoded_file_size;
     size_t m_target_segment_uncompressed_size;
+    size_t m_segment_frame_uncompressed_size;
     size_t m_target_data_size_of_dictionaries;
     int m_compression_level;
     Command m_command;
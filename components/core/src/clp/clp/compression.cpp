@@ -91,6 +91,8 @@ bool compress(
     archive_user_config.creation_num = 0;
     archive_user_config.target_segment_uncompressed_size
             = command_line_args.get_target_segment_uncompressed_size();
+    archive_user_config.segment_frame_uncompressed_size
+            = command_line_args.get_segment_frame_uncompressed_size();
     archive_user_config.compression_level = command_line_args.get_compression_level();
     archive_user_config.output_dir = command_line_args.get_output_dir();
     archive_user_config.global_metadata_db = global_metadata_db.get();
@@ -0,0 +1,138 @@
+#ifndef CLP_FFI_NODEIDVALUEPAIRS_HPP
+#define CLP_FFI_NODEIDVALUEPAIRS_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <optional>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include "SchemaTree.hpp"
+#include "Value.hpp"
+
+namespace clp::ffi {
+/**
+ * A flat collection of schema-tree-node-ID & value pairs, sorted by node ID.
+ *
+ * This class provides the subset of `std::unordered_map`'s interface used by log events, but stores
+ * all pairs contiguously in a single buffer. Compared to a node-based map, this avoids an
+ * allocation per pair, and `clear` retains the buffer so that a collection can be reused across log
+ * events without reallocating.
+ *
+ * Pairs are kept sorted by node ID, so lookups are binary searches. Inserting pairs in increasing
+ * node-ID order (the common case when deserializing a log event) appends to the buffer.
+ */
+class NodeIdValuePairs {
+public:
+    // Types
+    using key_type = SchemaTree::Node::id_t;
+    using mapped_type = std::optional<Value>;
+    using value_type = std::pair<key_type, mapped_type>;
+    using size_type = size_t;
+    using iterator = std::vector<value_type>::iterator;
+    using const_iterator = std::vector<value_type>::const_iterator;
+
+    // Constructors
+    NodeIdValuePairs() = default;
+
+    /**
+     * Constructs the collection from the given pairs. If a node ID appears more than once, only its
+     * first pair is kept.
+     * @param pairs
+     */
+    NodeIdValuePairs(std::initializer_list<value_type> pairs) {
+        m_pairs.reserve(pairs.size());
+        for (auto const& pair : pairs) {
+            emplace(pair.first, pair.second);
+        }
+    }
+
+    // Methods
+    [[nodiscard]] auto begin() const -> const_iterator { return m_pairs.cbegin(); }
+
+    [[nodiscard]] auto end() const -> const_iterator { return m_pairs.cend(); }
+
+    [[nodiscard]] auto size() const -> size_type { return m_pairs.size(); }
+
+    [[nodiscard]] auto empty() const -> bool { return m_pairs.empty(); }
+
+    /**
+     * Reserves space for at least `num_pairs` pairs.
+     * @param num_pairs
+     */
+    auto reserve(size_type num_pairs) -> void { m_pairs.reserve(num_pairs); }
+
+    /**
+     * Removes all pairs while retaining the underlying buffer.
+     */
+    auto clear() -> void { m_pairs.clear(); }
+
+    /**
+     * Inserts a pair with the given node ID and a value constructed from `args`, if the collection
+     * doesn't already contain the node ID.
+     * @tparam ValueArgs
+     * @param node_id
+     * @param args Arguments to construct the value from.
+     * @return A pair:
+     * - An iterator to the pair with the given node ID.
+     * - Whether the pair was inserted.
+     */
+    template <typename... ValueArgs>
+    auto emplace(key_type node_id, ValueArgs&&... args) -> std::pair<iterator, bool> {
+        if (m_pairs.empty() || m_pairs.back().first < node_id) {
+            m_pairs.emplace_back(node_id, std::forward<ValueArgs>(args)...);
+            return {m_pairs.end() - 1, true};
+        }
+
+        auto const it{lower_bound(node_id)};
+        if (m_pairs.end() != it && it->first == node_id) {
+            return {it, false};
+        }
+        return {m_pairs.emplace(it, node_id, std::forward<ValueArgs>(args)...), true};
+    }
+
+    /**
+     * @param node_id
+     * @return An iterator to the pair with the given node ID, or `end()` if it doesn't exist.
+     */
+    [[nodiscard]] auto find(key_type node_id) const -> const_iterator {
+        auto const it{lower_bound(node_id)};
+        if (m_pairs.cend() != it && it->first == node_id) {
+            return it;
+        }
+        return m_pairs.cend();
+    }
+
+    [[nodiscard]] auto contains(key_type node_id) const -> bool { return end() != find(node_id); }
+
+    /**
+     * @param node_id
+     * @return The value paired with the given node ID.
+     * @throw std::out_of_range if the collection doesn't contain the node ID.
+     */
+    [[nodiscard]] auto at(key_type node_id) const -> mapped_type const& {
+        auto const it{find(node_id)};
+        if (end() == it) {
+            throw std::out_of_range{"Node ID doesn't exist in the node-ID-value pairs."};
+        }
+        return it->second;
+    }
+
+private:
+    // Methods
+    [[nodiscard]] auto lower_bound(key_type node_id) -> iterator {
+        return std::ranges::lower_bound(m_pairs, node_id, {}, &value_type::first);
+    }
+
+    [[nodiscard]] auto lower_bound(key_type node_id) const -> const_iterator {
+        return std::ranges::lower_bound(m_pairs, node_id, {}, &value_type::first);
+    }
+
+    // Variables
+    std::vector<value_type> m_pairs;
+};
+}  // namespace clp::ffi
+
+#endif  // CLP_FFI_NODEIDVALUEPAIRS_HPP
@@ -38,12 +38,15 @@ public:
 
     /**
      * Reads a string of the given `length` from the `reader` and appends it to the blob.
+     * @tparam ReaderType A `ReaderInterface` or any other reader with the same
+     * `try_read_exact_length` method.
      * @param reader
      * @param length The exact length of the string to read.
      * @return std::nullopt on success.
-     * @return Forwards `ReaderInterface::try_read_exact_length`'s error code on failure.
+     * @return Forwards `ReaderType::try_read_exact_length`'s error code on failure.
      */
-    [[nodiscard]] auto read_from(ReaderInterface& reader, size_t length)
+    template <typename ReaderType>
+    [[nodiscard]] auto read_from(ReaderType& reader, size_t length)
             -> std::optional<ErrorCode> {
         auto const start_offset{m_data.size()};
         auto const end_offset{start_offset + length};
@@ -3,6 +3,8 @@
 
 #include <cstddef>
 #include <memory>
+#include <optional>
+#include <span>
 #include <string>
 #include <system_error>
 #include <utility>
@@ -11,9 +13,11 @@
 #include <nlohmann/json_fwd.hpp>
 #include <ystdlib/error_handling/Result.hpp>
 
+#include "../../ErrorCode.hpp"
 #include "../../ir/types.hpp"
 #include "../../ReaderInterface.hpp"
 #include "../../time_types.hpp"
+#include "../KeyValuePairLogEvent.hpp"
 #include "../SchemaTree.hpp"
 #include "DeserializerImpl.hpp"
 #include "IrDeserializationError.hpp"
@@ -23,6 +27,7 @@
 #include "protocol_constants.hpp"
 #include "search/AstEvaluationResult.hpp"
 #include "search/QueryHandlerReq.hpp"
+#include "SpanReader.hpp"
 #include "UnstructuredIrDeserializerImpl.hpp"
 #include "utils.hpp"
 
@@ -101,9 +106,16 @@ public:
      * Deserializes the stream from the given reader up to and including the next log event IR unit,
      * and invokes the user-defined IR unit handler according to the deserialized IR unit type.
      *
+     * NOTE: For key-value pair IR streams, if the reader buffers its content (see
+     * `ReaderInterface::try_peek_buffered_data`) and the next IR unit is entirely buffered, the IR
+     * unit is deserialized directly from the reader's buffer. Wrapping readers that don't buffer
+     * their content (e.g., decompressors) in a `BufferedReader` therefore speeds up
+     * deserialization.
+     *
      * NOTE: If the deserialized IR unit is `IrUnitType::LogEvent` and the query handler is not
      * `search::EmptyQueryHandler`, `handle_log_event` will only be invoked if the query handler
-     * returns `search::AstEvaluationResult::True`.
+     * returns `search::AstEvaluationResult::True`. In this case, only the values required to
+     * evaluate the query are decoded up front; the log event is fully decoded only if it matches.
      *
      * @param reader
      * @return Forwards `DeserializerImpl::get_next_ir_unit_type`'s return values if it fails to
@@ -112,12 +124,10 @@ public:
      * stream by deserializing an end-of-stream IR unit in the previous calls.
      * @return IrUnitType::LogEvent if a log event IR unit is deserialized, or an error code
      * indicating the failure:
-     * - Forwards `DeserializerImpl::deserialize_ir_unit_kv_pair_log_event`'s return values if it
-     *   failed to deserialize and construct the log event.
+     * - Forwards `deserialize_log_event`'s return values if it failed to deserialize and construct
+     *   the log event.
      * - Forwards `handle_log_event`'s return values from the user-defined IR unit handler on
      *   unit handling failure.
-     * - Forwards `search::QueryHandler::evaluate_kv_pair_log_event`'s return values on failure, if
-     *   `QueryHandlerType` is not `search::EmptyQueryHandler`.
      * @return IrUnitType::SchemaTreeNodeInsertion if a schema tree node insertion IR unit is
      * deserialized, or an error code indicating the failure:
      * - Forwards `DeserializerImpl::deserialize_ir_unit_schema_tree_node_insertion`'s return values
@@ -139,6 +149,8 @@ public:
      * - Forwards `deserialize_tag`'s return values on failure.
      * - Forwards `handle_end_of_stream`'s return values from the user-defined IR unit handler on
      *   unit handling failure.
+     * @return std::errc::io_error if the reader's read head can't be advanced past an IR unit
+     * deserialized from its buffer.
      */
     [[nodiscard]] auto deserialize_next_ir_unit(ReaderInterface& reader)
             -> ystdlib::error_handling::Result<IrUnitType>;
@@ -199,17 +211,64 @@ private:
     // Constructor
     Deserializer(
             std::unique_ptr<DeserializerImpl> deserializer_impl,
+            KvIrDeserializerImpl* kv_ir_deserializer_impl,
             IrUnitHandlerType ir_unit_handler,
             nlohmann::json metadata,
             QueryHandlerType query_handler
     )
             : m_deserializer_impl{std::move(deserializer_impl)},
+              m_kv_ir_deserializer_impl{kv_ir_deserializer_impl},
               m_metadata(std::move(metadata)),
               m_ir_unit_handler{std::move(ir_unit_handler)},
               m_query_handler{std::move(query_handler)} {}
 
+    // Methods
+    /**
+     * Implements `deserialize_next_ir_unit` for the given reader and deserializer implementation.
+     *
+     * NOTE: No state is modified and no handler is invoked until the IR unit has been entirely
+     * read, so if a read fails, the IR unit can be deserialized again from another reader.
+     * @tparam ReaderType
+     * @tparam DeserializerImplType
+     * @param reader
+     * @param deserializer_impl
+     * @return Same as `deserialize_next_ir_unit`.
+     */
+    template <typename ReaderType, typename DeserializerImplType>
+    [[nodiscard]] auto
+    deserialize_next_ir_unit_generic(ReaderType& reader, DeserializerImplType& deserializer_impl)
+            -> ystdlib::error_handling::Result<IrUnitType>;
+
+    /**
+     * Deserializes a log event IR unit and, if a query handler is provided, evaluates it against
+     * the query.
+     * @tparam ReaderType
+     * @tparam DeserializerImplType
+     * @param reader
+     * @param deserializer_impl
+     * @param tag
+     * @return A result containing the deserialized log event, or std::nullopt if it doesn't match
+     * the query, on success, or an error code indicating the failure:
+     * - Forwards `DeserializerImpl::deserialize_ir_unit_kv_pair_log_event`'s return values on
+     *   failure, if `QueryHandlerType` is `search::EmptyQueryHandler`.
+     * - Forwards `DeserializerImpl::deserialize_ir_unit_partial_kv_pair_log_event`'s return values
+     *   on failure, if `QueryHandlerType` is not `search::EmptyQueryHandler`.
+     * - Forwards `search::QueryHandler::evaluate_kv_pair_log_event`'s return values on failure, if
+     *   `QueryHandlerType` is not `search::EmptyQueryHandler`.
+     * - Forwards `DeserializerImpl::materialize_partial_kv_pair_log_event`'s return values on
+     *   failure, if `QueryHandlerType` is not `search::EmptyQueryHandler`.
+     */
+    template <typename ReaderType, typename DeserializerImplType>
+    [[nodiscard]] auto deserialize_log_event(
+            ReaderType& reader,
+            DeserializerImplType& deserializer_impl,
+            encoded_tag_t tag
+    ) -> ystdlib::error_handling::Result<std::optional<KeyValuePairLogEvent>>;
+
     // Variables
     std::unique_ptr<DeserializerImpl> m_deserializer_impl;
+    // `m_deserializer_impl` if it's a `KvIrDeserializerImpl`, or nullptr otherwise
+    KvIrDeserializerImpl* m_kv_ir_deserializer_impl{nullptr};
     std::shared_ptr<SchemaTree> m_auto_gen_keys_schema_tree{std::make_shared<SchemaTree>()};
     std::shared_ptr<SchemaTree> m_user_gen_keys_schema_tree{std::make_shared<SchemaTree>()};
     nlohmann::json m_metadata;
@@ -280,8 +339,11 @@ auto Deserializer<IrUnitHandlerType, QueryHandlerType>::create_generic(
     }
 
     std::unique_ptr<DeserializerImpl> deserializer_impl;
+    KvIrDeserializerImpl* kv_ir_deserializer_impl{nullptr};
     if (IRProtocolErrorCode::Supported == protocol_version_status) {
-        deserializer_impl = std::make_unique<KvIrDeserializerImpl>();
+        auto kv_ir_deserializer_impl_ptr{std::make_unique<KvIrDeserializerImpl>()};
+        kv_ir_deserializer_impl = kv_ir_deserializer_impl_ptr.get();
+        deserializer_impl = std::move(kv_ir_deserializer_impl_ptr);
     } else {
         if (EncodingType::FourByte == encoding_type) {
             deserializer_impl = YSTDLIB_ERROR_HANDLING_TRYX(
@@ -300,6 +362,7 @@ auto Deserializer<IrUnitHandlerType, QueryHandlerType>::create_generic(
 
     return Deserializer{
             std::move(deserializer_impl),
+            kv_ir_deserializer_impl,
             std::move(ir_unit_handler),
             std::move(metadata_json),
             std::move(query_handler)
@@ -314,37 +377,55 @@ auto Deserializer<IrUnitHandler, QueryHandlerType>::deserialize_next_ir_unit(
         return std::errc::operation_not_permitted;
     }
 
+    // Deserialize the IR unit directly from the reader's buffer if the reader has buffered all of
+    // it, so that none of the IR unit's reads go through a virtual call. Otherwise, deserialize it
+    // through the reader, which refills its buffer as necessary.
+    char const* buf{nullptr};
+    size_t buf_size{0};
+    if (nullptr != m_kv_ir_deserializer_impl
+        && ErrorCode_Success == reader.try_peek_buffered_data(buf, buf_size))
+    {
+        SpanReader span_reader{std::span{buf, buf_size}};
+        auto result{deserialize_next_ir_unit_generic(span_reader, *m_kv_ir_deserializer_impl)};
+        if (false == span_reader.is_exhausted()) {
+            size_t pos{0};
+            if (ErrorCode_Success != reader.try_get_pos(pos)
+                || ErrorCode_Success != reader.try_seek_from_begin(pos + span_reader.get_pos()))
+            {
+                return std::errc::io_error;
+            }
+            return result;
+        }
+    }
+    return deserialize_next_ir_unit_generic(reader, *m_deserializer_impl);
+}
+
+template <IrUnitHandlerReq IrUnitHandler, search::QueryHandlerReq QueryHandlerType>
+template <typename ReaderType, typename DeserializerImplType>
+auto Deserializer<IrUnitHandler, QueryHandlerType>::deserialize_next_ir_unit_generic(
+        ReaderType& reader,
+        DeserializerImplType& deserializer_impl
+) -> ystdlib::error_handling::Result<IrUnitType> {
     auto const [ir_unit_type, tag]{
-            YSTDLIB_ERROR_HANDLING_TRYX(m_deserializer_impl->get_next_ir_unit_type(reader))
+            YSTDLIB_ERROR_HANDLING_TRYX(deserializer_impl.get_next_ir_unit_type(reader))
     };
     switch (ir_unit_type) {
         case IrUnitType::LogEvent: {
-            auto log_event{YSTDLIB_ERROR_HANDLING_TRYX(
-                    m_deserializer_impl->deserialize_ir_unit_kv_pair_log_event(
-                            reader,
-                            tag,
-                            m_auto_gen_keys_schema_tree,
-                            m_user_gen_keys_schema_tree,
-                            m_utc_offset
-                    )
+            auto optional_log_event{YSTDLIB_ERROR_HANDLING_TRYX(
+                    deserialize_log_event(reader, deserializer_impl, tag)
             )};
 
             auto const log_event_idx{m_next_log_event_idx};
             m_next_log_event_idx += 1;
 
-            if constexpr (search::IsNonEmptyQueryHandler<QueryHandlerType>::value) {
-                if (search::AstEvaluationResult::True
-                    != YSTDLIB_ERROR_HANDLING_TRYX(
-                            m_query_handler.evaluate_kv_pair_log_event(log_event)
-                    ))
-                {
-                    break;
-                }
+            if (false == optional_log_event.has_value()) {
+                break;
             }
 
-            if (auto const err{
-                        m_ir_unit_handler.handle_log_event(std::move(log_event), log_event_idx)
-                };
+            if (auto const err{m_ir_unit_handler.handle_log_event(
+                        std::move(optional_log_event.value()),
+                        log_event_idx
+                )};
                 IRErrorCode::IRErrorCode_Success != err)
             {
                 return ir_error_code_to_errc(err);
@@ -355,7 +436,7 @@ auto Deserializer<IrUnitHandler, QueryHandlerType>::deserialize_next_ir_unit(
         case IrUnitType::SchemaTreeNodeInsertion: {
             std::string key_name_buffer;
             auto const [is_auto_generated, node_locator]{YSTDLIB_ERROR_HANDLING_TRYX(
-                    m_deserializer_impl->deserialize_ir_unit_schema_tree_node_insertion(
+                    deserializer_impl.deserialize_ir_unit_schema_tree_node_insertion(
                             reader,
                             tag,
                             key_name_buffer
@@ -424,6 +505,59 @@ auto Deserializer<IrUnitHandler, QueryHandlerType>::deserialize_next_ir_unit(
     return ir_unit_type;
 }
 
+template <IrUnitHandlerReq IrUnitHandler, search::QueryHandlerReq QueryHandlerType>
+template <typename ReaderType, typename DeserializerImplType>
+auto Deserializer<IrUnitHandler, QueryHandlerType>::deserialize_log_event(
+        ReaderType& reader,
+        DeserializerImplType& deserializer_impl,
+        encoded_tag_t tag
+) -> ystdlib::error_handling::Result<std::optional<KeyValuePairLogEvent>> {
+    if constexpr (search::IsNonEmptyQueryHandler<QueryHandlerType>::value) {
+        // Only decode the values the query can look at, and decode the rest once the log event is
+        // known to match.
+        auto partial_log_event{YSTDLIB_ERROR_HANDLING_TRYX(
+                deserializer_impl.deserialize_ir_unit_partial_kv_pair_log_event(
+                        reader,
+                        tag,
+                        m_auto_gen_keys_schema_tree,
+                        m_user_gen_keys_schema_tree,
+                        m_utc_offset,
+                        [this](bool is_auto_generated, SchemaTree::Node::id_t node_id) -> bool {
+                            return m_query_handler.is_value_required_for_evaluation(
+                                    is_auto_generated,
+                                    node_id
+                            );
+                        }
+                )
+        )};
+        if (search::AstEvaluationResult::True
+            != YSTDLIB_ERROR_HANDLING_TRYX(
+                    m_query_handler.evaluate_kv_pair_log_event(partial_log_event)
+            ))
+        {
+            return std::nullopt;
+        }
+        return std::optional<KeyValuePairLogEvent>{YSTDLIB_ERROR_HANDLING_TRYX(
+                deserializer_impl.materialize_partial_kv_pair_log_event(
+                        std::move(partial_log_event),
+                        m_auto_gen_keys_schema_tree,
+                        m_user_gen_keys_schema_tree,
+                        m_utc_offset
+                )
+        )};
+    } else {
+        return std::optional<KeyValuePairLogEvent>{YSTDLIB_ERROR_HANDLING_TRYX(
+                deserializer_impl.deserialize_ir_unit_kv_pair_log_event(
+                        reader,
+                        tag,
+                        m_auto_gen_keys_schema_tree,
+                        m_user_gen_keys_schema_tree,
+                        m_utc_offset
+                )
+        )};
+    }
+}
+
 template <IrUnitHandlerReq IrUnitHandlerType>
 [[nodiscard]] auto make_deserializer(ReaderInterface& reader, IrUnitHandlerType ir_unit_handler)
         -> ystdlib::error_handling::Result<Deserializer<IrUnitHandlerType>> {
@@ -7,4 +7,9 @@ auto DeserializerImpl::deserialize_ir_unit_utc_offset_change(ReaderInterface& re
         -> ystdlib::error_handling::Result<UtcOffset> {
     return UtcOffset{YSTDLIB_ERROR_HANDLING_TRYX(deserialize_int<int64_t>(reader))};
 }
+
+auto DeserializerImpl::deserialize_ir_unit_utc_offset_change(SpanReader& reader)
+        -> ystdlib::error_handling::Result<UtcOffset> {
+    return UtcOffset{YSTDLIB_ERROR_HANDLING_TRYX(deserialize_int<int64_t>(reader))};
+}
 }  // namespace clp::ffi::ir_stream
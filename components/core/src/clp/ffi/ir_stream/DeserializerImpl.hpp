@@ -12,7 +12,9 @@
 #include "../KeyValuePairLogEvent.hpp"
 #include "../SchemaTree.hpp"
 #include "decoding_methods.hpp"
+#include "ir_unit_deserialization_methods.hpp"
 #include "IrUnitType.hpp"
+#include "SpanReader.hpp"
 
 namespace clp::ffi::ir_stream {
 /**
@@ -45,6 +47,14 @@ public:
     [[nodiscard]] static auto deserialize_ir_unit_utc_offset_change(ReaderInterface& reader)
             -> ystdlib::error_handling::Result<UtcOffset>;
 
+    /**
+     * Deserializes a UTC offset change IR unit from a contiguous buffer.
+     * @param reader
+     * @return Same as `deserialize_ir_unit_utc_offset_change(ReaderInterface&)`.
+     */
+    [[nodiscard]] static auto deserialize_ir_unit_utc_offset_change(SpanReader& reader)
+            -> ystdlib::error_handling::Result<UtcOffset>;
+
     /**
      * Deserializes the type of the next IR unit from the given reader.
      * @param reader
@@ -77,6 +87,60 @@ public:
     ) -> ystdlib::error_handling::Result<KeyValuePairLogEvent>
             = 0;
 
+    /**
+     * Deserializes a KV pair log event IR unit from the given reader, but only decodes the values
+     * accepted by the given filter. The log event can then be fully materialized by calling
+     * `materialize_partial_kv_pair_log_event` before the next IR unit is deserialized.
+     *
+     * The default implementation decodes every value.
+     * @param reader
+     * @param tag
+     * @param auto_gen_keys_schema_tree
+     * @param user_gen_keys_schema_tree
+     * @param utc_offset
+     * @param value_filter
+     * @return A result containing the partially decoded KV pair log event on success, or an error
+     * code indicating the failure:
+     * - Forwards `deserialize_ir_unit_kv_pair_log_event`'s return values on failure.
+     */
+    [[nodiscard]] virtual auto deserialize_ir_unit_partial_kv_pair_log_event(
+            ReaderInterface& reader,
+            encoded_tag_t tag,
+            std::shared_ptr<SchemaTree> const& auto_gen_keys_schema_tree,
+            std::shared_ptr<SchemaTree> const& user_gen_keys_schema_tree,
+            UtcOffset utc_offset,
+            [[maybe_unused]] SchemaTreeNodeValueFilter const& value_filter
+    ) -> ystdlib::error_handling::Result<KeyValuePairLogEvent> {
+        return deserialize_ir_unit_kv_pair_log_event(
+                reader,
+                tag,
+                auto_gen_keys_schema_tree,
+                user_gen_keys_schema_tree,
+                utc_offset
+        );
+    }
+
+    /**
+     * Decodes the remaining values of the log event most recently returned by
+     * `deserialize_ir_unit_partial_kv_pair_log_event`.
+     *
+     * The default implementation returns the given log event as is.
+     * @param partial_log_event
+     * @param auto_gen_keys_schema_tree
+     * @param user_gen_keys_schema_tree
+     * @param utc_offset
+     * @return A result containing the fully decoded KV pair log event on success, or an error code
+     * indicating the failure defined by the derived class.
+     */
+    [[nodiscard]] virtual auto materialize_partial_kv_pair_log_event(
+            KeyValuePairLogEvent partial_log_event,
+            [[maybe_unused]] std::shared_ptr<SchemaTree> const& auto_gen_keys_schema_tree,
+            [[maybe_unused]] std::shared_ptr<SchemaTree> const& user_gen_keys_schema_tree,
+            [[maybe_unused]] UtcOffset utc_offset
+    ) -> ystdlib::error_handling::Result<KeyValuePairLogEvent> {
+        return partial_log_event;
+    }
+
     /**
      * Deserializes a schema tree node insertion IR unit from the given reader.
      * @param reader
@@ -2,9 +2,22 @@
 
 #include "ir_unit_deserialization_methods.hpp"
 #include "IrDeserializationError.hpp"
+#include "SpanReader.hpp"
 
 namespace clp::ffi::ir_stream {
-auto KvIrDeserializerImpl::get_next_ir_unit_type(ReaderInterface& reader)
+namespace {
+/**
+ * Generic implementation of `KvIrDeserializerImpl::get_next_ir_unit_type` for any reader type.
+ * @tparam ReaderType
+ * @param reader
+ * @return Same as `KvIrDeserializerImpl::get_next_ir_unit_type(ReaderInterface&)`.
+ */
+template <typename ReaderType>
+[[nodiscard]] auto generic_get_next_ir_unit_type(ReaderType& reader)
+        -> ystdlib::error_handling::Result<std::pair<IrUnitType, encoded_tag_t>>;
+
+template <typename ReaderType>
+auto generic_get_next_ir_unit_type(ReaderType& reader)
         -> ystdlib::error_handling::Result<std::pair<IrUnitType, encoded_tag_t>> {
     auto const tag{YSTDLIB_ERROR_HANDLING_TRYX(deserialize_tag(reader))};
     auto const optional_ir_unit_type{get_ir_unit_type_from_tag(tag)};
@@ -13,6 +26,38 @@ auto KvIrDeserializerImpl::get_next_ir_unit_type(ReaderInterface& reader)
     }
     return std::pair{optional_ir_unit_type.value(), tag};
 }
+}  // namespace
+
+template <typename ReaderType>
+auto KvIrDeserializerImpl::generic_deserialize_ir_unit_partial_kv_pair_log_event(
+        ReaderType& reader,
+        encoded_tag_t tag,
+        std::shared_ptr<SchemaTree> const& auto_gen_keys_schema_tree,
+        std::shared_ptr<SchemaTree> const& user_gen_keys_schema_tree,
+        UtcOffset utc_offset,
+        SchemaTreeNodeValueFilter const& value_filter
+) -> ystdlib::error_handling::Result<KeyValuePairLogEvent> {
+    YSTDLIB_ERROR_HANDLING_TRYV(
+            ir_stream::deserialize_ir_unit_raw_kv_pair_log_event(reader, tag, m_raw_log_event)
+    );
+    return decode_raw_kv_pair_log_event(
+            m_raw_log_event,
+            auto_gen_keys_schema_tree,
+            user_gen_keys_schema_tree,
+            utc_offset,
+            value_filter
+    );
+}
+
+auto KvIrDeserializerImpl::get_next_ir_unit_type(ReaderInterface& reader)
+        -> ystdlib::error_handling::Result<std::pair<IrUnitType, encoded_tag_t>> {
+    return generic_get_next_ir_unit_type(reader);
+}
+
+auto KvIrDeserializerImpl::get_next_ir_unit_type(SpanReader& reader)
+        -> ystdlib::error_handling::Result<std::pair<IrUnitType, encoded_tag_t>> {
+    return generic_get_next_ir_unit_type(reader);
+}
 
 auto KvIrDeserializerImpl::deserialize_ir_unit_kv_pair_log_event(
         ReaderInterface& reader,
@@ -30,6 +75,74 @@ auto KvIrDeserializerImpl::deserialize_ir_unit_kv_pair_log_event(
     );
 }
 
+auto KvIrDeserializerImpl::deserialize_ir_unit_kv_pair_log_event(
+        SpanReader& reader,
+        encoded_tag_t tag,
+        std::shared_ptr<SchemaTree> const& auto_gen_keys_schema_tree,
+        std::shared_ptr<SchemaTree> const& user_gen_keys_schema_tree,
+        UtcOffset utc_offset
+) -> ystdlib::error_handling::Result<KeyValuePairLogEvent> {
+    return ir_stream::deserialize_ir_unit_kv_pair_log_event(
+            reader,
+            tag,
+            auto_gen_keys_schema_tree,
+            user_gen_keys_schema_tree,
+            utc_offset
+    );
+}
+
+auto KvIrDeserializerImpl::deserialize_ir_unit_partial_kv_pair_log_event(
+        ReaderInterface& reader,
+        encoded_tag_t tag,
+        std::shared_ptr<SchemaTree> const& auto_gen_keys_schema_tree,
+        std::shared_ptr<SchemaTree> const& user_gen_keys_schema_tree,
+        UtcOffset utc_offset,
+        SchemaTreeNodeValueFilter const& value_filter
+) -> ystdlib::error_handling::Result<KeyValuePairLogEvent> {
+    return generic_deserialize_ir_unit_partial_kv_pair_log_event(
+            reader,
+            tag,
+            auto_gen_keys_schema_tree,
+            user_gen_keys_schema_tree,
+            utc_offset,
+            value_filter
+    );
+}
+
+auto KvIrDeserializerImpl::deserialize_ir_unit_partial_kv_pair_log_event(
+        SpanReader& reader,
+        encoded_tag_t tag,
+        std::shared_ptr<SchemaTree> const& auto_gen_keys_schema_tree,
+        std::shared_ptr<SchemaTree> const& user_gen_keys_schema_tree,
+        UtcOffset utc_offset,
+        SchemaTreeNodeValueFilter const& value_filter
+) -> ystdlib::error_handling::Result<KeyValuePairLogEvent> {
+    return generic_deserialize_ir_unit_partial_kv_pair_log_event(
+            reader,
+            tag,
+            auto_gen_keys_schema_tree,
+            user_gen_keys_schema_tree,
+            utc_offset,
+            value_filter
+    );
+}
+
+auto KvIrDeserializerImpl::materialize_partial_kv_pair_log_event(
+        [[maybe_unused]] KeyValuePairLogEvent partial_log_event,
+        std::shared_ptr<SchemaTree> const& auto_gen_keys_schema_tree,
+        std::shared_ptr<SchemaTree> const& user_gen_keys_schema_tree,
+        UtcOffset utc_offset
+) -> ystdlib::error_handling::Result<KeyValuePairLogEvent> {
+    // The partial log event only contains the few values needed for query evaluation, so decoding
+    // them again is cheaper than merging the remaining values into it.
+    return decode_raw_kv_pair_log_event(
+            m_raw_log_event,
+            auto_gen_keys_schema_tree,
+            user_gen_keys_schema_tree,
+            utc_offset
+    );
+}
+
 auto KvIrDeserializerImpl::deserialize_ir_unit_schema_tree_node_insertion(
         ReaderInterface& reader,
         encoded_tag_t tag,
@@ -37,4 +150,12 @@ auto KvIrDeserializerImpl::deserialize_ir_unit_schema_tree_node_insertion(
 ) -> ystdlib::error_handling::Result<std::pair<bool, SchemaTree::NodeLocator>> {
     return ir_stream::deserialize_ir_unit_schema_tree_node_insertion(reader, tag, key_name_buffer);
 }
+
+auto KvIrDeserializerImpl::deserialize_ir_unit_schema_tree_node_insertion(
+        SpanReader& reader,
+        encoded_tag_t tag,
+        std::string& key_name_buffer
+) -> ystdlib::error_handling::Result<std::pair<bool, SchemaTree::NodeLocator>> {
+    return ir_stream::deserialize_ir_unit_schema_tree_node_insertion(reader, tag, key_name_buffer);
+}
 }  // namespace clp::ffi::ir_stream
@@ -13,13 +13,19 @@
 #include "../SchemaTree.hpp"
 #include "decoding_methods.hpp"
 #include "DeserializerImpl.hpp"
+#include "ir_unit_deserialization_methods.hpp"
 #include "IrUnitType.hpp"
+#include "SpanReader.hpp"
 
 namespace clp::ffi::ir_stream {
 /**
  * IR deserializer implementation for key-value pair IR streams.
+ *
+ * In addition to the methods implementing `DeserializerImpl`, this class provides non-virtual
+ * overloads that deserialize IR units from a `SpanReader`, which `Deserializer` uses to deserialize
+ * IR units that are entirely buffered by the underlying reader.
  */
-class KvIrDeserializerImpl : public DeserializerImpl {
+class KvIrDeserializerImpl final : public DeserializerImpl {
 public:
     // Constructor
     KvIrDeserializerImpl() = default;
@@ -57,6 +63,35 @@ public:
             UtcOffset utc_offset
     ) -> ystdlib::error_handling::Result<KeyValuePairLogEvent> override;
 
+    /**
+     * Only the values accepted by `value_filter` are decoded; the rest are buffered undecoded
+     * until the log event is materialized.
+     *
+     * The possible error codes:
+     * - Forwards `clp::ffi::ir_stream::deserialize_ir_unit_raw_kv_pair_log_event`'s return values
+     *   on failure.
+     * - Forwards `clp::ffi::ir_stream::decode_raw_kv_pair_log_event`'s return values on failure.
+     */
+    [[nodiscard]] auto deserialize_ir_unit_partial_kv_pair_log_event(
+            ReaderInterface& reader,
+            encoded_tag_t tag,
+            std::shared_ptr<SchemaTree> const& auto_gen_keys_schema_tree,
+            std::shared_ptr<SchemaTree> const& user_gen_keys_schema_tree,
+            UtcOffset utc_offset,
+            SchemaTreeNodeValueFilter const& value_filter
+    ) -> ystdlib::error_handling::Result<KeyValuePairLogEvent> override;
+
+    /**
+     * The possible error codes:
+     * - Forwards `clp::ffi::ir_stream::decode_raw_kv_pair_log_event`'s return values on failure.
+     */
+    [[nodiscard]] auto materialize_partial_kv_pair_log_event(
+            KeyValuePairLogEvent partial_log_event,
+            std::shared_ptr<SchemaTree> const& auto_gen_keys_schema_tree,
+            std::shared_ptr<SchemaTree> const& user_gen_keys_schema_tree,
+            UtcOffset utc_offset
+    ) -> ystdlib::error_handling::Result<KeyValuePairLogEvent> override;
+
     /**
      * The possible error codes:
      * - Forwards `clp::ffi::ir_stream::deserialize_ir_unit_schema_tree_node_insertion`'s return
@@ -67,6 +102,94 @@ public:
             encoded_tag_t tag,
             std::string& key_name_buffer
     ) -> ystdlib::error_handling::Result<std::pair<bool, SchemaTree::NodeLocator>> override;
+
+    // Methods
+    /**
+     * Deserializes the type of the next IR unit from a contiguous buffer.
+     * @param reader
+     * @return Same as `get_next_ir_unit_type(ReaderInterface&)`.
+     */
+    [[nodiscard]] auto get_next_ir_unit_type(SpanReader& reader)
+            -> ystdlib::error_handling::Result<std::pair<IrUnitType, encoded_tag_t>>;
+
+    /**
+     * Deserializes a KV pair log event IR unit from a contiguous buffer.
+     * @param reader
+     * @param tag
+     * @param auto_gen_keys_schema_tree
+     * @param user_gen_keys_schema_tree
+     * @param utc_offset
+     * @return Same as `deserialize_ir_unit_kv_pair_log_event(ReaderInterface&, ...)`.
+     */
+    [[nodiscard]] auto deserialize_ir_unit_kv_pair_log_event(
+            SpanReader& reader,
+            encoded_tag_t tag,
+            std::shared_ptr<SchemaTree> const& auto_gen_keys_schema_tree,
+            std::shared_ptr<SchemaTree> const& user_gen_keys_schema_tree,
+            UtcOffset utc_offset
+    ) -> ystdlib::error_handling::Result<KeyValuePairLogEvent>;
+
+    /**
+     * Deserializes a KV pair log event IR unit from a contiguous buffer, but only decodes the
+     * values accepted by the given filter.
+     * @param reader
+     * @param tag
+     * @param auto_gen_keys_schema_tree
+     * @param user_gen_keys_schema_tree
+     * @param utc_offset
+     * @param value_filter
+     * @return Same as `deserialize_ir_unit_partial_kv_pair_log_event(ReaderInterface&, ...)`.
+     */
+    [[nodiscard]] auto deserialize_ir_unit_partial_kv_pair_log_event(
+            SpanReader& reader,
+            encoded_tag_t tag,
+            std::shared_ptr<SchemaTree> const& auto_gen_keys_schema_tree,
+            std::shared_ptr<SchemaTree> const& user_gen_keys_schema_tree,
+            UtcOffset utc_offset,
+            SchemaTreeNodeValueFilter const& value_filter
+    ) -> ystdlib::error_handling::Result<KeyValuePairLogEvent>;
+
+    /**
+     * Deserializes a schema tree node insertion IR unit from a contiguous buffer.
+     * @param reader
+     * @param tag
+     * @param key_name_buffer
+     * @return Same as `deserialize_ir_unit_schema_tree_node_insertion(ReaderInterface&, ...)`.
+     */
+    [[nodiscard]] auto deserialize_ir_unit_schema_tree_node_insertion(
+            SpanReader& reader,
+            encoded_tag_t tag,
+            std::string& key_name_buffer
+    ) -> ystdlib::error_handling::Result<std::pair<bool, SchemaTree::NodeLocator>>;
+
+private:
+    // Methods
+    /**
+     * Generic implementation of `deserialize_ir_unit_partial_kv_pair_log_event` for any reader
+     * type.
+     * @tparam ReaderType
+     * @param reader
+     * @param tag
+     * @param auto_gen_keys_schema_tree
+     * @param user_gen_keys_schema_tree
+     * @param utc_offset
+     * @param value_filter
+     * @return Same as `deserialize_ir_unit_partial_kv_pair_log_event(ReaderInterface&, ...)`.
+     */
+    template <typename ReaderType>
+    [[nodiscard]] auto generic_deserialize_ir_unit_partial_kv_pair_log_event(
+            ReaderType& reader,
+            encoded_tag_t tag,
+            std::shared_ptr<SchemaTree> const& auto_gen_keys_schema_tree,
+            std::shared_ptr<SchemaTree> const& user_gen_keys_schema_tree,
+            UtcOffset utc_offset,
+            SchemaTreeNodeValueFilter const& value_filter
+    ) -> ystdlib::error_handling::Result<KeyValuePairLogEvent>;
+
+    // Variables
+    // The undecoded values of the log event most recently deserialized by
+    // `deserialize_ir_unit_partial_kv_pair_log_event`
+    RawKvPairLogEvent m_raw_log_event;
 };
 }  // namespace clp::ffi::ir_stream
 
@@ -0,0 +1,111 @@
+#ifndef CLP_FFI_IR_STREAM_SCHEMASHAPECACHE_HPP
+#define CLP_FFI_IR_STREAM_SCHEMASHAPECACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+#include <vector>
+
+#include <ystdlib/error_handling/Result.hpp>
+
+#include "../SchemaTree.hpp"
+#include "protocol_constants.hpp"
+#include "utils.hpp"
+
+namespace clp::ffi::ir_stream {
+/**
+ * Cache of the schema-tree nodes visited while serializing the kv-pairs of the last log event,
+ * which lets the serializer skip schema-tree lookups and node ID encoding for log events that share
+ * the same key layout.
+ *
+ * The cache is positional: the `i`th kv-pair visited while serializing a log event is compared
+ * against the `i`th cached node. Since nodes are never removed from a schema tree (except when
+ * reverting to a snapshot, in which case the cache must be cleared), a cached node is valid
+ * regardless of the log event it was cached from, so a log event with a different key layout only
+ * costs the lookups for the kv-pairs that differ.
+ * @tparam is_auto_generated_node Whether the cached nodes are from the auto-generated or the
+ * user-generated schema tree.
+ */
+template <bool is_auto_generated_node>
+class SchemaShapeCache {
+public:
+    // Types
+    struct Entry {
+        SchemaTree::Node::id_t parent_id{SchemaTree::cRootId};
+        std::string key_name;
+        SchemaTree::Node::Type type{SchemaTree::Node::Type::Obj};
+        SchemaTree::Node::id_t node_id{SchemaTree::cRootId};
+        // The node ID, encoded for a node-ID-value pair
+        std::vector<int8_t> encoded_node_id;
+    };
+
+    // Methods
+    /**
+     * @param pos The position of the kv-pair in the order the kv-pairs are visited.
+     * @param locator
+     * @return The cached node at the given position if it corresponds to the given locator, or
+     * nullptr otherwise.
+     */
+    [[nodiscard]] auto find(size_t pos, SchemaTree::NodeLocator const& locator) const
+            -> Entry const* {
+        if (pos >= m_entries.size()) {
+            return nullptr;
+        }
+        auto const& entry{m_entries[pos]};
+        if (entry.parent_id != locator.get_parent_id() || entry.type != locator.get_type()
+            || entry.key_name != locator.get_key_name())
+        {
+            return nullptr;
+        }
+        return &entry;
+    }
+
+    /**
+     * Caches the node at the given position, replacing any node previously cached there.
+     * @param pos The position of the kv-pair in the order the kv-pairs are visited. Must be at most
+     * the number of positions cached so far.
+     * @param locator
+     * @param node_id The ID of the node that corresponds to `locator`.
+     * @return A result containing the cached node on success, or an error code indicating the
+     * failure:
+     * - Forwards `encode_and_serialize_schema_tree_node_id`'s return values on failure.
+     */
+    [[nodiscard]] auto
+    update(size_t pos, SchemaTree::NodeLocator const& locator, SchemaTree::Node::id_t node_id)
+            -> ystdlib::error_handling::Result<Entry const*> {
+        if (pos == m_entries.size()) {
+            m_entries.emplace_back();
+        }
+        auto& entry{m_entries[pos]};
+        entry.encoded_node_id.clear();
+        auto const encode_result{encode_and_serialize_schema_tree_node_id<
+                is_auto_generated_node,
+                cProtocol::Payload::EncodedSchemaTreeNodeIdByte,
+                cProtocol::Payload::EncodedSchemaTreeNodeIdShort,
+                cProtocol::Payload::EncodedSchemaTreeNodeIdInt
+        >(node_id, entry.encoded_node_id)};
+        if (encode_result.has_error()) {
+            // Drop the entry (and the ones after it) so that it can't be matched without an
+            // encoded node ID.
+            m_entries.resize(pos);
+            return encode_result.error();
+        }
+        entry.parent_id = locator.get_parent_id();
+        entry.key_name.assign(locator.get_key_name());
+        entry.type = locator.get_type();
+        entry.node_id = node_id;
+        return &entry;
+    }
+
+    /**
+     * Clears the cache.
+     */
+    auto clear() -> void { m_entries.clear(); }
+
+private:
+    std::vector<Entry> m_entries;
+};
+}  // namespace clp::ffi::ir_stream
+
+#endif  // CLP_FFI_IR_STREAM_SCHEMASHAPECACHE_HPP
@@ -22,6 +22,7 @@
 #include "../SchemaTree.hpp"
 #include "encoding_methods.hpp"
 #include "protocol_constants.hpp"
+#include "SchemaShapeCache.hpp"
 #include "utils.hpp"
 
 using std::optional;
@@ -54,7 +55,7 @@ concept SchemaTreeNodeSerializationMethodReq = requires(
 /**
  * Concept that defines the method to serialize a node-ID-value pair.
  * @param serialization_method
- * @param node_id
+ * @param encoded_node_id The already encoded node ID.
  * @param val
  * @param schema_tree_node_type The type of the schema tree node that corresponds to `val`.
  * @return A void result on success, or an error code indicating the failure.
@@ -62,28 +63,30 @@ concept SchemaTreeNodeSerializationMethodReq = requires(
 template <typename SerializationMethod>
 concept NodeIdValuePairSerializationMethodReq = requires(
         SerializationMethod serialization_method,
-        SchemaTree::Node::id_t id,
+        span<int8_t const> encoded_node_id,
         msgpack::object const& val,
         SchemaTree::Node::Type schema_tree_node_type
 ) {
     {
-        serialization_method(id, val, schema_tree_node_type)
+        serialization_method(encoded_node_id, val, schema_tree_node_type)
     } -> std::same_as<ystdlib::error_handling::Result<void>>;
 };
 
 /**
  * Concept that defines the method to serialize a node-ID-value pair whose value is an empty map.
  * @param serialization_method
- * @param node_id
+ * @param encoded_node_id The already encoded node ID.
  * @return A void result on success, or an error code indicating the failure.
  */
 template <typename SerializationMethod>
-concept EmptyMapSerializationMethodReq
-        = requires(SerializationMethod serialization_method, SchemaTree::Node::id_t node_id) {
-              {
-                  serialization_method(node_id)
-              } -> std::same_as<ystdlib::error_handling::Result<void>>;
-          };
+concept EmptyMapSerializationMethodReq = requires(
+        SerializationMethod serialization_method,
+        span<int8_t const> encoded_node_id
+) {
+    {
+        serialization_method(encoded_node_id)
+    } -> std::same_as<ystdlib::error_handling::Result<void>>;
+};
 
 /**
  * Class for iterating the kv-pairs of a MessagePack map.
@@ -232,11 +235,14 @@ template <typename encoded_variable_t>
 
 /**
  * Serializes the given msgpack map using a depth-first search (DFS).
+ * @tparam is_auto_generated_node
  * @tparam SchemaTreeNodeSerializationMethod
  * @tparam NodeIdValuePairSerializationMethod
  * @tparam EmptyMapSerializationMethod
  * @param msgpack_map
  * @param schema_tree
+ * @param schema_shape_cache The cache of the schema-tree nodes visited while serializing the
+ * previous msgpack map, which is updated with the nodes visited while serializing this one.
  * @param schema_tree_node_serialization_method
  * @param node_id_value_pair_serialization_method
  * @param empty_map_serialization_method
@@ -246,8 +252,10 @@ template <typename encoded_variable_t>
  * - Forwards `node_id_value_pair_serialization_method`'s return value on failure.
  * - Forwards `empty_map_serialization_method`'s return value on failure.
  * - Forwards `get_schema_tree_node_type_from_msgpack_val`'s return value on failure.
+ * - Forwards `SchemaShapeCache::update`'s return value on failure.
  */
 template <
+        bool is_auto_generated_node,
         SchemaTreeNodeSerializationMethodReq SchemaTreeNodeSerializationMethod,
         NodeIdValuePairSerializationMethodReq NodeIdValuePairSerializationMethod,
         EmptyMapSerializationMethodReq EmptyMapSerializationMethod
@@ -255,6 +263,7 @@ template <
 [[nodiscard]] auto serialize_msgpack_map_using_dfs(
         msgpack::object_map const& msgpack_map,
         SchemaTree& schema_tree,
+        SchemaShapeCache<is_auto_generated_node>& schema_shape_cache,
         SchemaTreeNodeSerializationMethod schema_tree_node_serialization_method,
         NodeIdValuePairSerializationMethod node_id_value_pair_serialization_method,
         EmptyMapSerializationMethod empty_map_serialization_method
@@ -440,6 +449,7 @@ auto is_msgpack_array_serializable(msgpack::object const& array) -> bool {
 }
 
 template <
+        bool is_auto_generated_node,
         SchemaTreeNodeSerializationMethodReq SchemaTreeNodeSerializationMethod,
         NodeIdValuePairSerializationMethodReq NodeIdValuePairSerializationMethod,
         EmptyMapSerializationMethodReq EmptyMapSerializationMethod
@@ -447,10 +457,12 @@ template <
 [[nodiscard]] auto serialize_msgpack_map_using_dfs(
         msgpack::object_map const& msgpack_map,
         SchemaTree& schema_tree,
+        SchemaShapeCache<is_auto_generated_node>& schema_shape_cache,
         SchemaTreeNodeSerializationMethod schema_tree_node_serialization_method,
         NodeIdValuePairSerializationMethod node_id_value_pair_serialization_method,
         EmptyMapSerializationMethod empty_map_serialization_method
 ) -> ystdlib::error_handling::Result<void> {
+    size_t num_visited_kv_pairs{0};
     vector<MsgpackMapIterator> dfs_stack;
     dfs_stack.emplace_back(
             SchemaTree::cRootId,
@@ -480,14 +492,25 @@ template <
                 schema_tree_node_type
         };
 
-        // Get the schema-tree node that corresponds with the current kv-pair, or add it if it
-        // doesn't exist.
-        auto opt_schema_tree_node_id{schema_tree.try_get_node_id(locator)};
-        if (false == opt_schema_tree_node_id.has_value()) {
-            opt_schema_tree_node_id.emplace(schema_tree.insert_node(locator));
-            YSTDLIB_ERROR_HANDLING_TRYV(schema_tree_node_serialization_method(locator));
+        // Get the schema-tree node that corresponds with the current kv-pair from the cache. On a
+        // cache miss, look the node up in the schema tree (adding it if it doesn't exist) and cache
+        // it.
+        auto const* cached_node{schema_shape_cache.find(num_visited_kv_pairs, locator)};
+        if (nullptr == cached_node) {
+            auto opt_schema_tree_node_id{schema_tree.try_get_node_id(locator)};
+            if (false == opt_schema_tree_node_id.has_value()) {
+                opt_schema_tree_node_id.emplace(schema_tree.insert_node(locator));
+                YSTDLIB_ERROR_HANDLING_TRYV(schema_tree_node_serialization_method(locator));
+            }
+            cached_node = YSTDLIB_ERROR_HANDLING_TRYX(schema_shape_cache.update(
+                    num_visited_kv_pairs,
+                    locator,
+                    opt_schema_tree_node_id.value()
+            ));
         }
-        auto const schema_tree_node_id{opt_schema_tree_node_id.value()};
+        ++num_visited_kv_pairs;
+        auto const schema_tree_node_id{cached_node->node_id};
+        span<int8_t const> const encoded_node_id{cached_node->encoded_node_id};
 
         if (msgpack::type::MAP == val.type) {
             // Serialize map
@@ -501,14 +524,14 @@ template <
                         span<MsgpackMapIterator::Child>{inner_map.ptr, inner_map_size}
                 );
             } else {
-                YSTDLIB_ERROR_HANDLING_TRYV(empty_map_serialization_method(schema_tree_node_id));
+                YSTDLIB_ERROR_HANDLING_TRYV(empty_map_serialization_method(encoded_node_id));
             }
             continue;
         }
 
         // Serialize primitive
         YSTDLIB_ERROR_HANDLING_TRYV(node_id_value_pair_serialization_method(
-                schema_tree_node_id,
+                encoded_node_id,
                 val,
                 schema_tree_node_type
         ));
@@ -578,14 +601,47 @@ auto Serializer<encoded_variable_t>::serialize_msgpack_map(
 ) -> ystdlib::error_handling::Result<void> {
     m_auto_gen_keys_schema_tree.take_snapshot();
     m_user_gen_keys_schema_tree.take_snapshot();
+    TransactionManager revert_manager{
+            []() noexcept -> void {},
+            [&]() noexcept -> void { revert_schema_trees(); }
+    };
+
+    YSTDLIB_ERROR_HANDLING_TRYV(serialize_log_event(auto_gen_kv_pairs_map, user_gen_kv_pairs_map));
+
+    revert_manager.mark_success();
+    return success();
+}
+
+template <typename encoded_variable_t>
+auto Serializer<encoded_variable_t>::serialize_msgpack_maps(
+        span<MsgpackMapPair const> msgpack_map_pairs
+) -> ystdlib::error_handling::Result<void> {
+    m_auto_gen_keys_schema_tree.take_snapshot();
+    m_user_gen_keys_schema_tree.take_snapshot();
+    auto const ir_buf_size{m_ir_buf.size()};
     TransactionManager revert_manager{
             []() noexcept -> void {},
             [&]() noexcept -> void {
-                m_user_gen_keys_schema_tree.revert();
-                m_auto_gen_keys_schema_tree.revert();
+                revert_schema_trees();
+                m_ir_buf.resize(ir_buf_size);
             }
     };
 
+    for (auto const& [auto_gen_kv_pairs_map, user_gen_kv_pairs_map] : msgpack_map_pairs) {
+        YSTDLIB_ERROR_HANDLING_TRYV(
+                serialize_log_event(auto_gen_kv_pairs_map, user_gen_kv_pairs_map)
+        );
+    }
+
+    revert_manager.mark_success();
+    return success();
+}
+
+template <typename encoded_variable_t>
+auto Serializer<encoded_variable_t>::serialize_log_event(
+        msgpack::object_map const& auto_gen_kv_pairs_map,
+        msgpack::object_map const& user_gen_kv_pairs_map
+) -> ystdlib::error_handling::Result<void> {
     m_schema_tree_node_buf.clear();
     m_sequential_serialization_buf.clear();
     m_user_gen_val_group_buf.clear();
@@ -600,37 +656,30 @@ auto Serializer<encoded_variable_t>::serialize_msgpack_map(
 
     auto auto_gen_node_id_value_pairs_serialization_method
             = [&](
-                      SchemaTree::Node::id_t node_id,
+                      BufferView encoded_node_id,
                       msgpack::object const& val,
                       SchemaTree::Node::Type schema_tree_node_type
               ) -> ystdlib::error_handling::Result<void> {
-        auto const encode_result = encode_and_serialize_schema_tree_node_id<
-                true,
-                cProtocol::Payload::EncodedSchemaTreeNodeIdByte,
-                cProtocol::Payload::EncodedSchemaTreeNodeIdShort,
-                cProtocol::Payload::EncodedSchemaTreeNodeIdInt
-        >(node_id, m_sequential_serialization_buf);
-        YSTDLIB_ERROR_HANDLING_TRYV(encode_result);
-        YSTDLIB_ERROR_HANDLING_TRYV(
-                serialize_value<encoded_variable_t>(
-                        val,
-                        schema_tree_node_type,
-                        m_logtype_buf,
-                        m_sequential_serialization_buf
-                )
+        m_sequential_serialization_buf.insert(
+                m_sequential_serialization_buf.cend(),
+                encoded_node_id.begin(),
+                encoded_node_id.end()
+        );
+        return serialize_value<encoded_variable_t>(
+                val,
+                schema_tree_node_type,
+                m_logtype_buf,
+                m_sequential_serialization_buf
         );
-        return success();
     };
 
     auto auto_gen_empty_map_serialization_method
-            = [&](SchemaTree::Node::id_t node_id) -> ystdlib::error_handling::Result<void> {
-        auto encode_result = encode_and_serialize_schema_tree_node_id<
-                true,
-                cProtocol::Payload::EncodedSchemaTreeNodeIdByte,
-                cProtocol::Payload::EncodedSchemaTreeNodeIdShort,
-                cProtocol::Payload::EncodedSchemaTreeNodeIdInt
-        >(node_id, m_sequential_serialization_buf);
-        YSTDLIB_ERROR_HANDLING_TRYV(encode_result);
+            = [&](BufferView encoded_node_id) -> ystdlib::error_handling::Result<void> {
+        m_sequential_serialization_buf.insert(
+                m_sequential_serialization_buf.cend(),
+                encoded_node_id.begin(),
+                encoded_node_id.end()
+        );
         serialize_value_empty_object(m_sequential_serialization_buf);
         return success();
     };
@@ -639,6 +688,7 @@ auto Serializer<encoded_variable_t>::serialize_msgpack_map(
         YSTDLIB_ERROR_HANDLING_TRYV(serialize_msgpack_map_using_dfs(
                 auto_gen_kv_pairs_map,
                 m_auto_gen_keys_schema_tree,
+                m_auto_gen_keys_schema_shape_cache,
                 auto_gen_schema_tree_node_serialization_method,
                 auto_gen_node_id_value_pairs_serialization_method,
                 auto_gen_empty_map_serialization_method
@@ -655,37 +705,30 @@ auto Serializer<encoded_variable_t>::serialize_msgpack_map(
 
     auto user_gen_node_id_value_pairs_serialization_method
             = [&](
-                      SchemaTree::Node::id_t node_id,
+                      BufferView encoded_node_id,
                       msgpack::object const& val,
                       SchemaTree::Node::Type schema_tree_node_type
               ) -> ystdlib::error_handling::Result<void> {
-        auto encode_result = encode_and_serialize_schema_tree_node_id<
-                false,
-                cProtocol::Payload::EncodedSchemaTreeNodeIdByte,
-                cProtocol::Payload::EncodedSchemaTreeNodeIdShort,
-                cProtocol::Payload::EncodedSchemaTreeNodeIdInt
-        >(node_id, m_sequential_serialization_buf);
-        YSTDLIB_ERROR_HANDLING_TRYV(encode_result);
-        YSTDLIB_ERROR_HANDLING_TRYV(
-                serialize_value<encoded_variable_t>(
-                        val,
-                        schema_tree_node_type,
-                        m_logtype_buf,
-                        m_user_gen_val_group_buf
-                )
+        m_sequential_serialization_buf.insert(
+                m_sequential_serialization_buf.cend(),
+                encoded_node_id.begin(),
+                encoded_node_id.end()
+        );
+        return serialize_value<encoded_variable_t>(
+                val,
+                schema_tree_node_type,
+                m_logtype_buf,
+                m_user_gen_val_group_buf
         );
-        return success();
     };
 
     auto user_gen_empty_map_serialization_method
-            = [&](SchemaTree::Node::id_t node_id) -> ystdlib::error_handling::Result<void> {
-        auto encode_result = encode_and_serialize_schema_tree_node_id<
-                false,
-                cProtocol::Payload::EncodedSchemaTreeNodeIdByte,
-                cProtocol::Payload::EncodedSchemaTreeNodeIdShort,
-                cProtocol::Payload::EncodedSchemaTreeNodeIdInt
-        >(node_id, m_sequential_serialization_buf);
-        YSTDLIB_ERROR_HANDLING_TRYV(encode_result);
+            = [&](BufferView encoded_node_id) -> ystdlib::error_handling::Result<void> {
+        m_sequential_serialization_buf.insert(
+                m_sequential_serialization_buf.cend(),
+                encoded_node_id.begin(),
+                encoded_node_id.end()
+        );
         serialize_value_empty_object(m_user_gen_val_group_buf);
         return success();
     };
@@ -696,6 +739,7 @@ auto Serializer<encoded_variable_t>::serialize_msgpack_map(
         YSTDLIB_ERROR_HANDLING_TRYV(serialize_msgpack_map_using_dfs(
                 user_gen_kv_pairs_map,
                 m_user_gen_keys_schema_tree,
+                m_user_gen_keys_schema_shape_cache,
                 user_gen_schema_tree_node_serialization_method,
                 user_gen_node_id_value_pairs_serialization_method,
                 user_gen_empty_map_serialization_method
@@ -718,11 +762,17 @@ auto Serializer<encoded_variable_t>::serialize_msgpack_map(
             m_user_gen_val_group_buf.cbegin(),
             m_user_gen_val_group_buf.cend()
     );
-
-    revert_manager.mark_success();
     return success();
 }
 
+template <typename encoded_variable_t>
+auto Serializer<encoded_variable_t>::revert_schema_trees() noexcept -> void {
+    m_user_gen_keys_schema_tree.revert();
+    m_auto_gen_keys_schema_tree.revert();
+    // The caches may contain nodes that were just removed from the schema trees
+    m_auto_gen_keys_schema_shape_cache.clear();
+    m_user_gen_keys_schema_shape_cache.clear();
+}
 template <typename encoded_variable_t>
 template <bool is_auto_generated_node>
 auto Serializer<encoded_variable_t>::serialize_schema_tree_node(
@@ -788,6 +838,13 @@ template auto Serializer<four_byte_encoded_variable_t>::serialize_msgpack_map(
         msgpack::object_map const& user_gen_kv_pairs_map
 ) -> ystdlib::error_handling::Result<void>;
 
+template auto Serializer<eight_byte_encoded_variable_t>::serialize_msgpack_maps(
+        span<MsgpackMapPair const> msgpack_map_pairs
+) -> ystdlib::error_handling::Result<void>;
+template auto Serializer<four_byte_encoded_variable_t>::serialize_msgpack_maps(
+        span<MsgpackMapPair const> msgpack_map_pairs
+) -> ystdlib::error_handling::Result<void>;
+
 template auto Serializer<eight_byte_encoded_variable_t>::serialize_schema_tree_node<true>(
         SchemaTree::NodeLocator const& locator
 ) -> ystdlib::error_handling::Result<void>;
@@ -5,6 +5,7 @@
 #include <optional>
 #include <span>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <msgpack.hpp>
@@ -14,6 +15,7 @@
 #include "../../time_types.hpp"
 #include "../SchemaTree.hpp"
 #include "IrSerializationError.hpp"
+#include "SchemaShapeCache.hpp"
 
 namespace clp::ffi::ir_stream {
 /**
@@ -38,6 +40,8 @@ public:
     // Types
     using Buffer = std::vector<int8_t>;
     using BufferView = std::span<int8_t const>;
+    // The auto-generated and user-generated kv-pairs of a log event
+    using MsgpackMapPair = std::pair<msgpack::object_map, msgpack::object_map>;
 
     // Factory functions
     /**
@@ -103,11 +107,43 @@ public:
             msgpack::object_map const& user_gen_kv_pairs_map
     ) -> ystdlib::error_handling::Result<void>;
 
+    /**
+     * Serializes the given pairs of msgpack maps as key-value pair log events, in order.
+     *
+     * This is equivalent to calling `serialize_msgpack_map` for each pair, except that the batch is
+     * serialized atomically: if any log event fails to serialize, none of the batch's log events
+     * are serialized.
+     * @param msgpack_map_pairs
+     * @return A void result on success, or an error code indicating the failure:
+     * - Forwards `serialize_msgpack_map`'s return values on failure.
+     */
+    [[nodiscard]] auto serialize_msgpack_maps(std::span<MsgpackMapPair const> msgpack_map_pairs)
+            -> ystdlib::error_handling::Result<void>;
+
 private:
     // Constructors
     Serializer() = default;
 
     // Methods
+    /**
+     * Serializes the given msgpack maps as a key-value pair log event, without reverting the schema
+     * trees on failure.
+     * @param auto_gen_kv_pairs_map
+     * @param user_gen_kv_pairs_map
+     * @return A void result on success, or an error code indicating the failure:
+     * - Forwards `serialize_schema_tree_node`'s return values on failure.
+     * - Forwards `serialize_msgpack_map_using_dfs`'s return values on failure.
+     */
+    [[nodiscard]] auto serialize_log_event(
+            msgpack::object_map const& auto_gen_kv_pairs_map,
+            msgpack::object_map const& user_gen_kv_pairs_map
+    ) -> ystdlib::error_handling::Result<void>;
+
+    /**
+     * Reverts the schema trees to their last snapshots and invalidates the schema shape caches.
+     */
+    auto revert_schema_trees() noexcept -> void;
+
     /**
      * Serializes a schema tree node identified by the given locator into `m_schema_tree_node_buf`.
      * @tparam is_auto_generated_node
@@ -126,6 +162,8 @@ private:
     Buffer m_ir_buf;
     SchemaTree m_auto_gen_keys_schema_tree;
     SchemaTree m_user_gen_keys_schema_tree;
+    SchemaShapeCache<true> m_auto_gen_keys_schema_shape_cache;
+    SchemaShapeCache<false> m_user_gen_keys_schema_shape_cache;
 
     std::string m_logtype_buf;
     Buffer m_schema_tree_node_buf;
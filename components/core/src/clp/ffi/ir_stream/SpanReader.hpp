@@ -0,0 +1,130 @@
+#ifndef CLP_FFI_IR_STREAM_SPANREADER_HPP
+#define CLP_FFI_IR_STREAM_SPANREADER_HPP
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <string>
+
+#include "../../ErrorCode.hpp"
+
+namespace clp::ffi::ir_stream {
+/**
+ * Reader for deserializing IR from a contiguous in-memory buffer.
+ *
+ * Unlike `ReaderInterface`, none of this reader's methods are virtual and each read is a bounds
+ * check followed by a copy, so the deserialization methods instantiated for this reader can inline
+ * every read. The reader implements the subset of `ReaderInterface`'s methods that the
+ * deserialization methods use, with the same return values.
+ *
+ * If a read fails because the buffer doesn't contain enough data, the reader records that it was
+ * exhausted. This allows callers to distinguish an IR unit that's cut off by the end of the buffer
+ * (and so may be complete in the underlying stream) from an IR unit that's corrupted.
+ */
+class SpanReader {
+public:
+    // Constructors
+    explicit SpanReader(std::span<char const> buf) : m_buf{buf} {}
+
+    // Methods
+    /**
+     * Tries to read the given number of bytes.
+     * @param buf
+     * @param num_bytes
+     * @return ErrorCode_Success on success.
+     * @return ErrorCode_EndOfFile if the buffer doesn't contain any more data.
+     * @return ErrorCode_Truncated if the buffer contains fewer than `num_bytes` bytes.
+     */
+    [[nodiscard]] auto try_read_exact_length(char* buf, size_t num_bytes) -> ErrorCode {
+        if (num_bytes > get_num_remaining_bytes()) {
+            return mark_exhausted();
+        }
+        std::copy_n(m_buf.subspan(m_pos).begin(), num_bytes, buf);
+        m_pos += num_bytes;
+        return ErrorCode_Success;
+    }
+
+    /**
+     * Tries to read a numeric value.
+     * @tparam ValueType
+     * @param value Returns the value read.
+     * @return Same as `try_read_exact_length`.
+     */
+    template <typename ValueType>
+    [[nodiscard]] auto try_read_numeric_value(ValueType& value) -> ErrorCode {
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+        return try_read_exact_length(reinterpret_cast<char*>(&value), sizeof(value));
+    }
+
+    /**
+     * Tries to read a string.
+     * @param str_length
+     * @param str Returns the string read.
+     * @return Same as `try_read_exact_length`.
+     */
+    [[nodiscard]] auto try_read_string(size_t str_length, std::string& str) -> ErrorCode {
+        if (str_length > get_num_remaining_bytes()) {
+            return mark_exhausted();
+        }
+        str.assign(m_buf.subspan(m_pos, str_length).data(), str_length);
+        m_pos += str_length;
+        return ErrorCode_Success;
+    }
+
+    /**
+     * @param pos Returns the position of the read head in the buffer.
+     * @return ErrorCode_Success
+     */
+    [[nodiscard]] auto try_get_pos(size_t& pos) const -> ErrorCode {
+        pos = m_pos;
+        return ErrorCode_Success;
+    }
+
+    [[nodiscard]] auto get_pos() const -> size_t { return m_pos; }
+
+    /**
+     * @return Whether a read failed because the buffer didn't contain enough data.
+     */
+    [[nodiscard]] auto is_exhausted() const -> bool { return m_is_exhausted; }
+
+private:
+    // Methods
+    [[nodiscard]] auto get_num_remaining_bytes() const -> size_t { return m_buf.size() - m_pos; }
+
+    /**
+     * Records that a read failed because the buffer didn't contain enough data.
+     * @return ErrorCode_EndOfFile if the buffer doesn't contain any more data.
+     * @return ErrorCode_Truncated otherwise.
+     */
+    [[nodiscard]] auto mark_exhausted() -> ErrorCode {
+        m_is_exhausted = true;
+        return 0 == get_num_remaining_bytes() ? ErrorCode_EndOfFile : ErrorCode_Truncated;
+    }
+
+    // Variables
+    std::span<char const> m_buf;
+    size_t m_pos{0};
+    bool m_is_exhausted{false};
+};
+
+/**
+ * Requirement for readers that IR can be deserialized from (i.e., `ReaderInterface` and its
+ * implementations, and `SpanReader`).
+ */
+template <typename ReaderType>
+concept IrReaderReq = requires(
+        ReaderType& reader,
+        char* buf,
+        size_t num_bytes,
+        int8_t& value,
+        std::string& str
+) {
+    { reader.try_read_exact_length(buf, num_bytes) } -> std::same_as<ErrorCode>;
+    { reader.try_read_numeric_value(value) } -> std::same_as<ErrorCode>;
+    { reader.try_read_string(num_bytes, str) } -> std::same_as<ErrorCode>;
+};
+}  // namespace clp::ffi::ir_stream
+
+#endif  // CLP_FFI_IR_STREAM_SPANREADER_HPP
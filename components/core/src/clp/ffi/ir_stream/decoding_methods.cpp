@@ -15,6 +15,7 @@
 #include "byteswap.hpp"
 #include "IrDeserializationError.hpp"
 #include "protocol_constants.hpp"
+#include "SpanReader.hpp"
 #include "utils.hpp"
 
 using clp::ir::eight_byte_encoded_variable_t;
@@ -28,6 +29,7 @@ namespace clp::ffi::ir_stream {
 namespace {
 /**
  * Deserializes a logtype from the given reader and appends it to the given string blob.
+ * @tparam ReaderType
  * @param reader
  * @param encoded_tag
  * @param string_blob The string blob to append the deserialized logtype to.
@@ -37,14 +39,16 @@ namespace {
  * - IrDeserializationErrorEnum::InvalidTag if the tag doesn't correspond to any valid logtype
  *   encoding.
  */
+template <IrReaderReq ReaderType>
 [[nodiscard]] auto deserialize_and_append_logtype(
-        ReaderInterface& reader,
+        ReaderType& reader,
         encoded_tag_t encoded_tag,
         StringBlob& string_blob
 ) -> ystdlib::error_handling::Result<void>;
 
 /**
  * Deserializes a dictionary variable from the given reader and appends it to the given string blob.
+ * @tparam ReaderType
  * @param reader
  * @param encoded_tag
  * @param string_blob The string blob to append the deserialized logtype to.
@@ -54,14 +58,81 @@ namespace {
  * - IrDeserializationErrorEnum::InvalidTag if the tag doesn't correspond to any valid dictionary
  *   variable encoding.
  */
+template <IrReaderReq ReaderType>
 [[nodiscard]] auto deserialize_and_append_dict_var(
-        ReaderInterface& reader,
+        ReaderType& reader,
         encoded_tag_t encoded_tag,
         StringBlob& string_blob
 ) -> ystdlib::error_handling::Result<void>;
 
+/**
+ * Generic implementation of `deserialize_encoded_text_ast` for any reader type.
+ * @tparam encoded_variable_t
+ * @tparam ReaderType
+ * @param reader
+ * @param encoded_tag
+ * @param logtype
+ * @param encoded_vars
+ * @param dict_vars
+ * @return Same as `deserialize_encoded_text_ast(ReaderInterface&, ...)`.
+ */
+template <typename encoded_variable_t, IrReaderReq ReaderType>
+[[nodiscard]] auto generic_deserialize_encoded_text_ast(
+        ReaderType& reader,
+        encoded_tag_t encoded_tag,
+        string& logtype,
+        vector<encoded_variable_t>& encoded_vars,
+        vector<string>& dict_vars
+) -> IRErrorCode;
+
+/**
+ * Generic implementation of `deserialize_encoded_text_ast` for any reader type.
+ * @tparam encoded_variable_t
+ * @tparam ReaderType
+ * @param reader
+ * @param encoded_tag
+ * @return Same as `deserialize_encoded_text_ast(ReaderInterface&, encoded_tag_t)`.
+ */
+template <ir::EncodedVariableTypeReq encoded_variable_t, IrReaderReq ReaderType>
+[[nodiscard]] auto
+generic_deserialize_encoded_text_ast(ReaderType& reader, encoded_tag_t encoded_tag)
+        -> ystdlib::error_handling::Result<EncodedTextAst<encoded_variable_t>>;
+
+/**
+ * Generic implementation of `deserialize_log_event` for any reader type.
+ * @tparam encoded_variable_t
+ * @tparam ReaderType
+ * @param reader
+ * @param encoded_tag
+ * @param logtype
+ * @param encoded_vars
+ * @param dict_vars
+ * @param timestamp_or_timestamp_delta
+ * @return Same as `deserialize_log_event(ReaderInterface&, ...)`.
+ */
+template <typename encoded_variable_t, IrReaderReq ReaderType>
+[[nodiscard]] auto generic_deserialize_log_event(
+        ReaderType& reader,
+        encoded_tag_t encoded_tag,
+        string& logtype,
+        vector<encoded_variable_t>& encoded_vars,
+        vector<string>& dict_vars,
+        epoch_time_ms_t& timestamp_or_timestamp_delta
+) -> IRErrorCode;
+
+/**
+ * Generic implementation of `deserialize_utc_offset_change` for any reader type.
+ * @tparam ReaderType
+ * @param reader
+ * @return Same as `deserialize_utc_offset_change(ReaderInterface&)`.
+ */
+template <IrReaderReq ReaderType>
+[[nodiscard]] auto generic_deserialize_utc_offset_change(ReaderType& reader)
+        -> ystdlib::error_handling::Result<UtcOffset>;
+
+template <IrReaderReq ReaderType>
 auto deserialize_and_append_logtype(
-        ReaderInterface& reader,
+        ReaderType& reader,
         encoded_tag_t encoded_tag,
         StringBlob& string_blob
 ) -> ystdlib::error_handling::Result<void> {
@@ -103,8 +174,9 @@ auto deserialize_and_append_logtype(
     return ystdlib::error_handling::success();
 }
 
+template <IrReaderReq ReaderType>
 auto deserialize_and_append_dict_var(
-        ReaderInterface& reader,
+        ReaderType& reader,
         encoded_tag_t encoded_tag,
         StringBlob& string_blob
 ) -> ystdlib::error_handling::Result<void> {
@@ -159,6 +231,7 @@ static bool is_variable_tag(encoded_tag_t tag, bool& is_encoded_var);
 
 /**
  * Deserializes a logtype from the given reader
+ * @tparam ReaderType
  * @param reader
  * @param encoded_tag
  * @param logtype Returns the logtype
@@ -166,11 +239,13 @@ static bool is_variable_tag(encoded_tag_t tag, bool& is_encoded_var);
  * @return IRErrorCode_Corrupted_IR if reader contains invalid IR
  * @return IRErrorCode_Incomplete_IR if reader doesn't contain enough data to deserialize
  */
+template <IrReaderReq ReaderType>
 static IRErrorCode
-deserialize_logtype(ReaderInterface& reader, encoded_tag_t encoded_tag, string& logtype);
+deserialize_logtype(ReaderType& reader, encoded_tag_t encoded_tag, string& logtype);
 
 /**
  * Deserializes a dictionary-type variable from the given reader
+ * @tparam ReaderType
  * @param reader
  * @param encoded_tag
  * @param dict_var Returns the dictionary variable
@@ -178,12 +253,14 @@ deserialize_logtype(ReaderInterface& reader, encoded_tag_t encoded_tag, string&
  * @return IRErrorCode_Corrupted_IR if reader contains invalid IR
  * @return IRErrorCode_Incomplete_IR if input buffer doesn't contain enough data to deserialize
  */
+template <IrReaderReq ReaderType>
 static IRErrorCode
-deserialize_dict_var(ReaderInterface& reader, encoded_tag_t encoded_tag, string& dict_var);
+deserialize_dict_var(ReaderType& reader, encoded_tag_t encoded_tag, string& dict_var);
 
 /**
  * Deserializes a timestamp from the given reader
  * @tparam encoded_variable_t Type of the encoded variable
+ * @tparam ReaderType
  * @param reader
  * @param encoded_tag
  * @param ts Returns the timestamp delta if encoded_variable_t == four_byte_encoded_variable_t or
@@ -192,9 +269,9 @@ deserialize_dict_var(ReaderInterface& reader, encoded_tag_t encoded_tag, string&
  * @return IRErrorCode_Corrupted_IR if reader contains invalid IR
  * @return IRErrorCode_Incomplete_IR if reader doesn't contain enough data to deserialize
  */
-template <typename encoded_variable_t>
+template <typename encoded_variable_t, IrReaderReq ReaderType>
 static IRErrorCode
-deserialize_timestamp(ReaderInterface& reader, encoded_tag_t encoded_tag, epoch_time_ms_t& ts);
+deserialize_timestamp(ReaderType& reader, encoded_tag_t encoded_tag, epoch_time_ms_t& ts);
 
 /**
  * Deserializes the next log event from the given reader
@@ -210,7 +287,7 @@ deserialize_timestamp(ReaderInterface& reader, encoded_tag_t encoded_tag, epoch_
  * @return Same as ffi::ir_stream::deserialize_log_event
  */
 template <typename encoded_variable_t>
-static IRErrorCode generic_deserialize_log_event(
+static IRErrorCode deserialize_and_decode_log_event(
         ReaderInterface& reader,
         encoded_tag_t encoded_tag,
         string& message,
@@ -261,8 +338,9 @@ static bool is_variable_tag(encoded_tag_t tag, bool& is_encoded_var) {
     return false;
 }
 
+template <IrReaderReq ReaderType>
 static IRErrorCode
-deserialize_logtype(ReaderInterface& reader, encoded_tag_t encoded_tag, string& logtype) {
+deserialize_logtype(ReaderType& reader, encoded_tag_t encoded_tag, string& logtype) {
     size_t logtype_length;
     if (encoded_tag == cProtocol::Payload::LogtypeStrLenUByte) {
         uint8_t length;
@@ -292,8 +370,9 @@ deserialize_logtype(ReaderInterface& reader, encoded_tag_t encoded_tag, string&
     return IRErrorCode_Success;
 }
 
+template <IrReaderReq ReaderType>
 static IRErrorCode
-deserialize_dict_var(ReaderInterface& reader, encoded_tag_t encoded_tag, string& dict_var) {
+deserialize_dict_var(ReaderType& reader, encoded_tag_t encoded_tag, string& dict_var) {
     // Deserialize variable's length
     size_t var_length;
     if (cProtocol::Payload::VarStrLenUByte == encoded_tag) {
@@ -326,9 +405,9 @@ deserialize_dict_var(ReaderInterface& reader, encoded_tag_t encoded_tag, string&
     return IRErrorCode_Success;
 }
 
-template <typename encoded_variable_t>
+template <typename encoded_variable_t, IrReaderReq ReaderType>
 static IRErrorCode
-deserialize_timestamp(ReaderInterface& reader, encoded_tag_t encoded_tag, epoch_time_ms_t& ts) {
+deserialize_timestamp(ReaderType& reader, encoded_tag_t encoded_tag, epoch_time_ms_t& ts) {
     static_assert(
             is_same_v<encoded_variable_t, eight_byte_encoded_variable_t>
             || is_same_v<encoded_variable_t, four_byte_encoded_variable_t>
@@ -374,7 +453,7 @@ deserialize_timestamp(ReaderInterface& reader, encoded_tag_t encoded_tag, epoch_
 }
 
 template <typename encoded_variable_t>
-static IRErrorCode generic_deserialize_log_event(
+static IRErrorCode deserialize_and_decode_log_event(
         ReaderInterface& reader,
         encoded_tag_t encoded_tag,
         string& message,
@@ -456,17 +535,23 @@ static IRErrorCode deserialize_metadata(
     return IRErrorCode_Success;
 }
 
-template <typename encoded_variable_t>
-auto deserialize_log_event(
-        ReaderInterface& reader,
+namespace {
+template <typename encoded_variable_t, IrReaderReq ReaderType>
+auto generic_deserialize_log_event(
+        ReaderType& reader,
         encoded_tag_t encoded_tag,
         string& logtype,
         vector<encoded_variable_t>& encoded_vars,
         vector<string>& dict_vars,
         epoch_time_ms_t& timestamp_or_timestamp_delta
 ) -> IRErrorCode {
-    if (auto const err
-        = deserialize_encoded_text_ast(reader, encoded_tag, logtype, encoded_vars, dict_vars);
+    if (auto const err = generic_deserialize_encoded_text_ast(
+                reader,
+                encoded_tag,
+                logtype,
+                encoded_vars,
+                dict_vars
+        );
         IRErrorCode_Success != err)
     {
         return err;
@@ -489,13 +574,13 @@ auto deserialize_log_event(
     return IRErrorCode_Success;
 }
 
-template <typename encoded_variable_t>
-auto deserialize_encoded_text_ast(
-        ReaderInterface& reader,
+template <typename encoded_variable_t, IrReaderReq ReaderType>
+auto generic_deserialize_encoded_text_ast(
+        ReaderType& reader,
         encoded_tag_t encoded_tag,
-        std::string& logtype,
-        std::vector<encoded_variable_t>& encoded_vars,
-        std::vector<std::string>& dict_vars
+        string& logtype,
+        vector<encoded_variable_t>& encoded_vars,
+        vector<string>& dict_vars
 ) -> IRErrorCode {
     // Handle variables
     string var_str;
@@ -530,8 +615,8 @@ auto deserialize_encoded_text_ast(
     return IRErrorCode_Success;
 }
 
-template <ir::EncodedVariableTypeReq encoded_variable_t>
-[[nodiscard]] auto deserialize_encoded_text_ast(ReaderInterface& reader, encoded_tag_t encoded_tag)
+template <ir::EncodedVariableTypeReq encoded_variable_t, IrReaderReq ReaderType>
+auto generic_deserialize_encoded_text_ast(ReaderType& reader, encoded_tag_t encoded_tag)
         -> ystdlib::error_handling::Result<EncodedTextAst<encoded_variable_t>> {
     StringBlob string_blob;
     vector<encoded_variable_t> encoded_vars;
@@ -546,7 +631,9 @@ template <ir::EncodedVariableTypeReq encoded_variable_t>
                     deserialize_and_append_dict_var(reader, encoded_tag, string_blob)
             );
         }
-        encoded_tag = YSTDLIB_ERROR_HANDLING_TRYX(deserialize_tag(reader));
+        if (ErrorCode_Success != reader.try_read_numeric_value(encoded_tag)) {
+            return IrDeserializationError{IrDeserializationErrorEnum::IncompleteStream};
+        }
     }
 
     YSTDLIB_ERROR_HANDLING_TRYV(deserialize_and_append_logtype(reader, encoded_tag, string_blob));
@@ -557,6 +644,84 @@ template <ir::EncodedVariableTypeReq encoded_variable_t>
     );
 }
 
+template <IrReaderReq ReaderType>
+auto generic_deserialize_utc_offset_change(ReaderType& reader)
+        -> ystdlib::error_handling::Result<UtcOffset> {
+    int64_t serialized_utc_offset{};
+    if (false == deserialize_int(reader, serialized_utc_offset)) {
+        return IrDeserializationError{IrDeserializationErrorEnum::IncompleteStream};
+    }
+    return UtcOffset{serialized_utc_offset};
+}
+}  // namespace
+
+template <typename encoded_variable_t>
+auto deserialize_log_event(
+        ReaderInterface& reader,
+        encoded_tag_t encoded_tag,
+        string& logtype,
+        vector<encoded_variable_t>& encoded_vars,
+        vector<string>& dict_vars,
+        epoch_time_ms_t& timestamp_or_timestamp_delta
+) -> IRErrorCode {
+    return generic_deserialize_log_event(
+            reader,
+            encoded_tag,
+            logtype,
+            encoded_vars,
+            dict_vars,
+            timestamp_or_timestamp_delta
+    );
+}
+
+template <typename encoded_variable_t>
+auto deserialize_log_event(
+        SpanReader& reader,
+        encoded_tag_t encoded_tag,
+        string& logtype,
+        vector<encoded_variable_t>& encoded_vars,
+        vector<string>& dict_vars,
+        epoch_time_ms_t& timestamp_or_timestamp_delta
+) -> IRErrorCode {
+    return generic_deserialize_log_event(
+            reader,
+            encoded_tag,
+            logtype,
+            encoded_vars,
+            dict_vars,
+            timestamp_or_timestamp_delta
+    );
+}
+
+template <typename encoded_variable_t>
+auto deserialize_encoded_text_ast(
+        ReaderInterface& reader,
+        encoded_tag_t encoded_tag,
+        std::string& logtype,
+        std::vector<encoded_variable_t>& encoded_vars,
+        std::vector<std::string>& dict_vars
+) -> IRErrorCode {
+    return generic_deserialize_encoded_text_ast(
+            reader,
+            encoded_tag,
+            logtype,
+            encoded_vars,
+            dict_vars
+    );
+}
+
+template <ir::EncodedVariableTypeReq encoded_variable_t>
+[[nodiscard]] auto deserialize_encoded_text_ast(ReaderInterface& reader, encoded_tag_t encoded_tag)
+        -> ystdlib::error_handling::Result<EncodedTextAst<encoded_variable_t>> {
+    return generic_deserialize_encoded_text_ast<encoded_variable_t>(reader, encoded_tag);
+}
+
+template <ir::EncodedVariableTypeReq encoded_variable_t>
+[[nodiscard]] auto deserialize_encoded_text_ast(SpanReader& reader, encoded_tag_t encoded_tag)
+        -> ystdlib::error_handling::Result<EncodedTextAst<encoded_variable_t>> {
+    return generic_deserialize_encoded_text_ast<encoded_variable_t>(reader, encoded_tag);
+}
+
 IRErrorCode get_encoding_type(ReaderInterface& reader, bool& is_four_bytes_encoding) {
     char buffer[cProtocol::MagicNumberLength];
     auto error_code = reader.try_read_exact_length(buffer, cProtocol::MagicNumberLength);
@@ -608,6 +773,13 @@ IRErrorCode deserialize_tag(ReaderInterface& reader, encoded_tag_t& tag) {
     return IRErrorCode_Success;
 }
 
+IRErrorCode deserialize_tag(SpanReader& reader, encoded_tag_t& tag) {
+    if (ErrorCode_Success != reader.try_read_numeric_value(tag)) {
+        return IRErrorCode_Incomplete_IR;
+    }
+    return IRErrorCode_Success;
+}
+
 auto deserialize_tag(ReaderInterface& reader) -> ystdlib::error_handling::Result<encoded_tag_t> {
     encoded_tag_t tag{};
     if (ErrorCode_Success != reader.try_read_numeric_value(tag)) {
@@ -616,6 +788,14 @@ auto deserialize_tag(ReaderInterface& reader) -> ystdlib::error_handling::Result
     return tag;
 }
 
+auto deserialize_tag(SpanReader& reader) -> ystdlib::error_handling::Result<encoded_tag_t> {
+    encoded_tag_t tag{};
+    if (ErrorCode_Success != reader.try_read_numeric_value(tag)) {
+        return IrDeserializationError{IrDeserializationErrorEnum::IncompleteStream};
+    }
+    return tag;
+}
+
 template <ir::EncodedVariableTypeReq encoded_variable_t>
 auto deserialize_timestamp_or_timestamp_delta(ReaderInterface& reader, encoded_tag_t encoded_tag)
         -> ystdlib::error_handling::Result<epoch_time_ms_t> {
@@ -757,21 +937,31 @@ auto validate_protocol_version(std::string_view protocol_version) -> IRProtocolE
 }
 
 IRErrorCode deserialize_utc_offset_change(ReaderInterface& reader, UtcOffset& utc_offset) {
-    int64_t serialized_utc_offset{};
-    if (false == deserialize_int(reader, serialized_utc_offset)) {
+    auto const result{generic_deserialize_utc_offset_change(reader)};
+    if (result.has_error()) {
         return IRErrorCode_Incomplete_IR;
     }
-    utc_offset = UtcOffset{serialized_utc_offset};
+    utc_offset = result.value();
+    return IRErrorCode_Success;
+}
+
+IRErrorCode deserialize_utc_offset_change(SpanReader& reader, UtcOffset& utc_offset) {
+    auto const result{generic_deserialize_utc_offset_change(reader)};
+    if (result.has_error()) {
+        return IRErrorCode_Incomplete_IR;
+    }
+    utc_offset = result.value();
     return IRErrorCode_Success;
 }
 
 auto deserialize_utc_offset_change(ReaderInterface& reader)
         -> ystdlib::error_handling::Result<UtcOffset> {
-    int64_t serialized_utc_offset{};
-    if (false == deserialize_int(reader, serialized_utc_offset)) {
-        return IrDeserializationError{IrDeserializationErrorEnum::IncompleteStream};
-    }
-    return UtcOffset{serialized_utc_offset};
+    return generic_deserialize_utc_offset_change(reader);
+}
+
+auto deserialize_utc_offset_change(SpanReader& reader)
+        -> ystdlib::error_handling::Result<UtcOffset> {
+    return generic_deserialize_utc_offset_change(reader);
 }
 
 namespace four_byte_encoding {
@@ -781,7 +971,7 @@ IRErrorCode deserialize_log_event(
         string& message,
         epoch_time_ms_t& timestamp_delta
 ) {
-    return generic_deserialize_log_event<four_byte_encoded_variable_t>(
+    return deserialize_and_decode_log_event<four_byte_encoded_variable_t>(
             reader,
             encoded_tag,
             message,
@@ -797,7 +987,7 @@ IRErrorCode deserialize_log_event(
         string& message,
         epoch_time_ms_t& timestamp
 ) {
-    return generic_deserialize_log_event<eight_byte_encoded_variable_t>(
+    return deserialize_and_decode_log_event<eight_byte_encoded_variable_t>(
             reader,
             encoded_tag,
             message,
@@ -825,6 +1015,24 @@ template auto deserialize_log_event<eight_byte_encoded_variable_t>(
         epoch_time_ms_t& timestamp_or_timestamp_delta
 ) -> IRErrorCode;
 
+template auto deserialize_log_event<four_byte_encoded_variable_t>(
+        SpanReader& reader,
+        encoded_tag_t encoded_tag,
+        string& logtype,
+        vector<four_byte_encoded_variable_t>& encoded_vars,
+        vector<string>& dict_vars,
+        epoch_time_ms_t& timestamp_or_timestamp_delta
+) -> IRErrorCode;
+
+template auto deserialize_log_event<eight_byte_encoded_variable_t>(
+        SpanReader& reader,
+        encoded_tag_t encoded_tag,
+        string& logtype,
+        vector<eight_byte_encoded_variable_t>& encoded_vars,
+        vector<string>& dict_vars,
+        epoch_time_ms_t& timestamp_or_timestamp_delta
+) -> IRErrorCode;
+
 template auto deserialize_encoded_text_ast<four_byte_encoded_variable_t>(
         ReaderInterface& reader,
         encoded_tag_t encoded_tag,
@@ -851,6 +1059,16 @@ template auto deserialize_encoded_text_ast<eight_byte_encoded_variable_t>(
         encoded_tag_t encoded_tag
 ) -> ystdlib::error_handling::Result<EncodedTextAst<eight_byte_encoded_variable_t>>;
 
+template auto deserialize_encoded_text_ast<four_byte_encoded_variable_t>(
+        SpanReader& reader,
+        encoded_tag_t encoded_tag
+) -> ystdlib::error_handling::Result<EncodedTextAst<four_byte_encoded_variable_t>>;
+
+template auto deserialize_encoded_text_ast<eight_byte_encoded_variable_t>(
+        SpanReader& reader,
+        encoded_tag_t encoded_tag
+) -> ystdlib::error_handling::Result<EncodedTextAst<eight_byte_encoded_variable_t>>;
+
 template auto deserialize_timestamp_or_timestamp_delta<four_byte_encoded_variable_t>(
         ReaderInterface& reader,
         encoded_tag_t encoded_tag
@@ -12,6 +12,7 @@
 #include "../../time_types.hpp"
 #include "../EncodedTextAst.hpp"
 #include "../encoding_methods.hpp"
+#include "SpanReader.hpp"
 
 namespace clp::ffi::ir_stream {
 using encoded_tag_t = int8_t;
@@ -85,6 +86,14 @@ IRErrorCode get_encoding_type(ReaderInterface& reader, bool& is_four_bytes_encod
  */
 [[nodiscard]] IRErrorCode deserialize_tag(ReaderInterface& reader, encoded_tag_t& tag);
 
+/**
+ * Deserializes the tag for the next packet from a contiguous buffer.
+ * @param reader
+ * @param tag Returns the tag of the next packet.
+ * @return Same as `deserialize_tag(ReaderInterface&, encoded_tag_t&)`.
+ */
+[[nodiscard]] IRErrorCode deserialize_tag(SpanReader& reader, encoded_tag_t& tag);
+
 /**
  * Deserializes the tag for the next packet.
  * @param reader
@@ -96,6 +105,14 @@ IRErrorCode get_encoding_type(ReaderInterface& reader, bool& is_four_bytes_encod
 [[nodiscard]] auto deserialize_tag(ReaderInterface& reader)
         -> ystdlib::error_handling::Result<encoded_tag_t>;
 
+/**
+ * Deserializes the tag for the next packet from a contiguous buffer.
+ * @param reader
+ * @return Same as `deserialize_tag(ReaderInterface&)`.
+ */
+[[nodiscard]] auto deserialize_tag(SpanReader& reader)
+        -> ystdlib::error_handling::Result<encoded_tag_t>;
+
 /**
  * Deserializes a timestamp or a timestamp delta from the given reader.
  * @tparam encoded_variable_t Type of the encoded variable
@@ -138,6 +155,27 @@ auto deserialize_log_event(
         ir::epoch_time_ms_t& timestamp_or_timestamp_delta
 ) -> IRErrorCode;
 
+/**
+ * Deserializes a log event from a contiguous buffer.
+ * @tparam encoded_variable_t
+ * @param reader
+ * @param encoded_tag
+ * @param logtype
+ * @param encoded_vars
+ * @param dict_vars
+ * @param timestamp_or_timestamp_delta
+ * @return Same as `deserialize_log_event(ReaderInterface&, ...)`.
+ */
+template <typename encoded_variable_t>
+auto deserialize_log_event(
+        SpanReader& reader,
+        encoded_tag_t encoded_tag,
+        std::string& logtype,
+        std::vector<encoded_variable_t>& encoded_vars,
+        std::vector<std::string>& dict_vars,
+        ir::epoch_time_ms_t& timestamp_or_timestamp_delta
+) -> IRErrorCode;
+
 /**
  * Deserializes an encoded text AST from the given stream
  * @tparam encoded_variable_t
@@ -175,6 +213,17 @@ template <ir::EncodedVariableTypeReq encoded_variable_t>
 [[nodiscard]] auto deserialize_encoded_text_ast(ReaderInterface& reader, encoded_tag_t encoded_tag)
         -> ystdlib::error_handling::Result<EncodedTextAst<encoded_variable_t>>;
 
+/**
+ * Deserializes an encoded text AST from a contiguous buffer.
+ * @tparam encoded_variable_t
+ * @param reader
+ * @param encoded_tag
+ * @return Same as `deserialize_encoded_text_ast(ReaderInterface&, encoded_tag_t)`.
+ */
+template <ir::EncodedVariableTypeReq encoded_variable_t>
+[[nodiscard]] auto deserialize_encoded_text_ast(SpanReader& reader, encoded_tag_t encoded_tag)
+        -> ystdlib::error_handling::Result<EncodedTextAst<encoded_variable_t>>;
+
 /**
  * Decodes the IR message calls the given methods to handle each component of the message
  * @tparam unescape_logtype Whether to remove the escape characters from the logtype before calling
@@ -275,6 +324,14 @@ IRErrorCode deserialize_preamble(
  */
 IRErrorCode deserialize_utc_offset_change(ReaderInterface& reader, UtcOffset& utc_offset);
 
+/**
+ * Deserializes a UTC offset change packet from a contiguous buffer.
+ * @param reader
+ * @param utc_offset The deserialized UTC offset.
+ * @return Same as `deserialize_utc_offset_change(ReaderInterface&, UtcOffset&)`.
+ */
+IRErrorCode deserialize_utc_offset_change(SpanReader& reader, UtcOffset& utc_offset);
+
 /**
  * Deserializes a UTC offset change packet.
  * @param reader
@@ -286,6 +343,14 @@ IRErrorCode deserialize_utc_offset_change(ReaderInterface& reader, UtcOffset& ut
 [[nodiscard]] auto deserialize_utc_offset_change(ReaderInterface& reader)
         -> ystdlib::error_handling::Result<UtcOffset>;
 
+/**
+ * Deserializes a UTC offset change packet from a contiguous buffer.
+ * @param reader
+ * @return Same as `deserialize_utc_offset_change(ReaderInterface&)`.
+ */
+[[nodiscard]] auto deserialize_utc_offset_change(SpanReader& reader)
+        -> ystdlib::error_handling::Result<UtcOffset>;
+
 /**
  * Validates whether the given protocol version can be supported by the current build.
  * @param protocol_version
@@ -4,6 +4,7 @@
 #include <cstdint>
 #include <memory>
 #include <optional>
+#include <span>
 #include <string>
 #include <system_error>
 #include <type_traits>
@@ -24,6 +25,7 @@
 #include "IrDeserializationError.hpp"
 #include "IrUnitType.hpp"
 #include "protocol_constants.hpp"
+#include "SpanReader.hpp"
 #include "utils.hpp"
 
 namespace clp::ffi::ir_stream {
@@ -45,6 +47,7 @@ using Schema = std::vector<SchemaTree::Node::id_t>;
 
 /**
  * Deserializes the parent ID of a schema tree node.
+ * @tparam ReaderType
  * @param reader
  * @return A result containing a pair or an error code indicating the failure:
  * - The pair:
@@ -54,23 +57,27 @@ using Schema = std::vector<SchemaTree::Node::id_t>;
  *   - Forwards `deserialize_tag`'s return values on failure.
  *   - Forwards `deserialize_and_decode_schema_tree_node_id`'s return values on failure.
  */
-[[nodiscard]] auto deserialize_schema_tree_node_parent_id(ReaderInterface& reader)
+template <IrReaderReq ReaderType>
+[[nodiscard]] auto deserialize_schema_tree_node_parent_id(ReaderType& reader)
         -> ystdlib::error_handling::Result<std::pair<bool, SchemaTree::Node::id_t>>;
 
 /**
  * Deserializes the key name of a schema tree node.
+ * @tparam ReaderType
  * @param reader
  * @param key_name Returns the deserialized key name.
  * @return A void result on success, or an error code indicating the failure:
  * - Forwards `deserialize_tag`'s return values on failure.
  * - Forwards `deserialize_string`'s return values on failure.
  */
+template <IrReaderReq ReaderType>
 [[nodiscard]] auto
-deserialize_schema_tree_node_key_name(ReaderInterface& reader, std::string& key_name)
+deserialize_schema_tree_node_key_name(ReaderType& reader, std::string& key_name)
         -> ystdlib::error_handling::Result<void>;
 
 /**
  * Deserializes an integer value packet.
+ * @tparam ReaderType
  * @param reader
  * @param tag
  * @param val Returns the deserialized value.
@@ -80,11 +87,13 @@ deserialize_schema_tree_node_key_name(ReaderInterface& reader, std::string& key_
  *   packet.
  * - Forwards `deserialize_int`'s return values on failure.
  */
-[[nodiscard]] auto deserialize_int_val(ReaderInterface& reader, encoded_tag_t tag)
+template <IrReaderReq ReaderType>
+[[nodiscard]] auto deserialize_int_val(ReaderType& reader, encoded_tag_t tag)
         -> ystdlib::error_handling::Result<value_int_t>;
 
 /**
  * Deserializes a string packet.
+ * @tparam ReaderType
  * @param reader
  * @param tag
  * @param deserialized_str Returns the deserialized string.
@@ -93,13 +102,15 @@ deserialize_schema_tree_node_key_name(ReaderInterface& reader, std::string& key_
  * - IrDeserializationErrorEnum::InvalidTag if the given tag doesn't correspond to a string packet.
  * - Forwards `deserialize_int`'s return values on failure.
  */
+template <IrReaderReq ReaderType>
 [[nodiscard]] auto
-deserialize_string(ReaderInterface& reader, encoded_tag_t tag, std::string& deserialized_str)
+deserialize_string(ReaderType& reader, encoded_tag_t tag, std::string& deserialized_str)
         -> ystdlib::error_handling::Result<void>;
 
 /**
  * Deserializes the auto-generated node-ID-value pairs and the IDs of all user-generated keys in a
  * log event.
+ * @tparam ReaderType
  * @param reader
  * @param tag Takes the current tag as input and returns the last tag read.
  * @return A result containing a pair or an error code indicating the failure:
@@ -112,13 +123,15 @@ deserialize_string(ReaderInterface& reader, encoded_tag_t tag, std::string& dese
  *   - Forwards `deserialize_tag`'s return values on failure.
  *   - Forwards `deserialize_and_decode_schema_tree_node_id`'s return values on failure.
  */
+template <IrReaderReq ReaderType>
 [[nodiscard]] auto deserialize_auto_gen_node_id_value_pairs_and_user_gen_schema(
-        ReaderInterface& reader,
+        ReaderType& reader,
         encoded_tag_t& tag
 ) -> ystdlib::error_handling::Result<std::pair<KeyValuePairLogEvent::NodeIdValuePairs, Schema>>;
 
 /**
  * Deserializes the next value and pushes the result into `node_id_value_pairs`.
+ * @tparam ReaderType
  * @param reader
  * @param tag
  * @param node_id The node ID that corresponds to the value.
@@ -133,8 +146,9 @@ deserialize_string(ReaderInterface& reader, encoded_tag_t tag, std::string& dese
  * - Forwards `deserialize_int_val`'s return values on failure.
  * - Forwards `deserialize_string`'s return values on failure.
  */
+template <IrReaderReq ReaderType>
 [[nodiscard]] auto deserialize_value_and_insert_to_node_id_value_pairs(
-        ReaderInterface& reader,
+        ReaderType& reader,
         encoded_tag_t tag,
         SchemaTree::Node::id_t node_id,
         KeyValuePairLogEvent::NodeIdValuePairs& node_id_value_pairs
@@ -143,6 +157,7 @@ deserialize_string(ReaderInterface& reader, encoded_tag_t tag, std::string& dese
 /**
  * Deserializes an encoded text AST and pushes the result into node_id_value_pairs.
  * @tparam encoded_variable_t
+ * @tparam ReaderType
  * @param reader
  * @param node_id The node ID that corresponds to the value.
  * @param node_id_value_pairs Returns the ID-value pair constructed by the deserialized encoded text
@@ -151,9 +166,9 @@ deserialize_string(ReaderInterface& reader, encoded_tag_t tag, std::string& dese
  * - Forwards `deserialize_tag`'s return values on failure.
  * - Forwards `deserialize_encoded_text_ast`'s return values on failure.
  */
-template <ir::EncodedVariableTypeReq encoded_variable_t>
+template <ir::EncodedVariableTypeReq encoded_variable_t, IrReaderReq ReaderType>
 [[nodiscard]] auto deserialize_encoded_text_ast_and_insert_to_node_id_value_pairs(
-        ReaderInterface& reader,
+        ReaderType& reader,
         SchemaTree::Node::id_t node_id,
         KeyValuePairLogEvent::NodeIdValuePairs& node_id_value_pairs
 ) -> ystdlib::error_handling::Result<void>;
@@ -161,6 +176,7 @@ template <ir::EncodedVariableTypeReq encoded_variable_t>
 /**
  * Deserializes values and constructs ID-value pairs according to the given schema. The number of
  * values to deserialize is indicated by the size of the given schema.
+ * @tparam ReaderType
  * @param reader
  * @param tag
  * @param schema The log event's schema.
@@ -170,13 +186,134 @@ template <ir::EncodedVariableTypeReq encoded_variable_t>
  * - Forwards `deserialize_tag`'s return values on failure.
  * - Forwards `deserialize_value_and_insert_to_node_id_value_pairs`'s return values on failure.
  */
+template <IrReaderReq ReaderType>
 [[nodiscard]] auto deserialize_value_and_construct_node_id_value_pairs(
-        ReaderInterface& reader,
+        ReaderType& reader,
         encoded_tag_t tag,
         Schema const& schema,
         KeyValuePairLogEvent::NodeIdValuePairs& node_id_value_pairs
 ) -> ystdlib::error_handling::Result<void>;
 
+/**
+ * Reads the given number of bytes and appends them to the given buffer.
+ * @tparam ReaderType
+ * @param reader
+ * @param num_bytes
+ * @param buffer
+ * @return A void result on success, or an error code indicating the failure:
+ * - IrDeserializationErrorEnum::IncompleteStream if the stream is truncated.
+ */
+template <IrReaderReq ReaderType>
+[[nodiscard]] auto
+read_and_append_bytes(ReaderType& reader, size_t num_bytes, std::string& buffer)
+        -> ystdlib::error_handling::Result<void>;
+
+/**
+ * Reads a length-prefixed byte sequence (e.g., a string packet's payload) and appends it, including
+ * its length, to the given buffer.
+ * @tparam length_t The type of the length prefix.
+ * @tparam ReaderType
+ * @param reader
+ * @param buffer
+ * @return A void result on success, or an error code indicating the failure:
+ * - Forwards `read_and_append_bytes`'s return values on failure.
+ * - Forwards `deserialize_int`'s return values on failure.
+ */
+template <IntegerType length_t, IrReaderReq ReaderType>
+[[nodiscard]] auto
+read_and_append_length_prefixed_bytes(ReaderType& reader, std::string& buffer)
+        -> ystdlib::error_handling::Result<void>;
+
+/**
+ * Reads an encoded text AST and appends its serialized bytes, including the tags of its
+ * components, to the given buffer.
+ * @tparam encoded_variable_t
+ * @tparam ReaderType
+ * @param reader
+ * @param buffer
+ * @return A void result on success, or an error code indicating the failure:
+ * - IrDeserializationErrorEnum::InvalidTag if a tag doesn't correspond to a variable or a logtype.
+ * - Forwards `deserialize_tag`'s return values on failure.
+ * - Forwards `read_and_append_bytes`'s return values on failure.
+ * - Forwards `read_and_append_length_prefixed_bytes`'s return values on failure.
+ */
+template <ir::EncodedVariableTypeReq encoded_variable_t, IrReaderReq ReaderType>
+[[nodiscard]] auto read_and_append_encoded_text_ast(ReaderType& reader, std::string& buffer)
+        -> ystdlib::error_handling::Result<void>;
+
+/**
+ * Reads the next value without decoding it and appends it to the given raw log event.
+ * @tparam ReaderType
+ * @param reader
+ * @param tag
+ * @param is_auto_generated Whether the value belongs to an auto-generated key.
+ * @param node_id The node ID that corresponds to the value.
+ * @param raw_log_event
+ * @return A void result on success, or an error code indicating the failure:
+ * - IrDeserializationErrorEnum::UnknownValueType if the tag doesn't correspond to any known value
+ *   type.
+ * - Forwards `read_and_append_bytes`'s return values on failure.
+ * - Forwards `read_and_append_length_prefixed_bytes`'s return values on failure.
+ * - Forwards `read_and_append_encoded_text_ast`'s return values on failure.
+ */
+template <IrReaderReq ReaderType>
+[[nodiscard]] auto read_and_append_raw_value(
+        ReaderType& reader,
+        encoded_tag_t tag,
+        bool is_auto_generated,
+        SchemaTree::Node::id_t node_id,
+        RawKvPairLogEvent& raw_log_event
+) -> ystdlib::error_handling::Result<void>;
+
+/**
+ * Generic implementation of `deserialize_ir_unit_schema_tree_node_insertion` for any reader type.
+ * @tparam ReaderType
+ * @param reader
+ * @param tag
+ * @param key_name
+ * @return Same as `deserialize_ir_unit_schema_tree_node_insertion(ReaderInterface&, ...)`.
+ */
+template <IrReaderReq ReaderType>
+[[nodiscard]] auto generic_deserialize_ir_unit_schema_tree_node_insertion(
+        ReaderType& reader,
+        encoded_tag_t tag,
+        std::string& key_name
+) -> ystdlib::error_handling::Result<std::pair<bool, SchemaTree::NodeLocator>>;
+
+/**
+ * Generic implementation of `deserialize_ir_unit_kv_pair_log_event` for any reader type.
+ * @tparam ReaderType
+ * @param reader
+ * @param tag
+ * @param auto_gen_keys_schema_tree
+ * @param user_gen_keys_schema_tree
+ * @param utc_offset
+ * @return Same as `deserialize_ir_unit_kv_pair_log_event(ReaderInterface&, ...)`.
+ */
+template <IrReaderReq ReaderType>
+[[nodiscard]] auto generic_deserialize_ir_unit_kv_pair_log_event(
+        ReaderType& reader,
+        encoded_tag_t tag,
+        std::shared_ptr<SchemaTree> auto_gen_keys_schema_tree,
+        std::shared_ptr<SchemaTree> user_gen_keys_schema_tree,
+        UtcOffset utc_offset
+) -> ystdlib::error_handling::Result<KeyValuePairLogEvent>;
+
+/**
+ * Generic implementation of `deserialize_ir_unit_raw_kv_pair_log_event` for any reader type.
+ * @tparam ReaderType
+ * @param reader
+ * @param tag
+ * @param raw_log_event
+ * @return Same as `deserialize_ir_unit_raw_kv_pair_log_event(ReaderInterface&, ...)`.
+ */
+template <IrReaderReq ReaderType>
+[[nodiscard]] auto generic_deserialize_ir_unit_raw_kv_pair_log_event(
+        ReaderType& reader,
+        encoded_tag_t tag,
+        RawKvPairLogEvent& raw_log_event
+) -> ystdlib::error_handling::Result<void>;
+
 /**
  * @param tag
  * @return Whether the given tag can be a valid leading tag of a log event IR unit.
@@ -209,7 +346,8 @@ auto schema_tree_node_tag_to_type(encoded_tag_t tag)
     }
 }
 
-auto deserialize_schema_tree_node_parent_id(ReaderInterface& reader)
+template <IrReaderReq ReaderType>
+auto deserialize_schema_tree_node_parent_id(ReaderType& reader)
         -> ystdlib::error_handling::Result<std::pair<bool, SchemaTree::Node::id_t>> {
     auto const tag{YSTDLIB_ERROR_HANDLING_TRYX(deserialize_tag(reader))};
     return deserialize_and_decode_schema_tree_node_id<
@@ -219,7 +357,8 @@ auto deserialize_schema_tree_node_parent_id(ReaderInterface& reader)
     >(tag, reader);
 }
 
-auto deserialize_schema_tree_node_key_name(ReaderInterface& reader, std::string& key_name)
+template <IrReaderReq ReaderType>
+auto deserialize_schema_tree_node_key_name(ReaderType& reader, std::string& key_name)
         -> ystdlib::error_handling::Result<void> {
     return deserialize_string(
             reader,
@@ -228,7 +367,8 @@ auto deserialize_schema_tree_node_key_name(ReaderInterface& reader, std::string&
     );
 }
 
-auto deserialize_int_val(ReaderInterface& reader, encoded_tag_t tag)
+template <IrReaderReq ReaderType>
+auto deserialize_int_val(ReaderType& reader, encoded_tag_t tag)
         -> ystdlib::error_handling::Result<value_int_t> {
     switch (tag) {
         case cProtocol::Payload::ValueInt8:
@@ -244,7 +384,8 @@ auto deserialize_int_val(ReaderInterface& reader, encoded_tag_t tag)
     }
 }
 
-auto deserialize_string(ReaderInterface& reader, encoded_tag_t tag, std::string& deserialized_str)
+template <IrReaderReq ReaderType>
+auto deserialize_string(ReaderType& reader, encoded_tag_t tag, std::string& deserialized_str)
         -> ystdlib::error_handling::Result<void> {
     size_t str_length{};
     if (cProtocol::Payload::StrLenUByte == tag) {
@@ -268,8 +409,9 @@ auto deserialize_string(ReaderInterface& reader, encoded_tag_t tag, std::string&
     return ystdlib::error_handling::success();
 }
 
+template <IrReaderReq ReaderType>
 auto deserialize_auto_gen_node_id_value_pairs_and_user_gen_schema(
-        ReaderInterface& reader,
+        ReaderType& reader,
         encoded_tag_t& tag
 ) -> ystdlib::error_handling::Result<std::pair<KeyValuePairLogEvent::NodeIdValuePairs, Schema>> {
     KeyValuePairLogEvent::NodeIdValuePairs auto_gen_node_id_value_pairs;
@@ -333,8 +475,9 @@ auto deserialize_auto_gen_node_id_value_pairs_and_user_gen_schema(
     return {std::move(auto_gen_node_id_value_pairs), std::move(user_gen_schema)};
 }
 
+template <IrReaderReq ReaderType>
 auto deserialize_value_and_insert_to_node_id_value_pairs(
-        ReaderInterface& reader,
+        ReaderType& reader,
         encoded_tag_t tag,
         SchemaTree::Node::id_t node_id,
         KeyValuePairLogEvent::NodeIdValuePairs& node_id_value_pairs
@@ -399,9 +542,9 @@ auto deserialize_value_and_insert_to_node_id_value_pairs(
     return ystdlib::error_handling::success();
 }
 
-template <ir::EncodedVariableTypeReq encoded_variable_t>
+template <ir::EncodedVariableTypeReq encoded_variable_t, IrReaderReq ReaderType>
 [[nodiscard]] auto deserialize_encoded_text_ast_and_insert_to_node_id_value_pairs(
-        ReaderInterface& reader,
+        ReaderType& reader,
         SchemaTree::Node::id_t node_id,
         KeyValuePairLogEvent::NodeIdValuePairs& node_id_value_pairs
 ) -> ystdlib::error_handling::Result<void> {
@@ -415,8 +558,9 @@ template <ir::EncodedVariableTypeReq encoded_variable_t>
     return ystdlib::error_handling::success();
 }
 
+template <IrReaderReq ReaderType>
 auto deserialize_value_and_construct_node_id_value_pairs(
-        ReaderInterface& reader,
+        ReaderType& reader,
         encoded_tag_t tag,
         Schema const& schema,
         KeyValuePairLogEvent::NodeIdValuePairs& node_id_value_pairs
@@ -443,6 +587,164 @@ auto deserialize_value_and_construct_node_id_value_pairs(
     return ystdlib::error_handling::success();
 }
 
+template <IrReaderReq ReaderType>
+auto read_and_append_bytes(ReaderType& reader, size_t num_bytes, std::string& buffer)
+        -> ystdlib::error_handling::Result<void> {
+    auto const begin_pos{buffer.size()};
+    buffer.resize(begin_pos + num_bytes);
+    if (clp::ErrorCode_Success
+        != reader.try_read_exact_length(buffer.data() + begin_pos, num_bytes))
+    {
+        return IrDeserializationError{IrDeserializationErrorEnum::IncompleteStream};
+    }
+    return ystdlib::error_handling::success();
+}
+
+template <IntegerType length_t, IrReaderReq ReaderType>
+auto read_and_append_length_prefixed_bytes(ReaderType& reader, std::string& buffer)
+        -> ystdlib::error_handling::Result<void> {
+    auto const length_pos{buffer.size()};
+    YSTDLIB_ERROR_HANDLING_TRYV(read_and_append_bytes(reader, sizeof(length_t), buffer));
+
+    // Lengths are never negative, so they're decoded as unsigned to bound the read size.
+    SpanReader length_reader{std::span{buffer}.subspan(length_pos, sizeof(length_t))};
+    auto const length{YSTDLIB_ERROR_HANDLING_TRYX(
+            deserialize_int<std::make_unsigned_t<length_t>>(length_reader)
+    )};
+    return read_and_append_bytes(reader, static_cast<size_t>(length), buffer);
+}
+
+template <ir::EncodedVariableTypeReq encoded_variable_t, IrReaderReq ReaderType>
+auto read_and_append_encoded_text_ast(ReaderType& reader, std::string& buffer)
+        -> ystdlib::error_handling::Result<void> {
+    constexpr encoded_tag_t cEncodedVarTag{
+            std::is_same_v<encoded_variable_t, ir::eight_byte_encoded_variable_t>
+                    ? cProtocol::Payload::VarEightByteEncoding
+                    : cProtocol::Payload::VarFourByteEncoding
+    };
+
+    // Variables are followed by the logtype, which terminates the encoded text AST.
+    while (true) {
+        auto const tag{YSTDLIB_ERROR_HANDLING_TRYX(deserialize_tag(reader))};
+        buffer.push_back(static_cast<char>(tag));
+        switch (tag) {
+            case cEncodedVarTag: {
+                YSTDLIB_ERROR_HANDLING_TRYV(
+                        read_and_append_bytes(reader, sizeof(encoded_variable_t), buffer)
+                );
+                break;
+            }
+            case cProtocol::Payload::VarStrLenUByte: {
+                YSTDLIB_ERROR_HANDLING_TRYV(
+                        read_and_append_length_prefixed_bytes<uint8_t>(reader, buffer)
+                );
+                break;
+            }
+            case cProtocol::Payload::VarStrLenUShort: {
+                YSTDLIB_ERROR_HANDLING_TRYV(
+                        read_and_append_length_prefixed_bytes<uint16_t>(reader, buffer)
+                );
+                break;
+            }
+            case cProtocol::Payload::VarStrLenInt: {
+                YSTDLIB_ERROR_HANDLING_TRYV(
+                        read_and_append_length_prefixed_bytes<int32_t>(reader, buffer)
+                );
+                break;
+            }
+            case cProtocol::Payload::LogtypeStrLenUByte:
+                return read_and_append_length_prefixed_bytes<uint8_t>(reader, buffer);
+            case cProtocol::Payload::LogtypeStrLenUShort:
+                return read_and_append_length_prefixed_bytes<uint16_t>(reader, buffer);
+            case cProtocol::Payload::LogtypeStrLenInt:
+                return read_and_append_length_prefixed_bytes<int32_t>(reader, buffer);
+            default:
+                return IrDeserializationError{IrDeserializationErrorEnum::InvalidTag};
+        }
+    }
+}
+
+template <IrReaderReq ReaderType>
+auto read_and_append_raw_value(
+        ReaderType& reader,
+        encoded_tag_t tag,
+        bool is_auto_generated,
+        SchemaTree::Node::id_t node_id,
+        RawKvPairLogEvent& raw_log_event
+) -> ystdlib::error_handling::Result<void> {
+    auto& buffer{raw_log_event.buffer};
+    auto const begin_pos{buffer.size()};
+    switch (tag) {
+        case cProtocol::Payload::ValueInt8: {
+            YSTDLIB_ERROR_HANDLING_TRYV(read_and_append_bytes(reader, sizeof(int8_t), buffer));
+            break;
+        }
+        case cProtocol::Payload::ValueInt16: {
+            YSTDLIB_ERROR_HANDLING_TRYV(read_and_append_bytes(reader, sizeof(int16_t), buffer));
+            break;
+        }
+        case cProtocol::Payload::ValueInt32: {
+            YSTDLIB_ERROR_HANDLING_TRYV(read_and_append_bytes(reader, sizeof(int32_t), buffer));
+            break;
+        }
+        case cProtocol::Payload::ValueInt64: {
+            YSTDLIB_ERROR_HANDLING_TRYV(read_and_append_bytes(reader, sizeof(int64_t), buffer));
+            break;
+        }
+        case cProtocol::Payload::ValueFloat: {
+            YSTDLIB_ERROR_HANDLING_TRYV(read_and_append_bytes(reader, sizeof(uint64_t), buffer));
+            break;
+        }
+        case cProtocol::Payload::ValueTrue:
+        case cProtocol::Payload::ValueFalse:
+        case cProtocol::Payload::ValueNull:
+        case cProtocol::Payload::ValueEmpty:
+            break;
+        case cProtocol::Payload::StrLenUByte: {
+            YSTDLIB_ERROR_HANDLING_TRYV(
+                    read_and_append_length_prefixed_bytes<uint8_t>(reader, buffer)
+            );
+            break;
+        }
+        case cProtocol::Payload::StrLenUShort: {
+            YSTDLIB_ERROR_HANDLING_TRYV(
+                    read_and_append_length_prefixed_bytes<uint16_t>(reader, buffer)
+            );
+            break;
+        }
+        case cProtocol::Payload::StrLenUInt: {
+            YSTDLIB_ERROR_HANDLING_TRYV(
+                    read_and_append_length_prefixed_bytes<uint32_t>(reader, buffer)
+            );
+            break;
+        }
+        case cProtocol::Payload::ValueEightByteEncodingClpStr: {
+            YSTDLIB_ERROR_HANDLING_TRYV(
+                    read_and_append_encoded_text_ast<ir::eight_byte_encoded_variable_t>(
+                            reader,
+                            buffer
+                    )
+            );
+            break;
+        }
+        case cProtocol::Payload::ValueFourByteEncodingClpStr: {
+            YSTDLIB_ERROR_HANDLING_TRYV(
+                    read_and_append_encoded_text_ast<ir::four_byte_encoded_variable_t>(
+                            reader,
+                            buffer
+                    )
+            );
+            break;
+        }
+        default:
+            return IrDeserializationError{IrDeserializationErrorEnum::UnknownValueType};
+    }
+    raw_log_event.values.push_back(
+            RawKvPairLogEvent::RawValue{is_auto_generated, node_id, tag, begin_pos, buffer.size()}
+    );
+    return ystdlib::error_handling::success();
+}
+
 auto is_log_event_ir_unit_tag(encoded_tag_t tag) -> bool {
     if (cProtocol::Payload::ValueEmpty == tag) {
         // The log event is an empty object
@@ -466,6 +768,131 @@ auto is_encoded_key_id_tag(encoded_tag_t tag) -> bool {
            || cProtocol::Payload::EncodedSchemaTreeNodeIdShort == tag
            || cProtocol::Payload::EncodedSchemaTreeNodeIdInt == tag;
 }
+
+template <IrReaderReq ReaderType>
+auto generic_deserialize_ir_unit_schema_tree_node_insertion(
+        ReaderType& reader,
+        encoded_tag_t tag,
+        std::string& key_name
+) -> ystdlib::error_handling::Result<std::pair<bool, SchemaTree::NodeLocator>> {
+    auto const type{YSTDLIB_ERROR_HANDLING_TRYX(schema_tree_node_tag_to_type(tag))};
+    auto const parent_node_id_result{deserialize_schema_tree_node_parent_id(reader)};
+    if (parent_node_id_result.has_error()) {
+        return parent_node_id_result.error();
+    }
+    auto const [is_auto_generated, parent_id]{parent_node_id_result.value()};
+    YSTDLIB_ERROR_HANDLING_TRYV(deserialize_schema_tree_node_key_name(reader, key_name));
+
+    return {is_auto_generated, SchemaTree::NodeLocator{parent_id, key_name, type}};
+}
+
+template <IrReaderReq ReaderType>
+auto generic_deserialize_ir_unit_kv_pair_log_event(
+        ReaderType& reader,
+        encoded_tag_t tag,
+        std::shared_ptr<SchemaTree> auto_gen_keys_schema_tree,
+        std::shared_ptr<SchemaTree> user_gen_keys_schema_tree,
+        UtcOffset utc_offset
+) -> ystdlib::error_handling::Result<KeyValuePairLogEvent> {
+    auto auto_gen_node_id_value_pairs_and_user_gen_schema_result{
+            deserialize_auto_gen_node_id_value_pairs_and_user_gen_schema(reader, tag)
+    };
+    if (auto_gen_node_id_value_pairs_and_user_gen_schema_result.has_error()) {
+        return auto_gen_node_id_value_pairs_and_user_gen_schema_result.error();
+    }
+    auto& [auto_gen_node_id_value_pairs,
+           user_gen_schema]{auto_gen_node_id_value_pairs_and_user_gen_schema_result.value()};
+
+    KeyValuePairLogEvent::NodeIdValuePairs user_gen_node_id_value_pairs;
+    if (false == user_gen_schema.empty()) {
+        YSTDLIB_ERROR_HANDLING_TRYV(deserialize_value_and_construct_node_id_value_pairs(
+                reader,
+                tag,
+                user_gen_schema,
+                user_gen_node_id_value_pairs
+        ));
+    } else {
+        if (cProtocol::Payload::ValueEmpty != tag) {
+            return IrDeserializationError{IrDeserializationErrorEnum::InvalidTag};
+        }
+    }
+
+    return KeyValuePairLogEvent::create(
+            std::move(auto_gen_keys_schema_tree),
+            std::move(user_gen_keys_schema_tree),
+            std::move(auto_gen_node_id_value_pairs),
+            std::move(user_gen_node_id_value_pairs),
+            utc_offset
+    );
+}
+
+template <IrReaderReq ReaderType>
+auto generic_deserialize_ir_unit_raw_kv_pair_log_event(
+        ReaderType& reader,
+        encoded_tag_t tag,
+        RawKvPairLogEvent& raw_log_event
+) -> ystdlib::error_handling::Result<void> {
+    raw_log_event.clear();
+    auto& user_gen_schema{raw_log_event.user_gen_schema};
+
+    // Read pairs of auto-generated node IDs and values
+    while (is_encoded_key_id_tag(tag)) {
+        auto const schema_tree_node_id_result{deserialize_and_decode_schema_tree_node_id<
+                cProtocol::Payload::EncodedSchemaTreeNodeIdByte,
+                cProtocol::Payload::EncodedSchemaTreeNodeIdShort,
+                cProtocol::Payload::EncodedSchemaTreeNodeIdInt
+        >(tag, reader)};
+        if (schema_tree_node_id_result.has_error()) {
+            return schema_tree_node_id_result.error();
+        }
+        auto const [is_auto_generated, node_id]{schema_tree_node_id_result.value()};
+        tag = YSTDLIB_ERROR_HANDLING_TRYX(deserialize_tag(reader));
+        if (false == is_auto_generated) {
+            user_gen_schema.push_back(node_id);
+            break;
+        }
+        YSTDLIB_ERROR_HANDLING_TRYV(
+                read_and_append_raw_value(reader, tag, true, node_id, raw_log_event)
+        );
+        tag = YSTDLIB_ERROR_HANDLING_TRYX(deserialize_tag(reader));
+    }
+
+    // Read any remaining user-generated node IDs
+    while (is_encoded_key_id_tag(tag)) {
+        auto const schema_tree_node_id_result{deserialize_and_decode_schema_tree_node_id<
+                cProtocol::Payload::EncodedSchemaTreeNodeIdByte,
+                cProtocol::Payload::EncodedSchemaTreeNodeIdShort,
+                cProtocol::Payload::EncodedSchemaTreeNodeIdInt
+        >(tag, reader)};
+        if (schema_tree_node_id_result.has_error()) {
+            return schema_tree_node_id_result.error();
+        }
+        auto const [is_auto_generated, node_id]{schema_tree_node_id_result.value()};
+        if (is_auto_generated) {
+            return IrDeserializationError{IrDeserializationErrorEnum::InvalidKeyGroupOrdering};
+        }
+        user_gen_schema.push_back(node_id);
+        tag = YSTDLIB_ERROR_HANDLING_TRYX(deserialize_tag(reader));
+    }
+
+    if (user_gen_schema.empty()) {
+        if (cProtocol::Payload::ValueEmpty != tag) {
+            return IrDeserializationError{IrDeserializationErrorEnum::InvalidTag};
+        }
+        return ystdlib::error_handling::success();
+    }
+
+    // Read the user-generated values, which follow the user-generated node IDs
+    for (size_t i{0}; i < user_gen_schema.size(); ++i) {
+        if (0 != i) {
+            tag = YSTDLIB_ERROR_HANDLING_TRYX(deserialize_tag(reader));
+        }
+        YSTDLIB_ERROR_HANDLING_TRYV(
+                read_and_append_raw_value(reader, tag, false, user_gen_schema[i], raw_log_event)
+        );
+    }
+    return ystdlib::error_handling::success();
+}
 }  // namespace
 
 auto get_ir_unit_type_from_tag(encoded_tag_t tag) -> std::optional<IrUnitType> {
@@ -494,15 +921,15 @@ auto deserialize_ir_unit_schema_tree_node_insertion(
         encoded_tag_t tag,
         std::string& key_name
 ) -> ystdlib::error_handling::Result<std::pair<bool, SchemaTree::NodeLocator>> {
-    auto const type{YSTDLIB_ERROR_HANDLING_TRYX(schema_tree_node_tag_to_type(tag))};
-    auto const parent_node_id_result{deserialize_schema_tree_node_parent_id(reader)};
-    if (parent_node_id_result.has_error()) {
-        return parent_node_id_result.error();
-    }
-    auto const [is_auto_generated, parent_id]{parent_node_id_result.value()};
-    YSTDLIB_ERROR_HANDLING_TRYV(deserialize_schema_tree_node_key_name(reader, key_name));
+    return generic_deserialize_ir_unit_schema_tree_node_insertion(reader, tag, key_name);
+}
 
-    return {is_auto_generated, SchemaTree::NodeLocator{parent_id, key_name, type}};
+auto deserialize_ir_unit_schema_tree_node_insertion(
+        SpanReader& reader,
+        encoded_tag_t tag,
+        std::string& key_name
+) -> ystdlib::error_handling::Result<std::pair<bool, SchemaTree::NodeLocator>> {
+    return generic_deserialize_ir_unit_schema_tree_node_insertion(reader, tag, key_name);
 }
 
 auto deserialize_ir_unit_kv_pair_log_event(
@@ -512,27 +939,79 @@ auto deserialize_ir_unit_kv_pair_log_event(
         std::shared_ptr<SchemaTree> user_gen_keys_schema_tree,
         UtcOffset utc_offset
 ) -> ystdlib::error_handling::Result<KeyValuePairLogEvent> {
-    auto auto_gen_node_id_value_pairs_and_user_gen_schema_result{
-            deserialize_auto_gen_node_id_value_pairs_and_user_gen_schema(reader, tag)
-    };
-    if (auto_gen_node_id_value_pairs_and_user_gen_schema_result.has_error()) {
-        return auto_gen_node_id_value_pairs_and_user_gen_schema_result.error();
-    }
-    auto& [auto_gen_node_id_value_pairs,
-           user_gen_schema]{auto_gen_node_id_value_pairs_and_user_gen_schema_result.value()};
+    return generic_deserialize_ir_unit_kv_pair_log_event(
+            reader,
+            tag,
+            std::move(auto_gen_keys_schema_tree),
+            std::move(user_gen_keys_schema_tree),
+            utc_offset
+    );
+}
 
+auto deserialize_ir_unit_kv_pair_log_event(
+        SpanReader& reader,
+        encoded_tag_t tag,
+        std::shared_ptr<SchemaTree> auto_gen_keys_schema_tree,
+        std::shared_ptr<SchemaTree> user_gen_keys_schema_tree,
+        UtcOffset utc_offset
+) -> ystdlib::error_handling::Result<KeyValuePairLogEvent> {
+    return generic_deserialize_ir_unit_kv_pair_log_event(
+            reader,
+            tag,
+            std::move(auto_gen_keys_schema_tree),
+            std::move(user_gen_keys_schema_tree),
+            utc_offset
+    );
+}
+
+auto deserialize_ir_unit_raw_kv_pair_log_event(
+        ReaderInterface& reader,
+        encoded_tag_t tag,
+        RawKvPairLogEvent& raw_log_event
+) -> ystdlib::error_handling::Result<void> {
+    return generic_deserialize_ir_unit_raw_kv_pair_log_event(reader, tag, raw_log_event);
+}
+
+auto deserialize_ir_unit_raw_kv_pair_log_event(
+        SpanReader& reader,
+        encoded_tag_t tag,
+        RawKvPairLogEvent& raw_log_event
+) -> ystdlib::error_handling::Result<void> {
+    return generic_deserialize_ir_unit_raw_kv_pair_log_event(reader, tag, raw_log_event);
+}
+
+auto decode_raw_kv_pair_log_event(
+        RawKvPairLogEvent const& raw_log_event,
+        std::shared_ptr<SchemaTree> auto_gen_keys_schema_tree,
+        std::shared_ptr<SchemaTree> user_gen_keys_schema_tree,
+        UtcOffset utc_offset,
+        SchemaTreeNodeValueFilter const& value_filter
+) -> ystdlib::error_handling::Result<KeyValuePairLogEvent> {
+    KeyValuePairLogEvent::NodeIdValuePairs auto_gen_node_id_value_pairs;
     KeyValuePairLogEvent::NodeIdValuePairs user_gen_node_id_value_pairs;
-    if (false == user_gen_schema.empty()) {
-        YSTDLIB_ERROR_HANDLING_TRYV(deserialize_value_and_construct_node_id_value_pairs(
-                reader,
+    for (auto const& [is_auto_generated, node_id, tag, begin_pos, end_pos] : raw_log_event.values)
+    {
+        if (value_filter && false == value_filter(is_auto_generated, node_id)) {
+            continue;
+        }
+
+        auto& node_id_value_pairs{
+                is_auto_generated ? auto_gen_node_id_value_pairs : user_gen_node_id_value_pairs
+        };
+        if (false == is_auto_generated && node_id_value_pairs.contains(node_id)) {
+            // The key should be unique in a schema
+            return IrDeserializationError{IrDeserializationErrorEnum::DuplicateKey};
+        }
+
+        SpanReader value_reader{
+                std::span{raw_log_event.buffer}.subspan(begin_pos, end_pos - begin_pos)
+        };
+        YSTDLIB_ERROR_HANDLING_TRYV(deserialize_value_and_insert_to_node_id_value_pairs(
+                value_reader,
                 tag,
-                user_gen_schema,
-                user_gen_node_id_value_pairs
+                node_id,
+                node_id_value_pairs
         ));
-    } else {
-        if (cProtocol::Payload::ValueEmpty != tag) {
-            return IrDeserializationError{IrDeserializationErrorEnum::InvalidTag};
-        }
     }
 
     return KeyValuePairLogEvent::create(
@@ -1,10 +1,13 @@
 #ifndef CLP_FFI_IR_STREAM_IR_UNIT_DESERIALIZATION_METHODS_HPP
 #define CLP_FFI_IR_STREAM_IR_UNIT_DESERIALIZATION_METHODS_HPP
 
+#include <cstddef>
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include <ystdlib/error_handling/Result.hpp>
 
@@ -14,8 +17,47 @@
 #include "../SchemaTree.hpp"
 #include "decoding_methods.hpp"
 #include "IrUnitType.hpp"
+#include "SpanReader.hpp"
 
 namespace clp::ffi::ir_stream {
+/**
+ * The serialized values of a key-value pair log event IR unit, keyed by their schema-tree node IDs.
+ *
+ * This allows callers to decode only the values they need (e.g., to evaluate a query) and to defer
+ * decoding the rest until they know the log event is needed. An instance is meant to be reused
+ * across log events so that its buffers are only allocated once.
+ */
+struct RawKvPairLogEvent {
+    // Types
+    struct RawValue {
+        bool is_auto_generated;
+        SchemaTree::Node::id_t node_id;
+        encoded_tag_t tag;
+        // The value's serialized bytes (excluding its tag) in `buffer`
+        size_t begin_pos;
+        size_t end_pos;
+    };
+
+    // Methods
+    auto clear() -> void {
+        values.clear();
+        buffer.clear();
+        user_gen_schema.clear();
+    }
+
+    // Variables
+    std::vector<RawValue> values;
+    std::string buffer;
+    // Buffer for the user-generated node IDs, which are serialized before their values
+    std::vector<SchemaTree::Node::id_t> user_gen_schema;
+};
+
+/**
+ * Predicate that decides whether the value of a schema-tree node should be decoded.
+ * Signature: (bool is_auto_generated, SchemaTree::Node::id_t node_id) -> bool
+ */
+using SchemaTreeNodeValueFilter = std::function<bool(bool, SchemaTree::Node::id_t)>;
+
 /**
  * @param tag
  * @return The IR unit type indicated by the given tag on success.
@@ -46,6 +88,19 @@ namespace clp::ffi::ir_stream {
         std::string& key_name
 ) -> ystdlib::error_handling::Result<std::pair<bool, SchemaTree::NodeLocator>>;
 
+/**
+ * Deserializes a schema tree node insertion IR unit from a contiguous buffer.
+ * @param reader
+ * @param tag
+ * @param key_name
+ * @return Same as `deserialize_ir_unit_schema_tree_node_insertion(ReaderInterface&, ...)`.
+ */
+[[nodiscard]] auto deserialize_ir_unit_schema_tree_node_insertion(
+        SpanReader& reader,
+        encoded_tag_t tag,
+        std::string& key_name
+) -> ystdlib::error_handling::Result<std::pair<bool, SchemaTree::NodeLocator>>;
+
 /**
  * Deserializes a key-value pair log event IR unit.
  * @param reader
@@ -70,6 +125,84 @@ namespace clp::ffi::ir_stream {
         std::shared_ptr<SchemaTree> user_gen_keys_schema_tree,
         UtcOffset utc_offset
 ) -> ystdlib::error_handling::Result<KeyValuePairLogEvent>;
+
+/**
+ * Deserializes a key-value pair log event IR unit from a contiguous buffer.
+ * @param reader
+ * @param tag
+ * @param auto_gen_keys_schema_tree
+ * @param user_gen_keys_schema_tree
+ * @param utc_offset
+ * @return Same as `deserialize_ir_unit_kv_pair_log_event(ReaderInterface&, ...)`.
+ */
+[[nodiscard]] auto deserialize_ir_unit_kv_pair_log_event(
+        SpanReader& reader,
+        encoded_tag_t tag,
+        std::shared_ptr<SchemaTree> auto_gen_keys_schema_tree,
+        std::shared_ptr<SchemaTree> user_gen_keys_schema_tree,
+        UtcOffset utc_offset
+) -> ystdlib::error_handling::Result<KeyValuePairLogEvent>;
+
+/**
+ * Deserializes a key-value pair log event IR unit without decoding any of its values.
+ * @param reader
+ * @param tag
+ * @param raw_log_event Returns the log event's node IDs and serialized values. Any existing content
+ * is cleared.
+ * @return A void result on success, or an error code indicating the failure:
+ * - IrDeserializationErrorEnum::IncompleteStream if the IR stream is truncated.
+ * - IrDeserializationErrorEnum::InvalidKeyGroupOrdering if the IR stream contains auto-generated
+ *   key IDs *after* a user-generated key ID has been deserialized.
+ * - IrDeserializationErrorEnum::InvalidTag if the log event is empty but the tag is not
+ *   `cProtocol::Payload::ValueEmpty`, or if an encoded text AST contains an invalid tag.
+ * - IrDeserializationErrorEnum::UnknownValueType if a value's tag doesn't correspond to any known
+ *   value type.
+ * - Forwards `deserialize_tag`'s return values on failure.
+ * - Forwards `deserialize_and_decode_schema_tree_node_id`'s return values on failure.
+ */
+[[nodiscard]] auto deserialize_ir_unit_raw_kv_pair_log_event(
+        ReaderInterface& reader,
+        encoded_tag_t tag,
+        RawKvPairLogEvent& raw_log_event
+) -> ystdlib::error_handling::Result<void>;
+
+/**
+ * Deserializes a key-value pair log event IR unit from a contiguous buffer without decoding any of
+ * its values.
+ * @param reader
+ * @param tag
+ * @param raw_log_event
+ * @return Same as `deserialize_ir_unit_raw_kv_pair_log_event(ReaderInterface&, ...)`.
+ */
+[[nodiscard]] auto deserialize_ir_unit_raw_kv_pair_log_event(
+        SpanReader& reader,
+        encoded_tag_t tag,
+        RawKvPairLogEvent& raw_log_event
+) -> ystdlib::error_handling::Result<void>;
+
+/**
+ * Decodes the values of a raw key-value pair log event and constructs a log event from them.
+ * @param raw_log_event
+ * @param auto_gen_keys_schema_tree Schema tree for auto-generated keys, used to construct the
+ * KV-pair log event.
+ * @param user_gen_keys_schema_tree Schema tree for user-generated keys, used to construct the
+ * KV-pair log event.
+ * @param utc_offset UTC offset used to construct the KV-pair log event.
+ * @param value_filter If set, only values accepted by the filter are decoded, and the constructed
+ * log event only contains their node-ID-value pairs.
+ * @return A result containing the constructed log event or an error code indicating the failure:
+ * - IrDeserializationErrorEnum::DuplicateKey if a user-generated key is duplicated in the log
+ *   event.
+ * - Forwards `deserialize_value_and_insert_to_node_id_value_pairs`'s return values on failure.
+ * - Forwards `KeyValuePairLogEvent::create`'s return values on failure.
+ */
+[[nodiscard]] auto decode_raw_kv_pair_log_event(
+        RawKvPairLogEvent const& raw_log_event,
+        std::shared_ptr<SchemaTree> auto_gen_keys_schema_tree,
+        std::shared_ptr<SchemaTree> user_gen_keys_schema_tree,
+        UtcOffset utc_offset,
+        SchemaTreeNodeValueFilter const& value_filter = {}
+) -> ystdlib::error_handling::Result<KeyValuePairLogEvent>;
 }  // namespace clp::ffi::ir_stream
 
 #endif  // CLP_FFI_IR_STREAM_IR_UNIT_DESERIALIZATION_METHODS_HPP
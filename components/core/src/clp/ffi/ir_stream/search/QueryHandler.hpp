@@ -107,6 +107,18 @@ public:
         return m_query_handler_impl.evaluate_kv_pair_log_event(log_event);
     }
 
+    /**
+     * @param is_auto_generated
+     * @param node_id
+     * @return Whether the value of the given schema-tree node may affect the result of
+     * `evaluate_kv_pair_log_event`, based on the columns resolved so far.
+     */
+    [[nodiscard]] auto
+    is_value_required_for_evaluation(bool is_auto_generated, SchemaTree::Node::id_t node_id) const
+            -> bool {
+        return m_query_handler_impl.is_value_required_for_evaluation(is_auto_generated, node_id);
+    }
+
 private:
     // Constructor
     explicit QueryHandler(
@@ -95,6 +95,13 @@ using clp_s::search::ast::literal_type_bitmask_t;
         QueryHandlerImpl::PartialResolutionMap& user_gen_namespace_partial_resolutions
 ) -> ystdlib::error_handling::Result<void>;
 
+/**
+ * @param query
+ * @return Whether any filter in the given query is on a pure wildcard column (i.e., a column that
+ * can match any key).
+ */
+[[nodiscard]] auto has_pure_wildcard_column(std::shared_ptr<Expression> const& query) -> bool;
+
 /**
  * @param key_namespace
  * @return Whether `key_namespace` is auto-generated or user-generated, or std::nullopt if the
@@ -297,6 +304,34 @@ auto initialize_partial_resolution_from_search_ast(
     return ystdlib::error_handling::success();
 }
 
+auto has_pure_wildcard_column(std::shared_ptr<Expression> const& query) -> bool {
+    if (nullptr == query) {
+        return false;
+    }
+
+    std::vector<Expression*> ast_dfs_stack;
+    ast_dfs_stack.emplace_back(query.get());
+    while (false == ast_dfs_stack.empty()) {
+        auto* expr{ast_dfs_stack.back()};
+        ast_dfs_stack.pop_back();
+        if (expr->has_only_expression_operands()) {
+            for (auto it{expr->op_begin()}; it != expr->op_end(); ++it) {
+                if (auto* child_expr{dynamic_cast<Expression*>(it->get())}; nullptr != child_expr)
+                {
+                    ast_dfs_stack.emplace_back(child_expr);
+                }
+            }
+            continue;
+        }
+
+        auto* filter{dynamic_cast<FilterExpr*>(expr)};
+        if (nullptr != filter && filter->get_column()->is_pure_wildcard()) {
+            return true;
+        }
+    }
+    return false;
+}
+
 auto is_auto_generated(std::string_view key_namespace) -> std::optional<bool> {
     if (clp_s::constants::cAutogenNamespace == key_namespace) {
         return true;
@@ -392,13 +427,15 @@ auto QueryHandlerImpl::create(
                     projected_column_to_original_key_and_index
             ));
 
+    auto const query_has_pure_wildcard_column{has_pure_wildcard_column(query)};
     return QueryHandlerImpl{
             std::move(query),
             std::move(auto_gen_namespace_partial_resolutions),
             std::move(user_gen_namespace_partial_resolutions),
             std::move(projected_columns),
             std::move(projected_column_to_original_key_and_index),
-            case_sensitive_match
+            case_sensitive_match,
+            query_has_pure_wildcard_column
     };
 }
 
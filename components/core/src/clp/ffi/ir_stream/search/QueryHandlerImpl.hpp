@@ -189,6 +189,28 @@ public:
             NewProjectedSchemaTreeNodeCallbackType new_projected_schema_tree_node_callback
     ) -> ystdlib::error_handling::Result<void>;
 
+    /**
+     * @param is_auto_generated
+     * @param node_id
+     * @return Whether the value of the given schema-tree node may affect the result of
+     * `evaluate_kv_pair_log_event`. Values of other nodes can be omitted from the log event being
+     * evaluated without changing the evaluation result.
+     */
+    [[nodiscard]] auto
+    is_value_required_for_evaluation(bool is_auto_generated, SchemaTree::Node::id_t node_id) const
+            -> bool {
+        if (nullptr == m_query || m_is_empty_query) {
+            return false;
+        }
+        if (m_has_pure_wildcard_column) {
+            return true;
+        }
+        auto const& resolved_node_ids{
+                is_auto_generated ? m_auto_gen_resolved_node_ids : m_user_gen_resolved_node_ids
+        };
+        return resolved_node_ids.contains(node_id);
+    }
+
     [[nodiscard]] auto get_resolved_column_to_schema_tree_node_ids() const -> std::unordered_map<
             clp_s::search::ast::ColumnDescriptor*,
             std::unordered_set<SchemaTree::Node::id_t>
@@ -298,12 +320,14 @@ private:
             PartialResolutionMap user_gen_namespace_partial_resolutions,
             std::vector<std::shared_ptr<clp_s::search::ast::ColumnDescriptor>> projected_columns,
             ProjectionMap projected_column_to_original_key_and_index,
-            bool case_sensitive_match
+            bool case_sensitive_match,
+            bool has_pure_wildcard_column
     )
             : m_query{std::move(query)},
               m_is_empty_query{
                       nullptr != dynamic_cast<clp_s::search::ast::EmptyExpr*>(m_query.get())
               },
+              m_has_pure_wildcard_column{has_pure_wildcard_column},
               m_auto_gen_namespace_partial_resolutions{
                       std::move(auto_gen_namespace_partial_resolutions)
               },
@@ -388,6 +412,7 @@ private:
     // Variables
     std::shared_ptr<clp_s::search::ast::Expression> m_query;
     bool m_is_empty_query;
+    bool m_has_pure_wildcard_column;
     PartialResolutionMap m_auto_gen_namespace_partial_resolutions;
     PartialResolutionMap m_user_gen_namespace_partial_resolutions;
     std::unordered_map<
@@ -395,6 +420,8 @@ private:
             std::unordered_set<SchemaTree::Node::id_t>
     >
             m_resolved_column_to_schema_tree_node_ids;
+    std::unordered_set<SchemaTree::Node::id_t> m_auto_gen_resolved_node_ids;
+    std::unordered_set<SchemaTree::Node::id_t> m_user_gen_resolved_node_ids;
     std::vector<std::shared_ptr<clp_s::search::ast::ColumnDescriptor>> m_projected_columns;
     ProjectionMap m_projected_column_to_original_key_and_index;
     bool m_case_sensitive_match;
@@ -516,6 +543,11 @@ auto QueryHandlerImpl::handle_column_resolution_on_new_schema_tree_node(
             std::unordered_set<SchemaTree::Node::id_t>{}
     );
     it->second.emplace(node_id);
+    if (is_auto_generated) {
+        m_auto_gen_resolved_node_ids.emplace(node_id);
+    } else {
+        m_user_gen_resolved_node_ids.emplace(node_id);
+    }
     return ystdlib::error_handling::success();
 }
 }  // namespace clp::ffi::ir_stream::search
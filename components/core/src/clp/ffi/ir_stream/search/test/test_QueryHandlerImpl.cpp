@@ -919,4 +919,73 @@ TEST_CASE("query_handler_evaluation_kv_pair_log_event", "[ffi][ir_stream][search
         REQUIRE((AstEvaluationResult::False == evaluation_result));
     }
 }
+
+TEST_CASE(
+        "query_handler_is_value_required_for_evaluation",
+        "[ffi][ir_stream][search][QueryHandler]"
+) {
+    /*
+     * <0:root:Obj>
+     *      |
+     *      |--> <1:a:Int>
+     *      |
+     *      |--> <2:b:Str>
+     */
+    constexpr SchemaTree::Node::id_t cIntNodeId{1};
+    constexpr SchemaTree::Node::id_t cStrNodeId{2};
+    std::vector<std::pair<SchemaTree::Node::id_t, SchemaTree::NodeLocator>> const nodes{
+            {cIntNodeId, {SchemaTree::cRootId, "a", SchemaTree::Node::Type::Int}},
+            {cStrNodeId, {SchemaTree::cRootId, "b", SchemaTree::Node::Type::Str}}
+    };
+
+    auto create_query_handler = [&](std::string const& query_str) -> QueryHandlerImpl {
+        auto query_stream{std::istringstream{query_str}};
+        auto query{clp_s::search::kql::parse_kql_expression(query_stream)};
+        REQUIRE((nullptr != query));
+
+        auto query_handler_impl_result{QueryHandlerImpl::create(query, {}, true, false)};
+        REQUIRE_FALSE(query_handler_impl_result.has_error());
+        auto& query_handler_impl{query_handler_impl_result.value()};
+        for (auto const& [node_id, locator] : nodes) {
+            for (auto const is_auto_generated : {true, false}) {
+                REQUIRE_FALSE(query_handler_impl
+                                      .update_partially_resolved_columns(
+                                              is_auto_generated,
+                                              locator,
+                                              node_id,
+                                              trivial_new_projected_schema_tree_node_callback
+                                      )
+                                      .has_error());
+            }
+        }
+        return std::move(query_handler_impl);
+    };
+
+    SECTION("Only values of resolved columns are required") {
+        auto const query_handler_impl{create_query_handler(fmt::format("a: {}", cRefTestInt))};
+        REQUIRE(query_handler_impl.is_value_required_for_evaluation(false, cIntNodeId));
+        REQUIRE_FALSE(query_handler_impl.is_value_required_for_evaluation(false, cStrNodeId));
+        REQUIRE_FALSE(query_handler_impl.is_value_required_for_evaluation(true, cIntNodeId));
+        REQUIRE_FALSE(query_handler_impl.is_value_required_for_evaluation(true, cStrNodeId));
+    }
+
+    SECTION("Columns are resolved in their own namespace") {
+        auto const query_handler_impl{create_query_handler(
+                fmt::format("{}b: {}", cAutogenNamespace, cRefTestStr)
+        )};
+        REQUIRE(query_handler_impl.is_value_required_for_evaluation(true, cStrNodeId));
+        REQUIRE_FALSE(query_handler_impl.is_value_required_for_evaluation(true, cIntNodeId));
+        REQUIRE_FALSE(query_handler_impl.is_value_required_for_evaluation(false, cStrNodeId));
+    }
+
+    SECTION("All values are required by pure wildcard columns") {
+        auto const query_handler_impl{create_query_handler(
+                fmt::format("a: {} OR *: {}", cRefTestInt, cRefTestStr)
+        )};
+        for (auto const& [node_id, locator] : nodes) {
+            REQUIRE(query_handler_impl.is_value_required_for_evaluation(true, node_id));
+            REQUIRE(query_handler_impl.is_value_required_for_evaluation(false, node_id));
+        }
+    }
+}
 }  // namespace clp::ffi::ir_stream::search::test
@@ -6,6 +6,7 @@
 #include <string>
 #include <string_view>
 
+#include <regex_utils/RegexMatcher.hpp>
 #include <string_utils/string_utils.hpp>
 #include <ystdlib/error_handling/Result.hpp>
 
@@ -46,12 +47,16 @@ requires std::same_as<OperandType, value_int_t> || std::same_as<OperandType, val
  * operands.
  * @param op
  * @param filter_operand The operand associated with the filter.
+ * @param regex_matcher The regex associated with the filter, or nullptr if the filter isn't a regex
+ * filter. If set, it's used instead of `filter_operand`, which is only the regex's wildcard
+ * superset.
  * @param value_operand The value operand to evaluate.
  * @return Whether the filter condition is satisfied.
  */
 [[nodiscard]] auto evaluate_string_filter_op(
         FilterOperation op,
         std::string_view filter_operand,
+        clp::regex_utils::RegexMatcher const* regex_matcher,
         std::string_view value_operand,
         bool case_sensitive_match
 ) -> bool;
@@ -158,9 +163,21 @@ auto evaluate_numerical_filter_op(
 auto evaluate_string_filter_op(
         FilterOperation op,
         std::string_view filter_operand,
+        clp::regex_utils::RegexMatcher const* regex_matcher,
         std::string_view value_operand,
         bool case_sensitive_match
 ) -> bool {
+    if (nullptr != regex_matcher) {
+        switch (op) {
+            case FilterOperation::EQ:
+                return regex_matcher->matches(value_operand);
+            case FilterOperation::NEQ:
+                return false == regex_matcher->matches(value_operand);
+            default:
+                return false;
+        }
+    }
+
     switch (op) {
         case FilterOperation::EQ:
             return clp::string_utils::wildcard_match_unsafe(
@@ -245,7 +262,13 @@ auto evaluate_var_string_filter_op(
     }
     auto const value_operand{value.get_immutable_view<std::string>()};
 
-    return evaluate_string_filter_op(op, filter_operand, value_operand, case_sensitive_match);
+    return evaluate_string_filter_op(
+            op,
+            filter_operand,
+            operand->get_regex_matcher(case_sensitive_match).get(),
+            value_operand,
+            case_sensitive_match
+    );
 }
 
 auto evaluate_clp_string_filter_op(
@@ -265,7 +288,13 @@ auto evaluate_clp_string_filter_op(
                     : value.get_immutable_view<clp::ffi::FourByteEncodedTextAst>().to_string()
     )};
 
-    return evaluate_string_filter_op(op, filter_operand, value_operand, case_sensitive_match);
+    return evaluate_string_filter_op(
+            op,
+            filter_operand,
+            operand->get_regex_matcher(case_sensitive_match).get(),
+            value_operand,
+            case_sensitive_match
+    );
 }
 }  // namespace
 
@@ -0,0 +1,280 @@
+#include "LogEventMatcher.hpp"
+
+#include <cctype>
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include <string_utils/string_utils.hpp>
+#include <ystdlib/error_handling/Result.hpp>
+
+#include "../../ir/EncodedTextAst.hpp"
+#include "../../ir/LogEvent.hpp"
+#include "../../ir/LogEventDeserializer.hpp"
+#include "../../ir/parsing.hpp"
+#include "../../ir/types.hpp"
+#include "../../type_utils.hpp"
+#include "../encoding_methods.hpp"
+#include "ExactVariableToken.hpp"
+#include "query_methods.hpp"
+#include "QueryToken.hpp"
+#include "Subquery.hpp"
+#include "WildcardToken.hpp"
+
+using clp::ir::VariablePlaceholder;
+using clp::string_utils::wildcard_match_unsafe;
+using std::optional;
+using std::string;
+using std::string_view;
+using std::vector;
+
+namespace clp::ffi::search {
+namespace {
+// Bounds the memory used by the logtype cache for streams with many distinct logtypes
+constexpr size_t cMaxNumCachedLogtypes{65'536};
+
+/**
+ * @param lhs
+ * @param rhs
+ * @param case_sensitive_match
+ * @return Whether the two strings are equal.
+ */
+[[nodiscard]] auto strings_are_equal(string_view lhs, string_view rhs, bool case_sensitive_match)
+        -> bool;
+
+/**
+ * @param token_type
+ * @return The variable placeholder corresponding to the given variable token type.
+ */
+[[nodiscard]] auto token_type_to_placeholder(TokenType token_type) -> VariablePlaceholder;
+
+auto strings_are_equal(string_view lhs, string_view rhs, bool case_sensitive_match) -> bool {
+    if (case_sensitive_match) {
+        return lhs == rhs;
+    }
+    if (lhs.size() != rhs.size()) {
+        return false;
+    }
+    for (size_t i{0}; i < lhs.size(); ++i) {
+        if (std::tolower(static_cast<unsigned char>(lhs[i]))
+            != std::tolower(static_cast<unsigned char>(rhs[i])))
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+auto token_type_to_placeholder(TokenType token_type) -> VariablePlaceholder {
+    switch (token_type) {
+        case TokenType::IntegerVariable:
+            return VariablePlaceholder::Integer;
+        case TokenType::FloatVariable:
+            return VariablePlaceholder::Float;
+        case TokenType::DictionaryVariable:
+        default:
+            return VariablePlaceholder::Dictionary;
+    }
+}
+}  // namespace
+
+template <typename encoded_variable_t>
+LogEventMatcher<encoded_variable_t>::LogEventMatcher(
+        string_view wildcard_query,
+        bool ignore_case
+)
+        : m_query{string_utils::clean_up_wildcard_search_string(wildcard_query)},
+          m_case_sensitive_match{false == ignore_case} {
+    generate_subqueries(m_query, m_subqueries);
+}
+
+template <typename encoded_variable_t>
+auto LogEventMatcher<encoded_variable_t>::match(
+        ir::EncodedTextAst<encoded_variable_t> const& message
+) -> optional<string> {
+    auto const& logtype_match{get_logtype_match(message.get_logtype())};
+    if (logtype_match.matching_subquery_idxs.empty()
+        || logtype_match.num_encoded_vars != message.get_encoded_vars().size()
+        || logtype_match.num_dict_vars != message.get_dict_vars().size())
+    {
+        return std::nullopt;
+    }
+
+    bool vars_matched{false};
+    for (auto const subquery_idx : logtype_match.matching_subquery_idxs) {
+        if (vars_match(m_subqueries[subquery_idx], logtype_match.placeholders, message)) {
+            vars_matched = true;
+            break;
+        }
+    }
+    if (false == vars_matched) {
+        return std::nullopt;
+    }
+
+    // The subqueries can overapproximate the query (e.g., a logtype query's wildcards can span
+    // variables), so verify the match against the decoded message.
+    ++m_num_decoded_messages;
+    auto decoded_message{message.decode_and_unparse()};
+    if (false == decoded_message.has_value()
+        || false == wildcard_match_unsafe(decoded_message.value(), m_query, m_case_sensitive_match))
+    {
+        return std::nullopt;
+    }
+    return decoded_message;
+}
+
+template <typename encoded_variable_t>
+auto LogEventMatcher<encoded_variable_t>::find_next_match(
+        ir::LogEventDeserializer<encoded_variable_t>& deserializer
+)
+        -> ystdlib::error_handling::Result<
+                std::pair<ir::LogEvent<encoded_variable_t>, std::string>> {
+    while (true) {
+        auto log_event{YSTDLIB_ERROR_HANDLING_TRYX(deserializer.deserialize_log_event())};
+        auto decoded_message{match(log_event.get_message())};
+        if (decoded_message.has_value()) {
+            return std::make_pair(std::move(log_event), std::move(decoded_message.value()));
+        }
+    }
+}
+
+template <typename encoded_variable_t>
+auto LogEventMatcher<encoded_variable_t>::get_logtype_match(string const& logtype)
+        -> LogtypeMatch const& {
+    if (auto const it{m_logtype_matches.find(logtype)}; m_logtype_matches.end() != it) {
+        return it->second;
+    }
+    if (m_logtype_matches.size() >= cMaxNumCachedLogtypes) {
+        m_logtype_matches.clear();
+    }
+
+    LogtypeMatch logtype_match;
+    for (size_t i{0}; i < m_subqueries.size(); ++i) {
+        auto const& subquery{m_subqueries[i]};
+        bool const logtype_matches{
+                subquery.logtype_query_contains_wildcards()
+                        ? wildcard_match_unsafe(
+                                  logtype,
+                                  subquery.get_logtype_query(),
+                                  m_case_sensitive_match
+                          )
+                        : strings_are_equal(
+                                  logtype,
+                                  subquery.get_logtype_query(),
+                                  m_case_sensitive_match
+                          )
+        };
+        if (logtype_matches) {
+            logtype_match.matching_subquery_idxs.push_back(i);
+        }
+    }
+
+    if (false == logtype_match.matching_subquery_idxs.empty()) {
+        auto const escape_char{enum_to_underlying_type(VariablePlaceholder::Escape)};
+        bool is_escaped{false};
+        for (auto const c : logtype) {
+            if (is_escaped) {
+                is_escaped = false;
+            } else if (escape_char == c) {
+                is_escaped = true;
+            } else if (ir::is_variable_placeholder(c)) {
+                auto const placeholder{static_cast<VariablePlaceholder>(c)};
+                logtype_match.placeholders.push_back(placeholder);
+                if (VariablePlaceholder::Dictionary == placeholder) {
+                    ++logtype_match.num_dict_vars;
+                } else {
+                    ++logtype_match.num_encoded_vars;
+                }
+            }
+        }
+    }
+
+    return m_logtype_matches.emplace(logtype, std::move(logtype_match)).first->second;
+}
+
+template <typename encoded_variable_t>
+auto LogEventMatcher<encoded_variable_t>::vars_match(
+        Subquery<encoded_variable_t> const& subquery,
+        vector<VariablePlaceholder> const& placeholders,
+        ir::EncodedTextAst<encoded_variable_t> const& message
+) const -> bool {
+    auto const& query_vars{subquery.get_query_vars()};
+    auto const& encoded_vars{message.get_encoded_vars()};
+    auto const& dict_vars{message.get_dict_vars()};
+
+    // Try to find the query variables in the message's variables, in order, but not necessarily
+    // contiguously
+    size_t query_var_idx{0};
+    size_t encoded_var_idx{0};
+    size_t dict_var_idx{0};
+    for (auto const placeholder : placeholders) {
+        if (query_vars.size() == query_var_idx) {
+            break;
+        }
+        bool const is_dict_var{VariablePlaceholder::Dictionary == placeholder};
+        auto const matches{std::visit(
+                overloaded{
+                        [&](ExactVariableToken<encoded_variable_t> const& token) -> bool {
+                            if (token.get_placeholder() != placeholder) {
+                                return false;
+                            }
+                            if (is_dict_var) {
+                                return wildcard_match_unsafe(
+                                        dict_vars[dict_var_idx],
+                                        token.get_value(),
+                                        m_case_sensitive_match
+                                );
+                            }
+                            return token.get_encoded_value() == encoded_vars[encoded_var_idx];
+                        },
+                        [&](WildcardToken<encoded_variable_t> const& token) -> bool {
+                            if (token_type_to_placeholder(token.get_current_interpretation())
+                                != placeholder)
+                            {
+                                return false;
+                            }
+                            string decoded_var;
+                            switch (placeholder) {
+                                case VariablePlaceholder::Integer:
+                                    decoded_var = decode_integer_var(encoded_vars[encoded_var_idx]);
+                                    break;
+                                case VariablePlaceholder::Float:
+                                    decoded_var = decode_float_var(encoded_vars[encoded_var_idx]);
+                                    break;
+                                default:
+                                    return wildcard_match_unsafe(
+                                            dict_vars[dict_var_idx],
+                                            token.get_value(),
+                                            m_case_sensitive_match
+                                    );
+                            }
+                            return wildcard_match_unsafe(
+                                    decoded_var,
+                                    token.get_value(),
+                                    m_case_sensitive_match
+                            );
+                        }
+                },
+                query_vars[query_var_idx]
+        )};
+        if (matches) {
+            ++query_var_idx;
+        }
+        if (is_dict_var) {
+            ++dict_var_idx;
+        } else {
+            ++encoded_var_idx;
+        }
+    }
+    return query_vars.size() == query_var_idx;
+}
+
+// Explicitly declare specializations to avoid having to validate that the template parameters are
+// supported
+template class LogEventMatcher<ir::eight_byte_encoded_variable_t>;
+template class LogEventMatcher<ir::four_byte_encoded_variable_t>;
+}  // namespace clp::ffi::search
@@ -0,0 +1,133 @@
+#ifndef CLP_FFI_SEARCH_LOGEVENTMATCHER_HPP
+#define CLP_FFI_SEARCH_LOGEVENTMATCHER_HPP
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <ystdlib/error_handling/Result.hpp>
+
+#include "../../ir/EncodedTextAst.hpp"
+#include "../../ir/LogEvent.hpp"
+#include "../../ir/LogEventDeserializer.hpp"
+#include "../../ir/types.hpp"
+#include "Subquery.hpp"
+
+namespace clp::ffi::search {
+/**
+ * Matches log events from an unstructured (four-byte or eight-byte encoded) IR stream against a
+ * wildcard query, without decoding log events that can't match.
+ *
+ * The query is translated into subqueries (see `generate_subqueries`), each made up of a logtype
+ * query and a sequence of variable queries. A log event can only match if, for some subquery:
+ * - its logtype matches the subquery's logtype query; and
+ * - the subquery's variable queries match the log event's variables, in order (though not
+ *   necessarily contiguously).
+ *
+ * Since IR streams typically contain few distinct logtypes, the subqueries matching each logtype
+ * (along with the logtype's variable placeholders) are cached, so each distinct logtype is only
+ * matched against the logtype queries once. Exact variable queries are compared against encoded
+ * variables without decoding them.
+ *
+ * Log events that pass these checks are decoded and matched against the query itself, so the
+ * matcher returns exactly the log events whose decoded messages match the query.
+ *
+ * NOTE: Subqueries reference the query string, so the matcher can't be copied or moved.
+ * @tparam encoded_variable_t The type of encoded variables in the IR stream.
+ */
+template <typename encoded_variable_t>
+class LogEventMatcher {
+public:
+    // Constructors
+    /**
+     * @param wildcard_query A wildcard query that must match the entirety of a log event's message
+     * (i.e., callers that want substring matches should surround the query with '*').
+     * @param ignore_case Whether to match the query case-insensitively.
+     * @throw QueryMethodFailed if `wildcard_query` is empty after cleaning it up.
+     */
+    LogEventMatcher(std::string_view wildcard_query, bool ignore_case);
+
+    // Delete copy & move constructors and assignment operators
+    LogEventMatcher(LogEventMatcher const&) = delete;
+    LogEventMatcher(LogEventMatcher&&) = delete;
+    auto operator=(LogEventMatcher const&) -> LogEventMatcher& = delete;
+    auto operator=(LogEventMatcher&&) -> LogEventMatcher& = delete;
+
+    // Destructor
+    ~LogEventMatcher() = default;
+
+    // Methods
+    /**
+     * @param message
+     * @return The decoded message if it matches the query, or std::nullopt otherwise (including if
+     * the message is corrupted).
+     */
+    [[nodiscard]] auto match(ir::EncodedTextAst<encoded_variable_t> const& message)
+            -> std::optional<std::string>;
+
+    /**
+     * Deserializes log events from the given stream until one matches the query.
+     * @param deserializer
+     * @return A result containing the matching log event and its decoded message, or an error code
+     * indicating the failure:
+     * - Forwards `ir::LogEventDeserializer::deserialize_log_event`'s return values on failure
+     *   (including std::errc::no_message on reaching the end of the IR stream).
+     */
+    [[nodiscard]] auto find_next_match(ir::LogEventDeserializer<encoded_variable_t>& deserializer)
+            -> ystdlib::error_handling::Result<
+                    std::pair<ir::LogEvent<encoded_variable_t>, std::string>>;
+
+    /**
+     * @return The number of messages that passed the encoded checks and so had to be decoded.
+     */
+    [[nodiscard]] auto get_num_decoded_messages() const -> size_t {
+        return m_num_decoded_messages;
+    }
+
+private:
+    // Types
+    /**
+     * The result of matching a logtype against the subqueries' logtype queries.
+     */
+    struct LogtypeMatch {
+        std::vector<size_t> matching_subquery_idxs;
+        // The logtype's unescaped variable placeholders, in order
+        std::vector<ir::VariablePlaceholder> placeholders;
+        size_t num_encoded_vars{0};
+        size_t num_dict_vars{0};
+    };
+
+    // Methods
+    /**
+     * @param logtype
+     * @return The cached result of matching `logtype` against the subqueries' logtype queries,
+     * computing it if necessary.
+     */
+    [[nodiscard]] auto get_logtype_match(std::string const& logtype) -> LogtypeMatch const&;
+
+    /**
+     * @param subquery
+     * @param placeholders
+     * @param message
+     * @return Whether the subquery's variable queries match the message's variables, in order.
+     */
+    [[nodiscard]] auto vars_match(
+            Subquery<encoded_variable_t> const& subquery,
+            std::vector<ir::VariablePlaceholder> const& placeholders,
+            ir::EncodedTextAst<encoded_variable_t> const& message
+    ) const -> bool;
+
+    // Variables
+    std::string m_query;
+    bool m_case_sensitive_match;
+    std::vector<Subquery<encoded_variable_t>> m_subqueries;
+    std::unordered_map<std::string, LogtypeMatch> m_logtype_matches;
+    size_t m_num_decoded_messages{0};
+};
+}  // namespace clp::ffi::search
+
+#endif  // CLP_FFI_SEARCH_LOGEVENTMATCHER_HPP
@@ -1,5 +1,7 @@
 #include "LogEventDeserializer.hpp"
 
+#include <cstddef>
+#include <span>
 #include <vector>
 
 #include <nlohmann/json.hpp>
@@ -8,6 +10,7 @@
 
 #include "../ffi/ir_stream/decoding_methods.hpp"
 #include "../ffi/ir_stream/protocol_constants.hpp"
+#include "../ffi/ir_stream/SpanReader.hpp"
 #include "EncodedTextAst.hpp"
 #include "types.hpp"
 
@@ -71,10 +74,34 @@ auto LogEventDeserializer<encoded_variable_t>::create(ReaderInterface& reader)
 template <typename encoded_variable_t>
 auto LogEventDeserializer<encoded_variable_t>::deserialize_log_event()
         -> ystdlib::error_handling::Result<LogEvent<encoded_variable_t>> {
+    // Deserialize the log event directly from the reader's buffer if the reader has buffered all
+    // of it, so that none of the log event's reads go through a virtual call.
+    char const* buf{nullptr};
+    size_t buf_size{0};
+    if (ErrorCode_Success == m_reader.try_peek_buffered_data(buf, buf_size)) {
+        ffi::ir_stream::SpanReader span_reader{std::span{buf, buf_size}};
+        auto result{generic_deserialize_log_event(span_reader)};
+        if (false == span_reader.is_exhausted()) {
+            size_t pos{0};
+            if (ErrorCode_Success != m_reader.try_get_pos(pos)
+                || ErrorCode_Success != m_reader.try_seek_from_begin(pos + span_reader.get_pos()))
+            {
+                return std::errc::io_error;
+            }
+            return result;
+        }
+    }
+    return generic_deserialize_log_event(m_reader);
+}
+
+template <typename encoded_variable_t>
+template <typename ReaderType>
+auto LogEventDeserializer<encoded_variable_t>::generic_deserialize_log_event(ReaderType& reader)
+        -> ystdlib::error_handling::Result<LogEvent<encoded_variable_t>> {
     // Process any packets before the log event
     ffi::ir_stream::encoded_tag_t tag{};
     while (true) {
-        auto ir_error_code = ffi::ir_stream::deserialize_tag(m_reader, tag);
+        auto ir_error_code = ffi::ir_stream::deserialize_tag(reader, tag);
         if (ffi::ir_stream::IRErrorCode_Incomplete_IR == ir_error_code) {
             return std::errc::result_out_of_range;
         }
@@ -84,7 +111,7 @@ auto LogEventDeserializer<encoded_variable_t>::deserialize_log_event()
         }
 
         if (ffi::ir_stream::cProtocol::Payload::UtcOffsetChange == tag) {
-            ir_error_code = ffi::ir_stream::deserialize_utc_offset_change(m_reader, m_utc_offset);
+            ir_error_code = ffi::ir_stream::deserialize_utc_offset_change(reader, m_utc_offset);
             if (ffi::ir_stream::IRErrorCode_Incomplete_IR == ir_error_code) {
                 return std::errc::result_out_of_range;
             }
@@ -100,7 +127,7 @@ auto LogEventDeserializer<encoded_variable_t>::deserialize_log_event()
     std::vector<encoded_variable_t> encoded_vars;
 
     auto ir_error_code = ffi::ir_stream::deserialize_log_event(
-            m_reader,
+            reader,
             tag,
             logtype,
             encoded_vars,
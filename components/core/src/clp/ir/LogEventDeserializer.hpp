@@ -55,11 +55,17 @@ public:
     [[nodiscard]] auto get_current_utc_offset() const -> UtcOffset { return m_utc_offset; }
 
     /**
-     * Deserializes a log event from the stream
+     * Deserializes a log event from the stream.
+     *
+     * NOTE: If the reader buffers its content (see `ReaderInterface::try_peek_buffered_data`) and
+     * the log event is entirely buffered, the log event is deserialized directly from the reader's
+     * buffer.
      * @return A result containing the log event or an error code indicating the failure:
      * - std::errc::no_message on reaching the end of the IR stream
      * - std::errc::result_out_of_range if the IR stream is truncated
      * - std::errc::protocol_error if the IR stream is corrupted
+     * - std::errc::io_error if the reader's read head can't be advanced past a log event
+     *   deserialized from its buffer
      */
     [[nodiscard]] auto deserialize_log_event()
             -> ystdlib::error_handling::Result<LogEvent<encoded_variable_t>>;
@@ -72,6 +78,20 @@ private:
             : m_reader{reader},
               m_prev_msg_timestamp{ref_timestamp} {}
 
+    // Methods
+    /**
+     * Implements `deserialize_log_event` for the given reader.
+     *
+     * NOTE: The deserializer's state is only updated once the log event has been entirely read,
+     * except for UTC offset changes, which can safely be deserialized again.
+     * @tparam ReaderType
+     * @param reader
+     * @return Same as `deserialize_log_event`.
+     */
+    template <typename ReaderType>
+    [[nodiscard]] auto generic_deserialize_log_event(ReaderType& reader)
+            -> ystdlib::error_handling::Result<LogEvent<encoded_variable_t>>;
+
     // Variables
     TimestampPattern m_timestamp_pattern{0, "%Y-%m-%dT%H:%M:%S.%3"};
     UtcOffset m_utc_offset{0};
@@ -71,7 +71,8 @@ int main(int argc, char const* argv[]) {
             FileWriter::OpenMode::CREATE_FOR_WRITING
     );
     string human_readable_value;
-    for (auto const& entry : logtype_dict.get_entries()) {
+    for (size_t id = 0; id < logtype_dict.get_num_entries(); ++id) {
+        auto const& entry = logtype_dict.get_entry(id);
         auto const& value = entry.get_value();
         human_readable_value.clear();
 
@@ -154,7 +155,8 @@ int main(int argc, char const* argv[]) {
             readable_var_segment_index_path.string(),
             FileWriter::OpenMode::CREATE_FOR_WRITING
     );
-    for (auto const& entry : var_dict.get_entries()) {
+    for (size_t id = 0; id < var_dict.get_num_entries(); ++id) {
+        auto const& entry = var_dict.get_entry(id);
         file_writer.write_string(entry.get_value());
         file_writer.write_char('\n');
 
@@ -58,6 +58,20 @@ auto ErrorCategory::message(ErrorCodeEnum error_enum) const -> std::string {
         case ErrorCodeEnum::UnsupportedCharsetPattern:
             return "Currently only supports character set that can be reduced to a single "
                    "character.";
+
+        case ErrorCodeEnum::InvalidCharsetRange:
+            return "Character set range is out of order or has a non-character endpoint.";
+
+        case ErrorCodeEnum::InvalidQuantifier:
+            return "Quantifier has nothing to repeat, follows another quantifier, or has invalid "
+                   "bounds.";
+
+        case ErrorCodeEnum::UnsupportedRegexFeature:
+            return "Regex features that can't be matched by a finite automaton (e.g., "
+                   "backreferences, lookarounds, and word boundaries) are unsupported.";
+
+        case ErrorCodeEnum::RegexTooLarge:
+            return "Regex is too large or too deeply nested to compile.";
         default:
             return "Unknown error code enum.";
     }
@@ -22,6 +22,10 @@ enum class ErrorCodeEnum : uint8_t {
     UnmatchedParenthesis,
     IncompleteCharsetStructure,
     UnsupportedCharsetPattern,
+    InvalidCharsetRange,
+    InvalidQuantifier,
+    UnsupportedRegexFeature,
+    RegexTooLarge,
 };
 
 using ErrorCode = ystdlib::error_handling::ErrorCode<ErrorCodeEnum>;
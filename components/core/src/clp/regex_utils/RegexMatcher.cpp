@@ -0,0 +1,906 @@
+#include "regex_utils/RegexMatcher.hpp"
+
+#include <algorithm>
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <map>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <string_utils/constants.hpp>
+#include <string_utils/string_utils.hpp>
+#include <ystdlib/error_handling/Result.hpp>
+
+#include "constants.hpp"
+#include "ErrorCode.hpp"
+#include "regex_translation_utils.hpp"
+
+namespace clp::regex_utils {
+using clp::string_utils::clean_up_wildcard_search_string;
+using clp::string_utils::cZeroOrMoreCharsWildcard;
+using std::string;
+using std::string_view;
+using std::vector;
+using ByteSet = std::bitset<256>;
+using NfaState = RegexMatcher::NfaState;
+
+namespace {
+constexpr size_t cUnboundedRepeats{std::numeric_limits<size_t>::max()};
+constexpr size_t cMaxRepeats{1000};
+constexpr size_t cMaxNestingDepth{1000};
+constexpr size_t cMaxNumNfaStates{100'000};
+constexpr size_t cMaxNumDfaStates{4096};
+// Bounds the number of NFA states visited while building the DFA
+constexpr size_t cMaxDfaConstructionWork{20'000'000};
+
+/**
+ * A node in a regex's abstract syntax tree.
+ */
+struct AstNode {
+    enum class Type : uint8_t {
+        // Matches the empty string
+        Empty,
+        // Matches a single byte in `bytes`
+        Bytes,
+        // Matches its children in sequence
+        Concatenation,
+        // Matches any one of its children
+        Alternation,
+        // Matches its only child repeated between `min_repeats` and `max_repeats` times
+        Repeat,
+    };
+
+    Type type{Type::Empty};
+    ByteSet bytes;
+    vector<size_t> children;
+    size_t min_repeats{0};
+    size_t max_repeats{0};
+};
+
+/**
+ * Recursive-descent parser that converts a regex (without its anchors) into an abstract syntax
+ * tree. Bytes are case-folded as they're parsed if the regex is case-insensitive.
+ */
+class Parser {
+public:
+    // Constructor
+    Parser(string_view regex, bool case_insensitive)
+            : m_regex{regex},
+              m_case_insensitive{case_insensitive} {}
+
+    // Methods
+    /**
+     * @return A result containing the index of the root node on success, or an error code
+     * indicating the failure (see `RegexMatcher::create`).
+     */
+    [[nodiscard]] auto parse() -> ystdlib::error_handling::Result<size_t>;
+
+    [[nodiscard]] auto get_nodes() const -> vector<AstNode> const& { return m_nodes; }
+
+private:
+    // Methods
+    [[nodiscard]] auto parse_alternation(size_t depth) -> ystdlib::error_handling::Result<size_t>;
+
+    [[nodiscard]] auto parse_concatenation(size_t depth)
+            -> ystdlib::error_handling::Result<size_t>;
+
+    /**
+     * Parses an atom (a byte, class, or group) followed by its quantifiers.
+     * @param depth
+     * @return A result containing the index of the parsed node on success, or an error code
+     * indicating the failure.
+     */
+    [[nodiscard]] auto parse_quantified_atom(size_t depth)
+            -> ystdlib::error_handling::Result<size_t>;
+
+    [[nodiscard]] auto parse_atom(size_t depth) -> ystdlib::error_handling::Result<size_t>;
+
+    /**
+     * Parses a character set, starting after its opening `[`.
+     * @return A result containing the index of the parsed node on success, or an error code
+     * indicating the failure.
+     */
+    [[nodiscard]] auto parse_charset() -> ystdlib::error_handling::Result<size_t>;
+
+    /**
+     * Parses an escape sequence, starting after its `\`.
+     * @return A result containing the set of bytes the escape sequence matches on success, or an
+     * error code indicating the failure.
+     */
+    [[nodiscard]] auto parse_escape_sequence() -> ystdlib::error_handling::Result<ByteSet>;
+
+    /**
+     * Tries to parse a quantifier at the current position.
+     * @param min_repeats Returns the quantifier's lower bound.
+     * @param max_repeats Returns the quantifier's upper bound.
+     * @return A result containing whether a quantifier was parsed on success, or an error code
+     * indicating the failure.
+     */
+    [[nodiscard]] auto parse_quantifier(size_t& min_repeats, size_t& max_repeats)
+            -> ystdlib::error_handling::Result<bool>;
+
+    /**
+     * Tries to parse a bounded quantifier (`{n}`, `{n,}` or `{n,m}`) at the current position,
+     * which must be a `{`. If the braces don't form a bounded quantifier, the position is left
+     * unchanged so that the `{` can be parsed as a literal.
+     * @param min_repeats
+     * @param max_repeats
+     * @return A result containing whether a quantifier was parsed on success, or an error code
+     * indicating the failure.
+     */
+    [[nodiscard]] auto parse_bounded_quantifier(size_t& min_repeats, size_t& max_repeats)
+            -> ystdlib::error_handling::Result<bool>;
+
+    /**
+     * @param bytes
+     * @return `bytes` with the other case of each letter added if the regex is case-insensitive.
+     */
+    [[nodiscard]] auto fold_case(ByteSet bytes) const -> ByteSet;
+
+    auto add_node(AstNode node) -> size_t;
+
+    [[nodiscard]] auto is_at_end() const -> bool { return m_pos >= m_regex.size(); }
+
+    // Variables
+    string_view m_regex;
+    size_t m_pos{0};
+    bool m_case_insensitive;
+    vector<AstNode> m_nodes;
+};
+
+/**
+ * Compiles a regex's abstract syntax tree into a Thompson NFA.
+ */
+class NfaCompiler {
+public:
+    // Constructor
+    NfaCompiler(vector<AstNode> const& nodes, vector<NfaState>& states)
+            : m_nodes{nodes},
+              m_states{states} {}
+
+    // Methods
+    /**
+     * Compiles the subtree rooted at `node_idx` into states that transition to `next_state` after
+     * matching the subtree.
+     * @param node_idx
+     * @param next_state
+     * @return A result containing the subtree's start state on success, or an error code
+     * indicating the failure:
+     * - ErrorCodeEnum::RegexTooLarge if the NFA would have too many states.
+     */
+    [[nodiscard]] auto compile(size_t node_idx, uint32_t next_state)
+            -> ystdlib::error_handling::Result<uint32_t>;
+
+    /**
+     * @return A result containing the new state's index on success, or an error code indicating
+     * the failure:
+     * - ErrorCodeEnum::RegexTooLarge if the NFA would have too many states.
+     */
+    [[nodiscard]] auto add_state(NfaState state) -> ystdlib::error_handling::Result<uint32_t>;
+
+private:
+    // Methods
+    /**
+     * Adds an epsilon state whose transitions are set by the caller.
+     * @return Forwards `add_state`'s return values.
+     */
+    [[nodiscard]] auto add_epsilon_state() -> ystdlib::error_handling::Result<uint32_t> {
+        return add_state(NfaState{.type = NfaState::Type::Epsilon, .bytes = {}, .next_states = {}});
+    }
+
+    // Variables
+    vector<AstNode> const& m_nodes;
+    vector<NfaState>& m_states;
+};
+
+/**
+ * @param regex
+ * @return Whether `regex` ends with a `$` that isn't escaped.
+ */
+[[nodiscard]] auto ends_with_end_anchor(string_view regex) -> bool;
+
+/**
+ * @param predicate
+ * @return The set of bytes satisfying `predicate`.
+ */
+template <typename Predicate>
+[[nodiscard]] auto create_byte_set(Predicate predicate) -> ByteSet;
+
+auto Parser::parse() -> ystdlib::error_handling::Result<size_t> {
+    auto const root{YSTDLIB_ERROR_HANDLING_TRYX(parse_alternation(0))};
+    if (false == is_at_end()) {
+        // `parse_alternation` only stops early at an unmatched `)`
+        return ErrorCode{ErrorCodeEnum::UnmatchedParenthesis};
+    }
+    return root;
+}
+
+auto Parser::parse_alternation(size_t depth) -> ystdlib::error_handling::Result<size_t> {
+    if (depth > cMaxNestingDepth) {
+        return ErrorCode{ErrorCodeEnum::RegexTooLarge};
+    }
+
+    AstNode alternation{.type = AstNode::Type::Alternation};
+    alternation.children.push_back(YSTDLIB_ERROR_HANDLING_TRYX(parse_concatenation(depth)));
+    while (false == is_at_end() && '|' == m_regex[m_pos]) {
+        ++m_pos;
+        alternation.children.push_back(YSTDLIB_ERROR_HANDLING_TRYX(parse_concatenation(depth)));
+    }
+    if (1 == alternation.children.size()) {
+        return alternation.children.front();
+    }
+    return add_node(std::move(alternation));
+}
+
+auto Parser::parse_concatenation(size_t depth) -> ystdlib::error_handling::Result<size_t> {
+    AstNode concatenation{.type = AstNode::Type::Concatenation};
+    while (false == is_at_end() && '|' != m_regex[m_pos] && ')' != m_regex[m_pos]) {
+        auto const child{YSTDLIB_ERROR_HANDLING_TRYX(parse_quantified_atom(depth))};
+        concatenation.children.push_back(child);
+    }
+    if (concatenation.children.empty()) {
+        return add_node(AstNode{.type = AstNode::Type::Empty});
+    }
+    if (1 == concatenation.children.size()) {
+        return concatenation.children.front();
+    }
+    return add_node(std::move(concatenation));
+}
+
+auto Parser::parse_quantified_atom(size_t depth) -> ystdlib::error_handling::Result<size_t> {
+    size_t min_repeats{};
+    size_t max_repeats{};
+    if (YSTDLIB_ERROR_HANDLING_TRYX(parse_quantifier(min_repeats, max_repeats))) {
+        // Nothing to repeat
+        return ErrorCode{ErrorCodeEnum::InvalidQuantifier};
+    }
+
+    auto node_idx{YSTDLIB_ERROR_HANDLING_TRYX(parse_atom(depth))};
+    if (false == YSTDLIB_ERROR_HANDLING_TRYX(parse_quantifier(min_repeats, max_repeats))) {
+        return node_idx;
+    }
+
+    // Laziness doesn't affect whether a string matches, but possessiveness does
+    if (false == is_at_end() && cRegexZeroOrOne == m_regex[m_pos]) {
+        ++m_pos;
+    } else if (false == is_at_end() && cRegexOneOrMore == m_regex[m_pos]) {
+        return ErrorCode{ErrorCodeEnum::UnsupportedRegexFeature};
+    }
+
+    size_t nested_min_repeats{};
+    size_t nested_max_repeats{};
+    if (YSTDLIB_ERROR_HANDLING_TRYX(parse_quantifier(nested_min_repeats, nested_max_repeats))) {
+        return ErrorCode{ErrorCodeEnum::InvalidQuantifier};
+    }
+
+    AstNode repeat{
+            .type = AstNode::Type::Repeat,
+            .min_repeats = min_repeats,
+            .max_repeats = max_repeats
+    };
+    repeat.children.push_back(node_idx);
+    return add_node(std::move(repeat));
+}
+
+auto Parser::parse_atom(size_t depth) -> ystdlib::error_handling::Result<size_t> {
+    auto const c{m_regex[m_pos++]};
+    switch (c) {
+        case '(': {
+            if (false == is_at_end() && '?' == m_regex[m_pos]) {
+                // Only non-capturing groups are supported (not lookarounds, named groups, etc.)
+                if (m_pos + 1 >= m_regex.size() || ':' != m_regex[m_pos + 1]) {
+                    return ErrorCode{ErrorCodeEnum::UnsupportedRegexFeature};
+                }
+                m_pos += 2;
+            }
+            auto const group{YSTDLIB_ERROR_HANDLING_TRYX(parse_alternation(depth + 1))};
+            if (is_at_end()) {
+                return ErrorCode{ErrorCodeEnum::UnmatchedParenthesis};
+            }
+            // `parse_alternation` only stops at the end of the regex or at a `)`
+            ++m_pos;
+            return group;
+        }
+        case '[':
+            return parse_charset();
+        case '.':
+            return add_node(
+                    AstNode{.type = AstNode::Type::Bytes, .bytes = ~create_byte_set([](int b) {
+                                return '\n' == b;
+                            })}
+            );
+        case cEscapeChar:
+            return add_node(
+                    AstNode{.type = AstNode::Type::Bytes,
+                            .bytes = fold_case(YSTDLIB_ERROR_HANDLING_TRYX(parse_escape_sequence()))
+                    }
+            );
+        case cRegexStartAnchor:
+            return ErrorCode{ErrorCodeEnum::IllegalCaret};
+        case cRegexEndAnchor:
+            return ErrorCode{ErrorCodeEnum::IllegalDollarSign};
+        default: {
+            ByteSet bytes;
+            bytes.set(static_cast<uint8_t>(c));
+            return add_node(AstNode{.type = AstNode::Type::Bytes, .bytes = fold_case(bytes)});
+        }
+    }
+}
+
+auto Parser::parse_charset() -> ystdlib::error_handling::Result<size_t> {
+    bool negated{false};
+    if (false == is_at_end() && cCharsetNegate == m_regex[m_pos]) {
+        negated = true;
+        ++m_pos;
+    }
+
+    // Parses a single member of the set, returning the set of bytes it matches and, if it's a
+    // single byte, setting `byte`.
+    auto const parse_member = [&](std::optional<uint8_t>& byte) -> ystdlib::error_handling::Result<
+                                                                        ByteSet> {
+        auto const c{m_regex[m_pos++]};
+        if ('[' == c && false == is_at_end() && ':' == m_regex[m_pos]) {
+            // POSIX character classes (e.g., `[:alpha:]`)
+            return ErrorCode{ErrorCodeEnum::UnsupportedRegexFeature};
+        }
+        ByteSet bytes;
+        if (cEscapeChar == c) {
+            if (is_at_end()) {
+                return ErrorCode{ErrorCodeEnum::IncompleteCharsetStructure};
+            }
+            bytes = YSTDLIB_ERROR_HANDLING_TRYX(parse_escape_sequence());
+        } else {
+            bytes.set(static_cast<uint8_t>(c));
+        }
+        byte.reset();
+        if (1 == bytes.count()) {
+            for (size_t b{0}; b < bytes.size(); ++b) {
+                if (bytes.test(b)) {
+                    byte = static_cast<uint8_t>(b);
+                    break;
+                }
+            }
+        }
+        return bytes;
+    };
+
+    ByteSet bytes;
+    bool is_first_member{true};
+    while (true) {
+        if (is_at_end()) {
+            return ErrorCode{ErrorCodeEnum::IncompleteCharsetStructure};
+        }
+        // A `]` is a literal if it's the first member of the set
+        if (']' == m_regex[m_pos] && false == is_first_member) {
+            ++m_pos;
+            break;
+        }
+        is_first_member = false;
+
+        std::optional<uint8_t> range_begin;
+        auto const member_bytes{YSTDLIB_ERROR_HANDLING_TRYX(parse_member(range_begin))};
+        bool const is_range{
+                m_pos + 1 < m_regex.size() && '-' == m_regex[m_pos] && ']' != m_regex[m_pos + 1]
+        };
+        if (false == is_range) {
+            bytes |= member_bytes;
+            continue;
+        }
+
+        ++m_pos;
+        std::optional<uint8_t> range_end;
+        YSTDLIB_ERROR_HANDLING_TRYV(parse_member(range_end));
+        if (false == range_begin.has_value() || false == range_end.has_value()
+            || range_begin.value() > range_end.value())
+        {
+            return ErrorCode{ErrorCodeEnum::InvalidCharsetRange};
+        }
+        for (size_t b{range_begin.value()}; b <= range_end.value(); ++b) {
+            bytes.set(b);
+        }
+    }
+
+    // Fold before negating so that a negated set excludes both cases of each letter
+    bytes = fold_case(bytes);
+    if (negated) {
+        bytes.flip();
+    }
+    return add_node(AstNode{.type = AstNode::Type::Bytes, .bytes = bytes});
+}
+
+auto Parser::parse_escape_sequence() -> ystdlib::error_handling::Result<ByteSet> {
+    if (is_at_end()) {
+        return ErrorCode{ErrorCodeEnum::IllegalEscapeSequence};
+    }
+
+    auto const is_digit = [](int b) { return b >= '0' && b <= '9'; };
+    auto const is_word_char = [&](int b) {
+        return is_digit(b) || (b >= 'a' && b <= 'z') || (b >= 'A' && b <= 'Z') || '_' == b;
+    };
+    auto const is_space = [](int b) {
+        return ' ' == b || '\t' == b || '\n' == b || '\r' == b || '\f' == b || '\v' == b;
+    };
+    auto const create_single_byte_set = [](char c) {
+        ByteSet bytes;
+        bytes.set(static_cast<uint8_t>(c));
+        return bytes;
+    };
+
+    auto const c{m_regex[m_pos++]};
+    switch (c) {
+        case 'd':
+            return create_byte_set(is_digit);
+        case 'D':
+            return ~create_byte_set(is_digit);
+        case 'w':
+            return create_byte_set(is_word_char);
+        case 'W':
+            return ~create_byte_set(is_word_char);
+        case 's':
+            return create_byte_set(is_space);
+        case 'S':
+            return ~create_byte_set(is_space);
+        case 't':
+            return create_single_byte_set('\t');
+        case 'n':
+            return create_single_byte_set('\n');
+        case 'r':
+            return create_single_byte_set('\r');
+        case 'f':
+            return create_single_byte_set('\f');
+        case 'v':
+            return create_single_byte_set('\v');
+        case 'x': {
+            constexpr int cHexBase{16};
+            if (m_pos + 1 >= m_regex.size()) {
+                return ErrorCode{ErrorCodeEnum::IllegalEscapeSequence};
+            }
+            auto const high{hex_digit_to_value(m_regex[m_pos])};
+            auto const low{hex_digit_to_value(m_regex[m_pos + 1])};
+            if (high < 0 || low < 0) {
+                return ErrorCode{ErrorCodeEnum::IllegalEscapeSequence};
+            }
+            m_pos += 2;
+            return create_single_byte_set(static_cast<char>(high * cHexBase + low));
+        }
+        // Backreferences, word boundaries and input anchors
+        case 'b':
+        case 'B':
+        case 'A':
+        case 'z':
+        case 'Z':
+        case 'G':
+        case 'k':
+            return ErrorCode{ErrorCodeEnum::UnsupportedRegexFeature};
+        default:
+            if (is_digit(static_cast<uint8_t>(c))) {
+                return ErrorCode{ErrorCodeEnum::UnsupportedRegexFeature};
+            }
+            if (is_word_char(static_cast<uint8_t>(c))) {
+                return ErrorCode{ErrorCodeEnum::IllegalEscapeSequence};
+            }
+            // Any other escaped character is a literal
+            return create_single_byte_set(c);
+    }
+}
+
+auto Parser::parse_quantifier(size_t& min_repeats, size_t& max_repeats)
+        -> ystdlib::error_handling::Result<bool> {
+    if (is_at_end()) {
+        return false;
+    }
+    switch (m_regex[m_pos]) {
+        case cRegexZeroOrMore:
+            min_repeats = 0;
+            max_repeats = cUnboundedRepeats;
+            break;
+        case cRegexOneOrMore:
+            min_repeats = 1;
+            max_repeats = cUnboundedRepeats;
+            break;
+        case cRegexZeroOrOne:
+            min_repeats = 0;
+            max_repeats = 1;
+            break;
+        case '{':
+            return parse_bounded_quantifier(min_repeats, max_repeats);
+        default:
+            return false;
+    }
+    ++m_pos;
+    return true;
+}
+
+auto Parser::parse_bounded_quantifier(size_t& min_repeats, size_t& max_repeats)
+        -> ystdlib::error_handling::Result<bool> {
+    // Parses a decimal number at `pos`, advancing `pos` past it
+    auto const parse_number = [&](size_t& pos) -> std::optional<size_t> {
+        constexpr size_t cDecimalBase{10};
+        size_t const begin_pos{pos};
+        size_t number{0};
+        for (; pos < m_regex.size() && m_regex[pos] >= '0' && m_regex[pos] <= '9'; ++pos) {
+            // Saturate rather than overflow; the bound is validated below
+            number = std::min(
+                    number * cDecimalBase + static_cast<size_t>(m_regex[pos] - '0'),
+                    cMaxRepeats + 1
+            );
+        }
+        if (begin_pos == pos) {
+            return std::nullopt;
+        }
+        return number;
+    };
+
+    size_t pos{m_pos + 1};
+    auto const optional_min{parse_number(pos)};
+    if (false == optional_min.has_value() || pos >= m_regex.size()) {
+        return false;
+    }
+    size_t min{optional_min.value()};
+    size_t max{min};
+    if (',' == m_regex[pos]) {
+        ++pos;
+        auto const optional_max{parse_number(pos)};
+        max = optional_max.value_or(cUnboundedRepeats);
+    }
+    if (pos >= m_regex.size() || '}' != m_regex[pos]) {
+        return false;
+    }
+
+    if (min > max || min > cMaxRepeats || (cUnboundedRepeats != max && max > cMaxRepeats)) {
+        return ErrorCode{ErrorCodeEnum::InvalidQuantifier};
+    }
+    m_pos = pos + 1;
+    min_repeats = min;
+    max_repeats = max;
+    return true;
+}
+
+auto Parser::fold_case(ByteSet bytes) const -> ByteSet {
+    if (false == m_case_insensitive) {
+        return bytes;
+    }
+    constexpr int cCaseOffset{'a' - 'A'};
+    for (int b{'A'}; b <= 'Z'; ++b) {
+        if (bytes.test(b) || bytes.test(b + cCaseOffset)) {
+            bytes.set(b);
+            bytes.set(b + cCaseOffset);
+        }
+    }
+    return bytes;
+}
+
+auto Parser::add_node(AstNode node) -> size_t {
+    m_nodes.emplace_back(std::move(node));
+    return m_nodes.size() - 1;
+}
+
+auto NfaCompiler::compile(size_t node_idx, uint32_t next_state)
+        -> ystdlib::error_handling::Result<uint32_t> {
+    auto const& node{m_nodes[node_idx]};
+    switch (node.type) {
+        case AstNode::Type::Empty:
+            return next_state;
+        case AstNode::Type::Bytes:
+            return add_state(
+                    NfaState{
+                            .type = NfaState::Type::Consume,
+                            .bytes = node.bytes,
+                            .next_states = {next_state}
+                    }
+            );
+        case AstNode::Type::Concatenation: {
+            auto state{next_state};
+            for (auto it{node.children.rbegin()}; node.children.rend() != it; ++it) {
+                state = YSTDLIB_ERROR_HANDLING_TRYX(compile(*it, state));
+            }
+            return state;
+        }
+        case AstNode::Type::Alternation: {
+            vector<uint32_t> child_states;
+            for (auto const child : node.children) {
+                child_states.push_back(YSTDLIB_ERROR_HANDLING_TRYX(compile(child, next_state)));
+            }
+            auto const split_state{YSTDLIB_ERROR_HANDLING_TRYX(add_epsilon_state())};
+            m_states[split_state].next_states = std::move(child_states);
+            return split_state;
+        }
+        case AstNode::Type::Repeat: {
+            auto const child{node.children.front()};
+            auto state{next_state};
+            if (cUnboundedRepeats == node.max_repeats) {
+                // A loop that either matches the child again or exits
+                auto const loop_state{YSTDLIB_ERROR_HANDLING_TRYX(add_epsilon_state())};
+                auto const child_state{YSTDLIB_ERROR_HANDLING_TRYX(compile(child, loop_state))};
+                m_states[loop_state].next_states = {child_state, next_state};
+                state = loop_state;
+            } else {
+                // Nested optional matches of the child, each of which can exit the repetition
+                for (size_t i{node.min_repeats}; i < node.max_repeats; ++i) {
+                    auto const optional_state{YSTDLIB_ERROR_HANDLING_TRYX(add_epsilon_state())};
+                    auto const child_state{YSTDLIB_ERROR_HANDLING_TRYX(compile(child, state))};
+                    m_states[optional_state].next_states = {child_state, next_state};
+                    state = optional_state;
+                }
+            }
+            for (size_t i{0}; i < node.min_repeats; ++i) {
+                state = YSTDLIB_ERROR_HANDLING_TRYX(compile(child, state));
+            }
+            return state;
+        }
+        default:
+            return ErrorCode{ErrorCodeEnum::IllegalState};
+    }
+}
+
+auto NfaCompiler::add_state(NfaState state) -> ystdlib::error_handling::Result<uint32_t> {
+    if (m_states.size() >= cMaxNumNfaStates) {
+        return ErrorCode{ErrorCodeEnum::RegexTooLarge};
+    }
+    m_states.emplace_back(std::move(state));
+    return static_cast<uint32_t>(m_states.size() - 1);
+}
+
+auto ends_with_end_anchor(string_view regex) -> bool {
+    if (regex.empty() || cRegexEndAnchor != regex.back()) {
+        return false;
+    }
+    size_t num_preceding_escape_chars{0};
+    for (auto it{regex.rbegin() + 1}; regex.rend() != it && cEscapeChar == *it; ++it) {
+        ++num_preceding_escape_chars;
+    }
+    return 0 == num_preceding_escape_chars % 2;
+}
+
+template <typename Predicate>
+auto create_byte_set(Predicate predicate) -> ByteSet {
+    ByteSet bytes;
+    for (size_t b{0}; b < bytes.size(); ++b) {
+        if (predicate(static_cast<int>(b))) {
+            bytes.set(b);
+        }
+    }
+    return bytes;
+}
+}  // namespace
+
+auto RegexMatcher::create(string_view regex, bool case_insensitive)
+        -> ystdlib::error_handling::Result<RegexMatcher> {
+    auto body{regex};
+    // Like the wildcard translator, allow repeated anchors
+    bool anchored_at_start{false};
+    while (false == body.empty() && cRegexStartAnchor == body.front()) {
+        anchored_at_start = true;
+        body.remove_prefix(1);
+    }
+    bool anchored_at_end{false};
+    while (ends_with_end_anchor(body)) {
+        anchored_at_end = true;
+        body.remove_suffix(1);
+    }
+
+    Parser parser{body, case_insensitive};
+    auto const root{YSTDLIB_ERROR_HANDLING_TRYX(parser.parse())};
+    auto const& nodes{parser.get_nodes()};
+
+    RegexMatcher matcher{string{regex}, case_insensitive, anchored_at_start, anchored_at_end};
+    NfaCompiler compiler{nodes, matcher.m_nfa_states};
+    matcher.m_nfa_match_state = YSTDLIB_ERROR_HANDLING_TRYX(compiler.add_state(
+            NfaState{.type = NfaState::Type::Match, .bytes = {}, .next_states = {}}
+    ));
+    matcher.m_nfa_start_state
+            = YSTDLIB_ERROR_HANDLING_TRYX(compiler.compile(root, matcher.m_nfa_match_state));
+
+    StateSetScratch scratch;
+    scratch.visit_generations.resize(matcher.m_nfa_states.size(), 0);
+    ++scratch.generation;
+    matcher.add_epsilon_closure(matcher.m_nfa_start_state, matcher.m_nfa_start_closure, scratch);
+    std::ranges::sort(matcher.m_nfa_start_closure);
+
+    matcher.compute_byte_classes();
+    matcher.build_dfa();
+
+    string wildcard_superset;
+    if (false == anchored_at_start) {
+        wildcard_superset.push_back(cZeroOrMoreCharsWildcard);
+    }
+    wildcard_superset += YSTDLIB_ERROR_HANDLING_TRYX(regex_to_wildcard(
+            body,
+            {case_insensitive,
+             /*add_prefix_suffix_wildcards=*/false,
+             /*translate_to_superset=*/true}
+    ));
+    // Even with an end anchor, the string may end with a trailing newline
+    wildcard_superset.push_back(cZeroOrMoreCharsWildcard);
+    matcher.m_wildcard_superset = clean_up_wildcard_search_string(wildcard_superset);
+
+    return matcher;
+}
+
+auto RegexMatcher::matches(string_view str) const -> bool {
+    return uses_dfa() ? dfa_matches(str) : nfa_matches(str);
+}
+
+auto RegexMatcher::compute_byte_classes() -> void {
+    // Refine the partition of bytes with each consuming state's set of bytes
+    constexpr size_t cNumBytes{256};
+    m_byte_classes.fill(0);
+    m_num_byte_classes = 1;
+    for (auto const& state : m_nfa_states) {
+        if (NfaState::Type::Consume != state.type) {
+            continue;
+        }
+        std::array<int, cNumBytes * 2> refined_class_ids{};
+        refined_class_ids.fill(-1);
+        size_t num_refined_classes{0};
+        for (size_t b{0}; b < cNumBytes; ++b) {
+            auto const key{m_byte_classes.at(b) * 2ULL + (state.bytes.test(b) ? 1ULL : 0ULL)};
+            if (refined_class_ids.at(key) < 0) {
+                refined_class_ids.at(key) = static_cast<int>(num_refined_classes++);
+            }
+            m_byte_classes.at(b) = static_cast<uint8_t>(refined_class_ids.at(key));
+        }
+        m_num_byte_classes = num_refined_classes;
+    }
+}
+
+auto RegexMatcher::build_dfa() -> void {
+    // The first byte in each class represents the class
+    vector<uint8_t> class_representatives(m_num_byte_classes, 0);
+    vector<bool> is_class_represented(m_num_byte_classes, false);
+    for (size_t b{0}; b < m_byte_classes.size(); ++b) {
+        auto const byte_class{m_byte_classes.at(b)};
+        if (false == is_class_represented[byte_class]) {
+            is_class_represented[byte_class] = true;
+            class_representatives[byte_class] = static_cast<uint8_t>(b);
+        }
+    }
+
+    std::map<vector<uint32_t>, uint32_t> state_set_to_dfa_state;
+    vector<vector<uint32_t>> dfa_state_sets;
+    auto const add_dfa_state = [&](vector<uint32_t> const& state_set) -> uint32_t {
+        auto const [it, inserted]{state_set_to_dfa_state.try_emplace(
+                state_set,
+                static_cast<uint32_t>(dfa_state_sets.size())
+        )};
+        if (inserted) {
+            dfa_state_sets.push_back(state_set);
+        }
+        return it->second;
+    };
+    add_dfa_state({});
+    add_dfa_state(m_nfa_start_closure);
+
+    StateSetScratch scratch;
+    scratch.visit_generations.resize(m_nfa_states.size(), 0);
+    vector<uint32_t> next_state_set;
+    vector<uint32_t> transitions;
+    size_t work{0};
+    for (size_t dfa_state{0}; dfa_state < dfa_state_sets.size(); ++dfa_state) {
+        for (size_t byte_class{0}; byte_class < m_num_byte_classes; ++byte_class) {
+            work += compute_next_states(
+                    dfa_state_sets[dfa_state],
+                    class_representatives[byte_class],
+                    next_state_set,
+                    scratch
+            );
+            transitions.push_back(add_dfa_state(next_state_set));
+            if (dfa_state_sets.size() > cMaxNumDfaStates || work > cMaxDfaConstructionWork) {
+                // Fall back to simulating the NFA
+                return;
+            }
+        }
+    }
+
+    m_dfa_transitions = std::move(transitions);
+    m_dfa_accepting_states.reserve(dfa_state_sets.size());
+    for (auto const& state_set : dfa_state_sets) {
+        m_dfa_accepting_states.push_back(contains_match_state(state_set));
+    }
+}
+
+auto RegexMatcher::add_epsilon_closure(
+        uint32_t state_id,
+        vector<uint32_t>& states,
+        StateSetScratch& scratch
+) const -> void {
+    vector<uint32_t> pending_states{state_id};
+    while (false == pending_states.empty()) {
+        auto const id{pending_states.back()};
+        pending_states.pop_back();
+        if (scratch.generation == scratch.visit_generations[id]) {
+            continue;
+        }
+        scratch.visit_generations[id] = scratch.generation;
+
+        auto const& state{m_nfa_states[id]};
+        if (NfaState::Type::Epsilon == state.type) {
+            // Push in reverse so that the states are visited in order
+            for (auto it{state.next_states.rbegin()}; state.next_states.rend() != it; ++it) {
+                pending_states.push_back(*it);
+            }
+        } else {
+            states.push_back(id);
+        }
+    }
+}
+
+auto RegexMatcher::compute_next_states(
+        vector<uint32_t> const& states,
+        uint8_t byte,
+        vector<uint32_t>& next_states,
+        StateSetScratch& scratch
+) const -> size_t {
+    next_states.clear();
+    ++scratch.generation;
+    for (auto const id : states) {
+        auto const& state{m_nfa_states[id]};
+        if (NfaState::Type::Consume == state.type && state.bytes.test(byte)) {
+            add_epsilon_closure(state.next_states.front(), next_states, scratch);
+        }
+    }
+    if (false == m_anchored_at_start) {
+        for (auto const id : m_nfa_start_closure) {
+            if (scratch.generation != scratch.visit_generations[id]) {
+                scratch.visit_generations[id] = scratch.generation;
+                next_states.push_back(id);
+            }
+        }
+    }
+    std::ranges::sort(next_states);
+    return states.size() + next_states.size();
+}
+
+auto RegexMatcher::contains_match_state(vector<uint32_t> const& states) const -> bool {
+    return std::ranges::binary_search(states, m_nfa_match_state);
+}
+
+auto RegexMatcher::dfa_matches(string_view str) const -> bool {
+    auto state{cStartDfaState};
+    for (size_t i{0}; i < str.size(); ++i) {
+        if (m_dfa_accepting_states[state]) {
+            if (false == m_anchored_at_end) {
+                return true;
+            }
+            if (i + 1 == str.size() && '\n' == str[i]) {
+                return true;
+            }
+        }
+        auto const byte_class{m_byte_classes.at(static_cast<uint8_t>(str[i]))};
+        state = m_dfa_transitions[state * m_num_byte_classes + byte_class];
+        if (cDeadDfaState == state) {
+            return false;
+        }
+    }
+    return m_dfa_accepting_states[state];
+}
+
+auto RegexMatcher::nfa_matches(string_view str) const -> bool {
+    StateSetScratch scratch;
+    scratch.visit_generations.resize(m_nfa_states.size(), 0);
+    auto states{m_nfa_start_closure};
+    vector<uint32_t> next_states;
+    for (size_t i{0}; i < str.size(); ++i) {
+        if (contains_match_state(states)) {
+            if (false == m_anchored_at_end) {
+                return true;
+            }
+            if (i + 1 == str.size() && '\n' == str[i]) {
+                return true;
+            }
+        }
+        compute_next_states(states, static_cast<uint8_t>(str[i]), next_states, scratch);
+        if (next_states.empty()) {
+            return false;
+        }
+        std::swap(states, next_states);
+    }
+    return contains_match_state(states);
+}
+}  // namespace clp::regex_utils
@@ -0,0 +1,210 @@
+#ifndef CLP_REGEX_UTILS_REGEXMATCHER_HPP
+#define CLP_REGEX_UTILS_REGEXMATCHER_HPP
+
+#include <array>
+#include <bitset>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <ystdlib/error_handling/Result.hpp>
+
+namespace clp::regex_utils {
+/**
+ * Matches strings against a regex in time linear in the length of the string.
+ *
+ * The regex is compiled once into a Thompson NFA, which is then converted into a DFA over the
+ * equivalence classes of bytes that the regex can't distinguish. If the DFA would have too many
+ * states, the matcher instead simulates the NFA, which is slower but still linear in the length of
+ * the string. Either way, the matcher is immutable after creation, so it can be shared between
+ * threads.
+ *
+ * The supported syntax is the subset of POSIX ERE / PCRE syntax that can be matched by a finite
+ * automaton:
+ * - literals, `.` (any byte except `\n`), and escaped metacharacters;
+ * - the escape sequences `\d`, `\D`, `\w`, `\W`, `\s`, `\S`, `\t`, `\n`, `\r`, `\f`, `\v` and
+ *   `\xHH`;
+ * - character sets (e.g., `[a-z_]`, `[^\d.]`);
+ * - capturing and non-capturing (`(?:...)`) groups, and alternation (`|`);
+ * - the quantifiers `*`, `+`, `?`, `{n}`, `{n,}` and `{n,m}`, optionally lazy (which doesn't
+ *   affect whether a string matches);
+ * - a start anchor `^` at the beginning of the regex and an end anchor `$` at the end of the regex.
+ *
+ * Like `grep`, a regex without anchors matches any string that contains a match (i.e., the search
+ * is a substring search). `$` also matches before a trailing `\n`. Strings are matched byte-wise,
+ * so non-ASCII characters can only be matched literally or by byte-wise classes (e.g., `.`).
+ */
+class RegexMatcher {
+public:
+    // Types
+    /**
+     * A state in the regex's Thompson NFA.
+     */
+    struct NfaState {
+        enum class Type : uint8_t {
+            // Consumes a byte in `bytes` and transitions to `next_states[0]`
+            Consume,
+            // Transitions to each of `next_states` without consuming a byte
+            Epsilon,
+            // Accepts
+            Match,
+        };
+
+        Type type{Type::Epsilon};
+        std::bitset<256> bytes;
+        std::vector<uint32_t> next_states;
+    };
+
+    // Factory function
+    /**
+     * @param regex
+     * @param case_insensitive Whether to match the regex case-insensitively.
+     * @return A result containing the newly created matcher on success, or an error code
+     * indicating the failure:
+     * - ErrorCodeEnum::IllegalCaret if `^` isn't at the beginning of the regex.
+     * - ErrorCodeEnum::IllegalDollarSign if `$` isn't at the end of the regex.
+     * - ErrorCodeEnum::IllegalEscapeSequence if the regex contains an unknown escape sequence.
+     * - ErrorCodeEnum::UnmatchedParenthesis if the regex contains an unmatched `(` or `)`.
+     * - ErrorCodeEnum::IncompleteCharsetStructure if a character set isn't closed.
+     * - ErrorCodeEnum::InvalidCharsetRange if a character set contains a reversed range.
+     * - ErrorCodeEnum::InvalidQuantifier if a quantifier has nothing to repeat or its bounds are
+     *   invalid.
+     * - ErrorCodeEnum::UnsupportedRegexFeature if the regex uses a feature that can't be matched by
+     *   a finite automaton (e.g., backreferences or lookarounds).
+     * - ErrorCodeEnum::RegexTooLarge if the compiled regex would be too large.
+     */
+    [[nodiscard]] static auto create(std::string_view regex, bool case_insensitive)
+            -> ystdlib::error_handling::Result<RegexMatcher>;
+
+    // Methods
+    /**
+     * @param str
+     * @return Whether `str` contains a match for the regex (or matches it entirely, if the regex is
+     * anchored at both ends).
+     */
+    [[nodiscard]] auto matches(std::string_view str) const -> bool;
+
+    [[nodiscard]] auto get_regex() const -> std::string const& { return m_regex; }
+
+    [[nodiscard]] auto is_case_insensitive() const -> bool { return m_case_insensitive; }
+
+    /**
+     * @return A wildcard query that matches every string the regex matches (and possibly more),
+     * which can be used to prune the search space before verifying candidates with `matches`.
+     */
+    [[nodiscard]] auto get_wildcard_superset() const -> std::string const& {
+        return m_wildcard_superset;
+    }
+
+    /**
+     * @return Whether the regex was compiled into a DFA (as opposed to being matched by simulating
+     * its NFA).
+     */
+    [[nodiscard]] auto uses_dfa() const -> bool { return false == m_dfa_transitions.empty(); }
+
+private:
+    // Types
+    /**
+     * Scratch space for computing sets of NFA states, which marks the states visited while
+     * computing the current set with the current generation.
+     */
+    struct StateSetScratch {
+        std::vector<uint32_t> visit_generations;
+        uint32_t generation{0};
+    };
+
+    // Constants
+    static constexpr uint32_t cDeadDfaState{0};
+    static constexpr uint32_t cStartDfaState{1};
+
+    // Constructor
+    RegexMatcher(
+            std::string regex,
+            bool case_insensitive,
+            bool anchored_at_start,
+            bool anchored_at_end
+    )
+            : m_regex{std::move(regex)},
+              m_case_insensitive{case_insensitive},
+              m_anchored_at_start{anchored_at_start},
+              m_anchored_at_end{anchored_at_end} {}
+
+    // Methods
+    /**
+     * Partitions bytes into the equivalence classes that no NFA state distinguishes.
+     */
+    auto compute_byte_classes() -> void;
+
+    /**
+     * Converts the NFA into a DFA using subset construction, unless the DFA would have too many
+     * states.
+     */
+    auto build_dfa() -> void;
+
+    /**
+     * Adds the consuming and accepting states in the epsilon closure of `state_id` to `states`,
+     * skipping states already visited in the current generation of `scratch`.
+     * @param state_id
+     * @param states
+     * @param scratch
+     */
+    auto add_epsilon_closure(
+            uint32_t state_id,
+            std::vector<uint32_t>& states,
+            StateSetScratch& scratch
+    ) const -> void;
+
+    /**
+     * Computes the set of NFA states reachable from `states` after consuming `byte`, closed under
+     * epsilon transitions. If the regex isn't anchored at the start, the set also includes the
+     * start state's closure, so that a match can begin at any position.
+     * @param states
+     * @param byte
+     * @param next_states Returns the sorted set of states.
+     * @param scratch
+     * @return The number of NFA states visited.
+     */
+    auto compute_next_states(
+            std::vector<uint32_t> const& states,
+            uint8_t byte,
+            std::vector<uint32_t>& next_states,
+            StateSetScratch& scratch
+    ) const -> size_t;
+
+    /**
+     * @param states
+     * @return Whether `states` contains the accepting state.
+     */
+    [[nodiscard]] auto contains_match_state(std::vector<uint32_t> const& states) const -> bool;
+
+    [[nodiscard]] auto dfa_matches(std::string_view str) const -> bool;
+
+    [[nodiscard]] auto nfa_matches(std::string_view str) const -> bool;
+
+    // Variables
+    std::string m_regex;
+    bool m_case_insensitive;
+    bool m_anchored_at_start;
+    bool m_anchored_at_end;
+    std::string m_wildcard_superset;
+
+    std::vector<NfaState> m_nfa_states;
+    uint32_t m_nfa_start_state{0};
+    uint32_t m_nfa_match_state{0};
+    std::vector<uint32_t> m_nfa_start_closure;
+
+    std::array<uint8_t, 256> m_byte_classes{};
+    size_t m_num_byte_classes{1};
+
+    // The DFA's transitions, indexed by `state * m_num_byte_classes + byte_class`. State
+    // `cDeadDfaState` is the dead state and state 1 is the start state. Empty if the NFA is
+    // simulated instead.
+    std::vector<uint32_t> m_dfa_transitions;
+    std::vector<bool> m_dfa_accepting_states;
+};
+}  // namespace clp::regex_utils
+
+#endif  // CLP_REGEX_UTILS_REGEXMATCHER_HPP
@@ -13,10 +13,12 @@ class RegexToWildcardTranslatorConfig {
 public:
     RegexToWildcardTranslatorConfig(
             bool case_insensitive_wildcard,
-            bool add_prefix_suffix_wildcards
+            bool add_prefix_suffix_wildcards,
+            bool translate_to_superset = false
     )
             : m_case_insensitive_wildcard{case_insensitive_wildcard},
-              m_add_prefix_suffix_wildcards{add_prefix_suffix_wildcards} {}
+              m_add_prefix_suffix_wildcards{add_prefix_suffix_wildcards},
+              m_translate_to_superset{translate_to_superset} {}
 
     /**
      * @return True if the final translated wildcard string will be fed into a case-insensitive
@@ -36,10 +38,19 @@ public:
         return m_add_prefix_suffix_wildcards;
     }
 
+    /**
+     * @return True if patterns that have no equivalent wildcard (e.g., quantifiers on single
+     * characters, character sets, groups, and alternations) should be approximated by wildcards
+     * instead of failing the translation. The translated wildcard then matches every string that
+     * the regex matches, but may match others too, so matches must be verified against the regex.
+     */
+    [[nodiscard]] auto translate_to_superset() const -> bool { return m_translate_to_superset; }
+
 private:
     // Variables
     bool m_case_insensitive_wildcard;
     bool m_add_prefix_suffix_wildcards;
+    bool m_translate_to_superset;
 };
 }  // namespace clp::regex_utils
 
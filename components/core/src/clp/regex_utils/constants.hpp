@@ -24,6 +24,35 @@ constexpr size_t cCharBitarraySize = 128;
     return bit_array;
 }
 
+/**
+ * @param c
+ * @return The value of hex digit `c`, or -1 if `c` isn't a hex digit.
+ */
+[[nodiscard]] constexpr auto hex_digit_to_value(char c) -> int {
+    constexpr int cFirstHexLetterValue{10};
+    if (c >= '0' && c <= '9') {
+        return c - '0';
+    }
+    if (c >= 'a' && c <= 'f') {
+        return c - 'a' + cFirstHexLetterValue;
+    }
+    if (c >= 'A' && c <= 'F') {
+        return c - 'A' + cFirstHexLetterValue;
+    }
+    return -1;
+}
+
+/**
+ * @param lut
+ * @param ch
+ * @return Whether `ch` is an ASCII character that's set in the lookup table.
+ */
+[[nodiscard]] constexpr auto
+is_in_char_bit_array(std::array<bool, cCharBitarraySize> const& lut, char ch) -> bool {
+    auto const byte{static_cast<unsigned char>(ch)};
+    return byte < cCharBitarraySize && lut.at(byte);
+}
+
 // Regex meta characters
 constexpr char cRegexZeroOrMore{'*'};
 constexpr char cRegexOneOrMore{'+'};
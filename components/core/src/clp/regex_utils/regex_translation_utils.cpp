@@ -1,9 +1,13 @@
 #include "regex_utils/regex_translation_utils.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <optional>
 #include <string>
 #include <string_view>
+#include <vector>
 
 #include <string_utils/constants.hpp>
 #include <string_utils/string_utils.hpp>
@@ -17,11 +21,18 @@ namespace clp::regex_utils {
 using clp::string_utils::cSingleCharWildcard;
 using clp::string_utils::cZeroOrMoreCharsWildcard;
 using clp::string_utils::is_alphabet;
+using clp::string_utils::is_decimal_digit;
 using std::optional;
 using std::string;
 using std::string_view;
+using std::vector;
 
 namespace {
+constexpr size_t cUnboundedRepeats{std::numeric_limits<size_t>::max()};
+// Bounded quantifiers are expanded into at most this many copies of their atom, to bound the
+// length of superset translations
+constexpr size_t cMaxExpandedRepeats{1000};
+
 /**
  * Class for storing regex translation analysis states, capture group, quantifier information, etc.
  */
@@ -51,12 +62,23 @@ public:
         End,
     };
 
+    /**
+     * A group (i.e., parentheses) being translated into a superset.
+     */
+    struct Group {
+        // The position in the wildcard string where the group's translation begins
+        size_t wildcard_begin_pos;
+        bool has_alternation;
+    };
+
     // Constructor
-    TranslatorState() = default;
+    explicit TranslatorState(string_view::const_iterator regex_end) : m_regex_end{regex_end} {}
 
     // Getters
     [[nodiscard]] auto get_state() const -> RegexPatternState { return m_state; }
 
+    [[nodiscard]] auto get_regex_end() const -> string_view::const_iterator { return m_regex_end; }
+
     [[nodiscard]] auto get_charset_begin_it() const -> optional<string_view::const_iterator> {
         return m_charset_begin_it;
     }
@@ -70,10 +92,37 @@ public:
 
     auto invalidate_charset_begin_it() -> void { m_charset_begin_it.reset(); }
 
+    // Superset translation state
+    [[nodiscard]] auto get_last_atom_begin_pos() const -> size_t { return m_last_atom_begin_pos; }
+
+    auto set_last_atom_begin_pos(size_t pos) -> void { m_last_atom_begin_pos = pos; }
+
+    [[nodiscard]] auto is_after_quantifier() const -> bool { return m_is_after_quantifier; }
+
+    auto set_after_quantifier(bool is_after_quantifier) -> void {
+        m_is_after_quantifier = is_after_quantifier;
+    }
+
+    [[nodiscard]] auto get_open_groups() -> vector<Group>& { return m_open_groups; }
+
+    [[nodiscard]] auto has_top_level_alternation() const -> bool {
+        return m_has_top_level_alternation;
+    }
+
+    auto set_top_level_alternation() -> void { m_has_top_level_alternation = true; }
+
 private:
     // Members
     RegexPatternState m_state{RegexPatternState::Normal};
     optional<string_view::const_iterator> m_charset_begin_it;
+    string_view::const_iterator m_regex_end;
+
+    // The position in the wildcard string where the translation of the last atom (i.e., the
+    // pattern a quantifier would apply to) begins
+    size_t m_last_atom_begin_pos{0};
+    bool m_is_after_quantifier{false};
+    vector<Group> m_open_groups;
+    bool m_has_top_level_alternation{false};
 };
 
 /**
@@ -102,6 +151,17 @@ using StateTransitionFuncSig
  */
 [[nodiscard]] StateTransitionFuncSig normal_state_transition;
 
+/**
+ * Handles the patterns that only have a superset translation (quantifiers, groups, and
+ * alternations) before deferring to `normal_state_transition`.
+ *
+ * A quantifier replaces the translation of the atom it applies to with enough copies of it to
+ * cover the minimum number of repeats, followed by a `*` if more repeats are allowed. A group with
+ * an alternation is translated into a `*`, and so is the whole regex if it has an alternation
+ * outside of any group.
+ */
+[[nodiscard]] StateTransitionFuncSig superset_normal_state_transition;
+
 /**
  * Attempts to translate regex wildcard patterns that start with `.` character.
  *
@@ -152,6 +212,50 @@ using StateTransitionFuncSig
  */
 [[nodiscard]] StateTransitionFuncSig final_state_cleanup;
 
+/**
+ * Parses a bounded quantifier (e.g., `{2}`, `{2,}`, or `{2,5}`).
+ * @param state
+ * @param it The position of the quantifier's opening `{`. If the quantifier is valid, returns the
+ * position of its closing `}`.
+ * @param min_repeats Returns the quantifier's minimum number of repeats.
+ * @param max_repeats Returns the quantifier's maximum number of repeats.
+ * @return Whether `it` is the start of a bounded quantifier.
+ */
+[[nodiscard]] auto parse_bounded_quantifier(
+        TranslatorState const& state,
+        string_view::const_iterator& it,
+        size_t& min_repeats,
+        size_t& max_repeats
+) -> bool;
+
+/**
+ * Replaces the translation of the last atom with the translation of the atom repeated between
+ * `min_repeats` and `max_repeats` times.
+ * @param state
+ * @param wildcard_str
+ * @param min_repeats
+ * @param max_repeats
+ */
+auto repeat_last_atom(
+        TranslatorState& state,
+        string& wildcard_str,
+        size_t min_repeats,
+        size_t max_repeats
+) -> void;
+
+/**
+ * @param charset_begin_it
+ * @param charset_len
+ * @param config
+ * @return The single character that the given character set is equivalent to, or std::nullopt if
+ * the set isn't equivalent to a single character.
+ */
+[[nodiscard]] auto reduce_charset(
+        string_view::const_iterator charset_begin_it,
+        size_t charset_len,
+        RegexToWildcardTranslatorConfig const& config
+) -> optional<char>;
+
 /**
  * Appends a single character as a literal to the wildcard string.
  *
@@ -209,6 +313,85 @@ auto normal_state_transition(
     return ErrorCodeEnum::Success;
 }
 
+auto superset_normal_state_transition(
+        TranslatorState& state,
+        string_view::const_iterator& it,
+        string& wildcard_str,
+        RegexToWildcardTranslatorConfig const& config
+) -> ErrorCode {
+    auto& open_groups{state.get_open_groups()};
+    auto const ch{*it};
+    switch (ch) {
+        case cRegexZeroOrOne:
+            if (state.is_after_quantifier()) {
+                // A lazy quantifier matches the same strings as a greedy one
+                state.set_after_quantifier(false);
+                return ErrorCodeEnum::Success;
+            }
+            repeat_last_atom(state, wildcard_str, 0, 1);
+            return ErrorCodeEnum::Success;
+        case cRegexZeroOrMore:
+            repeat_last_atom(state, wildcard_str, 0, cUnboundedRepeats);
+            return ErrorCodeEnum::Success;
+        case cRegexOneOrMore:
+            repeat_last_atom(state, wildcard_str, 1, cUnboundedRepeats);
+            return ErrorCodeEnum::Success;
+        case '{': {
+            size_t min_repeats{};
+            size_t max_repeats{};
+            if (parse_bounded_quantifier(state, it, min_repeats, max_repeats)) {
+                if (min_repeats > max_repeats) {
+                    return ErrorCodeEnum::InvalidQuantifier;
+                }
+                repeat_last_atom(state, wildcard_str, min_repeats, max_repeats);
+                return ErrorCodeEnum::Success;
+            }
+            // A `{` that doesn't start a quantifier is a literal
+            break;
+        }
+        case '(':
+            if (state.get_regex_end() != it + 1 && cRegexZeroOrOne == *(it + 1)) {
+                // Only non-capturing groups are supported (not lookarounds, named groups, etc.)
+                if (state.get_regex_end() == it + 2 || ':' != *(it + 2)) {
+                    return ErrorCodeEnum::UnsupportedRegexFeature;
+                }
+                it += 2;
+            }
+            open_groups.push_back({wildcard_str.size(), false});
+            state.set_after_quantifier(false);
+            return ErrorCodeEnum::Success;
+        case ')': {
+            if (open_groups.empty()) {
+                return ErrorCodeEnum::UnmatchedParenthesis;
+            }
+            auto const group{open_groups.back()};
+            open_groups.pop_back();
+            if (group.has_alternation) {
+                wildcard_str.resize(group.wildcard_begin_pos);
+                wildcard_str += cZeroOrMoreCharsWildcard;
+            }
+            state.set_last_atom_begin_pos(group.wildcard_begin_pos);
+            state.set_after_quantifier(false);
+            return ErrorCodeEnum::Success;
+        }
+        case '|':
+            if (open_groups.empty()) {
+                state.set_top_level_alternation();
+            } else {
+                open_groups.back().has_alternation = true;
+            }
+            state.set_last_atom_begin_pos(wildcard_str.size());
+            state.set_after_quantifier(false);
+            return ErrorCodeEnum::Success;
+        default:
+            break;
+    }
+
+    state.set_last_atom_begin_pos(wildcard_str.size());
+    state.set_after_quantifier(false);
+    return normal_state_transition(state, it, wildcard_str, config);
+}
+
 auto dot_state_transition(
         TranslatorState& state,
         string_view::const_iterator& it,
@@ -218,9 +401,11 @@ auto dot_state_transition(
     switch (*it) {
         case cZeroOrMoreCharsWildcard:
             wildcard_str += cZeroOrMoreCharsWildcard;
+            state.set_after_quantifier(true);
             break;
         case cRegexOneOrMore:
             wildcard_str = wildcard_str + cSingleCharWildcard + cZeroOrMoreCharsWildcard;
+            state.set_after_quantifier(true);
             break;
         default:
             wildcard_str += cSingleCharWildcard;
@@ -236,14 +421,67 @@ auto escaped_state_transition(
         TranslatorState& state,
         string_view::const_iterator& it,
         string& wildcard_str,
-        [[maybe_unused]] RegexToWildcardTranslatorConfig const& config
+        RegexToWildcardTranslatorConfig const& config
 ) -> ErrorCode {
     auto const ch{*it};
-    if (false == cRegexEscapeSeqMetaCharsLut.at(ch)) {
+    state.set_next_state(TranslatorState::RegexPatternState::Normal);
+    if (is_in_char_bit_array(cRegexEscapeSeqMetaCharsLut, ch)) {
+        append_char_to_wildcard(ch, wildcard_str);
+        return ErrorCodeEnum::Success;
+    }
+    if (false == config.translate_to_superset()) {
         return ErrorCodeEnum::IllegalEscapeSequence;
     }
-    append_char_to_wildcard(ch, wildcard_str);
-    state.set_next_state(TranslatorState::RegexPatternState::Normal);
+
+    switch (ch) {
+        // Character classes
+        case 'd':
+        case 'D':
+        case 'w':
+        case 'W':
+        case 's':
+        case 'S':
+            wildcard_str += cSingleCharWildcard;
+            break;
+        case 't':
+            append_char_to_wildcard('\t', wildcard_str);
+            break;
+        case 'n':
+            append_char_to_wildcard('\n', wildcard_str);
+            break;
+        case 'r':
+            append_char_to_wildcard('\r', wildcard_str);
+            break;
+        case 'f':
+            append_char_to_wildcard('\f', wildcard_str);
+            break;
+        case 'v':
+            append_char_to_wildcard('\v', wildcard_str);
+            break;
+        case 'x': {
+            constexpr int cHexBase{16};
+            constexpr int cNumHexDigits{2};
+            if (state.get_regex_end() - it <= cNumHexDigits) {
+                return ErrorCodeEnum::IllegalEscapeSequence;
+            }
+            auto const high{hex_digit_to_value(*(it + 1))};
+            auto const low{hex_digit_to_value(*(it + 2))};
+            if (high < 0 || low < 0) {
+                return ErrorCodeEnum::IllegalEscapeSequence;
+            }
+            it += cNumHexDigits;
+            append_char_to_wildcard(static_cast<char>(high * cHexBase + low), wildcard_str);
+            break;
+        }
+        default:
+            // Escaped letters and digits that aren't handled above are unsupported features (e.g.,
+            // backreferences), while any other escaped character is a literal
+            if (is_alphabet(ch) || is_decimal_digit(ch) || '_' == ch) {
+                return ErrorCodeEnum::IllegalEscapeSequence;
+            }
+            append_char_to_wildcard(ch, wildcard_str);
+            break;
+    }
     return ErrorCodeEnum::Success;
 }
 
@@ -268,31 +506,22 @@ auto charset_state_transition(
         return ErrorCodeEnum::Success;
     }
 
-    auto const charset_len{it - charset_begin_it};
-    if (0 == charset_len || charset_len > 2) {
-        return ErrorCodeEnum::UnsupportedCharsetPattern;
+    auto const charset_len{static_cast<size_t>(it - charset_begin_it)};
+    if (config.translate_to_superset()
+        && (0 == charset_len || (1 == charset_len && cCharsetNegate == *charset_begin_it)))
+    {
+        // A `]` is a literal if it's the first member of the set
+        return ErrorCodeEnum::Success;
     }
 
-    auto const ch0{*charset_begin_it};
-    auto const ch1{*(charset_begin_it + 1)};
-    char parsed_char{};
-
-    if (1 == charset_len) {
-        if (cCharsetNegate == ch0 || cEscapeChar == ch0) {
-            return ErrorCodeEnum::UnsupportedCharsetPattern;
-        }
-        parsed_char = ch0;
-    } else {  // 2 == charset_len
-        if (cEscapeChar == ch0 && cRegexCharsetEscapeSeqMetaCharsLut.at(ch1)) {
-            parsed_char = ch1;
-        } else if (config.case_insensitive_wildcard() && is_same_char_opposite_case(ch0, ch1)) {
-            parsed_char = ch0 > ch1 ? ch0 : ch1;  // choose the lower case character
-        } else {
-            return ErrorCodeEnum::UnsupportedCharsetPattern;
-        }
+    auto const parsed_char{reduce_charset(charset_begin_it, charset_len, config)};
+    if (parsed_char.has_value()) {
+        append_char_to_wildcard(parsed_char.value(), wildcard_str);
+    } else if (config.translate_to_superset()) {
+        wildcard_str += cSingleCharWildcard;
+    } else {
+        return ErrorCodeEnum::UnsupportedCharsetPattern;
     }
-
-    append_char_to_wildcard(parsed_char, wildcard_str);
     state.invalidate_charset_begin_it();
     state.set_next_state(TranslatorState::RegexPatternState::Normal);
     return ErrorCodeEnum::Success;
@@ -335,10 +564,25 @@ auto final_state_cleanup(
         case TranslatorState::RegexPatternState::Charset:
         case TranslatorState::RegexPatternState::CharsetEscaped:
             return ErrorCodeEnum::IncompleteCharsetStructure;
+        case TranslatorState::RegexPatternState::Escaped:
+            if (config.translate_to_superset()) {
+                return ErrorCodeEnum::IllegalEscapeSequence;
+            }
+            break;
         default:
             break;
     }
 
+    if (config.translate_to_superset()) {
+        if (false == state.get_open_groups().empty()) {
+            return ErrorCodeEnum::UnmatchedParenthesis;
+        }
+        if (state.has_top_level_alternation()) {
+            wildcard_str = string(1, cZeroOrMoreCharsWildcard);
+            return ErrorCodeEnum::Success;
+        }
+    }
+
     if (TranslatorState::RegexPatternState::End != state.get_state()
         && config.add_prefix_suffix_wildcards())
     {
@@ -347,8 +591,98 @@ auto final_state_cleanup(
     return ErrorCodeEnum::Success;
 }
 
+auto parse_bounded_quantifier(
+        TranslatorState const& state,
+        string_view::const_iterator& it,
+        size_t& min_repeats,
+        size_t& max_repeats
+) -> bool {
+    // Parses a decimal number at `pos`, advancing `pos` past it
+    auto const parse_number = [&](string_view::const_iterator& pos) -> optional<size_t> {
+        constexpr size_t cDecimalBase{10};
+        auto const begin_pos{pos};
+        size_t number{0};
+        for (; state.get_regex_end() != pos && is_decimal_digit(*pos); ++pos) {
+            // Saturate rather than overflow, since larger bounds aren't expanded anyway
+            number = std::min(
+                    number * cDecimalBase + static_cast<size_t>(*pos - '0'),
+                    cMaxExpandedRepeats + 1
+            );
+        }
+        if (begin_pos == pos) {
+            return std::nullopt;
+        }
+        return number;
+    };
+
+    auto pos{it + 1};
+    auto const optional_min{parse_number(pos)};
+    if (false == optional_min.has_value() || state.get_regex_end() == pos) {
+        return false;
+    }
+    size_t const min{optional_min.value()};
+    size_t max{min};
+    if (',' == *pos) {
+        ++pos;
+        max = parse_number(pos).value_or(cUnboundedRepeats);
+    }
+    if (state.get_regex_end() == pos || '}' != *pos) {
+        return false;
+    }
+    it = pos;
+    min_repeats = min;
+    max_repeats = max;
+    return true;
+}
+
+auto repeat_last_atom(
+        TranslatorState& state,
+        string& wildcard_str,
+        size_t min_repeats,
+        size_t max_repeats
+) -> void {
+    auto const atom_begin_pos{state.get_last_atom_begin_pos()};
+    auto const atom{wildcard_str.substr(atom_begin_pos)};
+    wildcard_str.resize(atom_begin_pos);
+    auto const num_expanded_repeats{std::min(min_repeats, cMaxExpandedRepeats)};
+    for (size_t i{0}; i < num_expanded_repeats; ++i) {
+        wildcard_str += atom;
+    }
+    if (max_repeats > num_expanded_repeats && false == atom.empty()) {
+        wildcard_str += cZeroOrMoreCharsWildcard;
+    }
+    state.set_after_quantifier(true);
+}
+
+auto reduce_charset(
+        string_view::const_iterator charset_begin_it,
+        size_t charset_len,
+        RegexToWildcardTranslatorConfig const& config
+) -> optional<char> {
+    if (0 == charset_len || charset_len > 2) {
+        return std::nullopt;
+    }
+
+    auto const ch0{*charset_begin_it};
+    if (1 == charset_len) {
+        if (cCharsetNegate == ch0 || cEscapeChar == ch0) {
+            return std::nullopt;
+        }
+        return ch0;
+    }
+
+    auto const ch1{*(charset_begin_it + 1)};
+    if (cEscapeChar == ch0 && is_in_char_bit_array(cRegexCharsetEscapeSeqMetaCharsLut, ch1)) {
+        return ch1;
+    }
+    if (config.case_insensitive_wildcard() && is_same_char_opposite_case(ch0, ch1)) {
+        return ch0 > ch1 ? ch0 : ch1;  // choose the lower case character
+    }
+    return std::nullopt;
+}
+
 auto append_char_to_wildcard(char ch, string& wildcard_str) -> void {
-    if (cWildcardMetaCharsLut.at(ch)) {
+    if (is_in_char_bit_array(cWildcardMetaCharsLut, ch)) {
         wildcard_str += cEscapeChar;
     }
     wildcard_str += ch;
@@ -377,7 +711,7 @@ auto regex_to_wildcard(string_view regex_str, RegexToWildcardTranslatorConfig co
 
     string_view::const_iterator it{regex_str.cbegin()};
     string wildcard_str;
-    TranslatorState state;
+    TranslatorState state{regex_str.cend()};
 
     // If there is no starting anchor character, append multichar wildcard prefix
     if (cRegexStartAnchor == *it) {
@@ -390,7 +724,9 @@ auto regex_to_wildcard(string_view regex_str, RegexToWildcardTranslatorConfig co
     while (it != regex_str.cend()) {
         switch (state.get_state()) {
             case TranslatorState::RegexPatternState::Normal:
-                ec = normal_state_transition(state, it, wildcard_str, config);
+                ec = config.translate_to_superset()
+                             ? superset_normal_state_transition(state, it, wildcard_str, config)
+                             : normal_state_transition(state, it, wildcard_str, config);
                 break;
             case TranslatorState::RegexPatternState::Dot:
                 ec = dot_state_transition(state, it, wildcard_str, config);
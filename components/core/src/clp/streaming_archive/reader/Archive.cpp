@@ -87,6 +87,7 @@ void Archive::open(string const& path) {
     logtype_segment_index_path += '/';
     logtype_segment_index_path += cLogTypeSegmentIndexFilename;
     m_logtype_dictionary.open(logtype_dict_path, logtype_segment_index_path);
+    update_num_vars_per_logtype();
 
     // Open variables dictionary
     string var_dict_path = m_path;
@@ -111,6 +112,7 @@ void Archive::open(string const& path) {
 
 void Archive::close() {
     m_logtype_dictionary.close();
+    m_num_vars_per_logtype.clear();
     m_var_dictionary.close();
     m_segment_manager.close();
     m_segments_dir_path.clear();
@@ -120,11 +122,22 @@ void Archive::close() {
 
 void Archive::refresh_dictionaries() {
     m_logtype_dictionary.read_new_entries();
+    update_num_vars_per_logtype();
     m_var_dictionary.read_new_entries();
 }
 
 ErrorCode Archive::open_file(File& file, MetadataDB::FileIterator const& file_metadata_ix) {
-    return file.open_me(m_logtype_dictionary, file_metadata_ix, m_segment_manager);
+    auto const error_code = file.open_me(
+            m_logtype_dictionary,
+            m_num_vars_per_logtype,
+            file_metadata_ix,
+            m_segment_manager
+    );
+    if (ErrorCode_Success != error_code) {
+        return error_code;
+    }
+    load_num_vars_of_file_logtypes(file);
+    return ErrorCode_Success;
 }
 
 void Archive::close_file(File& file) {
@@ -239,4 +252,23 @@ void Archive::decompress_empty_directories(string const& output_dir) {
         }
     }
 }
+
+void Archive::update_num_vars_per_logtype() {
+    m_num_vars_per_logtype.resize(m_logtype_dictionary.get_num_entries(), cUnknownNumVars);
+}
+
+void Archive::load_num_vars_of_file_logtypes(File const& file) {
+    auto const num_logtypes = m_num_vars_per_logtype.size();
+    for (size_t msg_ix = 0; msg_ix < file.m_num_messages; ++msg_ix) {
+        auto const logtype_id = file.m_logtypes[msg_ix];
+        // Logtypes that aren't in the dictionary are left for the file's scan to report
+        if (logtype_id < 0 || static_cast<size_t>(logtype_id) >= num_logtypes) {
+            continue;
+        }
+        auto& num_vars = m_num_vars_per_logtype[logtype_id];
+        if (cUnknownNumVars == num_vars) {
+            num_vars = m_logtype_dictionary.get_entry(logtype_id).get_num_variables();
+        }
+    }
+}
 }  // namespace clp::streaming_archive::reader
@@ -1,12 +1,15 @@
 #ifndef CLP_STREAMING_ARCHIVE_READER_ARCHIVE_HPP
 #define CLP_STREAMING_ARCHIVE_READER_ARCHIVE_HPP
 
+#include <cstddef>
+#include <cstdint>
 #include <filesystem>
 #include <iterator>
 #include <list>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "../../ErrorCode.hpp"
 #include "../../LogTypeDictionaryReader.hpp"
@@ -187,12 +190,32 @@ public:
     }
 
 private:
+    // Constants
+    static constexpr size_t cUnknownNumVars{SIZE_MAX};
+
+    // Methods
+    /**
+     * Grows `m_num_vars_per_logtype` to cover any new logtype dictionary entries, without decoding
+     * them
+     */
+    void update_num_vars_per_logtype();
+    /**
+     * Adds the number of variables in each of the file's logtypes to `m_num_vars_per_logtype`, if
+     * it isn't there yet
+     * @param file
+     */
+    void load_num_vars_of_file_logtypes(File const& file);
+
     // Variables
     std::string m_id;
     std::string m_path;
     std::string m_segments_dir_path;
     LogTypeDictionaryReader m_logtype_dictionary;
     VariableDictionaryReader m_var_dictionary;
+    // Dense copy of each logtype's number of variables, used to scan segments without touching
+    // the dictionary entries. A logtype's count is only loaded (and its entry decoded) once a file
+    // containing it is opened, and is `cUnknownNumVars` until then.
+    std::vector<size_t> m_num_vars_per_logtype;
 
     SegmentManager m_segment_manager;
 
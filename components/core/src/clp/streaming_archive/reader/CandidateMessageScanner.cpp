@@ -0,0 +1,134 @@
+#include "CandidateMessageScanner.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace clp::streaming_archive::reader {
+void CandidateMessageScanner::open(
+        logtype_dictionary_id_t const* logtypes,
+        epochtime_t const* timestamps,
+        size_t num_messages,
+        std::vector<size_t> const& num_vars_per_logtype
+) {
+    m_logtypes = logtypes;
+    m_timestamps = timestamps;
+    m_num_messages = num_messages;
+    m_num_vars_per_logtype = &num_vars_per_logtype;
+    reset();
+}
+
+void CandidateMessageScanner::close() {
+    m_logtypes = nullptr;
+    m_timestamps = nullptr;
+    m_num_messages = 0;
+    m_num_vars_per_logtype = nullptr;
+    reset();
+}
+
+void CandidateMessageScanner::reset() {
+    m_query = nullptr;
+    m_num_candidates = 0;
+    m_next_candidate_ix = 0;
+    m_block_end_msg_ix = 0;
+    m_block_end_variables_ix = 0;
+}
+
+bool CandidateMessageScanner::find_next_candidate(
+        Query const& query,
+        size_t& msg_ix,
+        size_t& variables_ix
+) {
+    if (&query != m_query) {
+        reset();
+        m_query = &query;
+    }
+
+    while (true) {
+        if (m_next_candidate_ix < m_num_candidates) {
+            msg_ix = m_candidate_msg_ixs[m_next_candidate_ix];
+            variables_ix = m_candidate_variables_ixs[m_next_candidate_ix];
+            ++m_next_candidate_ix;
+            return true;
+        }
+
+        if (m_num_candidates > 0) {
+            // Skip past the rest of the previously scanned block
+            msg_ix = m_block_end_msg_ix;
+            variables_ix = m_block_end_variables_ix;
+            m_num_candidates = 0;
+            m_next_candidate_ix = 0;
+        }
+        if (msg_ix >= m_num_messages) {
+            return false;
+        }
+
+        scan_block(query, msg_ix, variables_ix);
+        if (0 == m_num_candidates) {
+            msg_ix = m_block_end_msg_ix;
+            variables_ix = m_block_end_variables_ix;
+        }
+    }
+}
+
+void CandidateMessageScanner::scan_block(
+        Query const& query,
+        size_t begin_msg_ix,
+        size_t begin_variables_ix
+) {
+    auto const end_msg_ix{std::min(m_num_messages, begin_msg_ix + cNumMessagesPerBlock)};
+    auto const& num_vars_per_logtype = *m_num_vars_per_logtype;
+
+    // Validate the block's logtypes up front so the scan below doesn't need to
+    uint64_t max_logtype_id{0};
+    for (auto msg_ix{begin_msg_ix}; msg_ix < end_msg_ix; ++msg_ix) {
+        max_logtype_id = std::max(max_logtype_id, static_cast<uint64_t>(m_logtypes[msg_ix]));
+    }
+    if (max_logtype_id >= num_vars_per_logtype.size()) {
+        throw OperationFailed(ErrorCode_Corrupt, __FILENAME__, __LINE__);
+    }
+
+    m_candidate_msg_ixs.resize(cNumMessagesPerBlock);
+    m_candidate_variables_ixs.resize(cNumMessagesPerBlock);
+    auto* candidate_msg_ixs = m_candidate_msg_ixs.data();
+    auto* candidate_variables_ixs = m_candidate_variables_ixs.data();
+
+    // An empty bitmap still needs a readable word, so use a local zero word in its place
+    auto const& bitmap = query.get_relevant_logtypes_bitmap();
+    uint64_t const empty_bitmap_word{0};
+    auto const* bitmap_words = bitmap.empty() ? &empty_bitmap_word : bitmap.data();
+    auto const num_bitmap_words{static_cast<uint64_t>(bitmap.size())};
+    auto const search_begin_timestamp{query.get_search_begin_timestamp()};
+    auto const search_end_timestamp{query.get_search_end_timestamp()};
+
+    // NOTE: This loop is intentionally branch-free: every message is written to the candidate
+    // buffers, but the number of candidates only advances for messages whose logtype is in the
+    // bitmap and whose timestamp is in the search time range. This keeps the scan running at
+    // memory bandwidth when few messages could match.
+    size_t num_candidates{0};
+    auto variables_ix{begin_variables_ix};
+    for (auto msg_ix{begin_msg_ix}; msg_ix < end_msg_ix; ++msg_ix) {
+        auto const logtype_id{static_cast<uint64_t>(m_logtypes[msg_ix])};
+        auto const word_ix{logtype_id / Query::cNumLogtypesPerBitmapWord};
+        auto const word_is_in_bitmap{static_cast<uint64_t>(word_ix < num_bitmap_words)};
+        auto const word{bitmap_words[word_is_in_bitmap * word_ix] & (0 - word_is_in_bitmap)};
+        auto const timestamp{m_timestamps[msg_ix]};
+        auto const is_candidate{
+                ((word >> (logtype_id % Query::cNumLogtypesPerBitmapWord)) & 1ULL)
+                & static_cast<uint64_t>(search_begin_timestamp <= timestamp)
+                & static_cast<uint64_t>(timestamp <= search_end_timestamp)
+        };
+
+        candidate_msg_ixs[num_candidates] = msg_ix;
+        candidate_variables_ixs[num_candidates] = variables_ix;
+        num_candidates += is_candidate;
+        variables_ix += num_vars_per_logtype[logtype_id];
+    }
+
+    m_num_candidates = num_candidates;
+    m_next_candidate_ix = 0;
+    m_block_end_msg_ix = end_msg_ix;
+    m_block_end_variables_ix = variables_ix;
+}
+}  // namespace clp::streaming_archive::reader
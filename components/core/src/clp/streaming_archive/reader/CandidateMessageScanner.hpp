@@ -0,0 +1,105 @@
+#ifndef CLP_STREAMING_ARCHIVE_READER_CANDIDATEMESSAGESCANNER_HPP
+#define CLP_STREAMING_ARCHIVE_READER_CANDIDATEMESSAGESCANNER_HPP
+
+#include <cstddef>
+#include <vector>
+
+#include "../../Defs.h"
+#include "../../ErrorCode.hpp"
+#include "../../Query.hpp"
+#include "../../TraceableException.hpp"
+
+namespace clp::streaming_archive::reader {
+/**
+ * Scans a file's logtype and timestamp columns for candidate messages, i.e., messages that could
+ * match a query based only on their logtypes and timestamps. The columns are scanned in blocks:
+ * each block is filtered against the query's relevant logtypes bitmap and time range, and the
+ * block's candidates are then returned one at a time.
+ */
+class CandidateMessageScanner {
+public:
+    // Types
+    class OperationFailed : public TraceableException {
+    public:
+        // Constructors
+        OperationFailed(ErrorCode error_code, char const* const filename, int line_number)
+                : TraceableException(error_code, filename, line_number) {}
+
+        // Methods
+        char const* what() const noexcept override {
+            return "streaming_archive::reader::CandidateMessageScanner operation failed";
+        }
+    };
+
+    // Constants
+    // Number of messages scanned at a time
+    static constexpr size_t cNumMessagesPerBlock{4096};
+
+    // Methods
+    /**
+     * Sets the columns to scan and discards any pending candidates
+     * @param logtypes
+     * @param timestamps
+     * @param num_messages
+     * @param num_vars_per_logtype The number of variables in each logtype in the dictionary
+     */
+    void open(
+            logtype_dictionary_id_t const* logtypes,
+            epochtime_t const* timestamps,
+            size_t num_messages,
+            std::vector<size_t> const& num_vars_per_logtype
+    );
+    /**
+     * Clears the columns and discards any pending candidates
+     */
+    void close();
+    /**
+     * Discards any pending candidates. This must be called whenever the caller's position in the
+     * columns changes other than by consuming the candidates this scanner returns.
+     */
+    void reset();
+
+    /**
+     * Finds the next candidate message for the given query, starting at the given position. The
+     * caller should advance its position past each returned candidate before calling this again.
+     * @param query
+     * @param msg_ix The index of the first message to scan. Returns the index of the candidate, or
+     * the number of messages if there are no more candidates.
+     * @param variables_ix The index of `msg_ix`'s first variable. Returns the index of the
+     * candidate's first variable, or the end of the variables if there are no more candidates.
+     * @return Whether a candidate was found
+     * @throw CandidateMessageScanner::OperationFailed if a message's logtype isn't in the
+     * dictionary
+     */
+    bool find_next_candidate(Query const& query, size_t& msg_ix, size_t& variables_ix);
+
+private:
+    // Methods
+    /**
+     * Finds the candidates in the block starting at the given position
+     * @param query
+     * @param begin_msg_ix
+     * @param begin_variables_ix
+     * @throw CandidateMessageScanner::OperationFailed if a message's logtype isn't in the
+     * dictionary
+     */
+    void scan_block(Query const& query, size_t begin_msg_ix, size_t begin_variables_ix);
+
+    // Variables
+    logtype_dictionary_id_t const* m_logtypes{nullptr};
+    epochtime_t const* m_timestamps{nullptr};
+    size_t m_num_messages{0};
+    std::vector<size_t> const* m_num_vars_per_logtype{nullptr};
+
+    // Candidates from the last scanned block, along with the index of their first variable
+    Query const* m_query{nullptr};
+    std::vector<size_t> m_candidate_msg_ixs;
+    std::vector<size_t> m_candidate_variables_ixs;
+    size_t m_num_candidates{0};
+    size_t m_next_candidate_ix{0};
+    size_t m_block_end_msg_ix{0};
+    size_t m_block_end_variables_ix{0};
+};
+}  // namespace clp::streaming_archive::reader
+
+#endif  // CLP_STREAMING_ARCHIVE_READER_CANDIDATEMESSAGESCANNER_HPP
@@ -3,6 +3,10 @@
 #include <sys/stat.h>
 #include <unistd.h>
 
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
 #include "../../EncodedVariableInterpreter.hpp"
 #include "../../spdlog_with_specializations.hpp"
 #include "../Constants.hpp"
@@ -21,10 +25,12 @@ epochtime_t File::get_end_ts() const {
 
 ErrorCode File::open_me(
         LogTypeDictionaryReader const& archive_logtype_dict,
+        std::vector<size_t> const& num_vars_per_logtype,
         MetadataDB::FileIterator const& file_metadata_ix,
         SegmentManager& segment_manager
 ) {
     m_archive_logtype_dict = &archive_logtype_dict;
+    m_num_vars_per_logtype = &num_vars_per_logtype;
 
     // Populate metadata from database document
     file_metadata_ix.get_id(m_id_as_string);
@@ -142,6 +148,12 @@ ErrorCode File::open_me(
 
     m_msgs_ix = 0;
     m_variables_ix = 0;
+    m_candidate_message_scanner.open(
+            m_logtypes,
+            m_timestamps,
+            m_num_messages,
+            num_vars_per_logtype
+    );
 
     m_current_ts_pattern_ix = 0;
     m_current_ts_in_milli = m_begin_ts;
@@ -163,6 +175,7 @@ void File::close_me() {
     m_num_messages = 0;
     m_variables_ix = 0;
     m_num_variables = 0;
+    m_candidate_message_scanner.close();
 
     m_current_ts_pattern_ix = 0;
     m_current_ts_in_milli = 0;
@@ -173,11 +186,13 @@ void File::close_me() {
     m_orig_path.clear();
 
     m_archive_logtype_dict = nullptr;
+    m_num_vars_per_logtype = nullptr;
 }
 
 void File::reset_indices() {
     m_msgs_ix = 0;
     m_variables_ix = 0;
+    m_candidate_message_scanner.reset();
 }
 
 string const& File::get_orig_path() const {
@@ -205,6 +220,8 @@ bool File::find_message_in_time_range(
         epochtime_t search_end_timestamp,
         Message& msg
 ) {
+    m_candidate_message_scanner.reset();
+
     bool found_msg = false;
     while (m_msgs_ix < m_num_messages && !found_msg) {
         // Get logtype
@@ -250,27 +267,22 @@ bool File::find_message_in_time_range(
 }
 
 SubQuery const* File::find_message_matching_query(Query const& query, Message& msg) {
-    SubQuery const* matching_sub_query = nullptr;
-    while (m_msgs_ix < m_num_messages && nullptr == matching_sub_query) {
-        auto const curr_msg_ix{m_msgs_ix};
-        auto logtype_id = m_logtypes[curr_msg_ix];
-
-        // Get number of variables in logtype
-        auto const& logtype_dictionary_entry = m_archive_logtype_dict->get_entry(logtype_id);
-        auto const num_vars = logtype_dictionary_entry.get_num_variables();
-
-        auto const vars_begin_ix{m_variables_ix};
-        auto const vars_end_ix{m_variables_ix + num_vars};
+    size_t curr_msg_ix{m_msgs_ix};
+    size_t vars_begin_ix{m_variables_ix};
+    while (m_candidate_message_scanner.find_next_candidate(query, curr_msg_ix, vars_begin_ix)) {
+        auto const logtype_id{m_logtypes[curr_msg_ix]};
+        auto const vars_end_ix{vars_begin_ix + (*m_num_vars_per_logtype)[logtype_id]};
+        if (vars_end_ix > m_num_variables) {
+            // Logtypes not in sync with variables, so stop search
+            m_candidate_message_scanner.reset();
+            m_msgs_ix = m_num_messages;
+            return nullptr;
+        }
 
         // Advance indices
-        ++m_msgs_ix;
+        m_msgs_ix = curr_msg_ix + 1;
         m_variables_ix = vars_end_ix;
 
-        auto const timestamp{m_timestamps[curr_msg_ix]};
-        if (false == query.timestamp_is_in_search_time_range(timestamp)) {
-            continue;
-        }
-
         for (auto const* sub_query : query.get_relevant_sub_queries()) {
             if (false == sub_query->matches_logtype(logtype_id)) {
                 continue;
@@ -285,17 +297,23 @@ SubQuery const* File::find_message_matching_query(Query const& query, Message& m
             }
 
             msg.set_logtype_id(logtype_id);
-            msg.set_timestamp(timestamp);
+            msg.set_timestamp(m_timestamps[curr_msg_ix]);
             msg.set_msg_ix(m_begin_message_ix, curr_msg_ix);
-            matching_sub_query = sub_query;
-            break;
+            return sub_query;
         }
+
+        curr_msg_ix = m_msgs_ix;
+        vars_begin_ix = m_variables_ix;
     }
 
-    return matching_sub_query;
+    m_msgs_ix = curr_msg_ix;
+    m_variables_ix = vars_begin_ix;
+    return nullptr;
 }
 
 bool File::get_next_message(Message& msg) {
+    m_candidate_message_scanner.reset();
+
     if (m_msgs_ix >= m_num_messages) {
         return false;
     }
@@ -11,6 +11,7 @@
 #include "../../Query.hpp"
 #include "../../TimestampPattern.hpp"
 #include "../MetadataDB.hpp"
+#include "CandidateMessageScanner.hpp"
 #include "Message.hpp"
 #include "SegmentManager.hpp"
 
@@ -49,7 +50,8 @@ public:
               m_timestamps(nullptr),
               m_variables(nullptr),
               m_current_ts_pattern_ix(0),
-              m_current_ts_in_milli(0) {}
+              m_current_ts_in_milli(0),
+              m_num_vars_per_logtype(nullptr) {}
 
     // Methods
     std::string const& get_id_as_string() const { return m_id_as_string; }
@@ -75,6 +77,9 @@ private:
     /**
      * Opens file
      * @param archive_logtype_dict
+     * @param num_vars_per_logtype The number of variables in each logtype in the dictionary. Only
+     * the counts of the file's logtypes need to be known, and the archive fills those in once the
+     * file is opened.
      * @param file_metadata_ix
      * @param segment_manager
      * @return Same as SegmentManager::try_read
@@ -82,6 +87,7 @@ private:
      */
     ErrorCode open_me(
             LogTypeDictionaryReader const& archive_logtype_dict,
+            std::vector<size_t> const& num_vars_per_logtype,
             MetadataDB::FileIterator const& file_metadata_ix,
             SegmentManager& segment_manager
     );
@@ -114,10 +120,15 @@ private:
     );
     /**
      * Finds message matching the given query
+     *
+     * Only the candidate messages found by `CandidateMessageScanner` are matched against the
+     * query's sub-queries.
      * @param query
      * @param msg
      * @return nullptr if no message matched
      * @return pointer to matching subquery otherwise
+     * @throw streaming_archive::reader::CandidateMessageScanner::OperationFailed if a message's
+     * logtype isn't in the dictionary
      */
     SubQuery const* find_message_matching_query(Query const& query, Message& msg);
     /**
@@ -160,6 +171,9 @@ private:
     size_t m_current_ts_pattern_ix;
     epochtime_t m_current_ts_in_milli;
 
+    std::vector<size_t> const* m_num_vars_per_logtype;
+    CandidateMessageScanner m_candidate_message_scanner;
+
     size_t m_split_ix;
     bool m_is_split;
 };
@@ -4,6 +4,8 @@
 #include <unistd.h>
 
 #include <climits>
+#include <cstddef>
+#include <tuple>
 #include <utility>
 
 #include <spdlog/spdlog.h>
@@ -60,6 +62,23 @@ ErrorCode Segment::try_open(string const& segment_dir_path, segment_id_t segment
     m_memory_mapped_segment_file.emplace(std::move(result.value()));
 
     auto const view{m_memory_mapped_segment_file.value().get_view()};
+#if USE_ZSTD_COMPRESSION
+    streaming_compression::zstd::SeekTable seek_table;
+    auto const error_code{
+            streaming_compression::zstd::SeekTable::try_read(view.data(), view.size(), seek_table)
+    };
+    if (ErrorCode_Success == error_code) {
+        m_seek_table.emplace(std::move(seek_table));
+    } else if (ErrorCode_Unsupported != error_code) {
+        SPDLOG_ERROR(
+                "streaming_archive::reader::Segment: Invalid seek table in segment: {}",
+                segment_path.c_str()
+        );
+        m_memory_mapped_segment_file.reset();
+        return ErrorCode_Corrupt;
+    }
+    m_open_frame_idx = 0;
+#endif
     m_decompressor.open(view.data(), view.size());
 
     m_segment_path = segment_path;
@@ -69,6 +88,9 @@ ErrorCode Segment::try_open(string const& segment_dir_path, segment_id_t segment
 void Segment::close() {
     if (!m_segment_path.empty()) {
         m_decompressor.close();
+#if USE_ZSTD_COMPRESSION
+        m_seek_table.reset();
+#endif
         m_memory_mapped_segment_file.reset();
         m_segment_path.clear();
     }
@@ -85,10 +107,48 @@ Segment::try_read(uint64_t decompressed_stream_pos, char* extraction_buf, uint64
         );
         return ErrorCode_BadParam;
     }
+#if USE_ZSTD_COMPRESSION
+    if (m_seek_table.has_value()) {
+        if (decompressed_stream_pos + extraction_len > m_seek_table->get_decompressed_size()) {
+            return ErrorCode_Truncated;
+        }
+        decompressed_stream_pos = seek_to_frame(decompressed_stream_pos);
+    }
+#endif
     return m_decompressor.get_decompressed_stream_region(
             decompressed_stream_pos,
             extraction_buf,
             extraction_len
     );
 }
+
+#if USE_ZSTD_COMPRESSION
+size_t Segment::seek_to_frame(uint64_t decompressed_stream_pos) {
+    auto const& seek_table{m_seek_table.value()};
+    auto const frame_idx{seek_table.find_frame(decompressed_stream_pos)};
+    auto const open_frame_decompressed_offset{
+            seek_table.get_frame_decompressed_offset(m_open_frame_idx)
+    };
+
+    // The decompressor reads forward across frame boundaries, so it only needs to be reopened if
+    // the position is behind it or in a later frame than the one it's currently decompressing.
+    size_t decompressor_pos{0};
+    std::ignore = m_decompressor.try_get_pos(decompressor_pos);
+    auto const current_pos{open_frame_decompressed_offset + decompressor_pos};
+    if (decompressed_stream_pos >= current_pos && seek_table.find_frame(current_pos) == frame_idx)
+    {
+        return decompressed_stream_pos - open_frame_decompressed_offset;
+    }
+
+    auto const view{m_memory_mapped_segment_file.value().get_view()};
+    auto const frame_compressed_offset{seek_table.get_frame_compressed_offset(frame_idx)};
+    m_decompressor.close();
+    m_decompressor.open(
+            view.data() + frame_compressed_offset,
+            seek_table.get_compressed_size() - frame_compressed_offset
+    );
+    m_open_frame_idx = frame_idx;
+    return decompressed_stream_pos - seek_table.get_frame_decompressed_offset(frame_idx);
+}
+#endif
 }  // namespace clp::streaming_archive::reader
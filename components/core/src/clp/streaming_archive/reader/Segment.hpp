@@ -10,12 +10,16 @@
 #include "../../ReadOnlyMemoryMappedFile.hpp"
 #include "../../streaming_compression/passthrough/Decompressor.hpp"
 #include "../../streaming_compression/zstd/Decompressor.hpp"
+#include "../../streaming_compression/zstd/SeekTable.hpp"
 #include "../Constants.hpp"
 
 namespace clp::streaming_archive::reader {
 /**
  * Class for reading segments. A segment is a container for multiple compressed buffers that
  * itself may be further compressed and stored on disk.
+ *
+ * If a zstd-compressed segment ends with a seek table, reads only decompress the frames covering
+ * the requested region. Otherwise, the segment is decompressed as a single stream.
  */
 class Segment {
 public:
@@ -52,6 +56,18 @@ public:
     try_read(uint64_t decompressed_stream_pos, char* extraction_buf, uint64_t extraction_len);
 
 private:
+#if USE_ZSTD_COMPRESSION
+    // Methods
+    /**
+     * Opens the decompressor at the beginning of the frame containing the given position, unless
+     * the decompressor can reach the position without going back to an earlier frame.
+     * @param decompressed_stream_pos
+     * @return The position relative to the beginning of the opened frame.
+     */
+    size_t seek_to_frame(uint64_t decompressed_stream_pos);
+#endif
+
+    // Variables
     std::string m_segment_path;
     std::optional<ReadOnlyMemoryMappedFile> m_memory_mapped_segment_file;
 
@@ -59,6 +75,9 @@ private:
     streaming_compression::passthrough::Decompressor m_decompressor;
 #elif USE_ZSTD_COMPRESSION
     streaming_compression::zstd::Decompressor m_decompressor;
+    std::optional<streaming_compression::zstd::SeekTable> m_seek_table;
+    // Index of the frame at which the decompressor was last opened
+    size_t m_open_frame_idx{0};
 #else
     static_assert(false, "Unsupported compression mode.");
 #endif
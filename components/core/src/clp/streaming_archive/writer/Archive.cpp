@@ -121,6 +121,7 @@ void Archive::open(UserConfig const& user_config) {
     m_metadata_db.open(metadata_db_path.string());
 
     m_target_segment_uncompressed_size = user_config.target_segment_uncompressed_size;
+    m_segment_frame_uncompressed_size = user_config.segment_frame_uncompressed_size;
     m_next_segment_id = 0;
     m_compression_level = user_config.compression_level;
 
@@ -569,7 +570,12 @@ void Archive::append_file_contents_to_segment(
         vector<File*>& files_in_segment
 ) {
     if (!segment.is_open()) {
-        segment.open(m_segments_dir_path, m_next_segment_id++, m_compression_level);
+        segment.open(
+                m_segments_dir_path,
+                m_next_segment_id++,
+                m_compression_level,
+                m_segment_frame_uncompressed_size
+        );
     }
 
     m_file->append_to_segment(m_logtype_dict, segment);
@@ -33,6 +33,8 @@ public:
      * @param creator_id
      * @param creation_num
      * @param target_segment_uncompressed_size
+     * @param segment_frame_uncompressed_size Uncompressed size of each independently
+     * decompressible frame in a segment, or 0 to compress each segment as a single frame
      * @param compression_level Compression level of the compressor being opened
      * @param output_dir Output directory
      * @param global_metadata_db
@@ -44,6 +46,7 @@ public:
         boost::uuids::uuid creator_id;
         size_t creation_num;
         size_t target_segment_uncompressed_size;
+        size_t segment_frame_uncompressed_size;
         int compression_level;
         std::string output_dir;
         GlobalMetadataDB* global_metadata_db;
@@ -340,6 +343,7 @@ private:
     std::vector<File*> m_file_metadata_for_global_update;
 
     size_t m_target_segment_uncompressed_size;
+    size_t m_segment_frame_uncompressed_size;
     Segment m_segment_for_files_with_timestamps;
     ArrayBackedPosIntSet<logtype_dictionary_id_t>
             m_logtype_ids_in_segment_for_files_with_timestamps;
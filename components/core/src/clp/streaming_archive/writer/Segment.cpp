@@ -2,6 +2,7 @@
 
 #include <sys/stat.h>
 
+#include <algorithm>
 #include <climits>
 #include <cmath>
 #include <cstring>
@@ -26,10 +27,18 @@ Segment::~Segment() {
     }
 }
 
-void Segment::open(string const& segments_dir_path, segment_id_t id, int compression_level) {
+void Segment::open(
+        string const& segments_dir_path,
+        segment_id_t id,
+        int compression_level,
+        size_t frame_uncompressed_size
+) {
     if (!m_segment_path.empty()) {
         throw OperationFailed(ErrorCode_NotInit, __FILENAME__, __LINE__);
     }
+    if (frame_uncompressed_size > streaming_compression::zstd::SeekTable::cMaxFrameSize) {
+        throw OperationFailed(ErrorCode_BadParam, __FILENAME__, __LINE__);
+    }
 
     m_id = id;
 
@@ -40,6 +49,11 @@ void Segment::open(string const& segments_dir_path, segment_id_t id, int compres
     m_offset = 0;
     m_compressed_size = 0;
 
+    m_frame_uncompressed_size = frame_uncompressed_size;
+    m_frame_begin_offset = 0;
+    m_frame_begin_compressed_pos = 0;
+    m_seek_table.clear();
+
     m_file_writer.open(m_segment_path, FileWriter::OpenMode::CREATE_FOR_WRITING);
 #if USE_PASSTHROUGH_COMPRESSION
     m_compressor.open(m_file_writer);
@@ -51,7 +65,17 @@ void Segment::open(string const& segments_dir_path, segment_id_t id, int compres
 }
 
 void Segment::close() {
+#if USE_ZSTD_COMPRESSION
+    if (0 != m_frame_uncompressed_size) {
+        end_frame();
+        m_compressor.close();
+        m_seek_table.write(m_file_writer);
+    } else {
+        m_compressor.close();
+    }
+#else
     m_compressor.close();
+#endif
     m_compressed_size = m_file_writer.get_pos();
 
     m_file_writer.flush();
@@ -62,11 +86,34 @@ void Segment::close() {
 }
 
 void Segment::append(char const* buf, uint64_t const buf_len, uint64_t& offset) {
+    // Return offset
+    offset = m_offset;
+
+#if USE_ZSTD_COMPRESSION
+    if (0 != m_frame_uncompressed_size) {
+        // Compress the buffer into frames of the configured size so that readers can decompress
+        // a region of the segment without decompressing everything before it
+        uint64_t num_bytes_appended{0};
+        while (num_bytes_appended < buf_len) {
+            auto const num_bytes_left_in_frame
+                    = m_frame_uncompressed_size - (m_offset - m_frame_begin_offset);
+            auto const num_bytes_to_append
+                    = std::min<uint64_t>(num_bytes_left_in_frame, buf_len - num_bytes_appended);
+            m_compressor.write(buf + num_bytes_appended, num_bytes_to_append);
+            num_bytes_appended += num_bytes_to_append;
+            m_offset += num_bytes_to_append;
+            if (m_offset - m_frame_begin_offset == m_frame_uncompressed_size) {
+                end_frame();
+            }
+        }
+        return;
+    }
+#endif
+
     // Compress
     m_compressor.write(buf, buf_len);
 
-    // Return offset and update it
-    offset = m_offset;
+    // Update offset
     m_offset += buf_len;
 }
 
@@ -86,4 +133,23 @@ size_t Segment::get_compressed_size() {
 bool Segment::is_open() const {
     return !m_segment_path.empty();
 }
+
+void Segment::end_frame() {
+    if (m_offset == m_frame_begin_offset) {
+        return;
+    }
+
+    m_compressor.flush();
+    auto const compressed_pos{m_file_writer.get_pos()};
+    if (ErrorCode_Success
+        != m_seek_table.add_frame(
+                compressed_pos - m_frame_begin_compressed_pos,
+                m_offset - m_frame_begin_offset
+        ))
+    {
+        throw OperationFailed(ErrorCode_Unsupported, __FILENAME__, __LINE__);
+    }
+    m_frame_begin_offset = m_offset;
+    m_frame_begin_compressed_pos = compressed_pos;
+}
 }  // namespace clp::streaming_archive::writer
@@ -9,6 +9,7 @@
 #include "../../FileWriter.hpp"
 #include "../../streaming_compression/passthrough/Compressor.hpp"
 #include "../../streaming_compression/zstd/Compressor.hpp"
+#include "../../streaming_compression/zstd/SeekTable.hpp"
 #include "../../TraceableException.hpp"
 #include "../Constants.hpp"
 
@@ -44,10 +45,17 @@ public:
      * @param segments_dir_path
      * @param id
      * @param compression_level
+     * @param frame_uncompressed_size The uncompressed size of each independently decompressible
+     * frame in the segment, or 0 to compress the segment as a single frame without a seek table.
      * @throw streaming_archive::writer::Segment::OperationFailed if segment wasn't closed
-     * before this call
+     * before this call, or if the frame size can't be represented in a seek table
      */
-    void open(std::string const& segments_dir_path, segment_id_t id, int compression_level);
+    void open(
+            std::string const& segments_dir_path,
+            segment_id_t id,
+            int compression_level,
+            size_t frame_uncompressed_size
+    );
     /**
      * Closes the segment
      * @throw streaming_archive::writer::Segment::OperationFailed if compression fails
@@ -79,6 +87,14 @@ public:
     size_t get_compressed_size();
 
 private:
+    // Methods
+    /**
+     * Ends the current frame (if it contains any data) and adds it to the seek table
+     * @throw streaming_archive::writer::Segment::OperationFailed if the frame can't be added to
+     * the seek table
+     */
+    void end_frame();
+
     // Variables
     std::string m_segment_path;
     segment_id_t m_id;
@@ -86,6 +102,11 @@ private:
     uint64_t m_offset;  // total input bytes processed
     uint64_t m_compressed_size;
 
+    size_t m_frame_uncompressed_size{0};
+    uint64_t m_frame_begin_offset{0};
+    size_t m_frame_begin_compressed_pos{0};
+    streaming_compression::zstd::SeekTable m_seek_table;
+
     FileWriter m_file_writer;
 #if USE_PASSTHROUGH_COMPRESSION
     streaming_compression::passthrough::Compressor m_compressor;
@@ -0,0 +1,154 @@
+#include "SeekTable.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <tuple>
+
+#include "../../ErrorCode.hpp"
+#include "../../WriterInterface.hpp"
+
+namespace clp::streaming_compression::zstd {
+namespace {
+// The seekable format stores all fields in little-endian byte order
+constexpr size_t cUint32Size{4};
+
+/**
+ * Writes a 32-bit value to the given buffer in little-endian byte order.
+ * @param value
+ * @param buf
+ */
+auto encode_little_endian_uint32(uint32_t value, char* buf) -> void;
+
+/**
+ * @param buf
+ * @return The 32-bit value stored in little-endian byte order in the given buffer.
+ */
+auto decode_little_endian_uint32(char const* buf) -> uint32_t;
+
+auto encode_little_endian_uint32(uint32_t value, char* buf) -> void {
+    for (size_t i{0}; i < cUint32Size; ++i) {
+        buf[i] = static_cast<char>((value >> (i * 8)) & 0xFF);
+    }
+}
+
+auto decode_little_endian_uint32(char const* buf) -> uint32_t {
+    uint32_t value{0};
+    for (size_t i{0}; i < cUint32Size; ++i) {
+        value |= static_cast<uint32_t>(static_cast<unsigned char>(buf[i])) << (i * 8);
+    }
+    return value;
+}
+}  // namespace
+
+auto SeekTable::add_frame(size_t compressed_size, size_t decompressed_size) -> ErrorCode {
+    if (compressed_size > cMaxFrameSize || decompressed_size > cMaxFrameSize) {
+        return ErrorCode_BadParam;
+    }
+    m_compressed_offsets.emplace_back(m_compressed_offsets.back() + compressed_size);
+    m_decompressed_offsets.emplace_back(m_decompressed_offsets.back() + decompressed_size);
+    return ErrorCode_Success;
+}
+
+auto SeekTable::write(WriterInterface& writer) const -> void {
+    auto const num_frames{get_num_frames()};
+    std::array<char, cEntrySize> buf{};
+
+    // Skippable frame header
+    encode_little_endian_uint32(cSkippableFrameMagicNumber, buf.data());
+    encode_little_endian_uint32(
+            static_cast<uint32_t>(num_frames * cEntrySize + cFooterSize),
+            buf.data() + cUint32Size
+    );
+    writer.write(buf.data(), cSkippableFrameHeaderSize);
+
+    // Entries (without checksums)
+    for (size_t i{0}; i < num_frames; ++i) {
+        encode_little_endian_uint32(
+                static_cast<uint32_t>(m_compressed_offsets[i + 1] - m_compressed_offsets[i]),
+                buf.data()
+        );
+        encode_little_endian_uint32(
+                static_cast<uint32_t>(m_decompressed_offsets[i + 1] - m_decompressed_offsets[i]),
+                buf.data() + cUint32Size
+        );
+        writer.write(buf.data(), cEntrySize);
+    }
+
+    // Footer: number of frames, seek table descriptor (no checksums), seekable magic number
+    std::array<char, cFooterSize> footer{};
+    encode_little_endian_uint32(static_cast<uint32_t>(num_frames), footer.data());
+    footer[cUint32Size] = 0;
+    encode_little_endian_uint32(cSeekableMagicNumber, footer.data() + cUint32Size + 1);
+    writer.write(footer.data(), footer.size());
+}
+
+auto SeekTable::try_read(
+        char const* compressed_data,
+        size_t compressed_data_size,
+        SeekTable& seek_table
+) -> ErrorCode {
+    seek_table.clear();
+
+    if (compressed_data_size < cSkippableFrameHeaderSize + cFooterSize) {
+        return ErrorCode_Unsupported;
+    }
+    auto const* footer{compressed_data + compressed_data_size - cFooterSize};
+    if (cSeekableMagicNumber != decode_little_endian_uint32(footer + cUint32Size + 1)) {
+        return ErrorCode_Unsupported;
+    }
+
+    size_t const num_frames{decode_little_endian_uint32(footer)};
+    auto const descriptor{static_cast<uint8_t>(footer[cUint32Size])};
+    constexpr uint8_t cChecksumFlag{0x80};
+    constexpr size_t cChecksumSize{4};
+    size_t const entry_size{
+            (0 != (descriptor & cChecksumFlag)) ? cEntrySize + cChecksumSize : cEntrySize
+    };
+
+    size_t const seek_table_size{cSkippableFrameHeaderSize + num_frames * entry_size + cFooterSize};
+    if (seek_table_size > compressed_data_size) {
+        return ErrorCode_Corrupt;
+    }
+    auto const* seek_table_begin{compressed_data + compressed_data_size - seek_table_size};
+    if (cSkippableFrameMagicNumber != decode_little_endian_uint32(seek_table_begin)
+        || seek_table_size - cSkippableFrameHeaderSize
+                   != decode_little_endian_uint32(seek_table_begin + cUint32Size))
+    {
+        return ErrorCode_Corrupt;
+    }
+
+    seek_table.m_compressed_offsets.reserve(num_frames + 1);
+    seek_table.m_decompressed_offsets.reserve(num_frames + 1);
+    auto const* entry{seek_table_begin + cSkippableFrameHeaderSize};
+    for (size_t i{0}; i < num_frames; ++i, entry += entry_size) {
+        std::ignore = seek_table.add_frame(
+                decode_little_endian_uint32(entry),
+                decode_little_endian_uint32(entry + cUint32Size)
+        );
+    }
+
+    if (seek_table.get_compressed_size() + seek_table_size != compressed_data_size) {
+        seek_table.clear();
+        return ErrorCode_Corrupt;
+    }
+    return ErrorCode_Success;
+}
+
+auto SeekTable::clear() -> void {
+    m_compressed_offsets.resize(1);
+    m_decompressed_offsets.resize(1);
+}
+
+auto SeekTable::find_frame(size_t decompressed_pos) const -> size_t {
+    // Find the first frame that ends after the given position
+    auto const it{std::upper_bound(
+            std::next(m_decompressed_offsets.cbegin()),
+            m_decompressed_offsets.cend(),
+            decompressed_pos
+    )};
+    return static_cast<size_t>(std::distance(std::next(m_decompressed_offsets.cbegin()), it));
+}
+}  // namespace clp::streaming_compression::zstd
@@ -0,0 +1,96 @@
+#ifndef CLP_STREAMING_COMPRESSION_ZSTD_SEEKTABLE_HPP
+#define CLP_STREAMING_COMPRESSION_ZSTD_SEEKTABLE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "../../ErrorCode.hpp"
+#include "../../WriterInterface.hpp"
+
+namespace clp::streaming_compression::zstd {
+/**
+ * Seek table for a stream of independently decompressible zstd frames, serialized in the zstd
+ * seekable format (see contrib/seekable_format/zstd_seekable_compression_format.md in the zstd
+ * repo).
+ *
+ * The table is stored in a skippable frame after the last data frame, so streams with a seek
+ * table can still be decompressed sequentially by any zstd decompressor.
+ */
+class SeekTable {
+public:
+    // Constants
+    static constexpr uint32_t cSkippableFrameMagicNumber{0x184D'2A5E};
+    static constexpr uint32_t cSeekableMagicNumber{0x8F92'EAB1};
+    static constexpr size_t cSkippableFrameHeaderSize{8};
+    static constexpr size_t cFooterSize{9};
+    static constexpr size_t cEntrySize{8};
+    // The largest frame (compressed or decompressed) that an entry can describe
+    static constexpr size_t cMaxFrameSize{UINT32_MAX};
+
+    // Methods
+    /**
+     * Adds a frame to the end of the table.
+     * @param compressed_size
+     * @param decompressed_size
+     * @return ErrorCode_BadParam if either size can't be represented in the seek table
+     * @return ErrorCode_Success on success
+     */
+    [[nodiscard]] auto add_frame(size_t compressed_size, size_t decompressed_size) -> ErrorCode;
+
+    /**
+     * Writes the table as a skippable frame.
+     * @param writer
+     */
+    auto write(WriterInterface& writer) const -> void;
+
+    /**
+     * Reads the seek table at the end of the given compressed stream.
+     * @param compressed_data
+     * @param compressed_data_size
+     * @param seek_table Returns the seek table
+     * @return ErrorCode_Unsupported if the stream doesn't end with a seek table
+     * @return ErrorCode_Corrupt if the seek table is invalid or doesn't match the stream
+     * @return ErrorCode_Success on success
+     */
+    [[nodiscard]] static auto
+    try_read(char const* compressed_data, size_t compressed_data_size, SeekTable& seek_table)
+            -> ErrorCode;
+
+    auto clear() -> void;
+
+    [[nodiscard]] auto get_num_frames() const -> size_t { return m_compressed_offsets.size() - 1; }
+
+    /**
+     * @param decompressed_pos
+     * @return The index of the frame containing the given position in the decompressed stream,
+     * or the number of frames if the position is past the end of the stream.
+     */
+    [[nodiscard]] auto find_frame(size_t decompressed_pos) const -> size_t;
+
+    [[nodiscard]] auto get_frame_compressed_offset(size_t frame_idx) const -> size_t {
+        return m_compressed_offsets[frame_idx];
+    }
+
+    [[nodiscard]] auto get_frame_decompressed_offset(size_t frame_idx) const -> size_t {
+        return m_decompressed_offsets[frame_idx];
+    }
+
+    /**
+     * @return The total compressed size of all frames, excluding the seek table itself.
+     */
+    [[nodiscard]] auto get_compressed_size() const -> size_t { return m_compressed_offsets.back(); }
+
+    [[nodiscard]] auto get_decompressed_size() const -> size_t {
+        return m_decompressed_offsets.back();
+    }
+
+private:
+    // Variables
+    // The offsets of the beginning of each frame, followed by the end of the last frame
+    std::vector<size_t> m_compressed_offsets{0};
+    std::vector<size_t> m_decompressed_offsets{0};
+};
+}  // namespace clp::streaming_compression::zstd
+
+#endif  // CLP_STREAMING_COMPRESSION_ZSTD_SEEKTABLE_HPP
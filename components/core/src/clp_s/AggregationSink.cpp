@@ -1,7 +1,9 @@
 #include "AggregationSink.hpp"
 
+#include <cerrno>
 #include <cstdint>
 #include <iostream>
+#include <string>
 #include <string_view>
 #include <system_error>
 #include <variant>
@@ -15,6 +17,8 @@
 #include <spdlog/spdlog.h>
 #include <ystdlib/error_handling/Result.hpp>
 
+#include <clp/ErrorCode.hpp>
+#include <clp/networking/socket_utils.hpp>
 #include <clp_s/archive_constants.hpp>
 #include <clp_s/ResultsCacheUtils.hpp>
 
@@ -27,7 +31,21 @@ auto StdoutSink::write(AggregationResult const& result) -> ystdlib::error_handli
     for (auto const& [key, value] : result) {
         std::visit([&](auto const& field_value) -> void { document[key] = field_value; }, value);
     }
-    std::cout << document.dump() << '\n';
+    auto const serialized_document{document.dump() + '\n'};
+    if (-1 == m_results_socket_fd) {
+        std::cout << serialized_document;
+        return ystdlib::error_handling::success();
+    }
+    if (clp::ErrorCode_Success
+        != clp::networking::try_send(
+                m_results_socket_fd,
+                serialized_document.data(),
+                serialized_document.size()
+        ))
+    {
+        SPDLOG_ERROR("Failed to send aggregation result, errno={}", errno);
+        return std::errc::io_error;
+    }
     return ystdlib::error_handling::success();
 }
 
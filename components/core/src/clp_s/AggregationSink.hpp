@@ -56,13 +56,21 @@ public:
 class StdoutSink : public AggregationSink {
 public:
     // Constructors
-    explicit StdoutSink(std::string_view archive_id) : m_archive_id{archive_id} {}
+    /**
+     * @param archive_id
+     * @param results_socket_fd A connected socket to write the results to instead of stdout, or -1.
+     * The sink doesn't own the socket.
+     */
+    explicit StdoutSink(std::string_view archive_id, int results_socket_fd = -1)
+            : m_archive_id{archive_id},
+              m_results_socket_fd{results_socket_fd} {}
 
     // Methods implementing AggregationSink
     /**
-     * Dumps the document to stdout.
+     * Dumps the document to stdout, or to the results socket if one was given.
      * @param result The result document to write.
-     * @return A void result on success, there is no error case.
+     * @return A void result on success, or an error code indicating the failure:
+     * - std::errc::io_error if the document couldn't be sent over the results socket.
      */
     [[nodiscard]] auto write(AggregationResult const& result)
             -> ystdlib::error_handling::Result<void> override;
@@ -74,6 +82,7 @@ public:
 private:
     // Data members
     std::string m_archive_id;
+    int m_results_socket_fd;
 };
 
 /**
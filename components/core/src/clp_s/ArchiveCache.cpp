@@ -0,0 +1,110 @@
+#include "ArchiveCache.hpp"
+
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+
+namespace clp_s {
+auto ArchiveCache::KeyHash::operator()(Key const& key) const -> size_t {
+    // Combine hashes using the boost::hash_combine mixing constant.
+    constexpr size_t cHashMixingConstant{0x9e37'79b9ULL};
+    auto hash{std::hash<std::string>{}(key.archive_id)};
+    hash ^= std::hash<size_t>{}(static_cast<size_t>(key.section)) + cHashMixingConstant
+            + (hash << 6) + (hash >> 2);
+    hash ^= std::hash<size_t>{}(key.index) + cHashMixingConstant + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+auto ArchiveCache::evict_archive(std::string_view archive_id) -> size_t {
+    std::lock_guard<std::mutex> const lock{m_mutex};
+    size_t num_evicted{0ULL};
+    for (auto it{m_entries.begin()}; m_entries.end() != it;) {
+        auto const cur{it++};
+        if (cur->key.archive_id == archive_id) {
+            evict(cur);
+            ++num_evicted;
+        }
+    }
+    return num_evicted;
+}
+
+auto ArchiveCache::clear() -> size_t {
+    std::lock_guard<std::mutex> const lock{m_mutex};
+    auto const num_evicted{m_entries.size()};
+    m_metrics.num_evictions += num_evicted;
+    m_entries.clear();
+    m_key_to_entry.clear();
+    m_metrics.num_entries = 0ULL;
+    m_metrics.size_in_bytes = 0ULL;
+    return num_evicted;
+}
+
+auto ArchiveCache::set_capacity(size_t capacity_in_bytes) -> void {
+    std::lock_guard<std::mutex> const lock{m_mutex};
+    m_capacity_in_bytes = capacity_in_bytes;
+    evict_to_capacity();
+}
+
+auto ArchiveCache::get_capacity() const -> size_t {
+    std::lock_guard<std::mutex> const lock{m_mutex};
+    return m_capacity_in_bytes;
+}
+
+auto ArchiveCache::get_metrics() const -> Metrics {
+    std::lock_guard<std::mutex> const lock{m_mutex};
+    return m_metrics;
+}
+
+auto ArchiveCache::get_entry(Key const& key) -> std::shared_ptr<void> {
+    std::lock_guard<std::mutex> const lock{m_mutex};
+    auto const it{m_key_to_entry.find(key)};
+    if (m_key_to_entry.end() == it) {
+        ++m_metrics.num_misses;
+        return nullptr;
+    }
+    ++m_metrics.num_hits;
+    m_entries.splice(m_entries.begin(), m_entries, it->second);
+    return it->second->value;
+}
+
+auto ArchiveCache::put_entry(Key key, std::shared_ptr<void> value, size_t size_in_bytes) -> void {
+    if (nullptr == value) {
+        return;
+    }
+
+    std::lock_guard<std::mutex> const lock{m_mutex};
+    if (auto const it{m_key_to_entry.find(key)}; m_key_to_entry.end() != it) {
+        evict(it->second);
+    }
+    if (size_in_bytes > m_capacity_in_bytes) {
+        return;
+    }
+
+    m_entries.push_front(Entry{key, std::move(value), size_in_bytes});
+    m_key_to_entry.emplace(std::move(key), m_entries.begin());
+    ++m_metrics.num_insertions;
+    ++m_metrics.num_entries;
+    m_metrics.size_in_bytes += size_in_bytes;
+    evict_to_capacity();
+}
+
+auto ArchiveCache::evict_to_capacity() -> void {
+    while (m_metrics.size_in_bytes > m_capacity_in_bytes && false == m_entries.empty()) {
+        evict(std::prev(m_entries.end()));
+    }
+}
+
+auto ArchiveCache::evict(std::list<Entry>::iterator it) -> void {
+    m_metrics.size_in_bytes -= it->size_in_bytes;
+    --m_metrics.num_entries;
+    ++m_metrics.num_evictions;
+    m_key_to_entry.erase(it->key);
+    m_entries.erase(it);
+}
+}  // namespace clp_s
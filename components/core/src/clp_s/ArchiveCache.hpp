@@ -0,0 +1,170 @@
+#ifndef CLP_S_ARCHIVECACHE_HPP
+#define CLP_S_ARCHIVECACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace clp_s {
+/**
+ * A thread-safe, size-bounded LRU cache for immutable data decoded from archives (decompressed
+ * packed streams, dictionaries, schema trees, etc.).
+ *
+ * The cache is meant to outlive individual `ArchiveReader`s so that repeated queries against the
+ * same archives can skip decompression and dictionary decoding. Entries are keyed by archive ID,
+ * archive section, and an index within the section (e.g., the packed stream ID).
+ *
+ * Cached values are handed out as shared pointers, so evicting an entry never invalidates a value
+ * that is still in use. Callers must treat cached values as immutable.
+ */
+class ArchiveCache {
+public:
+    // Types
+    enum class Section : uint8_t {
+        PackedStream = 0,
+        VariableDictionary,
+        LogTypeDictionary,
+        ArrayDictionary,
+        SchemaTree,
+        SchemaMap
+    };
+
+    struct Key {
+        std::string archive_id;
+        Section section{Section::PackedStream};
+        size_t index{0ULL};
+
+        [[nodiscard]] auto operator==(Key const& rhs) const -> bool = default;
+    };
+
+    struct Metrics {
+        uint64_t num_hits{0ULL};
+        uint64_t num_misses{0ULL};
+        uint64_t num_insertions{0ULL};
+        uint64_t num_evictions{0ULL};
+        size_t num_entries{0ULL};
+        size_t size_in_bytes{0ULL};
+
+        /**
+         * @return The fraction of lookups that hit the cache, or 0 if there were no lookups.
+         */
+        [[nodiscard]] auto get_hit_rate() const -> double {
+            auto const num_lookups{num_hits + num_misses};
+            if (0 == num_lookups) {
+                return 0.0;
+            }
+            return static_cast<double>(num_hits) / static_cast<double>(num_lookups);
+        }
+    };
+
+    // Constructors
+    explicit ArchiveCache(size_t capacity_in_bytes) : m_capacity_in_bytes{capacity_in_bytes} {}
+
+    // Delete copy & move constructors and assignment operators
+    ArchiveCache(ArchiveCache const&) = delete;
+    ArchiveCache(ArchiveCache&&) = delete;
+    auto operator=(ArchiveCache const&) -> ArchiveCache& = delete;
+    auto operator=(ArchiveCache&&) -> ArchiveCache& = delete;
+
+    // Destructor
+    ~ArchiveCache() = default;
+
+    // Methods
+    /**
+     * Looks up a value in the cache, marking it as the most recently used entry on a hit.
+     * @tparam T The type of the cached value. Must match the type used in `put`.
+     * @param key
+     * @return The cached value, or nullptr if the key isn't cached.
+     */
+    template <typename T>
+    [[nodiscard]] auto get(Key const& key) -> std::shared_ptr<T> {
+        return std::static_pointer_cast<T>(get_entry(key));
+    }
+
+    /**
+     * Inserts a value into the cache, replacing any existing value for the same key and evicting
+     * least recently used entries until the cache fits within its capacity. Values larger than the
+     * cache's capacity aren't cached.
+     * @tparam T
+     * @param key
+     * @param value
+     * @param size_in_bytes The (approximate) memory footprint of `value`.
+     */
+    template <typename T>
+    auto put(Key key, std::shared_ptr<T> value, size_t size_in_bytes) -> void {
+        put_entry(std::move(key), std::static_pointer_cast<void>(std::move(value)), size_in_bytes);
+    }
+
+    /**
+     * Evicts every entry belonging to the given archive.
+     * @param archive_id
+     * @return The number of entries evicted.
+     */
+    auto evict_archive(std::string_view archive_id) -> size_t;
+
+    /**
+     * Evicts every entry in the cache.
+     * @return The number of entries evicted.
+     */
+    auto clear() -> size_t;
+
+    /**
+     * Changes the cache's capacity, evicting least recently used entries if necessary.
+     * @param capacity_in_bytes
+     */
+    auto set_capacity(size_t capacity_in_bytes) -> void;
+
+    [[nodiscard]] auto get_capacity() const -> size_t;
+
+    /**
+     * @return A snapshot of the cache's metrics.
+     */
+    [[nodiscard]] auto get_metrics() const -> Metrics;
+
+private:
+    // Types
+    struct KeyHash {
+        [[nodiscard]] auto operator()(Key const& key) const -> size_t;
+    };
+
+    struct Entry {
+        Key key;
+        std::shared_ptr<void> value;
+        size_t size_in_bytes{0ULL};
+    };
+
+    // Methods
+    [[nodiscard]] auto get_entry(Key const& key) -> std::shared_ptr<void>;
+
+    auto put_entry(Key key, std::shared_ptr<void> value, size_t size_in_bytes) -> void;
+
+    /**
+     * Evicts least recently used entries until the cache fits within its capacity. Must be called
+     * with `m_mutex` held.
+     */
+    auto evict_to_capacity() -> void;
+
+    /**
+     * Evicts the entry pointed to by `it`. Must be called with `m_mutex` held.
+     * @param it
+     */
+    auto evict(std::list<Entry>::iterator it) -> void;
+
+    // Variables
+    mutable std::mutex m_mutex;
+    size_t m_capacity_in_bytes;
+    // Entries ordered from most to least recently used
+    std::list<Entry> m_entries;
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> m_key_to_entry;
+    Metrics m_metrics;
+};
+}  // namespace clp_s
+
+#endif  // CLP_S_ARCHIVECACHE_HPP
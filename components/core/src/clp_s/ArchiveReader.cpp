@@ -9,11 +9,14 @@
 
 #include <fmt/core.h>
 #include <spdlog/spdlog.h>
+#include <utils/profiling/Counter.hpp>
+#include <utils/profiling/ScopedProfiler.hpp>
 #include <ystdlib/error_handling/Result.hpp>
 
 #include <clp/ir/types.hpp>
 #include <clp/type_utils.hpp>
 #include <clp_s/archive_constants.hpp>
+#include <clp_s/ArchiveCache.hpp>
 #include <clp_s/ArchiveReaderAdaptor.hpp>
 #include <clp_s/DictionaryEntry.hpp>
 #include <clp_s/ErrorCode.hpp>
@@ -21,6 +24,54 @@
 #include <clp_s/ReaderUtils.hpp>
 
 namespace clp_s {
+namespace {
+/**
+ * @tparam DictionaryReaderType
+ * @param dictionary
+ * @return The approximate memory footprint of the dictionary's decoded entries.
+ */
+template <typename DictionaryReaderType>
+auto get_dictionary_size_in_bytes(DictionaryReaderType const& dictionary) -> size_t;
+
+/**
+ * @param schema_tree
+ * @return The approximate memory footprint of the schema tree.
+ */
+auto get_schema_tree_size_in_bytes(SchemaTree const& schema_tree) -> size_t;
+
+/**
+ * @param schema_map
+ * @return The approximate memory footprint of the schema map.
+ */
+auto get_schema_map_size_in_bytes(ReaderUtils::SchemaMap const& schema_map) -> size_t;
+
+template <typename DictionaryReaderType>
+auto get_dictionary_size_in_bytes(DictionaryReaderType const& dictionary) -> size_t {
+    size_t size_in_bytes{sizeof(DictionaryReaderType)};
+    for (auto const& entry : dictionary.get_entries()) {
+        size_in_bytes += sizeof(entry) + entry.get_value().size();
+    }
+    return size_in_bytes;
+}
+
+auto get_schema_tree_size_in_bytes(SchemaTree const& schema_tree) -> size_t {
+    size_t size_in_bytes{sizeof(SchemaTree)};
+    for (auto const& node : schema_tree.get_nodes()) {
+        size_in_bytes += sizeof(node) + node.get_key_name().size()
+                         + node.get_children_ids().size() * sizeof(int32_t);
+    }
+    return size_in_bytes;
+}
+
+auto get_schema_map_size_in_bytes(ReaderUtils::SchemaMap const& schema_map) -> size_t {
+    size_t size_in_bytes{sizeof(ReaderUtils::SchemaMap)};
+    for (auto const& [schema_id, schema] : schema_map) {
+        size_in_bytes += sizeof(schema_id) + sizeof(schema) + schema.size() * sizeof(int32_t);
+    }
+    return size_in_bytes;
+}
+}  // namespace
+
 void ArchiveReader::open(Path const& archive_path, NetworkAuthOption const& network_auth) {
     if (m_is_open) {
         throw OperationFailed(ErrorCodeNotReady, __FILENAME__, __LINE__);
@@ -59,14 +110,40 @@ auto ArchiveReader::initialize_archive_reader() -> void {
         throw OperationFailed(rc, __FILENAME__, __LINE__);
     }
 
-    m_schema_tree = ReaderUtils::read_schema_tree(*m_archive_reader_adaptor);
-    m_schema_map = ReaderUtils::read_schemas(*m_archive_reader_adaptor);
+    if (nullptr != m_archive_cache) {
+        m_schema_tree = m_archive_cache->get<SchemaTree>(
+                {m_archive_id, ArchiveCache::Section::SchemaTree}
+        );
+        m_schema_map = m_archive_cache->get<ReaderUtils::SchemaMap>(
+                {m_archive_id, ArchiveCache::Section::SchemaMap}
+        );
+    }
+    if (nullptr == m_schema_tree) {
+        m_schema_tree = ReaderUtils::read_schema_tree(*m_archive_reader_adaptor);
+        if (nullptr != m_archive_cache) {
+            m_archive_cache->put(
+                    {m_archive_id, ArchiveCache::Section::SchemaTree},
+                    m_schema_tree,
+                    get_schema_tree_size_in_bytes(*m_schema_tree)
+            );
+        }
+    }
+    if (nullptr == m_schema_map) {
+        m_schema_map = ReaderUtils::read_schemas(*m_archive_reader_adaptor);
+        if (nullptr != m_archive_cache) {
+            m_archive_cache->put(
+                    {m_archive_id, ArchiveCache::Section::SchemaMap},
+                    m_schema_map,
+                    get_schema_map_size_in_bytes(*m_schema_map)
+            );
+        }
+    }
 
     m_log_event_idx_column_id = m_schema_tree->get_metadata_field_id(constants::cLogEventIdxName);
 
-    m_var_dict = ReaderUtils::get_variable_dictionary_reader(*m_archive_reader_adaptor);
-    m_log_dict = ReaderUtils::get_log_type_dictionary_reader(*m_archive_reader_adaptor);
-    m_array_dict = ReaderUtils::get_array_dictionary_reader(*m_archive_reader_adaptor);
+    m_var_dict = ReaderUtils::get_variable_dictionary_reader();
+    m_log_dict = ReaderUtils::get_log_type_dictionary_reader();
+    m_array_dict = ReaderUtils::get_array_dictionary_reader();
 }
 
 auto ArchiveReader::read_single_schema_metadata()
@@ -118,9 +195,11 @@ auto ArchiveReader::read_single_schema_metadata()
 
 auto ArchiveReader::read_metadata() -> ystdlib::error_handling::Result<void> {
     constexpr size_t cDecompressorFileReadBufferCapacity{64 * 1024};  // 64 KiB
+    PROFILE_SCOPE("read_table_metadata");
     auto table_metadata_reader = m_archive_reader_adaptor->checkout_reader_for_section(
             constants::cArchiveTableMetadataFile
     );
+    [[maybe_unused]] auto const table_metadata_begin_pos{table_metadata_reader->get_pos()};
     m_table_metadata_decompressor.open(*table_metadata_reader, cDecompressorFileReadBufferCapacity);
 
     YSTDLIB_ERROR_HANDLING_TRYV(m_stream_reader.read_metadata(m_table_metadata_decompressor));
@@ -179,6 +258,11 @@ auto ArchiveReader::read_metadata() -> ystdlib::error_handling::Result<void> {
             - prev_metadata.stream_offset()
     );
     m_id_to_schema_metadata[prev_schema_id] = prev_metadata;
+    PROFILE_COUNT("read_bytes", table_metadata_reader->get_pos() - table_metadata_begin_pos);
+    PROFILE_COUNT(
+            "decompressed_bytes",
+            m_table_metadata_decompressor.get_decompressed_stream_pos()
+    );
     m_table_metadata_decompressor.close();
 
     m_archive_reader_adaptor->checkin_reader_for_section(constants::cArchiveTableMetadataFile);
@@ -190,9 +274,50 @@ void ArchiveReader::read_dictionaries_and_metadata() {
     if (auto const result{read_metadata()}; result.has_error()) {
         throw OperationFailed(ErrorCodeFailure, __FILENAME__, __LINE__);
     }
-    m_var_dict->read_entries();
-    m_log_dict->read_entries();
-    m_array_dict->read_entries();
+    read_variable_dictionary();
+    read_log_type_dictionary();
+    read_array_dictionary();
+}
+
+std::shared_ptr<VariableDictionaryReader> ArchiveReader::read_variable_dictionary(bool lazy) {
+    read_dictionary(m_var_dict, ArchiveCache::Section::VariableDictionary, lazy);
+    return m_var_dict;
+}
+
+std::shared_ptr<LogTypeDictionaryReader> ArchiveReader::read_log_type_dictionary(bool lazy) {
+    read_dictionary(m_log_dict, ArchiveCache::Section::LogTypeDictionary, lazy);
+    return m_log_dict;
+}
+
+std::shared_ptr<LogTypeDictionaryReader> ArchiveReader::read_array_dictionary(bool lazy) {
+    read_dictionary(m_array_dict, ArchiveCache::Section::ArrayDictionary, lazy);
+    return m_array_dict;
+}
+
+template <typename DictionaryReaderType>
+auto ArchiveReader::read_dictionary(
+        std::shared_ptr<DictionaryReaderType>& dictionary,
+        ArchiveCache::Section section,
+        bool lazy
+) -> void {
+    if (nullptr == m_archive_cache) {
+        dictionary->read_entries(*m_archive_reader_adaptor, lazy);
+        return;
+    }
+
+    ArchiveCache::Key key{m_archive_id, section};
+    // A fully decoded dictionary can serve both lazy and non-lazy reads.
+    if (auto cached_dictionary{m_archive_cache->get<DictionaryReaderType>(key)};
+        nullptr != cached_dictionary)
+    {
+        dictionary = std::move(cached_dictionary);
+        return;
+    }
+
+    dictionary->read_entries(*m_archive_reader_adaptor, lazy);
+    if (false == lazy) {
+        m_archive_cache->put(std::move(key), dictionary, get_dictionary_size_in_bytes(*dictionary));
+    }
 }
 
 void ArchiveReader::open_packed_streams() {
@@ -245,13 +370,14 @@ std::vector<std::shared_ptr<SchemaReader>> ArchiveReader::read_all_tables() {
 
 BaseColumnReader* ArchiveReader::append_reader_column(SchemaReader& reader, int32_t column_id) {
     BaseColumnReader* column_reader = nullptr;
+    auto const has_encoded_integers{get_header().has_encoded_integer_columns()};
     auto const& node = m_schema_tree->get_node(column_id);
     switch (node.get_type()) {
         case NodeType::Integer:
-            column_reader = new Int64ColumnReader(column_id);
+            column_reader = new Int64ColumnReader(column_id, has_encoded_integers);
             break;
         case NodeType::DeltaInteger:
-            column_reader = new DeltaEncodedInt64ColumnReader(column_id);
+            column_reader = new DeltaEncodedInt64ColumnReader(column_id, has_encoded_integers);
             break;
         case NodeType::Float:
             column_reader = new FloatColumnReader(column_id);
@@ -260,26 +386,50 @@ BaseColumnReader* ArchiveReader::append_reader_column(SchemaReader& reader, int3
             column_reader = new FormattedFloatColumnReader(column_id);
             break;
         case NodeType::DictionaryFloat:
-            column_reader = new DictionaryFloatColumnReader(column_id, m_var_dict);
+            column_reader = new DictionaryFloatColumnReader(
+                    column_id,
+                    m_var_dict,
+                    has_encoded_integers
+            );
             break;
         case NodeType::ClpString:
-            column_reader = new ClpStringColumnReader(column_id, m_var_dict, m_log_dict);
+            column_reader = new ClpStringColumnReader(
+                    column_id,
+                    m_var_dict,
+                    m_log_dict,
+                    false,
+                    has_encoded_integers
+            );
             break;
         case NodeType::VarString:
-            column_reader = new VariableStringColumnReader(column_id, m_var_dict);
+            column_reader = new VariableStringColumnReader(
+                    column_id,
+                    m_var_dict,
+                    has_encoded_integers
+            );
             break;
         case NodeType::Boolean:
             column_reader = new BooleanColumnReader(column_id);
             break;
         case NodeType::UnstructuredArray:
-            column_reader = new ClpStringColumnReader(column_id, m_var_dict, m_array_dict, true);
+            column_reader = new ClpStringColumnReader(
+                    column_id,
+                    m_var_dict,
+                    m_array_dict,
+                    true,
+                    has_encoded_integers
+            );
             break;
         case NodeType::DeprecatedDateString:
             column_reader
                     = new DeprecatedDateStringColumnReader(column_id, get_timestamp_dictionary());
             break;
         case NodeType::Timestamp:
-            column_reader = new TimestampColumnReader(column_id, get_timestamp_dictionary());
+            column_reader = new TimestampColumnReader(
+                    column_id,
+                    get_timestamp_dictionary(),
+                    has_encoded_integers
+            );
             break;
         // No need to push columns without associated object readers into the SchemaReader.
         case NodeType::Metadata:
@@ -303,6 +453,7 @@ void ArchiveReader::append_unordered_reader_columns(
         bool should_marshal_records
 ) {
     size_t object_begin_pos = reader.get_column_size();
+    auto const has_encoded_integers{get_header().has_encoded_integer_columns()};
     for (int32_t column_id : schema_ids) {
         if (Schema::schema_entry_is_unordered_object(column_id)) {
             continue;
@@ -311,10 +462,10 @@ void ArchiveReader::append_unordered_reader_columns(
         auto const& node = m_schema_tree->get_node(column_id);
         switch (node.get_type()) {
             case NodeType::Integer:
-                column_reader = new Int64ColumnReader(column_id);
+                column_reader = new Int64ColumnReader(column_id, has_encoded_integers);
                 break;
             case NodeType::DeltaInteger:
-                column_reader = new DeltaEncodedInt64ColumnReader(column_id);
+                column_reader = new DeltaEncodedInt64ColumnReader(column_id, has_encoded_integers);
                 break;
             case NodeType::Float:
                 column_reader = new FloatColumnReader(column_id);
@@ -323,13 +474,27 @@ void ArchiveReader::append_unordered_reader_columns(
                 column_reader = new FormattedFloatColumnReader(column_id);
                 break;
             case NodeType::DictionaryFloat:
-                column_reader = new DictionaryFloatColumnReader(column_id, m_var_dict);
+                column_reader = new DictionaryFloatColumnReader(
+                        column_id,
+                        m_var_dict,
+                        has_encoded_integers
+                );
                 break;
             case NodeType::ClpString:
-                column_reader = new ClpStringColumnReader(column_id, m_var_dict, m_log_dict);
+                column_reader = new ClpStringColumnReader(
+                        column_id,
+                        m_var_dict,
+                        m_log_dict,
+                        false,
+                        has_encoded_integers
+                );
                 break;
             case NodeType::VarString:
-                column_reader = new VariableStringColumnReader(column_id, m_var_dict);
+                column_reader = new VariableStringColumnReader(
+                        column_id,
+                        m_var_dict,
+                        has_encoded_integers
+                );
                 break;
             case NodeType::Boolean:
                 column_reader = new BooleanColumnReader(column_id);
@@ -436,9 +601,17 @@ void ArchiveReader::close() {
     }
     m_is_open = false;
 
-    m_var_dict->close();
-    m_log_dict->close();
-    m_array_dict->close();
+    if (nullptr == m_archive_cache) {
+        m_var_dict->close();
+        m_log_dict->close();
+        m_array_dict->close();
+    } else {
+        // The dictionaries may be shared with other readers through the archive cache, so we
+        // release them instead of closing them.
+        m_var_dict.reset();
+        m_log_dict.reset();
+        m_array_dict.reset();
+    }
 
     m_stream_reader.close();
     m_archive_reader_adaptor.reset();
@@ -456,6 +629,21 @@ std::shared_ptr<char[]> ArchiveReader::read_stream(size_t stream_id, bool reuse_
         return m_stream_buffer;
     }
 
+    if (nullptr != m_archive_cache) {
+        ArchiveCache::Key key{m_archive_id, ArchiveCache::Section::PackedStream, stream_id};
+        m_stream_buffer = m_archive_cache->get<char[]>(key);
+        if (nullptr != m_stream_buffer) {
+            m_stream_buffer_size = m_stream_reader.get_uncompressed_stream_size(stream_id);
+        } else {
+            // Cached buffers are shared, so always decompress into a fresh buffer.
+            m_stream_buffer_size = 0;
+            m_stream_reader.read_stream(stream_id, m_stream_buffer, m_stream_buffer_size);
+            m_archive_cache->put(std::move(key), m_stream_buffer, m_stream_buffer_size);
+        }
+        m_cur_stream_id = stream_id;
+        return m_stream_buffer;
+    }
+
     if (false == reuse_buffer) {
         m_stream_buffer.reset();
         m_stream_buffer_size = 0;
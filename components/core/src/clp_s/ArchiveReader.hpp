@@ -13,6 +13,7 @@
 #include <nlohmann/json_fwd.hpp>
 #include <ystdlib/error_handling/Result.hpp>
 
+#include <clp_s/ArchiveCache.hpp>
 #include <clp_s/ArchiveReaderAdaptor.hpp>
 #include <clp_s/DictionaryEntry.hpp>
 #include <clp_s/DictionaryReader.hpp>
@@ -66,34 +67,28 @@ public:
     void open_packed_streams();
 
     /**
-     * Reads the variable dictionary from the archive.
+     * Reads the variable dictionary from the archive, or reuses a decoded copy from the attached
+     * archive cache.
      * @param lazy
      * @return the variable dictionary reader
      */
-    std::shared_ptr<VariableDictionaryReader> read_variable_dictionary(bool lazy = false) {
-        m_var_dict->read_entries(lazy);
-        return m_var_dict;
-    }
+    std::shared_ptr<VariableDictionaryReader> read_variable_dictionary(bool lazy = false);
 
     /**
-     * Reads the log type dictionary from the archive.
+     * Reads the log type dictionary from the archive, or reuses a decoded copy from the attached
+     * archive cache.
      * @param lazy
      * @return the log type dictionary reader
      */
-    std::shared_ptr<LogTypeDictionaryReader> read_log_type_dictionary(bool lazy = false) {
-        m_log_dict->read_entries(lazy);
-        return m_log_dict;
-    }
+    std::shared_ptr<LogTypeDictionaryReader> read_log_type_dictionary(bool lazy = false);
 
     /**
-     * Reads the array dictionary from the archive.
+     * Reads the array dictionary from the archive, or reuses a decoded copy from the attached
+     * archive cache.
      * @param lazy
      * @return the array dictionary reader
      */
-    std::shared_ptr<LogTypeDictionaryReader> read_array_dictionary(bool lazy = false) {
-        m_array_dict->read_entries(lazy);
-        return m_array_dict;
-    }
+    std::shared_ptr<LogTypeDictionaryReader> read_array_dictionary(bool lazy = false);
 
     /**
      * Reads the metadata from the archive.
@@ -175,6 +170,39 @@ public:
         return m_id_to_schema_metadata.at(schema_id).num_messages();
     }
 
+    /**
+     * @param schema_id
+     * @return The ID of the packed stream containing the given schema table.
+     * @throw std::out_of_range if `schema_id` is not found in the schema metadata.
+     */
+    [[nodiscard]] auto get_stream_id_for_schema(int32_t schema_id) const -> size_t {
+        return m_id_to_schema_metadata.at(schema_id).stream_id();
+    }
+
+    /**
+     * @return The per-packed-stream dictionary ID index for the archive. The index is empty if the
+     * archive was written without one.
+     */
+    [[nodiscard]] auto get_packed_stream_dictionary_index() const
+            -> PackedStreamDictionaryIndexPacket const& {
+        return m_archive_reader_adaptor->get_packed_stream_dictionary_index();
+    }
+
+    /**
+     * Attaches a cache that is shared across archive readers and outlives them. While a cache is
+     * attached, decompressed packed streams, fully decoded dictionaries, the schema tree, and the
+     * schema map are looked up in the cache before being read from the archive, and inserted into
+     * it after being read. Must be called before the archive is opened.
+     * @param archive_cache
+     * @throws OperationFailed if the archive is already open.
+     */
+    auto set_archive_cache(std::shared_ptr<ArchiveCache> archive_cache) -> void {
+        if (m_is_open) {
+            throw OperationFailed(ErrorCodeNotReady, __FILENAME__, __LINE__);
+        }
+        m_archive_cache = std::move(archive_cache);
+    }
+
     void set_projection(std::shared_ptr<search::Projection> projection) {
         m_projection = projection;
     }
@@ -258,12 +286,30 @@ private:
             bool should_marshal_records
     );
 
+    /**
+     * Reads a dictionary from the archive, or reuses a decoded copy from the attached archive
+     * cache. Only fully decoded (non-lazy) dictionaries are inserted into the cache since lazily
+     * decoded entries are mutated on access.
+     * @tparam DictionaryReaderType
+     * @param dictionary The dictionary reader, replaced by the cached reader on a cache hit
+     * @param section The archive cache section for the dictionary
+     * @param lazy
+     */
+    template <typename DictionaryReaderType>
+    auto read_dictionary(
+            std::shared_ptr<DictionaryReaderType>& dictionary,
+            ArchiveCache::Section section,
+            bool lazy
+    ) -> void;
+
     /**
      * Reads a table with given ID from the packed stream reader. If read_stream is called
      * multiple times in a row for the same stream_id a cached buffer is returned. This function
      * allows the caller to ask for the same buffer to be reused to read multiple different
      * tables: this can save memory allocations, but can only be used when tables are read one
-     * at a time.
+     * at a time. When an archive cache is attached, decompressed streams are looked up in and
+     * inserted into the cache, and buffers are never reused since they may be shared through the
+     * cache.
      * @param stream_id
      * @param reuse_buffer when true the same buffer is reused across invocations, overwriting
      * data returned previous calls to read_stream
@@ -277,6 +323,7 @@ private:
     std::shared_ptr<LogTypeDictionaryReader> m_log_dict;
     std::shared_ptr<LogTypeDictionaryReader> m_array_dict;
     std::shared_ptr<ArchiveReaderAdaptor> m_archive_reader_adaptor;
+    std::shared_ptr<ArchiveCache> m_archive_cache;
 
     std::shared_ptr<SchemaTree> m_schema_tree;
     std::shared_ptr<ReaderUtils::SchemaMap> m_schema_map;
@@ -175,6 +175,33 @@ auto ArchiveReaderAdaptor::try_read_range_index(ZstdDecompressor& decompressor,
     return ErrorCodeSuccess;
 }
 
+auto ArchiveReaderAdaptor::try_read_packed_stream_dictionary_index(
+        ZstdDecompressor& decompressor,
+        size_t size
+) -> ErrorCode {
+    std::vector<char> buffer(size);
+    if (auto const rc = decompressor.try_read_exact_length(buffer.data(), buffer.size());
+        ErrorCodeSuccess != rc)
+    {
+        return rc;
+    }
+
+    try {
+        auto obj_handle = msgpack::unpack(buffer.data(), buffer.size());
+        auto obj = obj_handle.get();
+        m_packed_stream_dictionary_index = obj.as<PackedStreamDictionaryIndexPacket>();
+    } catch (std::exception const& e) {
+        return ErrorCodeCorrupt;
+    }
+
+    if (m_packed_stream_dictionary_index.logtype_ids.size()
+        != m_packed_stream_dictionary_index.var_ids.size())
+    {
+        return ErrorCodeCorrupt;
+    }
+    return ErrorCodeSuccess;
+}
+
 auto
 ArchiveReaderAdaptor::try_read_unknown_metadata_packet(ZstdDecompressor& decompressor, size_t size)
         -> ErrorCode {
@@ -262,6 +289,9 @@ ErrorCode ArchiveReaderAdaptor::try_read_archive_metadata(ZstdDecompressor& deco
             case ArchiveMetadataPacketType::RangeIndex:
                 rc = try_read_range_index(decompressor, packet_size);
                 break;
+            case ArchiveMetadataPacketType::PackedStreamDictionaryIndex:
+                rc = try_read_packed_stream_dictionary_index(decompressor, packet_size);
+                break;
             default:
                 rc = try_read_unknown_metadata_packet(decompressor, packet_size);
                 break;
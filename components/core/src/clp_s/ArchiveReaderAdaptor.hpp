@@ -101,6 +101,15 @@ public:
 
     std::vector<RangeIndexEntry> const& get_range_index() const { return m_range_index; }
 
+    /**
+     * @return The per-packed-stream dictionary ID index for the archive. The index is empty if the
+     * archive was written without one.
+     */
+    [[nodiscard]] auto get_packed_stream_dictionary_index() const
+            -> PackedStreamDictionaryIndexPacket const& {
+        return m_packed_stream_dictionary_index;
+    }
+
     /**
      * @param log_event_idx
      * @return The file-level metadata associated with the record at `log_event_idx`.
@@ -144,6 +153,15 @@ private:
      */
     auto try_read_range_index(ZstdDecompressor& decompressor, size_t size) -> ErrorCode;
 
+    /**
+     * Tries to read a PackedStreamDictionaryIndex packet from the archive metadata.
+     * @param decompressor
+     * @param size The number of decompressed bytes making up the packet.
+     * @return ErrorCodeSuccess on success or the relevant ErrorCode on failure.
+     */
+    auto try_read_packed_stream_dictionary_index(ZstdDecompressor& decompressor, size_t size)
+            -> ErrorCode;
+
     /**
      * Tries to read an unknown metadata packet from the archive metadata.
      * @param decompressor
@@ -196,6 +214,7 @@ private:
     std::shared_ptr<clp::ReaderInterface> m_reader;
     std::vector<RangeIndexEntry> m_range_index;
     std::map<int64_t, nlohmann::json> m_non_empty_range_metadata_map;
+    PackedStreamDictionaryIndexPacket m_packed_stream_dictionary_index;
 };
 }  // namespace clp_s
 #endif  // CLP_S_ARCHIVEREADERADAPTOR_HPP
@@ -7,10 +7,12 @@
 #include <memory>
 #include <sstream>
 #include <string_view>
+#include <unordered_set>
 #include <vector>
 
 #include <nlohmann/json.hpp>
 #include <spdlog/spdlog.h>
+#include <utils/profiling/ScopedProfiler.hpp>
 
 #include <clp_s/archive_constants.hpp>
 #include <clp_s/Defs.hpp>
@@ -64,6 +66,7 @@ void ArchiveWriter::open(ArchiveWriterOption const& option) {
 }
 
 auto ArchiveWriter::close(bool is_split) -> ArchiveStats {
+    PROFILE_SCOPE("store_archive");
     if (m_range_open) {
         if (auto const rc = close_current_range(); ErrorCodeSuccess != rc) {
             throw OperationFailed(rc, __FILENAME__, __LINE__);
@@ -139,6 +142,7 @@ auto ArchiveWriter::close(bool is_split) -> ArchiveStats {
     m_authoritative_timestamp_namespace.clear();
     m_matched_timestamp_prefix_length = 0ULL;
     m_matched_timestamp_prefix_node_id = constants::cRootNodeId;
+    m_packed_stream_dictionary_index = {};
     return archive_stats;
 }
 
@@ -175,6 +179,12 @@ auto ArchiveWriter::write_archive_metadata(
     if (false == m_range_index_writer.empty()) {
         ++num_optional_packets;
     }
+    bool const has_packed_stream_dictionary_index{
+            false == m_packed_stream_dictionary_index.logtype_ids.empty()
+    };
+    if (has_packed_stream_dictionary_index) {
+        ++num_optional_packets;
+    }
     uint8_t const num_constant_packets{3U};
     compressor.write_numeric_value<uint8_t>(num_constant_packets + num_optional_packets);
 
@@ -211,6 +221,18 @@ auto ArchiveWriter::write_archive_metadata(
         throw OperationFailed(rc, __FILENAME__, __LINE__);
     }
 
+    // Write packed stream dictionary index
+    if (has_packed_stream_dictionary_index) {
+        msgpack_buffer = std::stringstream{};
+        msgpack::pack(msgpack_buffer, m_packed_stream_dictionary_index);
+        std::string packed_stream_dictionary_index_str = msgpack_buffer.str();
+        compressor.write_numeric_value(ArchiveMetadataPacketType::PackedStreamDictionaryIndex);
+        compressor.write_numeric_value(
+                static_cast<uint32_t>(packed_stream_dictionary_index_str.size())
+        );
+        compressor.write_string(packed_stream_dictionary_index_str);
+    }
+
     compressor.close();
     return archive_range_index;
 }
@@ -333,7 +355,7 @@ void ArchiveWriter::initialize_schema_writer(SchemaWriter* writer, Schema const&
                 break;
             case NodeType::UnstructuredArray:
                 writer->append_column(
-                        std::make_unique<ClpStringColumnWriter>(m_var_dict, m_array_dict)
+                        std::make_unique<ClpStringColumnWriter>(m_var_dict, m_array_dict, true)
                 );
                 break;
             case NodeType::DeltaInteger:
@@ -398,6 +420,10 @@ std::pair<size_t, size_t> ArchiveWriter::store_tables() {
      * We buffer the first half of the metadata in the "stream_metadata" vector, and the second half
      * of the metadata in the "schema_metadata" vector as we compress the tables. The metadata is
      * flushed once all of the schema tables have been compressed.
+     *
+     * While compressing the tables we also record the set of logtype and variable dictionary IDs
+     * referenced by each packed stream. This index is written as an optional packet in the archive
+     * metadata section so that search can skip decompressing streams that can't contain matches.
      */
     using schema_map_it = decltype(m_id_to_schema_writer)::iterator;
     std::vector<schema_map_it> schemas;
@@ -415,12 +441,30 @@ std::pair<size_t, size_t> ArchiveWriter::store_tables() {
     };
     std::sort(schemas.begin(), schemas.end(), comp);
 
+    std::unordered_set<clp::logtype_dictionary_id_t> current_stream_logtype_ids;
+    std::unordered_set<clp::variable_dictionary_id_t> current_stream_var_ids;
+    auto const flush_stream_dictionary_ids = [&]() -> void {
+        auto& logtype_ids = m_packed_stream_dictionary_index.logtype_ids.emplace_back(
+                current_stream_logtype_ids.begin(),
+                current_stream_logtype_ids.end()
+        );
+        std::sort(logtype_ids.begin(), logtype_ids.end());
+        auto& var_ids = m_packed_stream_dictionary_index.var_ids.emplace_back(
+                current_stream_var_ids.begin(),
+                current_stream_var_ids.end()
+        );
+        std::sort(var_ids.begin(), var_ids.end());
+        current_stream_logtype_ids.clear();
+        current_stream_var_ids.clear();
+    };
+
     uint64_t current_stream_offset{0};
     uint64_t current_stream_id{0};
     uint64_t current_table_file_offset{0};
     m_tables_compressor.open(m_tables_file_writer, m_compression_level);
     for (auto it : schemas) {
         it->second->store(m_tables_compressor);
+        it->second->collect_dictionary_ids(current_stream_logtype_ids, current_stream_var_ids);
         schema_metadata.emplace_back(
                 current_stream_id,
                 current_stream_offset,
@@ -431,6 +475,7 @@ std::pair<size_t, size_t> ArchiveWriter::store_tables() {
 
         if (current_stream_offset > m_min_table_size || schemas.size() == schema_metadata.size()) {
             stream_metadata.emplace_back(current_table_file_offset, current_stream_offset);
+            flush_stream_dictionary_ids();
             m_tables_compressor.close();
             current_stream_offset = 0;
             ++current_stream_id;
@@ -375,6 +375,8 @@ private:
 
     RangeIndexWriter m_range_index_writer;
     bool m_range_open{false};
+
+    PackedStreamDictionaryIndexPacket m_packed_stream_dictionary_index;
 };
 }  // namespace clp_s
 
@@ -64,6 +64,20 @@ public:
         return read_unaligned_span<T>(static_cast<size_t>(length_u64));
     }
 
+    /**
+     * @param length
+     * @return A pointer to the next `length` bytes in the buffer.
+     */
+    [[nodiscard]] auto read_bytes(size_t length) -> char const* {
+        if (m_remaining_size < length) {
+            throw OperationFailed(ErrorCodeOutOfBounds, __FILENAME__, __LINE__);
+        }
+        char const* bytes{m_buffer};
+        m_buffer += length;
+        m_remaining_size -= length;
+        return bytes;
+    }
+
     size_t get_remaining_size() { return m_remaining_size; }
 
 private:
@@ -3,6 +3,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <string>
+#include <string_view>
 #include <variant>
 
 #include <fmt/format.h>
@@ -22,7 +23,7 @@
 
 namespace clp_s {
 auto Int64ColumnReader::load(BufferViewReader& reader, uint64_t num_messages) -> void {
-    m_values = reader.read_unaligned_span_u64<int64_t>(num_messages);
+    m_values.load(reader, num_messages, m_has_encoded_integers);
 }
 
 auto Int64ColumnReader::extract_value(uint64_t cur_message)
@@ -31,7 +32,7 @@ auto Int64ColumnReader::extract_value(uint64_t cur_message)
 }
 
 auto DeltaEncodedInt64ColumnReader::load(BufferViewReader& reader, uint64_t num_messages) -> void {
-    m_values = reader.read_unaligned_span_u64<int64_t>(num_messages);
+    m_values.load(reader, num_messages, m_has_encoded_integers);
     if (num_messages > 0) {
         m_cur_idx = 0;
         m_cur_value = m_values[0];
@@ -112,7 +113,7 @@ auto BooleanColumnReader::extract_value(uint64_t cur_message)
 }
 
 auto DictionaryFloatColumnReader::load(BufferViewReader& reader, uint64_t num_messages) -> void {
-    m_var_dict_ids = reader.read_unaligned_span_u64<variable_dictionary_id_t>(num_messages);
+    m_var_dict_ids.load(reader, num_messages, m_has_encoded_integers);
 }
 
 auto DictionaryFloatColumnReader::extract_value(uint64_t cur_message)
@@ -128,7 +129,7 @@ auto DictionaryFloatColumnReader::extract_string_value_into_buffer(
 }
 
 auto ClpStringColumnReader::load(BufferViewReader& reader, uint64_t num_messages) -> void {
-    m_logtypes = reader.read_unaligned_span_u64<uint64_t>(num_messages);
+    m_logtypes.load(reader, num_messages, m_has_encoded_integers);
     auto const encoded_vars_length{reader.read_value<uint64_t>()};
     m_encoded_vars = reader.read_unaligned_span_u64<int64_t>(encoded_vars_length);
 }
@@ -216,8 +217,39 @@ auto ClpStringColumnReader::get_encoded_vars(uint64_t cur_message) -> UnalignedM
     return m_encoded_vars.sub_span(encoded_vars_offset, entry.get_num_variables());
 }
 
+auto ClpStringColumnReader::get_logtype_entry(uint64_t cur_message)
+        -> LogTypeDictionaryEntry const& {
+    auto const logtype_id{ClpStringColumnWriter::get_encoded_log_dict_id(m_logtypes[cur_message])};
+    auto& entry{m_log_dict->get_entry(logtype_id)};
+    if (false == entry.initialized()) {
+        entry.decode_log_type();
+    }
+    return entry;
+}
+
+auto ClpStringColumnReader::decode_variable(
+        int64_t encoded_var,
+        clp::ir::VariablePlaceholder placeholder,
+        std::string& buffer
+) const -> std::string_view {
+    switch (placeholder) {
+        case clp::ir::VariablePlaceholder::Integer:
+            buffer = std::to_string(encoded_var);
+            return buffer;
+        case clp::ir::VariablePlaceholder::Float:
+            clp::EncodedVariableInterpreter::convert_encoded_float_to_string(encoded_var, buffer);
+            return buffer;
+        case clp::ir::VariablePlaceholder::Dictionary:
+            return m_var_dict->get_value(
+                    clp::EncodedVariableInterpreter::decode_var_dict_id(encoded_var)
+            );
+        default:
+            return {};
+    }
+}
+
 auto VariableStringColumnReader::load(BufferViewReader& reader, uint64_t num_messages) -> void {
-    m_variables = reader.read_unaligned_span_u64<uint64_t>(num_messages);
+    m_variables.load(reader, num_messages, m_has_encoded_integers);
 }
 
 auto VariableStringColumnReader::extract_value(uint64_t cur_message)
@@ -281,7 +313,7 @@ auto DeprecatedDateStringColumnReader::get_encoded_time(uint64_t cur_message) ->
 
 auto TimestampColumnReader::load(BufferViewReader& reader, uint64_t num_messages) -> void {
     m_timestamps.load(reader, num_messages);
-    m_timestamp_encodings = reader.read_unaligned_span_u64<uint64_t>(num_messages);
+    m_timestamp_encodings.load(reader, num_messages, m_has_encoded_integers);
 }
 
 auto TimestampColumnReader::extract_value(uint64_t cur_message)
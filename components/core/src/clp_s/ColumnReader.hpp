@@ -5,14 +5,19 @@
 #include <cstdint>
 #include <memory>
 #include <string>
+#include <string_view>
 #include <utility>
 #include <variant>
+#include <vector>
 
+#include <clp/ir/types.hpp>
 #include <clp_s/BufferViewReader.hpp>
 #include <clp_s/Defs.hpp>
+#include <clp_s/DictionaryEntry.hpp>
 #include <clp_s/DictionaryReader.hpp>
 #include <clp_s/ErrorCode.hpp>
 #include <clp_s/FloatFormatEncoding.hpp>
+#include <clp_s/IntegerEncoding.hpp>
 #include <clp_s/SchemaTree.hpp>
 #include <clp_s/TimestampDictionaryReader.hpp>
 #include <clp_s/TraceableException.hpp>
@@ -102,7 +107,9 @@ private:
 class Int64ColumnReader : public BaseColumnReader {
 public:
     // Constructor
-    explicit Int64ColumnReader(int32_t id) : BaseColumnReader(id) {}
+    Int64ColumnReader(int32_t id, bool has_encoded_integers)
+            : BaseColumnReader(id),
+              m_has_encoded_integers{has_encoded_integers} {}
 
     // Methods inherited from BaseColumnReader
     auto load(BufferViewReader& reader, uint64_t num_messages) -> void override;
@@ -115,14 +122,29 @@ public:
     auto extract_string_value_into_buffer(uint64_t cur_message, std::string& buffer)
             -> void override;
 
+    /**
+     * Sets `bitmap[i]` to 1 for every message `i` whose value is within the given inclusive range,
+     * evaluating the range on the encoded values.
+     * @param lower
+     * @param upper
+     * @param bitmap
+     */
+    auto mark_values_in_range(int64_t lower, int64_t upper, std::vector<uint8_t>& bitmap) const
+            -> void {
+        m_values.mark_values_in_range(lower, upper, bitmap);
+    }
+
 private:
-    UnalignedMemSpan<int64_t> m_values;
+    EncodedIntegerSpan<int64_t> m_values;
+    bool m_has_encoded_integers;
 };
 
 class DeltaEncodedInt64ColumnReader : public BaseColumnReader {
 public:
     // Constructor
-    explicit DeltaEncodedInt64ColumnReader(int32_t id) : BaseColumnReader(id) {}
+    DeltaEncodedInt64ColumnReader(int32_t id, bool has_encoded_integers)
+            : BaseColumnReader(id),
+              m_has_encoded_integers{has_encoded_integers} {}
 
     // Methods inherited from BaseColumnReader
     auto load(BufferViewReader& reader, uint64_t num_messages) -> void override;
@@ -144,7 +166,8 @@ public:
     [[nodiscard]] auto get_value_at_idx(size_t idx) -> int64_t;
 
 private:
-    UnalignedMemSpan<int64_t> m_values;
+    EncodedIntegerSpan<int64_t> m_values;
+    bool m_has_encoded_integers;
     int64_t m_cur_value{};
     size_t m_cur_idx{};
 };
@@ -200,12 +223,14 @@ private:
 class DictionaryFloatColumnReader : public BaseColumnReader {
 public:
     // Constructor
-    explicit DictionaryFloatColumnReader(
+    DictionaryFloatColumnReader(
             int32_t id,
-            std::shared_ptr<VariableDictionaryReader> var_dict
+            std::shared_ptr<VariableDictionaryReader> var_dict,
+            bool has_encoded_integers
     )
             : BaseColumnReader(id),
-              m_var_dict{std::move(var_dict)} {}
+              m_var_dict{std::move(var_dict)},
+              m_has_encoded_integers{has_encoded_integers} {}
 
     // Methods inherited from BaseColumnReader
     auto load(BufferViewReader& reader, uint64_t num_messages) -> void override;
@@ -220,7 +245,8 @@ public:
 
 private:
     std::shared_ptr<VariableDictionaryReader> m_var_dict;
-    UnalignedMemSpan<variable_dictionary_id_t> m_var_dict_ids;
+    EncodedIntegerSpan<variable_dictionary_id_t> m_var_dict_ids;
+    bool m_has_encoded_integers;
 };
 
 class BooleanColumnReader : public BaseColumnReader {
@@ -250,12 +276,14 @@ public:
             int32_t id,
             std::shared_ptr<VariableDictionaryReader> var_dict,
             std::shared_ptr<LogTypeDictionaryReader> log_dict,
-            bool is_array = false
+            bool is_array,
+            bool has_encoded_integers
     )
             : BaseColumnReader(id),
               m_var_dict(std::move(var_dict)),
               m_log_dict(std::move(log_dict)),
-              m_is_array(is_array) /*, encoded_vars_index_(0)*/ {}
+              m_is_array(is_array),
+              m_has_encoded_integers(has_encoded_integers) {}
 
     // Methods inherited from BaseColumnReader
     auto load(BufferViewReader& reader, uint64_t num_messages) -> void override;
@@ -293,22 +321,49 @@ public:
      */
     auto get_encoded_vars(uint64_t cur_message) -> UnalignedMemSpan<int64_t>;
 
+    /**
+     * Gets the logtype dictionary entry, decoding it if necessary
+     * @param cur_message
+     * @return The logtype dictionary entry
+     */
+    auto get_logtype_entry(uint64_t cur_message) -> LogTypeDictionaryEntry const&;
+
+    /**
+     * Decodes a single encoded variable
+     * @param encoded_var
+     * @param placeholder The placeholder of the variable in its logtype
+     * @param buffer Buffer to decode non-dictionary variables into
+     * @return A view of the decoded variable, referencing either `buffer` or the variable
+     * dictionary
+     */
+    auto decode_variable(
+            int64_t encoded_var,
+            clp::ir::VariablePlaceholder placeholder,
+            std::string& buffer
+    ) const -> std::string_view;
+
 private:
     std::shared_ptr<VariableDictionaryReader> m_var_dict;
     std::shared_ptr<LogTypeDictionaryReader> m_log_dict;
 
-    UnalignedMemSpan<uint64_t> m_logtypes;
+    EncodedIntegerSpan<uint64_t> m_logtypes;
     UnalignedMemSpan<int64_t> m_encoded_vars;
 
     bool m_is_array;
+    bool m_has_encoded_integers;
 };
 
 class VariableStringColumnReader : public BaseColumnReader {
 public:
     // Constructor
-    VariableStringColumnReader(int32_t id, std::shared_ptr<VariableDictionaryReader> var_dict)
+    VariableStringColumnReader(
+            int32_t id,
+            std::shared_ptr<VariableDictionaryReader> var_dict,
+            bool has_encoded_integers
+    )
             : BaseColumnReader(id),
-              m_var_dict(std::move(var_dict)) {}
+              m_var_dict(std::move(var_dict)),
+              m_has_encoded_integers(has_encoded_integers) {}
 
     // Methods inherited from BaseColumnReader
     auto load(BufferViewReader& reader, uint64_t num_messages) -> void override;
@@ -337,10 +392,24 @@ public:
      */
     auto get_variable_id(uint64_t cur_message) -> uint64_t;
 
+    /**
+     * Sets `bitmap[i]` to 1 for every message `i` whose variable ID satisfies the given predicate.
+     * Other entries of `bitmap` are left unchanged.
+     * @tparam Predicate A callable that takes a variable ID and returns whether it matches.
+     * @param predicate
+     * @param bitmap A bitmap with an entry for every message.
+     */
+    template <typename Predicate>
+    auto mark_matching_variable_ids(Predicate predicate, std::vector<uint8_t>& bitmap) const
+            -> void {
+        m_variables.mark_matching_values(predicate, bitmap);
+    }
+
 private:
     std::shared_ptr<VariableDictionaryReader> m_var_dict;
 
-    UnalignedMemSpan<uint64_t> m_variables;
+    EncodedIntegerSpan<uint64_t> m_variables;
+    bool m_has_encoded_integers;
 };
 
 class DeprecatedDateStringColumnReader : public BaseColumnReader {
@@ -380,10 +449,15 @@ private:
 class TimestampColumnReader : public BaseColumnReader {
 public:
     // Constructor
-    TimestampColumnReader(int32_t id, std::shared_ptr<TimestampDictionaryReader> timestamp_dict)
+    TimestampColumnReader(
+            int32_t id,
+            std::shared_ptr<TimestampDictionaryReader> timestamp_dict,
+            bool has_encoded_integers
+    )
             : BaseColumnReader{id},
               m_timestamp_dict{std::move(timestamp_dict)},
-              m_timestamps{id} {}
+              m_timestamps{id, has_encoded_integers},
+              m_has_encoded_integers{has_encoded_integers} {}
 
     // Methods inherited from BaseColumnReader
     auto load(BufferViewReader& reader, uint64_t num_messages) -> void override;
@@ -406,7 +480,8 @@ private:
     std::shared_ptr<TimestampDictionaryReader> m_timestamp_dict;
 
     DeltaEncodedInt64ColumnReader m_timestamps;
-    UnalignedMemSpan<uint64_t> m_timestamp_encodings;
+    EncodedIntegerSpan<uint64_t> m_timestamp_encodings;
+    bool m_has_encoded_integers;
 };
 }  // namespace clp_s
 
@@ -1,10 +1,13 @@
 #include "ColumnWriter.hpp"
 
+#include <algorithm>
 #include <cassert>
 #include <cstddef>
 #include <cstdint>
+#include <span>
 #include <string>
 #include <type_traits>
+#include <unordered_set>
 #include <variant>
 #include <vector>
 
@@ -16,6 +19,7 @@
 #include <clp/ffi/EncodedTextAst.hpp>
 #include <clp/ffi/ir_stream/decoding_methods.hpp>
 #include <clp/TraceableException.hpp>
+#include <clp_s/IntegerEncoding.hpp>
 #include <clp_s/ParsedMessage.hpp>
 #include <clp_s/ZstdCompressor.hpp>
 
@@ -26,8 +30,7 @@ size_t Int64ColumnWriter::add_value(ParsedMessage::variable_t& value) {
 }
 
 void Int64ColumnWriter::store(ZstdCompressor& compressor) {
-    size_t size = m_values.size() * sizeof(int64_t);
-    compressor.write(reinterpret_cast<char const*>(m_values.data()), size);
+    write_encoded_integers(std::span<int64_t const>{m_values}, compressor);
 }
 
 auto DeltaEncodedInt64ColumnWriter::add_value(int64_t value) -> size_t {
@@ -41,8 +44,7 @@ size_t DeltaEncodedInt64ColumnWriter::add_value(ParsedMessage::variable_t& value
 }
 
 void DeltaEncodedInt64ColumnWriter::store(ZstdCompressor& compressor) {
-    size_t size = m_values.size() * sizeof(int64_t);
-    compressor.write(reinterpret_cast<char const*>(m_values.data()), size);
+    write_encoded_integers(std::span<int64_t const>{m_values}, compressor);
 }
 
 size_t FloatColumnWriter::add_value(ParsedMessage::variable_t& value) {
@@ -78,8 +80,17 @@ size_t DictionaryFloatColumnWriter::add_value(ParsedMessage::variable_t& value)
 }
 
 void DictionaryFloatColumnWriter::store(ZstdCompressor& compressor) {
-    auto size{m_var_dict_ids.size() * sizeof(clp::variable_dictionary_id_t)};
-    compressor.write(reinterpret_cast<char const*>(m_var_dict_ids.data()), size);
+    write_encoded_integers(
+            std::span<clp::variable_dictionary_id_t const>{m_var_dict_ids},
+            compressor
+    );
+}
+
+auto DictionaryFloatColumnWriter::collect_dictionary_ids(
+        [[maybe_unused]] std::unordered_set<clp::logtype_dictionary_id_t>& logtype_ids,
+        std::unordered_set<clp::variable_dictionary_id_t>& var_ids
+) const -> void {
+    var_ids.insert(m_var_dict_ids.begin(), m_var_dict_ids.end());
 }
 
 size_t BooleanColumnWriter::add_value(ParsedMessage::variable_t& value) {
@@ -94,14 +105,13 @@ void BooleanColumnWriter::store(ZstdCompressor& compressor) {
 
 auto ClpStringColumnWriter::add_value(ParsedMessage::variable_t& value) -> size_t {
     auto const offset{m_encoded_vars.size()};
-    std::vector<clp::variable_dictionary_id_t> temp_var_dict_ids;
     if (std::holds_alternative<std::string>(value)) {
         clp::EncodedVariableInterpreter::encode_and_add_to_dictionary(
                 std::get<std::string>(value),
                 m_logtype_entry,
                 *m_var_dict,
                 m_encoded_vars,
-                temp_var_dict_ids
+                m_var_dict_ids
         );
     } else if (std::holds_alternative<clp::ffi::EightByteEncodedTextAst>(value)) {
         auto const result{clp::EncodedVariableInterpreter::encode_and_add_to_dictionary(
@@ -109,7 +119,7 @@ auto ClpStringColumnWriter::add_value(ParsedMessage::variable_t& value) -> size_
                 m_logtype_entry,
                 *m_var_dict,
                 m_encoded_vars,
-                temp_var_dict_ids
+                m_var_dict_ids
         )};
         if (result.has_error()) {
             auto const error{result.error()};
@@ -126,7 +136,7 @@ auto ClpStringColumnWriter::add_value(ParsedMessage::variable_t& value) -> size_
                 m_logtype_entry,
                 *m_var_dict,
                 m_encoded_vars,
-                temp_var_dict_ids
+                m_var_dict_ids
         )};
         if (result.has_error()) {
             auto const error{result.error()};
@@ -139,6 +149,12 @@ auto ClpStringColumnWriter::add_value(ParsedMessage::variable_t& value) -> size_
         }
     }
 
+    // Deduplicate the IDs once enough new ones have accumulated, so that the buffer stays within a
+    // constant factor of the number of distinct IDs while amortizing the cost of each pass.
+    if (m_var_dict_ids.size() >= 2 * m_num_unique_var_dict_ids + cMinVarDictIdsToDeduplicate) {
+        deduplicate_var_dict_ids();
+    }
+
     clp::logtype_dictionary_id_t id{};
     m_log_dict->add_entry(m_logtype_entry, id);
     auto encoded_id{encode_log_dict_id(id, offset)};
@@ -147,14 +163,34 @@ auto ClpStringColumnWriter::add_value(ParsedMessage::variable_t& value) -> size_
 }
 
 auto ClpStringColumnWriter::store(ZstdCompressor& compressor) -> void {
-    size_t logtypes_size{m_logtypes.size() * sizeof(int64_t)};
-    compressor.write(reinterpret_cast<char const*>(m_logtypes.data()), logtypes_size);
+    write_encoded_integers(std::span<encoded_log_dict_id_t const>{m_logtypes}, compressor);
     size_t encoded_vars_size{m_encoded_vars.size() * sizeof(int64_t)};
     size_t num_encoded_vars{m_encoded_vars.size()};
     compressor.write_numeric_value(static_cast<uint64_t>(num_encoded_vars));
     compressor.write(reinterpret_cast<char const*>(m_encoded_vars.data()), encoded_vars_size);
 }
 
+auto ClpStringColumnWriter::deduplicate_var_dict_ids() -> void {
+    std::sort(m_var_dict_ids.begin(), m_var_dict_ids.end());
+    m_var_dict_ids.erase(
+            std::unique(m_var_dict_ids.begin(), m_var_dict_ids.end()),
+            m_var_dict_ids.end()
+    );
+    m_num_unique_var_dict_ids = m_var_dict_ids.size();
+}
+
+auto ClpStringColumnWriter::collect_dictionary_ids(
+        std::unordered_set<clp::logtype_dictionary_id_t>& logtype_ids,
+        std::unordered_set<clp::variable_dictionary_id_t>& var_ids
+) const -> void {
+    if (false == m_is_array) {
+        for (auto const encoded_id : m_logtypes) {
+            logtype_ids.insert(get_encoded_log_dict_id(encoded_id));
+        }
+    }
+    var_ids.insert(m_var_dict_ids.begin(), m_var_dict_ids.end());
+}
+
 size_t VariableStringColumnWriter::add_value(ParsedMessage::variable_t& value) {
     clp::variable_dictionary_id_t id{};
     m_var_dict->add_entry(std::get<std::string>(value), id);
@@ -163,8 +199,17 @@ size_t VariableStringColumnWriter::add_value(ParsedMessage::variable_t& value) {
 }
 
 void VariableStringColumnWriter::store(ZstdCompressor& compressor) {
-    auto size{m_var_dict_ids.size() * sizeof(clp::variable_dictionary_id_t)};
-    compressor.write(reinterpret_cast<char const*>(m_var_dict_ids.data()), size);
+    write_encoded_integers(
+            std::span<clp::variable_dictionary_id_t const>{m_var_dict_ids},
+            compressor
+    );
+}
+
+auto VariableStringColumnWriter::collect_dictionary_ids(
+        [[maybe_unused]] std::unordered_set<clp::logtype_dictionary_id_t>& logtype_ids,
+        std::unordered_set<clp::variable_dictionary_id_t>& var_ids
+) const -> void {
+    var_ids.insert(m_var_dict_ids.begin(), m_var_dict_ids.end());
 }
 
 auto TimestampColumnWriter::add_value(ParsedMessage::variable_t& value) -> size_t {
@@ -176,7 +221,6 @@ auto TimestampColumnWriter::add_value(ParsedMessage::variable_t& value) -> size_
 
 void TimestampColumnWriter::store(ZstdCompressor& compressor) {
     m_timestamps.store(compressor);
-    size_t const encodings_size{m_timestamp_encodings.size() * sizeof(uint64_t)};
-    compressor.write(reinterpret_cast<char const*>(m_timestamp_encodings.data()), encodings_size);
+    write_encoded_integers(std::span<uint64_t const>{m_timestamp_encodings}, compressor);
 }
 }  // namespace clp_s
@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <unordered_set>
 #include <utility>
 #include <vector>
 
@@ -11,6 +12,7 @@
 #include <clp_s/DictionaryEntry.hpp>
 #include <clp_s/DictionaryWriter.hpp>
 #include <clp_s/FloatFormatEncoding.hpp>
+#include <clp_s/IntegerEncoding.hpp>
 #include <clp_s/ParsedMessage.hpp>
 #include <clp_s/ZstdCompressor.hpp>
 
@@ -46,12 +48,24 @@ public:
 
     /**
      * Returns the total size of the header data that will be written to the compressor. This header
-     * size plus the sum of sizes returned by add_value is equal to the total size of data that will
-     * be written to the compressor in bytes.
+     * size plus the sum of sizes returned by add_value is an upper bound on the total size of data
+     * that will be written to the compressor in bytes (columns whose integers are encoded by
+     * `write_encoded_integers` may write less).
      *
      * @return the total size of header data that will be written to the compressor in bytes
      */
     [[nodiscard]] virtual auto get_total_header_size() const -> size_t { return 0; }
+
+    /**
+     * Adds the logtype and variable dictionary IDs referenced by this column to the given sets.
+     * Columns that don't reference any dictionary leave the sets unchanged.
+     * @param logtype_ids
+     * @param var_ids
+     */
+    virtual auto collect_dictionary_ids(
+            [[maybe_unused]] std::unordered_set<clp::logtype_dictionary_id_t>& logtype_ids,
+            [[maybe_unused]] std::unordered_set<clp::variable_dictionary_id_t>& var_ids
+    ) const -> void {}
 };
 
 class Int64ColumnWriter : public BaseColumnWriter {
@@ -61,6 +75,10 @@ public:
 
     auto store(ZstdCompressor& compressor) -> void override;
 
+    [[nodiscard]] auto get_total_header_size() const -> size_t override {
+        return cIntegerEncodingHeaderSize;
+    }
+
 private:
     // Data members
     std::vector<int64_t> m_values;
@@ -73,6 +91,10 @@ public:
 
     auto store(ZstdCompressor& compressor) -> void override;
 
+    [[nodiscard]] auto get_total_header_size() const -> size_t override {
+        return cIntegerEncodingHeaderSize;
+    }
+
     // Methods
     [[nodiscard]] auto add_value(int64_t value) -> size_t;
 
@@ -118,6 +140,15 @@ public:
 
     auto store(ZstdCompressor& compressor) -> void override;
 
+    [[nodiscard]] auto get_total_header_size() const -> size_t override {
+        return cIntegerEncodingHeaderSize;
+    }
+
+    auto collect_dictionary_ids(
+            std::unordered_set<clp::logtype_dictionary_id_t>& logtype_ids,
+            std::unordered_set<clp::variable_dictionary_id_t>& var_ids
+    ) const -> void override;
+
 private:
     // Data members
     std::shared_ptr<VariableDictionaryWriter> m_var_dict;
@@ -144,18 +175,31 @@ public:
     // Constructors
     ClpStringColumnWriter(
             std::shared_ptr<VariableDictionaryWriter> var_dict,
-            std::shared_ptr<LogTypeDictionaryWriter> log_dict
+            std::shared_ptr<LogTypeDictionaryWriter> log_dict,
+            bool is_array = false
     )
             : m_var_dict(std::move(var_dict)),
-              m_log_dict(std::move(log_dict)) {}
+              m_log_dict(std::move(log_dict)),
+              m_is_array(is_array) {}
 
     // Methods implementing BaseColumnWriter
     auto add_value(ParsedMessage::variable_t& value) -> size_t override;
 
     auto store(ZstdCompressor& compressor) -> void override;
 
+    /**
+     * Note: logtype IDs are only collected for non-array columns since array columns reference the
+     * array dictionary rather than the logtype dictionary.
+     */
+    auto collect_dictionary_ids(
+            std::unordered_set<clp::logtype_dictionary_id_t>& logtype_ids,
+            std::unordered_set<clp::variable_dictionary_id_t>& var_ids
+    ) const -> void override;
+
     // Methods
-    [[nodiscard]] auto get_total_header_size() const -> size_t override { return sizeof(size_t); }
+    [[nodiscard]] auto get_total_header_size() const -> size_t override {
+        return sizeof(size_t) + cIntegerEncodingHeaderSize;
+    }
 
     /**
      * @param encoded_id
@@ -176,6 +220,11 @@ public:
 
 private:
     // Methods
+    /**
+     * Sorts and removes duplicates from `m_var_dict_ids`.
+     */
+    auto deduplicate_var_dict_ids() -> void;
+
     /**
      * Encodes a log dict id
      * @param id
@@ -191,13 +240,19 @@ private:
     static constexpr int cOffsetBitPosition = 24;
     static constexpr uint64_t cLogDictIdMask = (1ULL << cOffsetBitPosition) - 1;
     static constexpr uint64_t cOffsetMask = ~cLogDictIdMask;
+    static constexpr size_t cMinVarDictIdsToDeduplicate{1024};
 
     std::shared_ptr<VariableDictionaryWriter> m_var_dict;
     std::shared_ptr<LogTypeDictionaryWriter> m_log_dict;
     LogTypeDictionaryEntry m_logtype_entry;
+    bool m_is_array{false};
 
     std::vector<encoded_log_dict_id_t> m_logtypes;
     std::vector<clp::encoded_variable_t> m_encoded_vars;
+    // The variable dictionary IDs referenced by this column, which may contain duplicates since
+    // they're only deduplicated periodically
+    std::vector<clp::variable_dictionary_id_t> m_var_dict_ids;
+    size_t m_num_unique_var_dict_ids{0};
 };
 
 class VariableStringColumnWriter : public BaseColumnWriter {
@@ -211,6 +266,15 @@ public:
 
     auto store(ZstdCompressor& compressor) -> void override;
 
+    [[nodiscard]] auto get_total_header_size() const -> size_t override {
+        return cIntegerEncodingHeaderSize;
+    }
+
+    auto collect_dictionary_ids(
+            std::unordered_set<clp::logtype_dictionary_id_t>& logtype_ids,
+            std::unordered_set<clp::variable_dictionary_id_t>& var_ids
+    ) const -> void override;
+
 private:
     // Data members
     std::shared_ptr<VariableDictionaryWriter> m_var_dict;
@@ -224,6 +288,10 @@ public:
 
     auto store(ZstdCompressor& compressor) -> void override;
 
+    [[nodiscard]] auto get_total_header_size() const -> size_t override {
+        return m_timestamps.get_total_header_size() + cIntegerEncodingHeaderSize;
+    }
+
 private:
     // Data members
     DeltaEncodedInt64ColumnWriter m_timestamps;
@@ -305,11 +305,13 @@ CommandLineArguments::parse_arguments(int argc, char const** argv) {
                 std::cerr << "  c - compress" << std::endl;
                 std::cerr << "  x - decompress" << std::endl;
                 std::cerr << "  s - search" << std::endl;
+                std::cerr << "  v - serve searches over a local socket" << std::endl;
                 std::cerr << std::endl;
                 std::cerr << "Try "
                           << " c --help OR"
                           << " x --help OR"
-                          << " s --help for command-specific details." << std::endl;
+                          << " s --help OR"
+                          << " v --help for command-specific details." << std::endl;
 
                 po::options_description visible_options;
                 visible_options.add(general_options);
@@ -324,6 +326,7 @@ CommandLineArguments::parse_arguments(int argc, char const** argv) {
             case (char)Command::Compress:
             case (char)Command::Extract:
             case (char)Command::Search:
+            case (char)Command::Serve:
                 m_command = (Command)command_input;
                 break;
             default:
@@ -1117,6 +1120,108 @@ CommandLineArguments::parse_arguments(int argc, char const** argv) {
                     throw std::invalid_argument("Unknown OUTPUT_HANDLER: " + output_handler_name);
                 }
             }
+        } else if ((char)Command::Serve == command_input) {
+            po::options_description serve_positional_options;
+            // clang-format off
+            serve_positional_options.add_options()(
+                    "socket-path",
+                    po::value<std::string>(&m_serve_socket_path),
+                    "Path of the Unix domain socket to accept search requests on"
+            );
+            // clang-format on
+            po::positional_options_description positional_options;
+            positional_options.add("socket-path", 1);
+
+            po::options_description serve_options("Serve Options");
+            // clang-format off
+            serve_options.add_options()(
+                    "max-concurrent-queries",
+                    po::value<size_t>(&m_max_concurrent_queries)
+                            ->value_name("NUM")
+                            ->default_value(m_max_concurrent_queries),
+                    "Maximum number of searches to run concurrently"
+            )(
+                    "max-queued-queries",
+                    po::value<size_t>(&m_max_queued_queries)
+                            ->value_name("NUM")
+                            ->default_value(m_max_queued_queries),
+                    "Maximum number of admitted searches waiting to run. Requests received while"
+                    " the queue is full are rejected."
+            )(
+                    "cache-size",
+                    po::value<size_t>(&m_archive_cache_size)
+                            ->value_name("SIZE")
+                            ->default_value(m_archive_cache_size),
+                    "Maximum size (B) of the decompressed archive data cached across searches"
+            )(
+                    "enable-telemetry",
+                    po::bool_switch(&m_enable_telemetry),
+                    "Publish search telemetry to the OpenTelemetry endpoint specified in the"
+                    " CLP_TELEMETRY_ENDPOINT environment variable"
+            );
+            // clang-format on
+
+            po::options_description all_serve_options;
+            all_serve_options.add(serve_positional_options);
+            all_serve_options.add(serve_options);
+
+            std::vector<std::string> unrecognized_options
+                    = po::collect_unrecognized(parsed.options, po::include_positional);
+            unrecognized_options.erase(unrecognized_options.begin());
+            po::store(
+                    po::command_line_parser(unrecognized_options)
+                            .options(all_serve_options)
+                            .positional(positional_options)
+                            .run(),
+                    parsed_command_line_options
+            );
+
+            po::notify(parsed_command_line_options);
+
+            if (parsed_command_line_options.count("help")) {
+                print_serve_usage();
+
+                std::cerr << "Each connection to SOCKET_PATH carries a single search request: a"
+                             " newline-terminated JSON array of the arguments that would be"
+                             " passed to `"
+                          << m_program_name
+                          << " s`. The server replies with a newline-terminated JSON object"
+                             " containing a boolean \"success\" field and, on failure, an"
+                             " \"error\" field. Results are written to the request's output"
+                             " handler."
+                          << std::endl;
+                std::cerr << std::endl;
+                std::cerr << "A connection can instead carry a control request: a"
+                             " newline-terminated JSON object with a \"type\" field of"
+                             " \"stats\" (reply with the archive cache's metrics) or \"evict\""
+                             " (evict the archive given by the \"archive_id\" field, or every"
+                             " archive if it's absent, from the archive cache)."
+                          << std::endl;
+                std::cerr << std::endl;
+                std::cerr << "Examples:" << std::endl;
+                std::cerr << "  # Serve searches on /tmp/clp-s.sock with at most 8 concurrent"
+                             " searches"
+                          << std::endl;
+                std::cerr << "  " << m_program_name
+                          << " v /tmp/clp-s.sock --max-concurrent-queries 8" << std::endl;
+                std::cerr << std::endl;
+
+                po::options_description visible_options;
+                visible_options.add(general_options);
+                visible_options.add(serve_options);
+                std::cerr << visible_options << std::endl;
+                return ParsingResult::InfoCommand;
+            }
+
+            if (m_serve_socket_path.empty()) {
+                throw std::invalid_argument(
+                        "missing required positional argument \"SOCKET_PATH\""
+                );
+            }
+
+            if (0 == m_max_concurrent_queries) {
+                throw std::invalid_argument("max-concurrent-queries must be positive");
+            }
         }
     } catch (std::exception& e) {
         SPDLOG_ERROR("{}", e.what());
@@ -1323,4 +1428,8 @@ void CommandLineArguments::print_search_usage() const {
                  " [OUTPUT_HANDLER [OUTPUT_HANDLER_OPTIONS]]"
               << std::endl;
 }
+
+void CommandLineArguments::print_serve_usage() const {
+    std::cerr << "Usage: " << m_program_name << " v [OPTIONS] SOCKET_PATH" << std::endl;
+}
 }  // namespace clp_s
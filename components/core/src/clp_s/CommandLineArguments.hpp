@@ -30,7 +30,8 @@ public:
     enum class Command : char {
         Compress = 'c',
         Extract = 'x',
-        Search = 's'
+        Search = 's',
+        Serve = 'v'
     };
 
     struct ResultsCacheOutputHandlerOptions {
@@ -142,6 +143,18 @@ public:
 
     bool get_record_log_order() const { return false == m_disable_log_order; }
 
+    [[nodiscard]] auto get_serve_socket_path() const -> std::string const& {
+        return m_serve_socket_path;
+    }
+
+    [[nodiscard]] auto get_max_concurrent_queries() const -> size_t {
+        return m_max_concurrent_queries;
+    }
+
+    [[nodiscard]] auto get_max_queued_queries() const -> size_t { return m_max_queued_queries; }
+
+    [[nodiscard]] auto get_archive_cache_size() const -> size_t { return m_archive_cache_size; }
+
 private:
     // Methods
     /**
@@ -228,6 +241,8 @@ private:
 
     void print_search_usage() const;
 
+    void print_serve_usage() const;
+
     // Variables
     std::string m_program_name;
     Command m_command;
@@ -266,6 +281,12 @@ private:
     std::vector<std::string> m_projection_columns;
 
     std::optional<Aggregator> m_aggregator;
+
+    // Serve variables
+    std::string m_serve_socket_path;
+    size_t m_max_concurrent_queries{4};
+    size_t m_max_queued_queries{64};
+    size_t m_archive_cache_size{1ULL * 1024 * 1024 * 1024};  // 1 GiB
 };
 }  // namespace clp_s
 
@@ -11,6 +11,8 @@
 
 #include <boost/algorithm/string/case_conv.hpp>
 #include <string_utils/string_utils.hpp>
+#include <utils/profiling/Counter.hpp>
+#include <utils/profiling/ScopedProfiler.hpp>
 
 #include "../clp/Defs.h"
 #include "ArchiveReaderAdaptor.hpp"
@@ -32,7 +34,7 @@ public:
     using Entry = EntryType;
 
     // Constructors
-    DictionaryReader(ArchiveReaderAdaptor& adaptor) : m_is_open(false), m_adaptor(adaptor) {}
+    DictionaryReader() : m_is_open(false) {}
 
     // Methods
     /**
@@ -48,8 +50,13 @@ public:
 
     /**
      * Reads all entries from disk
+     *
+     * The reader doesn't retain `adaptor`, so a reader whose entries have been read may outlive
+     * the archive it was read from (e.g., when it's cached in an `ArchiveCache`).
+     * @param adaptor The adaptor for the archive containing the dictionary
+     * @param lazy
      */
-    void read_entries(bool lazy = false);
+    void read_entries(ArchiveReaderAdaptor& adaptor, bool lazy = false);
 
     /**
      * @return All dictionary entries
@@ -91,7 +98,6 @@ public:
 
 protected:
     bool m_is_open;
-    ArchiveReaderAdaptor& m_adaptor;
     std::string m_dictionary_path;
     ZstdDecompressor m_dictionary_decompressor;
     std::vector<EntryType> m_entries;
@@ -121,13 +127,18 @@ void DictionaryReader<DictionaryIdType, EntryType>::close() {
 }
 
 template <typename DictionaryIdType, typename EntryType>
-void DictionaryReader<DictionaryIdType, EntryType>::read_entries(bool lazy) {
+void DictionaryReader<DictionaryIdType, EntryType>::read_entries(
+        ArchiveReaderAdaptor& adaptor,
+        bool lazy
+) {
     if (false == m_is_open) {
         throw OperationFailed(ErrorCodeNotInit, __FILENAME__, __LINE__);
     }
 
     constexpr size_t cDecompressorFileReadBufferCapacity = 64 * 1024;  // 64 KiB
-    auto dictionary_reader = m_adaptor.checkout_reader_for_section(m_dictionary_path);
+    PROFILE_SCOPE("read_dictionary");
+    auto dictionary_reader = adaptor.checkout_reader_for_section(m_dictionary_path);
+    [[maybe_unused]] auto const dictionary_begin_pos{dictionary_reader->get_pos()};
 
     uint64_t num_dictionary_entries;
     dictionary_reader->read_numeric_value(num_dictionary_entries, false);
@@ -140,8 +151,10 @@ void DictionaryReader<DictionaryIdType, EntryType>::read_entries(bool lazy) {
         entry.read_from_file(m_dictionary_decompressor, i, lazy);
     }
 
+    PROFILE_COUNT("read_bytes", dictionary_reader->get_pos() - dictionary_begin_pos);
+    PROFILE_COUNT("decompressed_bytes", m_dictionary_decompressor.get_decompressed_stream_pos());
     m_dictionary_decompressor.close();
-    m_adaptor.checkin_reader_for_section(m_dictionary_path);
+    adaptor.checkin_reader_for_section(m_dictionary_path);
 }
 
 template <typename DictionaryIdType, typename EntryType>
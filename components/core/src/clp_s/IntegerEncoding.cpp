@@ -0,0 +1,274 @@
+#include "IntegerEncoding.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <span>
+#include <vector>
+
+#include <clp_s/BufferViewReader.hpp>
+#include <clp_s/ErrorCode.hpp>
+#include <clp_s/ZstdCompressor.hpp>
+
+namespace clp_s {
+namespace {
+/**
+ * Writes the given values as raw 64-bit integers.
+ * @tparam T
+ * @param values
+ * @param compressor
+ */
+template <typename T>
+auto write_raw(std::span<T const> values, ZstdCompressor& compressor) -> void;
+
+/**
+ * Writes the given values using frame-of-reference encoding and bit-packing.
+ * @tparam T
+ * @param values
+ * @param frame_of_reference The minimum value.
+ * @param bit_width The number of bits needed to represent the largest value's offset from
+ * `frame_of_reference`.
+ * @param compressor
+ */
+template <typename T>
+auto write_bit_packed(
+        std::span<T const> values,
+        T frame_of_reference,
+        uint8_t bit_width,
+        ZstdCompressor& compressor
+) -> void;
+
+/**
+ * Writes the given values using run-length encoding.
+ * @tparam T
+ * @param values
+ * @param num_runs The number of runs of equal values in `values`.
+ * @param compressor
+ */
+template <typename T>
+auto write_run_length(std::span<T const> values, size_t num_runs, ZstdCompressor& compressor)
+        -> void;
+
+template <typename T>
+auto write_raw(std::span<T const> values, ZstdCompressor& compressor) -> void {
+    compressor.write_numeric_value(IntegerEncoding::Raw);
+    compressor.write(reinterpret_cast<char const*>(values.data()), values.size() * sizeof(T));
+}
+
+template <typename T>
+auto write_bit_packed(
+        std::span<T const> values,
+        T frame_of_reference,
+        uint8_t bit_width,
+        ZstdCompressor& compressor
+) -> void {
+    compressor.write_numeric_value(IntegerEncoding::BitPacked);
+    compressor.write_numeric_value(frame_of_reference);
+    compressor.write_numeric_value(bit_width);
+
+    std::vector<char> packed_values((values.size() * bit_width + 7) / 8 + cBitPackedPaddingSize);
+    if (0 != bit_width) {
+        size_t bit_pos{0};
+        for (auto const value : values) {
+            auto const offset{
+                    static_cast<uint64_t>(value) - static_cast<uint64_t>(frame_of_reference)
+            };
+            auto* const word_begin{packed_values.data() + bit_pos / 8};
+            uint64_t word{};
+            std::memcpy(&word, word_begin, sizeof(word));
+            word |= offset << (bit_pos % 8);
+            std::memcpy(word_begin, &word, sizeof(word));
+            bit_pos += bit_width;
+        }
+    }
+    compressor.write(packed_values.data(), packed_values.size());
+}
+
+template <typename T>
+auto write_run_length(std::span<T const> values, size_t num_runs, ZstdCompressor& compressor)
+        -> void {
+    std::vector<T> run_values;
+    std::vector<uint64_t> run_ends;
+    run_values.reserve(num_runs);
+    run_ends.reserve(num_runs);
+    for (size_t i{0}; i < values.size(); ++i) {
+        if (0 != i && values[i] == run_values.back()) {
+            run_ends.back() = i + 1;
+            continue;
+        }
+        run_values.push_back(values[i]);
+        run_ends.push_back(i + 1);
+    }
+
+    compressor.write_numeric_value(IntegerEncoding::RunLength);
+    compressor.write_numeric_value(static_cast<uint64_t>(run_values.size()));
+    compressor.write(
+            reinterpret_cast<char const*>(run_values.data()),
+            run_values.size() * sizeof(T)
+    );
+    compressor.write(
+            reinterpret_cast<char const*>(run_ends.data()),
+            run_ends.size() * sizeof(uint64_t)
+    );
+}
+}  // namespace
+
+template <typename T>
+auto write_encoded_integers(std::span<T const> values, ZstdCompressor& compressor) -> void {
+    if (values.empty()) {
+        write_raw(values, compressor);
+        return;
+    }
+
+    auto const [min_it, max_it] = std::minmax_element(values.begin(), values.end());
+    size_t num_runs{1};
+    for (size_t i{1}; i < values.size(); ++i) {
+        if (values[i] != values[i - 1]) {
+            ++num_runs;
+        }
+    }
+
+    auto const raw_size{values.size() * sizeof(T)};
+    auto const run_length_size{sizeof(uint64_t) + num_runs * (sizeof(T) + sizeof(uint64_t))};
+    auto const bit_width{static_cast<uint8_t>(
+            std::bit_width(static_cast<uint64_t>(*max_it) - static_cast<uint64_t>(*min_it))
+    )};
+    auto bit_packed_size{std::numeric_limits<size_t>::max()};
+    if (bit_width <= cMaxBitPackedWidth) {
+        bit_packed_size = sizeof(T) + sizeof(bit_width) + (values.size() * bit_width + 7) / 8
+                          + cBitPackedPaddingSize;
+    }
+
+    if (run_length_size < raw_size && run_length_size <= bit_packed_size) {
+        write_run_length(values, num_runs, compressor);
+    } else if (bit_packed_size < raw_size) {
+        write_bit_packed(values, *min_it, bit_width, compressor);
+    } else {
+        write_raw(values, compressor);
+    }
+}
+
+template <typename T>
+auto EncodedIntegerSpan<T>::load(BufferViewReader& reader, uint64_t num_values, bool is_encoded)
+        -> void {
+    m_encoding = IntegerEncoding::Raw;
+    if (is_encoded) {
+        m_encoding = static_cast<IntegerEncoding>(reader.read_value<uint8_t>());
+    }
+
+    switch (m_encoding) {
+        case IntegerEncoding::Raw:
+            m_raw_values = reader.read_unaligned_span_u64<T>(num_values);
+            m_size = m_raw_values.size();
+            return;
+        case IntegerEncoding::BitPacked: {
+            m_frame_of_reference = reader.read_value<T>();
+            m_bit_width = reader.read_value<uint8_t>();
+            if (m_bit_width > cMaxBitPackedWidth
+                || (0 != m_bit_width
+                    && num_values > std::numeric_limits<size_t>::max() / m_bit_width))
+            {
+                throw OperationFailed(ErrorCodeCorrupt, __FILENAME__, __LINE__);
+            }
+            m_size = static_cast<size_t>(num_values);
+            m_bit_mask = (uint64_t{1} << m_bit_width) - 1;
+            m_packed_values
+                    = reader.read_bytes((m_size * m_bit_width + 7) / 8 + cBitPackedPaddingSize);
+            return;
+        }
+        case IntegerEncoding::RunLength: {
+            auto const num_runs{reader.read_value<uint64_t>()};
+            if (num_runs > num_values || (0 == num_runs) != (0 == num_values)) {
+                throw OperationFailed(ErrorCodeCorrupt, __FILENAME__, __LINE__);
+            }
+            auto const run_values{reader.read_unaligned_span_u64<T>(num_runs)};
+            auto const run_ends{reader.read_unaligned_span_u64<uint64_t>(num_runs)};
+            m_run_values.resize(run_values.size());
+            m_run_ends.resize(run_ends.size());
+            uint64_t prev_run_end{0};
+            for (size_t i{0}; i < run_ends.size(); ++i) {
+                m_run_values[i] = run_values[i];
+                m_run_ends[i] = run_ends[i];
+                if (m_run_ends[i] <= prev_run_end) {
+                    throw OperationFailed(ErrorCodeCorrupt, __FILENAME__, __LINE__);
+                }
+                prev_run_end = m_run_ends[i];
+            }
+            if (prev_run_end != num_values) {
+                throw OperationFailed(ErrorCodeCorrupt, __FILENAME__, __LINE__);
+            }
+            m_size = static_cast<size_t>(num_values);
+            m_cur_run = 0;
+            return;
+        }
+    }
+    throw OperationFailed(ErrorCodeCorrupt, __FILENAME__, __LINE__);
+}
+
+template <typename T>
+auto EncodedIntegerSpan<T>::mark_values_in_range(T lower, T upper, std::vector<uint8_t>& bitmap)
+        const -> void {
+    if (lower > upper) {
+        return;
+    }
+
+    switch (m_encoding) {
+        case IntegerEncoding::Raw:
+            for (size_t i{0}; i < m_size; ++i) {
+                auto const value{m_raw_values[i]};
+                bitmap[i] |= (lower <= value && value <= upper) ? 1 : 0;
+            }
+            break;
+        case IntegerEncoding::BitPacked: {
+            if (upper < m_frame_of_reference) {
+                break;
+            }
+            // Offsets from the frame of reference are ordered the same way as the values, so the
+            // range can be translated into a range of offsets.
+            uint64_t lower_offset{0};
+            if (lower > m_frame_of_reference) {
+                lower_offset = static_cast<uint64_t>(lower)
+                               - static_cast<uint64_t>(m_frame_of_reference);
+            }
+            auto const upper_offset{
+                    static_cast<uint64_t>(upper) - static_cast<uint64_t>(m_frame_of_reference)
+            };
+            if (lower_offset > m_bit_mask) {
+                break;
+            }
+            auto const offset_range{upper_offset - lower_offset};
+            for (size_t i{0}; i < m_size; ++i) {
+                bitmap[i] |= (get_bit_packed_offset(i) - lower_offset <= offset_range) ? 1 : 0;
+            }
+            break;
+        }
+        case IntegerEncoding::RunLength: {
+            uint64_t run_begin{0};
+            for (size_t i{0}; i < m_run_values.size(); ++i) {
+                auto const value{m_run_values[i]};
+                if (lower <= value && value <= upper) {
+                    std::fill(
+                            bitmap.begin() + static_cast<std::ptrdiff_t>(run_begin),
+                            bitmap.begin() + static_cast<std::ptrdiff_t>(m_run_ends[i]),
+                            1
+                    );
+                }
+                run_begin = m_run_ends[i];
+            }
+            break;
+        }
+    }
+}
+
+template auto
+write_encoded_integers<int64_t>(std::span<int64_t const> values, ZstdCompressor& compressor)
+        -> void;
+template auto
+write_encoded_integers<uint64_t>(std::span<uint64_t const> values, ZstdCompressor& compressor)
+        -> void;
+template class EncodedIntegerSpan<int64_t>;
+template class EncodedIntegerSpan<uint64_t>;
+}  // namespace clp_s
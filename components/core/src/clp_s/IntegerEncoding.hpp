@@ -0,0 +1,216 @@
+#ifndef CLP_S_INTEGERENCODING_HPP
+#define CLP_S_INTEGERENCODING_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <span>
+#include <vector>
+
+#include <clp_s/BufferViewReader.hpp>
+#include <clp_s/ErrorCode.hpp>
+#include <clp_s/TraceableException.hpp>
+#include <clp_s/Utils.hpp>
+#include <clp_s/ZstdCompressor.hpp>
+
+namespace clp_s {
+/**
+ * Encodings for a column of 64-bit integers. The encoding is chosen per column when the column is
+ * stored, and is written as a one-byte tag before the column's data:
+ * - Raw: every value as a 64-bit integer.
+ * - BitPacked: frame-of-reference encoding, i.e., the minimum value as a 64-bit integer, followed
+ *   by a one-byte bit width, followed by every value minus the minimum packed into that many bits,
+ *   followed by `cBitPackedPaddingSize` bytes of padding.
+ * - RunLength: the number of runs as a 64-bit integer, followed by the value of every run as a
+ *   64-bit integer, followed by the (exclusive) end index of every run as a 64-bit integer.
+ */
+enum class IntegerEncoding : uint8_t {
+    Raw = 0,
+    BitPacked = 1,
+    RunLength = 2,
+};
+
+// The number of bytes an encoded column may use beyond the size of its raw values.
+constexpr size_t cIntegerEncodingHeaderSize{sizeof(IntegerEncoding)};
+
+// Bit-packed values are read with a single unaligned 64-bit load, so a value can span at most 64
+// bits minus the 7 bits it may be offset by within its first byte.
+constexpr uint8_t cMaxBitPackedWidth{56};
+
+// Padding after the bit-packed values so that the 64-bit load for the last value stays in bounds.
+constexpr size_t cBitPackedPaddingSize{sizeof(uint64_t) - 1};
+
+/**
+ * Writes the given values using whichever encoding produces the least data. The data written is at
+ * most `cIntegerEncodingHeaderSize` bytes larger than the raw values.
+ * @tparam T `int64_t` or `uint64_t`.
+ * @param values
+ * @param compressor
+ */
+template <typename T>
+auto write_encoded_integers(std::span<T const> values, ZstdCompressor& compressor) -> void;
+
+/**
+ * A read-only view of a column of 64-bit integers written by `write_encoded_integers`, which
+ * supports random access without decoding the column.
+ *
+ * Accessing run-length encoded values in increasing or decreasing order takes amortized constant
+ * time, while accessing them in any other order takes time logarithmic in the number of runs.
+ * @tparam T `int64_t` or `uint64_t`.
+ */
+template <typename T>
+class EncodedIntegerSpan {
+public:
+    class OperationFailed : public TraceableException {
+    public:
+        // Constructors
+        OperationFailed(ErrorCode error_code, char const* const filename, int line_number)
+                : TraceableException(error_code, filename, line_number) {}
+    };
+
+    // Methods
+    /**
+     * Reads the column from a shared buffer.
+     * @param reader
+     * @param num_values
+     * @param is_encoded Whether the column was written by `write_encoded_integers`, as opposed to
+     * as raw values without an encoding tag (as in archives from before integer encodings were
+     * introduced).
+     * @throw OperationFailed if the column is corrupt.
+     * @throw BufferViewReader::OperationFailed if the buffer doesn't contain the entire column.
+     */
+    auto load(BufferViewReader& reader, uint64_t num_values, bool is_encoded) -> void;
+
+    [[nodiscard]] auto size() const -> size_t { return m_size; }
+
+    [[nodiscard]] auto get_encoding() const -> IntegerEncoding { return m_encoding; }
+
+    /**
+     * @param i
+     * @return The value at index `i`.
+     */
+    [[nodiscard]] auto operator[](size_t i) -> T {
+        if (IntegerEncoding::BitPacked == m_encoding) {
+            return get_bit_packed_value(i);
+        }
+        if (IntegerEncoding::RunLength == m_encoding) {
+            return m_run_values[find_run(i)];
+        }
+        return m_raw_values[i];
+    }
+
+    /**
+     * Sets `bitmap[i]` to 1 for every index `i` whose value is within the given inclusive range.
+     * Other entries of `bitmap` are left unchanged.
+     *
+     * Bit-packed values are compared without adding the frame of reference back, and run-length
+     * encoded values are compared once per run.
+     * @param lower
+     * @param upper
+     * @param bitmap A bitmap with at least `size()` entries.
+     */
+    auto mark_values_in_range(T lower, T upper, std::vector<uint8_t>& bitmap) const -> void;
+
+    /**
+     * Sets `bitmap[i]` to 1 for every index `i` whose value satisfies the given predicate. Other
+     * entries of `bitmap` are left unchanged.
+     *
+     * Run-length encoded values are tested once per run.
+     * @tparam Predicate A callable that takes a value and returns whether it matches.
+     * @param predicate
+     * @param bitmap A bitmap with at least `size()` entries.
+     */
+    template <typename Predicate>
+    auto mark_matching_values(Predicate predicate, std::vector<uint8_t>& bitmap) const -> void {
+        switch (m_encoding) {
+            case IntegerEncoding::Raw:
+                for (size_t i{0}; i < m_size; ++i) {
+                    bitmap[i] |= predicate(m_raw_values[i]) ? 1 : 0;
+                }
+                break;
+            case IntegerEncoding::BitPacked:
+                for (size_t i{0}; i < m_size; ++i) {
+                    bitmap[i] |= predicate(get_bit_packed_value(i)) ? 1 : 0;
+                }
+                break;
+            case IntegerEncoding::RunLength: {
+                uint64_t run_begin{0};
+                for (size_t i{0}; i < m_run_values.size(); ++i) {
+                    if (predicate(m_run_values[i])) {
+                        std::fill(
+                                bitmap.begin() + static_cast<std::ptrdiff_t>(run_begin),
+                                bitmap.begin() + static_cast<std::ptrdiff_t>(m_run_ends[i]),
+                                1
+                        );
+                    }
+                    run_begin = m_run_ends[i];
+                }
+                break;
+            }
+        }
+    }
+
+private:
+    // Methods
+    /**
+     * @param i
+     * @return The bit-packed offset of the value at index `i` from the frame of reference.
+     */
+    [[nodiscard]] auto get_bit_packed_offset(size_t i) const -> uint64_t {
+        if (0 == m_bit_width) {
+            return 0;
+        }
+        auto const bit_pos{i * m_bit_width};
+        uint64_t word{};
+        std::memcpy(&word, m_packed_values + bit_pos / 8, sizeof(word));
+        return (word >> (bit_pos % 8)) & m_bit_mask;
+    }
+
+    /**
+     * @param i
+     * @return The bit-packed value at index `i`.
+     */
+    [[nodiscard]] auto get_bit_packed_value(size_t i) const -> T {
+        auto const offset{get_bit_packed_offset(i)};
+        return static_cast<T>(static_cast<uint64_t>(m_frame_of_reference) + offset);
+    }
+
+    /**
+     * @param i
+     * @return The index of the run containing index `i`.
+     */
+    [[nodiscard]] auto find_run(size_t i) -> size_t {
+        auto const run_begin{0 == m_cur_run ? 0 : m_run_ends[m_cur_run - 1]};
+        if (i >= run_begin && i < m_run_ends[m_cur_run]) {
+            return m_cur_run;
+        }
+        if (m_cur_run + 1 < m_run_ends.size() && i >= m_run_ends[m_cur_run]
+            && i < m_run_ends[m_cur_run + 1])
+        {
+            return ++m_cur_run;
+        }
+        m_cur_run = static_cast<size_t>(
+                std::upper_bound(m_run_ends.begin(), m_run_ends.end(), i) - m_run_ends.begin()
+        );
+        return m_cur_run;
+    }
+
+    // Variables
+    IntegerEncoding m_encoding{IntegerEncoding::Raw};
+    size_t m_size{0};
+
+    UnalignedMemSpan<T> m_raw_values;
+
+    T m_frame_of_reference{};
+    uint8_t m_bit_width{0};
+    uint64_t m_bit_mask{0};
+    char const* m_packed_values{nullptr};
+
+    std::vector<T> m_run_values;
+    std::vector<uint64_t> m_run_ends;
+    size_t m_cur_run{0};
+};
+}  // namespace clp_s
+
+#endif  // CLP_S_INTEGERENCODING_HPP
@@ -16,6 +16,7 @@
 #include <fmt/format.h>
 #include <simdjson.h>
 #include <spdlog/spdlog.h>
+#include <utils/profiling/ScopedProfiler.hpp>
 
 #include <clp/ErrorCode.hpp>
 #include <clp/ffi/EncodedTextAst.hpp>
@@ -753,6 +754,7 @@ auto JsonParser::ingest_json(
         std::string const& file_name_in_metadata,
         std::string const& archive_creator_id
 ) -> bool {
+    PROFILE_SCOPE("ingest_json");
     JsonFileIterator json_file_iterator(*reader, m_max_document_size);
     if (simdjson::error_code::SUCCESS != json_file_iterator.get_error()) {
         SPDLOG_ERROR(
@@ -855,6 +857,7 @@ auto JsonParser::ingest_json(
         // Instead of checking for an error every time we access a JSON field in parse_line we
         // just catch simdjson_error here instead.
         try {
+            PROFILE_SCOPE_DEBUG("parse");
             parse_line(ref.value(), constants::cRootNodeId, constants::cRootNodeName);
         } catch (simdjson::simdjson_error& error) {
             SPDLOG_ERROR(
@@ -866,10 +869,7 @@ auto JsonParser::ingest_json(
             return false;
         }
 
-        int32_t current_schema_id = m_archive_writer->add_schema(m_current_schema);
-        m_current_parsed_message.set_id(current_schema_id);
-        m_archive_writer
-                ->append_message(current_schema_id, m_current_schema, m_current_parsed_message);
+        append_current_message();
 
         bytes_consumed_up_to_prev_record = json_file_iterator.get_num_bytes_consumed();
         if (m_archive_writer->get_data_size() >= m_target_encoded_size) {
@@ -923,6 +923,7 @@ auto JsonParser::ingest_kvir(
         std::string const& file_name_in_metadata,
         std::string const& archive_creator_id
 ) -> bool {
+    PROFILE_SCOPE("ingest_kvir");
     auto deserializer_result{Deserializer<IrUnitHandler>::create(*reader, IrUnitHandler{})};
     if (deserializer_result.has_error()) {
         auto err = deserializer_result.error();
@@ -1388,17 +1389,29 @@ void JsonParser::parse_kv_log_event_subtree(
 void JsonParser::parse_kv_log_event(KeyValuePairLogEvent const& kv) {
     clp::ffi::SchemaTree const& tree = kv.get_user_gen_keys_schema_tree();
 
-    parse_kv_log_event_subtree<true>(
-            kv.get_auto_gen_node_id_value_pairs(),
-            kv.get_auto_gen_keys_schema_tree()
-    );
-    parse_kv_log_event_subtree<false>(
-            kv.get_user_gen_node_id_value_pairs(),
-            kv.get_user_gen_keys_schema_tree()
-    );
+    {
+        PROFILE_SCOPE_DEBUG("parse");
+        parse_kv_log_event_subtree<true>(
+                kv.get_auto_gen_node_id_value_pairs(),
+                kv.get_auto_gen_keys_schema_tree()
+        );
+        parse_kv_log_event_subtree<false>(
+                kv.get_user_gen_node_id_value_pairs(),
+                kv.get_user_gen_keys_schema_tree()
+        );
+    }
+
+    append_current_message();
+}
 
-    int32_t const current_schema_id = m_archive_writer->add_schema(m_current_schema);
+void JsonParser::append_current_message() {
+    int32_t current_schema_id{};
+    {
+        PROFILE_SCOPE_DEBUG("resolve_schema");
+        current_schema_id = m_archive_writer->add_schema(m_current_schema);
+    }
     m_current_parsed_message.set_id(current_schema_id);
+    PROFILE_SCOPE_DEBUG("append");
     m_archive_writer->append_message(current_schema_id, m_current_schema, m_current_parsed_message);
 }
 
@@ -188,6 +188,11 @@ private:
      */
     void parse_kv_log_event(clp::ffi::KeyValuePairLogEvent const& kv);
 
+    /**
+     * Resolves the schema of the current parsed message and appends the message to the archive.
+     */
+    void append_current_message();
+
     /**
      * Parses an array within a JSON line
      * @param line the JSON array
@@ -1,5 +1,7 @@
 #include "OutputHandlerImpl.hpp"
 
+#include <algorithm>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -7,6 +9,7 @@
 
 #include <bsoncxx/builder/basic/document.hpp>
 #include <bsoncxx/builder/basic/kvp.hpp>
+#include <fmt/format.h>
 #include <mongocxx/client.hpp>
 #include <mongocxx/collection.hpp>
 #include <mongocxx/exception/exception.hpp>
@@ -40,6 +43,23 @@ void FileOutputHandler::write(
     msgpack::pack(m_file_writer, src);
 }
 
+void SocketOutputHandler::write(
+        string_view message,
+        epochtime_t timestamp,
+        string_view archive_id,
+        int64_t log_event_idx
+) {
+    write(fmt::format("{}: {}: {} {}", archive_id, log_event_idx, timestamp, message));
+}
+
+void SocketOutputHandler::write(string_view message) {
+    if (clp::ErrorCode_Success
+        != clp::networking::try_send(m_socket_fd, message.data(), message.size()))
+    {
+        throw OperationFailed(ErrorCode::ErrorCodeFailureNetwork, __FILENAME__, __LINE__);
+    }
+}
+
 NetworkOutputHandler::NetworkOutputHandler(
         string const& host,
         int port,
@@ -76,12 +96,14 @@ ResultsCacheOutputHandler::ResultsCacheOutputHandler(
         uint64_t batch_size,
         uint64_t max_num_results,
         string_view dataset,
+        std::optional<epochtime_t> timestamp_lower_bound,
         bool should_output_timestamp
 )
         : ::clp_s::search::OutputHandler{should_output_timestamp, true},
           m_batch_size{batch_size},
           m_max_num_results{max_num_results},
-          m_dataset{dataset} {
+          m_dataset{dataset},
+          m_initial_timestamp_lower_bound{timestamp_lower_bound} {
     m_collection = connect_to_results_cache(uri, collection, m_client);
     m_results.reserve(m_batch_size);
 }
@@ -152,6 +174,12 @@ void ResultsCacheOutputHandler::write(
         string_view archive_id,
         int64_t log_event_idx
 ) {
+    if (m_initial_timestamp_lower_bound.has_value()
+        && timestamp <= m_initial_timestamp_lower_bound.value())
+    {
+        return;
+    }
+
     if (m_latest_results.size() < m_max_num_results) {
         m_latest_results.emplace(
                 std::make_unique<QueryResult>(
@@ -178,6 +206,17 @@ void ResultsCacheOutputHandler::write(
     }
 }
 
+auto ResultsCacheOutputHandler::get_timestamp_lower_bound() const -> std::optional<epochtime_t> {
+    if (0 == m_max_num_results || m_latest_results.size() < m_max_num_results) {
+        return m_initial_timestamp_lower_bound;
+    }
+    auto const kth_latest_timestamp{m_latest_results.top()->timestamp};
+    if (m_initial_timestamp_lower_bound.has_value()) {
+        return std::max(kth_latest_timestamp, m_initial_timestamp_lower_bound.value());
+    }
+    return kth_latest_timestamp;
+}
+
 CountReducerOutputHandler::CountReducerOutputHandler(int reducer_socket_fd)
         : search::OutputHandler(false, false),
           m_reducer_socket_fd(reducer_socket_fd),
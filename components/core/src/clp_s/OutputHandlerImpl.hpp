@@ -8,6 +8,7 @@
 #include <iostream>
 #include <map>
 #include <memory>
+#include <optional>
 #include <queue>
 #include <string>
 #include <string_view>
@@ -54,6 +55,39 @@ public:
     void write(std::string_view message) override { std::cout << message; }
 };
 
+/**
+ * Output handler that writes results, formatted like `StandardOutputHandler`'s, to a connected
+ * socket that it doesn't own.
+ */
+class SocketOutputHandler : public ::clp_s::search::OutputHandler {
+public:
+    // Types
+    class OperationFailed : public TraceableException {
+    public:
+        // Constructors
+        OperationFailed(ErrorCode error_code, char const* const filename, int line_number)
+                : TraceableException(error_code, filename, line_number) {}
+    };
+
+    // Constructors
+    explicit SocketOutputHandler(int socket_fd, bool should_output_metadata = false)
+            : ::clp_s::search::OutputHandler(should_output_metadata, true),
+              m_socket_fd{socket_fd} {}
+
+    // Methods inherited from OutputHandler
+    void write(
+            std::string_view message,
+            epochtime_t timestamp,
+            std::string_view archive_id,
+            int64_t log_event_idx
+    ) override;
+
+    void write(std::string_view message) override;
+
+private:
+    int m_socket_fd;
+};
+
 /**
  * Output handler that writes to a file.
  */
@@ -166,12 +200,24 @@ public:
     };
 
     // Constructor
+    /**
+     * @param uri
+     * @param collection
+     * @param batch_size
+     * @param max_num_results
+     * @param dataset
+     * @param timestamp_lower_bound The timestamp of the oldest of the latest `max_num_results`
+     * results found by previous searches (e.g., of other archives), if any. Records that aren't
+     * newer than this timestamp are dropped.
+     * @param should_output_metadata
+     */
     ResultsCacheOutputHandler(
             std::string_view uri,
             std::string_view collection,
             uint64_t batch_size,
             uint64_t max_num_results,
             std::string_view dataset,
+            std::optional<epochtime_t> timestamp_lower_bound = std::nullopt,
             bool should_output_metadata = true
     );
 
@@ -199,6 +245,14 @@ public:
 
     void write(std::string_view message) override { write(message, 0, {}, 0); }
 
+    /**
+     * @return The timestamp of the oldest of the latest `max_num_results` results seen so far, or
+     * the lower bound given at construction if it's newer.
+     */
+    [[nodiscard]] auto get_timestamp_lower_bound() const -> std::optional<epochtime_t> override;
+
+    [[nodiscard]] auto keeps_latest_results_only() const -> bool override { return true; }
+
 private:
     mongocxx::client m_client;
     mongocxx::collection m_collection;
@@ -206,6 +260,7 @@ private:
     uint64_t m_batch_size;
     uint64_t m_max_num_results;
     std::string m_dataset;
+    std::optional<epochtime_t> m_initial_timestamp_lower_bound;
     std::priority_queue<
             std::unique_ptr<QueryResult>,
             std::vector<std::unique_ptr<QueryResult>>,
@@ -3,6 +3,8 @@
 #include <cstddef>
 #include <cstdint>
 
+#include <utils/profiling/Counter.hpp>
+#include <utils/profiling/ScopedProfiler.hpp>
 #include <ystdlib/error_handling/Result.hpp>
 
 #include "../clp/BoundedReader.hpp"
@@ -105,6 +107,7 @@ void PackedStreamReader::close() {
 void
 PackedStreamReader::read_stream(size_t stream_id, std::shared_ptr<char[]>& buf, size_t& buf_size) {
     constexpr size_t cDecompressorFileReadBufferCapacity = 64 * 1024;  // 64 KiB
+    PROFILE_SCOPE("read_packed_stream");
     if (stream_id >= m_stream_metadata.size()) {
         throw OperationFailed(ErrorCodeCorrupt, __FILENAME__, __LINE__);
     }
@@ -157,6 +160,8 @@ PackedStreamReader::read_stream(size_t stream_id, std::shared_ptr<char[]>& buf,
     {
         throw OperationFailed(error, __FILENAME__, __LINE__);
     }
+    PROFILE_COUNT("read_bytes", bounded_reader.get_pos() - adjusted_file_offset);
+    PROFILE_COUNT("decompressed_bytes", uncompressed_size);
     m_packed_stream_decompressor.close_for_reuse();
 }
 }  // namespace clp_s
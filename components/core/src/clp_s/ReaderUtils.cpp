@@ -62,26 +62,20 @@ std::shared_ptr<SchemaTree> ReaderUtils::read_schema_tree(ArchiveReaderAdaptor&
     return tree;
 }
 
-std::shared_ptr<VariableDictionaryReader> ReaderUtils::get_variable_dictionary_reader(
-        ArchiveReaderAdaptor& adaptor
-) {
-    auto reader = std::make_shared<VariableDictionaryReader>(adaptor);
+std::shared_ptr<VariableDictionaryReader> ReaderUtils::get_variable_dictionary_reader() {
+    auto reader = std::make_shared<VariableDictionaryReader>();
     reader->open(constants::cArchiveVarDictFile);
     return reader;
 }
 
-std::shared_ptr<LogTypeDictionaryReader> ReaderUtils::get_log_type_dictionary_reader(
-        ArchiveReaderAdaptor& adaptor
-) {
-    auto reader = std::make_shared<LogTypeDictionaryReader>(adaptor);
+std::shared_ptr<LogTypeDictionaryReader> ReaderUtils::get_log_type_dictionary_reader() {
+    auto reader = std::make_shared<LogTypeDictionaryReader>();
     reader->open(constants::cArchiveLogDictFile);
     return reader;
 }
 
-std::shared_ptr<LogTypeDictionaryReader> ReaderUtils::get_array_dictionary_reader(
-        ArchiveReaderAdaptor& adaptor
-) {
-    auto reader = std::make_shared<LogTypeDictionaryReader>(adaptor);
+std::shared_ptr<LogTypeDictionaryReader> ReaderUtils::get_array_dictionary_reader() {
+    auto reader = std::make_shared<LogTypeDictionaryReader>();
     reader->open(constants::cArchiveArrayDictFile);
     return reader;
 }
@@ -48,30 +48,21 @@ public:
 
     /**
      * Gets the variable dictionary reader for an archive
-     * @param adaptor
      * @return the variable dictionary reader
      */
-    static std::shared_ptr<VariableDictionaryReader> get_variable_dictionary_reader(
-            ArchiveReaderAdaptor& adaptor
-    );
+    static std::shared_ptr<VariableDictionaryReader> get_variable_dictionary_reader();
 
     /**
      * Gets the log type dictionary reader for an archive
-     * @param adaptor
      * @return the log type dictionary reader
      */
-    static std::shared_ptr<LogTypeDictionaryReader> get_log_type_dictionary_reader(
-            ArchiveReaderAdaptor& adaptor
-    );
+    static std::shared_ptr<LogTypeDictionaryReader> get_log_type_dictionary_reader();
 
     /**
      * Gets the array dictionary reader for an archive
-     * @param adaptor
      * @return the array dictionary reader
      */
-    static std::shared_ptr<LogTypeDictionaryReader> get_array_dictionary_reader(
-            ArchiveReaderAdaptor& adaptor
-    );
+    static std::shared_ptr<LogTypeDictionaryReader> get_array_dictionary_reader();
 
     /**
      * Converts a serialized 64-bit numeric value into `size_t` with bounds checking.
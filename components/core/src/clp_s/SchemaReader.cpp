@@ -1,8 +1,11 @@
 #include "SchemaReader.hpp"
 
+#include <optional>
 #include <stack>
 #include <string>
 
+#include <utils/profiling/ScopedProfiler.hpp>
+
 #include <clp_s/archive_constants.hpp>
 #include <clp_s/BufferViewReader.hpp>
 #include <clp_s/ErrorCode.hpp>
@@ -75,6 +78,7 @@ SchemaReader::load(std::shared_ptr<char[]> stream_buffer, size_t offset, size_t
 }
 
 auto SchemaReader::generate_json_string(uint64_t message_index) -> std::string {
+    PROFILE_SCOPE_DEBUG("marshal_record");
     m_json_serializer.reset();
     m_json_serializer.begin_document();
     size_t column_id_index = 0;
@@ -284,11 +288,15 @@ bool SchemaReader::get_next_message_with_metadata(
         std::string& message,
         epochtime_t& timestamp,
         int64_t& log_event_idx,
-        FilterClass& filter
+        FilterClass& filter,
+        std::optional<epochtime_t> timestamp_lower_bound
 ) {
-    // TODO: If we already get max_num_results messages, we can skip messages
-    // with the timestamp less than the smallest timestamp in the priority queue
-    while (m_cur_message < m_num_messages && false == filter.filter(m_cur_message)) {
+    // Reading the timestamp is much cheaper than evaluating the filter, so check it first
+    while (m_cur_message < m_num_messages
+           && ((timestamp_lower_bound.has_value()
+                && m_get_timestamp() <= timestamp_lower_bound.value())
+               || false == filter.filter(m_cur_message)))
+    {
         ++m_cur_message;
     }
 
@@ -4,6 +4,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <memory>
+#include <optional>
 #include <span>
 #include <string>
 #include <type_traits>
@@ -232,17 +233,22 @@ public:
 
     /**
      * Gets the next message matching a filter as well as its timestamp and log event index.
+     *
+     * If a timestamp lower bound is given, messages with timestamps less than or equal to it are
+     * skipped before the filter is evaluated or the message is marshalled.
      * @param message
      * @param timestamp
      * @param log_event_idx
      * @param filter
+     * @param timestamp_lower_bound
      * @return true if there is a next message
      */
     bool get_next_message_with_metadata(
             std::string& message,
             epochtime_t& timestamp,
             int64_t& log_event_idx,
-            FilterClass& filter
+            FilterClass& filter,
+            std::optional<epochtime_t> timestamp_lower_bound = std::nullopt
     );
 
     /**
@@ -1,5 +1,6 @@
 #include "SchemaWriter.hpp"
 
+#include <unordered_set>
 #include <utility>
 
 namespace clp_s {
@@ -27,8 +28,19 @@ size_t SchemaWriter::append_message(ParsedMessage& message) {
 }
 
 void SchemaWriter::store(ZstdCompressor& compressor) {
+    auto const begin_pos{compressor.get_uncompressed_pos()};
     for (auto& writer : m_columns) {
         writer->store(compressor);
     }
+    m_total_uncompressed_size = compressor.get_uncompressed_pos() - begin_pos;
+}
+
+void SchemaWriter::collect_dictionary_ids(
+        std::unordered_set<clp::logtype_dictionary_id_t>& logtype_ids,
+        std::unordered_set<clp::variable_dictionary_id_t>& var_ids
+) const {
+    for (auto const& writer : m_columns) {
+        writer->collect_dictionary_ids(logtype_ids, var_ids);
+    }
 }
 }  // namespace clp_s
@@ -2,8 +2,10 @@
 #define CLP_S_SCHEMAWRITER_HPP
 
 #include <memory>
+#include <unordered_set>
 #include <vector>
 
+#include "../clp/Defs.h"
 #include "ColumnWriter.hpp"
 #include "FileWriter.hpp"
 #include "ParsedMessage.hpp"
@@ -39,15 +41,28 @@ public:
     size_t append_message(ParsedMessage& message);
 
     /**
-     * Stores the columns to disk.
+     * Stores the columns to disk, and updates the total uncompressed size to the size of the data
+     * actually written.
      * @param compressor
      */
     void store(ZstdCompressor& compressor);
 
+    /**
+     * Adds the logtype and variable dictionary IDs referenced by every column in this schema to
+     * the given sets.
+     * @param logtype_ids
+     * @param var_ids
+     */
+    void collect_dictionary_ids(
+            std::unordered_set<clp::logtype_dictionary_id_t>& logtype_ids,
+            std::unordered_set<clp::variable_dictionary_id_t>& var_ids
+    ) const;
+
     uint64_t get_num_messages() const { return m_num_messages; }
 
     /**
-     * @return the uncompressed in-memory size of the data that will be written to the compressor
+     * @return an upper bound on the uncompressed size of the data that will be written to the
+     * compressor before `store` is called, and the exact size of the data written afterwards
      */
     size_t get_total_uncompressed_size() const { return m_total_uncompressed_size; }
 
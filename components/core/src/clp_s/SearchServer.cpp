@@ -0,0 +1,318 @@
+#include "SearchServer.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <vector>
+
+#include <boost/asio.hpp>
+#include <nlohmann/json.hpp>
+#include <spdlog/spdlog.h>
+
+#include "ArchiveCache.hpp"
+#include "CommandLineArguments.hpp"
+
+using boost::asio::local::stream_protocol;
+
+namespace clp_s {
+namespace {
+constexpr size_t cMaxRequestSize{1024ULL * 1024};  // 1 MiB
+constexpr char cRequestDelimiter{'\n'};
+constexpr std::string_view cProgramName{"clp-s"};
+constexpr std::string_view cStatsRequestType{"stats"};
+constexpr std::string_view cEvictRequestType{"evict"};
+
+/**
+ * @param metrics
+ * @param capacity_in_bytes
+ * @return The given archive cache metrics as a JSON object.
+ */
+auto archive_cache_metrics_to_json(ArchiveCache::Metrics const& metrics, size_t capacity_in_bytes)
+        -> nlohmann::json;
+
+auto archive_cache_metrics_to_json(ArchiveCache::Metrics const& metrics, size_t capacity_in_bytes)
+        -> nlohmann::json {
+    return {{"num_hits", metrics.num_hits},
+            {"num_misses", metrics.num_misses},
+            {"hit_rate", metrics.get_hit_rate()},
+            {"num_insertions", metrics.num_insertions},
+            {"num_evictions", metrics.num_evictions},
+            {"num_entries", metrics.num_entries},
+            {"size_in_bytes", metrics.size_in_bytes},
+            {"capacity_in_bytes", capacity_in_bytes}};
+}
+}  // namespace
+
+auto SearchServer::run() -> bool {
+    // Remove any socket left behind by a previous server that didn't shut down cleanly.
+    std::error_code remove_error;
+    std::filesystem::remove(m_socket_path, remove_error);
+
+    try {
+        m_acceptor = stream_protocol::acceptor{
+                m_io_context,
+                stream_protocol::endpoint{m_socket_path}
+        };
+    } catch (std::exception const& e) {
+        SPDLOG_ERROR("Failed to listen on socket {} - {}", m_socket_path, e.what());
+        return false;
+    }
+
+    m_signals.add(SIGINT);
+    m_signals.add(SIGTERM);
+    m_signals.async_wait([this](boost::system::error_code const& error, int signal_number) -> void {
+        if (boost::asio::error::operation_aborted == error) {
+            return;
+        }
+        if (false == error.failed()) {
+            SPDLOG_INFO("Received signal {}, shutting down.", signal_number);
+        }
+        shut_down();
+    });
+
+    boost::asio::thread_pool workers{m_max_concurrent_queries};
+    queue_accept_task(workers);
+    SPDLOG_INFO("Serving search requests on {}", m_socket_path);
+
+    // Runs until the server is shut down, every pending request has been read or cancelled, and
+    // every response has been sent.
+    m_io_context.run();
+    workers.join();
+
+    std::filesystem::remove(m_socket_path, remove_error);
+    return true;
+}
+
+auto SearchServer::stop() -> void {
+    boost::asio::post(m_io_context, [this]() -> void { shut_down(); });
+}
+
+auto SearchServer::queue_accept_task(boost::asio::thread_pool& workers) -> void {
+    auto connection{std::make_shared<Connection>(m_acceptor.get_executor())};
+    m_acceptor.async_accept(
+            connection->socket,
+            [this, &workers, connection](boost::system::error_code const& error) -> void {
+                if (error.failed()) {
+                    if (m_acceptor.is_open()) {
+                        SPDLOG_ERROR("Failed to accept connection - {}", error.message());
+                        queue_accept_task(workers);
+                    }
+                    return;
+                }
+
+                m_connections_awaiting_requests.insert(connection);
+                boost::asio::async_read_until(
+                        connection->socket,
+                        boost::asio::dynamic_buffer(connection->request, cMaxRequestSize),
+                        cRequestDelimiter,
+                        [this, &workers, connection](
+                                boost::system::error_code const& read_error,
+                                size_t num_bytes_read
+                        ) -> void {
+                            m_connections_awaiting_requests.erase(connection);
+                            if (boost::asio::error::operation_aborted == read_error) {
+                                send_response(connection, false, "server is shutting down");
+                                return;
+                            }
+                            if (read_error.failed()) {
+                                SPDLOG_ERROR(
+                                        "Failed to read search request - {}",
+                                        read_error.message()
+                                );
+                                send_response(connection, false, "failed to read request");
+                                return;
+                            }
+                            connection->request.resize(num_bytes_read - 1);
+                            if (nlohmann::json response;
+                                try_handle_control_request(connection->request, response))
+                            {
+                                send_response(connection, response);
+                                return;
+                            }
+                            admit(connection, workers);
+                        }
+                );
+                queue_accept_task(workers);
+            }
+    );
+}
+
+auto SearchServer::shut_down() -> void {
+    boost::system::error_code error;
+    m_signals.cancel(error);
+    m_acceptor.close(error);
+    for (auto const& connection : m_connections_awaiting_requests) {
+        connection->socket.cancel(error);
+    }
+}
+
+auto SearchServer::admit(
+        std::shared_ptr<Connection> const& connection,
+        boost::asio::thread_pool& workers
+) -> void {
+    {
+        std::lock_guard<std::mutex> const lock{m_admission_mutex};
+        if (m_num_admitted_queries >= m_max_concurrent_queries + m_max_queued_queries) {
+            SPDLOG_WARN("Rejecting search request since the admission queue is full.");
+            send_response(connection, false, "server is busy");
+            return;
+        }
+        ++m_num_admitted_queries;
+    }
+
+    // Keep the I/O context running until the worker has queued the response on it.
+    boost::asio::post(
+            workers,
+            [this, connection, work_guard{boost::asio::make_work_guard(m_io_context)}]() -> void {
+                std::string error;
+                auto success{false};
+                // Results are written to the socket synchronously by the search, so undo the
+                // non-blocking mode that reading the request may have set on it.
+                boost::system::error_code blocking_error;
+                connection->socket.native_non_blocking(false, blocking_error);
+                if (blocking_error.failed()) {
+                    error = "failed to set up the connection";
+                } else {
+                    success = handle_request(
+                            connection->request,
+                            connection->socket.native_handle(),
+                            error
+                    );
+                }
+                send_response(connection, success, error);
+
+                std::lock_guard<std::mutex> const lock{m_admission_mutex};
+                --m_num_admitted_queries;
+            }
+    );
+}
+
+auto SearchServer::try_handle_control_request(
+        std::string const& request,
+        nlohmann::json& response
+) const -> bool {
+    auto const parsed_request = nlohmann::json::parse(request, nullptr, false);
+    if (false == parsed_request.is_object()) {
+        return false;
+    }
+
+    auto const type_it{parsed_request.find("type")};
+    if (parsed_request.end() == type_it || false == type_it->is_string()) {
+        response = {{"success", false}, {"error", "control request must have a string type"}};
+        return true;
+    }
+    auto const type{type_it->get<std::string>()};
+    if (cStatsRequestType == type) {
+        response = {{"success", true},
+                    {"archive_cache",
+                     archive_cache_metrics_to_json(
+                             m_archive_cache->get_metrics(),
+                             m_archive_cache->get_capacity()
+                     )}};
+    } else if (cEvictRequestType == type) {
+        auto const archive_id_it{parsed_request.find("archive_id")};
+        size_t num_evicted_entries{0ULL};
+        if (parsed_request.end() == archive_id_it) {
+            num_evicted_entries = m_archive_cache->clear();
+        } else if (archive_id_it->is_string()) {
+            num_evicted_entries
+                    = m_archive_cache->evict_archive(archive_id_it->get<std::string>());
+        } else {
+            response = {{"success", false}, {"error", "archive_id must be a string"}};
+            return true;
+        }
+        SPDLOG_INFO("Evicted {} entries from the archive cache.", num_evicted_entries);
+        response = {{"success", true}, {"num_evicted_entries", num_evicted_entries}};
+    } else {
+        response = {{"success", false}, {"error", "unknown control request type"}};
+    }
+    return true;
+}
+
+auto SearchServer::handle_request(
+        std::string const& request,
+        int results_socket_fd,
+        std::string& error
+) const -> bool {
+    std::vector<std::string> args;
+    try {
+        args = nlohmann::json::parse(request).get<std::vector<std::string>>();
+    } catch (nlohmann::json::exception const&) {
+        error = "request must be a JSON array of strings";
+        return false;
+    }
+
+    std::vector<char const*> argv{cProgramName.data()};
+    for (auto const& arg : args) {
+        argv.push_back(arg.c_str());
+    }
+
+    CommandLineArguments command_line_arguments{std::string{cProgramName}};
+    auto const parsing_result{command_line_arguments.parse_arguments(
+            static_cast<int>(argv.size()),
+            argv.data()
+    )};
+    if (CommandLineArguments::ParsingResult::Success != parsing_result) {
+        error = "invalid search arguments";
+        return false;
+    }
+    if (CommandLineArguments::Command::Search != command_line_arguments.get_command()) {
+        error = "only search requests are supported";
+        return false;
+    }
+    try {
+        if (false == m_search_handler(command_line_arguments, results_socket_fd)) {
+            error = "search failed";
+            return false;
+        }
+    } catch (std::exception const& e) {
+        SPDLOG_ERROR("Encountered error during search - {}", e.what());
+        error = "search failed";
+        return false;
+    }
+    return true;
+}
+
+auto SearchServer::send_response(
+        std::shared_ptr<Connection> const& connection,
+        bool success,
+        std::string const& error
+) -> void {
+    nlohmann::json response{{"success", success}};
+    if (false == success) {
+        response["error"] = error;
+    }
+    send_response(connection, response);
+}
+
+auto SearchServer::send_response(
+        std::shared_ptr<Connection> const& connection,
+        nlohmann::json const& response
+) -> void {
+    // Workers call this too, so hand the write to the thread running the I/O context, where it
+    // can't block accepting and reading other connections.
+    boost::asio::dispatch(
+            connection->socket.get_executor(),
+            [connection, serialized_response{response.dump() + cRequestDelimiter}]() mutable
+            -> void {
+                connection->response = std::move(serialized_response);
+                boost::asio::async_write(
+                        connection->socket,
+                        boost::asio::buffer(connection->response),
+                        [connection](boost::system::error_code const& error, size_t) -> void {
+                            if (error.failed()) {
+                                SPDLOG_WARN("Failed to send search response - {}", error.message());
+                            }
+                            boost::system::error_code close_error;
+                            connection->socket.close(close_error);
+                        }
+                );
+            }
+    );
+}
+}  // namespace clp_s
@@ -0,0 +1,183 @@
+#ifndef CLP_S_SEARCHSERVER_HPP
+#define CLP_S_SEARCHSERVER_HPP
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_set>
+#include <utility>
+
+#include <boost/asio.hpp>
+#include <nlohmann/json.hpp>
+
+#include "ArchiveCache.hpp"
+#include "CommandLineArguments.hpp"
+
+namespace clp_s {
+/**
+ * A long-running server that accepts search requests over a Unix domain socket, so that repeated
+ * searches avoid process startup and can share warm caches.
+ *
+ * Each connection carries a single request: a newline-terminated JSON array of the arguments that
+ * would be passed to `clp-s s`. The server replies with a newline-terminated JSON object containing
+ * a boolean `success` field and, on failure, an `error` field. Results of requests that use the
+ * stdout output handler are streamed back over the connection as they're produced, one per line,
+ * before the status line; results of other requests are written through their output handler.
+ *
+ * A connection can instead carry a control request: a newline-terminated JSON object whose `type`
+ * field is one of:
+ * - `"stats"`, which replies with the archive cache's metrics in an `archive_cache` field.
+ * - `"evict"`, which evicts the entries of the archive given by the `archive_id` field from the
+ *   archive cache, or every entry if the field is absent, and replies with the number of evicted
+ *   entries in a `num_evicted_entries` field.
+ * Control requests are handled as soon as they're received, without being admitted into the worker
+ * pool, so they're answered even while the server is busy.
+ *
+ * Admitted requests run on a fixed-size pool of worker threads. Requests received while
+ * `max_concurrent_queries + max_queued_queries` requests are already admitted are rejected
+ * immediately.
+ *
+ * On shutdown, the server stops accepting connections, rejects connections whose requests haven't
+ * been received yet, and waits for admitted requests to complete.
+ *
+ * NOTE: Search handlers stream results to clients that may disconnect at any time, so programs
+ * running the server should ignore SIGPIPE to have failed writes reported instead of being killed.
+ */
+class SearchServer {
+public:
+    // Types
+    /**
+     * Callback that runs a search described by the given arguments.
+     * @param command_line_arguments
+     * @param results_socket_fd A connected, blocking socket that results of the stdout output
+     * handler should be streamed to. The callback doesn't own the socket.
+     * @return Whether the search succeeded.
+     */
+    using SearchHandler = std::function<bool(CommandLineArguments const&, int)>;
+
+    // Constructors
+    SearchServer(
+            std::string socket_path,
+            size_t max_concurrent_queries,
+            size_t max_queued_queries,
+            std::shared_ptr<ArchiveCache> archive_cache,
+            SearchHandler search_handler
+    )
+            : m_socket_path{std::move(socket_path)},
+              m_max_concurrent_queries{max_concurrent_queries},
+              m_max_queued_queries{max_queued_queries},
+              m_archive_cache{std::move(archive_cache)},
+              m_search_handler{std::move(search_handler)} {}
+
+    // Methods
+    /**
+     * Serves search requests until the process receives SIGINT or SIGTERM.
+     * @return Whether the server started and shut down cleanly.
+     */
+    [[nodiscard]] auto run() -> bool;
+
+    /**
+     * Asynchronously stops a running server, as if the process received SIGINT or SIGTERM. If the
+     * server isn't running yet, it stops as soon as it starts.
+     *
+     * NOTE: This method is thread-safe.
+     */
+    auto stop() -> void;
+
+private:
+    // Types
+    struct Connection {
+        explicit Connection(boost::asio::any_io_executor const& executor) : socket{executor} {}
+
+        boost::asio::local::stream_protocol::socket socket;
+        std::string request;
+        std::string response;
+    };
+
+    // Methods
+    /**
+     * Asynchronously accepts the next connection and queues reading its request.
+     * @param workers
+     */
+    auto queue_accept_task(boost::asio::thread_pool& workers) -> void;
+
+    /**
+     * Stops accepting connections and cancels reading any requests that haven't been received yet.
+     * Must be called from the thread running the I/O context.
+     */
+    auto shut_down() -> void;
+
+    /**
+     * Admits the connection's request into the worker pool, or rejects it if the admission queue
+     * is full.
+     * @param connection
+     * @param workers
+     */
+    auto admit(std::shared_ptr<Connection> const& connection, boost::asio::thread_pool& workers)
+            -> void;
+
+    /**
+     * Handles the given request if it's a control request.
+     * @param request
+     * @param response Returns the response to the control request
+     * @return Whether the request was a control request.
+     */
+    [[nodiscard]] auto
+    try_handle_control_request(std::string const& request, nlohmann::json& response) const
+            -> bool;
+
+    /**
+     * Parses and runs the given request.
+     * @param request
+     * @param results_socket_fd
+     * @param error Returns the reason for the failure, if any
+     * @return Whether the request was valid and the search succeeded.
+     */
+    [[nodiscard]] auto
+    handle_request(std::string const& request, int results_socket_fd, std::string& error) const
+            -> bool;
+
+    /**
+     * Asynchronously writes a status response to the connection and closes it.
+     * @param connection
+     * @param success
+     * @param error
+     */
+    static auto send_response(
+            std::shared_ptr<Connection> const& connection,
+            bool success,
+            std::string const& error
+    ) -> void;
+
+    /**
+     * Asynchronously writes a response to the connection and closes it. The write runs on the
+     * thread running the I/O context, so this method can be called from any thread.
+     * @param connection
+     * @param response
+     */
+    static auto
+    send_response(std::shared_ptr<Connection> const& connection, nlohmann::json const& response)
+            -> void;
+
+    // Variables
+    std::string m_socket_path;
+    size_t m_max_concurrent_queries;
+    size_t m_max_queued_queries;
+    std::shared_ptr<ArchiveCache> m_archive_cache;
+    SearchHandler m_search_handler;
+
+    boost::asio::io_context m_io_context;
+    boost::asio::local::stream_protocol::acceptor m_acceptor{m_io_context};
+    boost::asio::signal_set m_signals{m_io_context};
+    // Connections whose requests are still being read. Only accessed from the thread running the
+    // I/O context.
+    std::unordered_set<std::shared_ptr<Connection>> m_connections_awaiting_requests;
+
+    std::mutex m_admission_mutex;
+    size_t m_num_admitted_queries{0ULL};
+};
+}  // namespace clp_s
+
+#endif  // CLP_S_SEARCHSERVER_HPP
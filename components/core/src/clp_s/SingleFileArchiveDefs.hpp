@@ -43,14 +43,15 @@ constexpr auto decompose_archive_version(uint32_t archive_version)
 
 // define the version
 constexpr uint8_t cArchiveMajorVersion = 0;
-constexpr uint8_t cArchiveMinorVersion = 5;
-constexpr uint16_t cArchivePatchVersion = 1;
+constexpr uint8_t cArchiveMinorVersion = 6;
+constexpr uint16_t cArchivePatchVersion = 0;
 constexpr uint32_t cArchiveVersion{
         make_archive_version(cArchiveMajorVersion, cArchiveMinorVersion, cArchivePatchVersion)
 };
 
 // Format version markers for backwards compatibility.
 constexpr uint32_t cDeprecatedDateStringFormatVersionMarker{make_archive_version(0, 5, 0)};
+constexpr uint32_t cEncodedIntegerColumnFormatVersionMarker{make_archive_version(0, 6, 0)};
 
 // define the magic number
 constexpr std::array<uint8_t, 4> cStructuredSFAMagicNumber{0xFD, 0x2F, 0xC5, 0x30};
@@ -85,6 +86,14 @@ struct ArchiveHeader {
         return version < cDeprecatedDateStringFormatVersionMarker;
     }
 
+    /**
+     * @return Whether the integer columns in this archive are stored with the encodings in
+     * `IntegerEncoding.hpp`, as opposed to as raw values.
+     */
+    [[nodiscard]] auto has_encoded_integer_columns() const -> bool {
+        return version >= cEncodedIntegerColumnFormatVersionMarker;
+    }
+
     uint8_t magic_number[4]{};
     uint32_t version{};
     uint64_t uncompressed_size{};
@@ -103,7 +112,8 @@ enum struct ArchiveMetadataPacketType : uint8_t {
     ArchiveInfo = 0,
     ArchiveFileInfo = 1,
     TimestampDictionary = 2,
-    RangeIndex = 3
+    RangeIndex = 3,
+    PackedStreamDictionaryIndex = 4
 };
 
 struct ArchiveInfoPacket {
@@ -125,6 +135,27 @@ struct ArchiveFileInfoPacket {
 
     MSGPACK_DEFINE_MAP(files);
 };
+
+/**
+ * Records which logtype and variable dictionary IDs are referenced by each packed stream in the
+ * archive. Entry `i` of each member corresponds to packed stream `i`, and the IDs for every stream
+ * are sorted in ascending order.
+ *
+ * Logtype IDs only cover the logtype dictionary (not the array dictionary), while variable IDs
+ * cover every column that references the variable dictionary.
+ *
+ * Format versioning: this packet was introduced in archive version 0.5.1 without a version bump
+ * since it's optional. Readers that predate it skip it as an unknown packet, and readers treat
+ * archives without it (or streams beyond the end of it) as able to match anything. Any change to
+ * the packet's layout or semantics must use a new `ArchiveMetadataPacketType` rather than
+ * changing this one, since the archive version doesn't record whether the packet is present.
+ */
+struct PackedStreamDictionaryIndexPacket {
+    std::vector<std::vector<uint64_t>> logtype_ids;
+    std::vector<std::vector<uint64_t>> var_ids;
+
+    MSGPACK_DEFINE_MAP(logtype_ids, var_ids);
+};
 }  // namespace clp_s
 
 #endif  // CLP_S_ARCHIVEDEFS_HPP
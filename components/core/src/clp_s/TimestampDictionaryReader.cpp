@@ -1,5 +1,6 @@
 #include "TimestampDictionaryReader.hpp"
 
+#include <cmath>
 #include <cstdint>
 #include <optional>
 #include <string>
@@ -109,6 +110,33 @@ auto TimestampDictionaryReader::read(
     return ErrorCodeSuccess;
 }
 
+auto TimestampDictionaryReader::get_authoritative_timestamp_end() const
+        -> std::optional<epochtime_t> {
+    constexpr double cMillisecondsInSecond{1000.0};
+    if (m_authoritative_timestamp_column_ids.empty()) {
+        return std::nullopt;
+    }
+    for (auto const& entry : m_entries) {
+        auto const& column_ids{entry.get_column_ids()};
+        if (false == column_ids.contains(*m_authoritative_timestamp_column_ids.begin())) {
+            continue;
+        }
+        switch (entry.get_timestamp_encoding()) {
+            case TimestampEntry::Epoch:
+                return entry.get_end_timestamp();
+            case TimestampEntry::DoubleEpoch:
+                // `SchemaReader` reports floating-point epoch timestamps in milliseconds, whereas
+                // the entry stores them in seconds.
+                return static_cast<epochtime_t>(
+                        std::ceil(entry.get_end_timestamp_double() * cMillisecondsInSecond)
+                );
+            default:
+                return std::nullopt;
+        }
+    }
+    return std::nullopt;
+}
+
 auto TimestampDictionaryReader::get_deprecated_timestamp_string_encoding(
         epochtime_t epoch,
         uint64_t format_id
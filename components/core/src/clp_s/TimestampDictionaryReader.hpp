@@ -80,6 +80,15 @@ public:
         return m_authoritative_timestamp_column_ids;
     }
 
+    /**
+     * NOTE: The returned timestamp is in the same units as the timestamps `SchemaReader` reports
+     * for records, which may differ from `TimestampEntry::get_end_timestamp`'s units (e.g., for
+     * archives with floating-point epoch timestamp columns).
+     * @return The end of the authoritative timestamp column's time range, or std::nullopt if there
+     * is no authoritative timestamp column or its range is unknown.
+     */
+    [[nodiscard]] auto get_authoritative_timestamp_end() const -> std::optional<epochtime_t>;
+
 private:
     using tokenized_column_to_range_t
             = std::vector<std::pair<std::vector<std::string>, TimestampEntry*>>;
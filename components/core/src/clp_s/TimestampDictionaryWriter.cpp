@@ -1,6 +1,9 @@
 #include "TimestampDictionaryWriter.hpp"
 
+#include <algorithm>
 #include <cstdint>
+#include <iterator>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -9,6 +12,7 @@
 #include <fmt/format.h>
 #include <spdlog/spdlog.h>
 
+#include <clp_s/timestamp_parser/ErrorCode.hpp>
 #include <clp_s/timestamp_parser/TimestampParser.hpp>
 #include <clp_s/TraceableException.hpp>
 
@@ -21,12 +25,12 @@ void TimestampDictionaryWriter::write(std::stringstream& stream) {
 
     write_numeric_value<uint64_t>(
             stream,
-            m_string_pattern_and_id_pairs.size() + m_numeric_pattern_to_id.size()
+            m_string_patterns.size() + m_numeric_pattern_to_id.size()
     );
-    for (auto const& [quoted_pattern, pattern_id] : m_string_pattern_and_id_pairs) {
-        write_numeric_value<uint64_t>(stream, pattern_id);
+    for (auto const& string_pattern : m_string_patterns) {
+        write_numeric_value<uint64_t>(stream, string_pattern.id);
 
-        auto const raw_pattern{quoted_pattern.get_pattern()};
+        auto const raw_pattern{string_pattern.pattern.get_pattern()};
         write_numeric_value<uint64_t>(stream, raw_pattern.length());
         stream.write(raw_pattern.data(), raw_pattern.size());
     }
@@ -47,18 +51,17 @@ auto TimestampDictionaryWriter::ingest_string_timestamp(
 ) -> std::pair<epochtime_t, uint64_t> {
     auto& [_, timestamp_entry] = *m_column_id_to_range.try_emplace(node_id, key, node_id).first;
 
-    // Try parsing the timestamp as one of the previously seen timestamp patterns
-    for (auto const& [quoted_pattern, pattern_id] : m_string_pattern_and_id_pairs) {
-        auto const parsing_result{timestamp_parser::parse_timestamp(
-                timestamp,
-                quoted_pattern,
-                is_json_literal,
-                m_generated_pattern
-        )};
-        if (parsing_result.has_error()) {
+    // Try parsing the timestamp as one of the previously seen timestamp patterns, starting with the
+    // most recently matched one
+    for (auto it{m_string_patterns.begin()}; m_string_patterns.end() != it; ++it) {
+        auto const optional_epoch_timestamp{parse_string_timestamp(*it, timestamp, is_json_literal)
+        };
+        if (false == optional_epoch_timestamp.has_value()) {
             continue;
         }
-        auto const epoch_timestamp{parsing_result.value().first};
+        auto const epoch_timestamp{optional_epoch_timestamp.value()};
+        auto const pattern_id{it->id};
+        std::rotate(m_string_patterns.begin(), it, std::next(it));
         timestamp_entry.ingest_timestamp(epoch_timestamp);
         return {epoch_timestamp, pattern_id};
     }
@@ -89,7 +92,8 @@ auto TimestampDictionaryWriter::ingest_string_timestamp(
     }
 
     auto const new_pattern_id{m_next_id++};
-    m_string_pattern_and_id_pairs.emplace_back(
+    m_string_patterns.emplace(
+            m_string_patterns.begin(),
             std::move(quoted_pattern_result.value()),
             new_pattern_id
     );
@@ -209,8 +213,40 @@ epochtime_t TimestampDictionaryWriter::get_end_timestamp() const {
 
 void TimestampDictionaryWriter::clear() {
     m_next_id = 0;
-    m_string_pattern_and_id_pairs.clear();
+    m_string_patterns.clear();
     m_numeric_pattern_to_id.clear();
     m_column_id_to_range.clear();
 }
+
+auto TimestampDictionaryWriter::parse_string_timestamp(
+        StringPattern& string_pattern,
+        std::string_view timestamp,
+        bool is_json_literal
+) -> std::optional<epochtime_t> {
+    auto& optional_compiled_pattern{string_pattern.compiled_patterns.at(is_json_literal ? 1 : 0)};
+    if (optional_compiled_pattern.has_value()) {
+        auto const result{optional_compiled_pattern->parse(timestamp)};
+        if (false == result.has_error()) {
+            return result.value();
+        }
+        if (timestamp_parser::ErrorCode{
+                    timestamp_parser::ErrorCodeEnum::UnsupportedTimestampContent
+            }
+            != result.error())
+        {
+            return std::nullopt;
+        }
+    }
+
+    auto const parsing_result{timestamp_parser::parse_timestamp(
+            timestamp,
+            string_pattern.pattern,
+            is_json_literal,
+            m_generated_pattern
+    )};
+    if (parsing_result.has_error()) {
+        return std::nullopt;
+    }
+    return parsing_result.value().first;
+}
 }  // namespace clp_s
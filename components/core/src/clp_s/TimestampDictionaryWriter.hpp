@@ -1,14 +1,18 @@
 #ifndef CLP_S_TIMESTAMPDICTIONARYWRITER_HPP
 #define CLP_S_TIMESTAMPDICTIONARYWRITER_HPP
 
+#include <array>
 #include <cstdint>
 #include <map>
+#include <optional>
 #include <sstream>
 #include <string>
 #include <string_view>
 #include <unordered_map>
 #include <utility>
+#include <vector>
 
+#include <clp_s/timestamp_parser/CompiledTimestampPattern.hpp>
 #include <clp_s/timestamp_parser/TimestampParser.hpp>
 
 #include "SchemaTree.hpp"
@@ -104,9 +108,43 @@ public:
     void clear();
 
 private:
+    // Types
+    /**
+     * A previously seen string timestamp pattern, along with its compiled forms for raw strings
+     * and JSON literals (or std::nullopt if it can't be compiled).
+     */
+    struct StringPattern {
+        StringPattern(timestamp_parser::TimestampPattern pattern, uint64_t id)
+                : pattern{std::move(pattern)},
+                  id{id},
+                  compiled_patterns{
+                          timestamp_parser::CompiledTimestampPattern::create(this->pattern, false),
+                          timestamp_parser::CompiledTimestampPattern::create(this->pattern, true)
+                  } {}
+
+        timestamp_parser::TimestampPattern pattern;
+        uint64_t id;
+        std::array<std::optional<timestamp_parser::CompiledTimestampPattern>, 2> compiled_patterns;
+    };
+
+    // Methods
+    /**
+     * Parses a string timestamp with a previously seen pattern, using the pattern's compiled form
+     * when possible.
+     * @param string_pattern
+     * @param timestamp
+     * @param is_json_literal
+     * @return The timestamp in epoch nanoseconds, or std::nullopt if the pattern doesn't match.
+     */
+    [[nodiscard]] auto parse_string_timestamp(
+            StringPattern& string_pattern,
+            std::string_view timestamp,
+            bool is_json_literal
+    ) -> std::optional<epochtime_t>;
+
     // Variables
-    std::vector<std::pair<timestamp_parser::TimestampPattern, uint64_t>>
-            m_string_pattern_and_id_pairs;
+    // Ordered from most to least recently matched
+    std::vector<StringPattern> m_string_patterns;
     absl::flat_hash_map<std::string, std::pair<timestamp_parser::TimestampPattern, uint64_t>>
             m_numeric_pattern_to_id;
     uint64_t m_next_id{};
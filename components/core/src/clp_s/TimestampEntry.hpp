@@ -106,6 +106,12 @@ public:
 
     auto get_timestamp_encoding() const -> TimestampEncoding { return m_encoding; }
 
+    /**
+     * @return The end of the time range as (fractional) seconds since the UNIX epoch, for entries
+     * with the DoubleEpoch encoding.
+     */
+    auto get_end_timestamp_double() const -> double { return m_epoch_end_double; }
+
 private:
     TimestampEncoding m_encoding;
     double m_epoch_start_double, m_epoch_end_double;
@@ -66,6 +66,11 @@ public:
      */
     void flush();
 
+    /**
+     * @return The number of uncompressed bytes written since the compressor was opened
+     */
+    [[nodiscard]] auto get_uncompressed_pos() const -> size_t { return m_uncompressed_stream_pos; }
+
     // Methods implementing the Compressor interface
     /**
      * Closes the compressor
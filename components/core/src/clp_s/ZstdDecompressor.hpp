@@ -64,6 +64,13 @@ public:
      */
     ErrorCode open(std::string const& compressed_file_path);
 
+    /**
+     * @return The number of bytes decompressed since the decompressor was opened.
+     */
+    [[nodiscard]] auto get_decompressed_stream_pos() const -> size_t {
+        return m_decompressed_stream_pos;
+    }
+
     // Methods implementing the ReaderInterface
     /**
      * Tries to read up to a given number of bytes from the decompressor
@@ -1,3 +1,7 @@
+#include <unistd.h>
+
+#include <csignal>
+#include <cstdint>
 #include <cstdlib>
 #include <exception>
 #include <filesystem>
@@ -19,10 +23,12 @@
 #if CLP_BUILD_CLP_S_ENABLE_CURL
     #include "../clp/CurlGlobalInstance.hpp"
 #endif
+#include <utils/profiling/JsonEmitter.hpp>
 #include <utils/profiling/Reporter.hpp>
 #include <utils/profiling/ScopedProfiler.hpp>
 #include <utils/profiling/Stopwatch.hpp>
 
+#include <clp/TransactionManager.hpp>
 #include <clp/type_utils.hpp>
 #include <clp_s/search/SearchTelemetry.hpp>
 #include <clp_s/search/TelemetryContext.hpp>
@@ -30,6 +36,7 @@
 #include "../clp/ir/constants.hpp"
 #include "../clp/streaming_archive/ArchiveMetadata.hpp"
 #include "../reducer/network_utils.hpp"
+#include "ArchiveCache.hpp"
 #include "CommandLineArguments.hpp"
 #include "Defs.hpp"
 #include "JsonConstructor.hpp"
@@ -48,7 +55,9 @@
 #include "search/Output.hpp"
 #include "search/OutputHandler.hpp"
 #include "search/Projection.hpp"
+#include "search/QueryPlanCache.hpp"
 #include "search/SchemaMatch.hpp"
+#include "SearchServer.hpp"
 #include "SingleFileArchiveDefs.hpp"
 
 using namespace clp_s::search;
@@ -78,9 +87,15 @@ void decompress_archive(clp_s::JsonConstructorOption const& json_constructor_opt
  *
  * @param command_line_arguments
  * @param archive_reader
- * @param expr A copy of the search AST which may be modified.
+ * @param expr The search AST, which is copied before being modified.
  * @param reducer_socket_fd
+ * @param results_socket_fd A socket to stream the stdout output handler's results to, or -1 to
+ * write them to stdout.
  * @param telemetry_span The span to record search telemetry onto, or null if telemetry is disabled.
+ * @param results_timestamp_lower_bound The results cache output handler's timestamp lower bound
+ * from searching the previous archives, which is updated after searching this archive.
+ * @param query_plan_cache A cache of query plans shared across the archives searched with the
+ * same query, or null to disable caching.
  * @return Whether the search succeeded.
  */
 bool search_archive(
@@ -88,9 +103,51 @@ bool search_archive(
         std::shared_ptr<clp_s::ArchiveReader> const& archive_reader,
         std::shared_ptr<ast::Expression> expr,
         int reducer_socket_fd,
-        std::shared_ptr<SearchTelemetrySpan> const& telemetry_span
+        int results_socket_fd,
+        std::shared_ptr<SearchTelemetrySpan> const& telemetry_span,
+        std::optional<clp_s::epochtime_t>& results_timestamp_lower_bound,
+        QueryPlanCache* query_plan_cache
 );
 
+/**
+ * Searches the inputs specified by the command line arguments.
+ * @param command_line_arguments
+ * @param archive_cache A cache shared across searches, or null to disable caching.
+ * @param results_socket_fd A socket to stream the stdout output handler's results to, or -1 to
+ * write them to stdout.
+ * @return Whether the search succeeded.
+ */
+auto search(
+        CommandLineArguments const& command_line_arguments,
+        std::shared_ptr<clp_s::ArchiveCache> const& archive_cache,
+        int results_socket_fd
+) -> bool;
+
+/**
+ * Searches each input path specified by the command line arguments.
+ * @param command_line_arguments
+ * @param expr
+ * @param reducer_socket_fd
+ * @param results_socket_fd
+ * @param archive_cache A cache shared across searches, or null to disable caching.
+ * @return Whether the search succeeded.
+ */
+auto search_input_paths(
+        CommandLineArguments const& command_line_arguments,
+        std::shared_ptr<ast::Expression> const& expr,
+        int reducer_socket_fd,
+        int results_socket_fd,
+        std::shared_ptr<clp_s::ArchiveCache> const& archive_cache
+) -> bool;
+
+/**
+ * Serves search requests over the local socket specified by the command line arguments until the
+ * process is interrupted. Decompressed archive data is cached across requests.
+ * @param command_line_arguments
+ * @return Whether the server ran successfully.
+ */
+auto serve(CommandLineArguments const& command_line_arguments) -> bool;
+
 bool compress(CommandLineArguments const& command_line_arguments) {
     auto archives_dir = std::filesystem::path(command_line_arguments.get_archives_dir());
 
@@ -122,12 +179,35 @@ bool compress(CommandLineArguments const& command_line_arguments) {
     option.structurize_arrays = command_line_arguments.get_structurize_arrays();
     option.record_log_order = command_line_arguments.get_record_log_order();
 
+    // The profile is logged on every exit path (including errors and exceptions), after the
+    // reporter below has emitted into it.
+    nlohmann::json profiler_json;
+    auto const log_profile = [&profiler_json](std::string_view description) noexcept -> void {
+        if (profiler_json.empty()) {
+            return;
+        }
+        SPDLOG_INFO(
+                "{}: {}",
+                description,
+                profiler_json.dump(-1, ' ', false, nlohmann::json::error_handler_t::replace)
+        );
+    };
+    clp::TransactionManager profile_logger{
+            [&log_profile]() noexcept -> void { log_profile("Compression profile"); },
+            [&log_profile]() noexcept -> void { log_profile("Failed compression's profile"); }
+    };
+    utils::profiling::Reporter const profiler_reporter{
+            "compress",
+            utils::profiling::JsonEmitter{profiler_json}
+    };
+
     clp_s::JsonParser parser(option);
     if (false == parser.ingest()) {
         SPDLOG_ERROR("Encountered error while parsing input.");
         return false;
     }
     std::ignore = parser.store();
+    profile_logger.mark_success();
     return true;
 }
 
@@ -141,7 +221,10 @@ bool search_archive(
         std::shared_ptr<clp_s::ArchiveReader> const& archive_reader,
         std::shared_ptr<ast::Expression> expr,
         int reducer_socket_fd,
-        std::shared_ptr<SearchTelemetrySpan> const& telemetry_span
+        int results_socket_fd,
+        std::shared_ptr<SearchTelemetrySpan> const& telemetry_span,
+        std::optional<clp_s::epochtime_t>& results_timestamp_lower_bound,
+        QueryPlanCache* query_plan_cache
 ) {
     PROFILE_SCOPE("search_archive");
 
@@ -181,35 +264,48 @@ bool search_archive(
         telemetry_span->set_search_result_metrics(metrics);
     };
 
-    auto timestamp_dict = archive_reader->get_timestamp_dictionary();
-    AddTimestampConditions add_timestamp_conditions(
-            timestamp_dict->get_authoritative_timestamp_tokenized_column(),
-            command_line_arguments.get_search_begin_ts(),
-            command_line_arguments.get_search_end_ts()
-    );
-    if (expr = add_timestamp_conditions.run(expr); std::dynamic_pointer_cast<ast::EmptyExpr>(expr))
-    {
-        record_error_and_log(
-                "no authoritative timestamp column",
-                fmt::format(
-                        "Query '{}' specified timestamp filters tge {} tle {}, but no authoritative"
-                        " timestamp column was found for this archive",
-                        query,
-                        command_line_arguments.get_search_begin_ts().value_or(cEpochTimeMin),
-                        command_line_arguments.get_search_end_ts().value_or(cEpochTimeMax)
-                )
-        );
-        return false;
+    std::optional<QueryPlanCache::Key> plan_key;
+    std::shared_ptr<QueryPlanCache::Plan const> plan;
+    if (nullptr != query_plan_cache) {
+        plan_key.emplace(*archive_reader);
+        plan = query_plan_cache->find(plan_key.value());
     }
 
-    if (expr = clp_s::search::ast::preprocess_query(expr);
-        std::dynamic_pointer_cast<ast::EmptyExpr>(expr))
-    {
-        record_error_and_log(
-                "query is logically false",
-                fmt::format("Query '{}' is logically false", query)
+    auto timestamp_dict = archive_reader->get_timestamp_dictionary();
+    if (nullptr != plan) {
+        expr = plan->normalized_expr;
+    } else {
+        expr = expr->copy();
+        AddTimestampConditions add_timestamp_conditions(
+                timestamp_dict->get_authoritative_timestamp_tokenized_column(),
+                command_line_arguments.get_search_begin_ts(),
+                command_line_arguments.get_search_end_ts()
         );
-        return false;
+        if (expr = add_timestamp_conditions.run(expr);
+            std::dynamic_pointer_cast<ast::EmptyExpr>(expr))
+        {
+            record_error_and_log(
+                    "no authoritative timestamp column",
+                    fmt::format(
+                            "Query '{}' specified timestamp filters tge {} tle {}, but no"
+                            " authoritative timestamp column was found for this archive",
+                            query,
+                            command_line_arguments.get_search_begin_ts().value_or(cEpochTimeMin),
+                            command_line_arguments.get_search_end_ts().value_or(cEpochTimeMax)
+                    )
+            );
+            return false;
+        }
+
+        if (expr = clp_s::search::ast::preprocess_query(expr);
+            std::dynamic_pointer_cast<ast::EmptyExpr>(expr))
+        {
+            record_error_and_log(
+                    "query is logically false",
+                    fmt::format("Query '{}' is logically false", query)
+            );
+            return false;
+        }
     }
     if (nullptr != telemetry_span) {
         telemetry_span->set_query_shape_metrics(
@@ -221,14 +317,22 @@ bool search_archive(
         );
     }
 
-    EvaluateRangeIndexFilters metadata_filter_pass{
-            archive_reader->get_range_index(),
-            false == command_line_arguments.get_ignore_case()
+    // Plans are only cached for queries without range index filters, so the range index pass can be
+    // skipped when reusing one.
+    bool const should_cache_plan{
+            nullptr == plan && plan_key.has_value() && QueryPlanCache::is_cacheable(expr)
     };
-    if (expr = metadata_filter_pass.run(expr); std::dynamic_pointer_cast<ast::EmptyExpr>(expr)) {
-        record_early_termination(cTerminationStageRangeIndexMatching);
-        SPDLOG_INFO("No matching metadata ranges for query '{}'", query);
-        return true;
+    if (nullptr == plan) {
+        EvaluateRangeIndexFilters metadata_filter_pass{
+                archive_reader->get_range_index(),
+                false == command_line_arguments.get_ignore_case()
+        };
+        if (expr = metadata_filter_pass.run(expr); std::dynamic_pointer_cast<ast::EmptyExpr>(expr))
+        {
+            record_early_termination(cTerminationStageRangeIndexMatching);
+            SPDLOG_INFO("No matching metadata ranges for query '{}'", query);
+            return true;
+        }
     }
 
     // skip decompressing the archive if we won't match based on
@@ -240,59 +344,93 @@ bool search_archive(
         return true;
     }
 
-    if (archive_reader->has_deprecated_timestamp_format()) {
-        ast::SetTimestampLiteralPrecision date_precision_pass{
-                ast::TimestampLiteral::Precision::Milliseconds
+    std::shared_ptr<SchemaMatch> match_pass;
+    std::shared_ptr<Projection> projection;
+    if (nullptr != plan) {
+        expr = plan->expr;
+        match_pass = plan->schema_match;
+        projection = plan->projection;
+        if (std::dynamic_pointer_cast<ast::EmptyExpr>(expr)) {
+            record_early_termination(cTerminationStageSchemaMatching);
+            SPDLOG_INFO("No matching schemas for query '{}'", query);
+            return true;
+        }
+    } else {
+        // Schema matching modifies the query in place, so keep the normalized query intact for the
+        // plan cache.
+        std::shared_ptr<ast::Expression> normalized_expr;
+        if (should_cache_plan) {
+            normalized_expr = expr;
+            expr = expr->copy();
+        }
+        auto const cache_plan = [&]() -> void {
+            if (nullptr == normalized_expr) {
+                return;
+            }
+            query_plan_cache->insert(
+                    std::move(plan_key.value()),
+                    std::make_shared<QueryPlanCache::Plan const>(
+                            QueryPlanCache::Plan{normalized_expr, expr, match_pass, projection}
+                    )
+            );
         };
-        expr = date_precision_pass.run(expr);
-    }
 
-    // Narrow against schemas
-    auto match_pass = std::make_shared<SchemaMatch>(
-            archive_reader->get_schema_tree(),
-            archive_reader->get_schema_map()
-    );
-    if (expr = match_pass->run(expr); std::dynamic_pointer_cast<ast::EmptyExpr>(expr)) {
-        record_early_termination(cTerminationStageSchemaMatching);
-        SPDLOG_INFO("No matching schemas for query '{}'", query);
-        return true;
-    }
+        if (archive_reader->has_deprecated_timestamp_format()) {
+            ast::SetTimestampLiteralPrecision date_precision_pass{
+                    ast::TimestampLiteral::Precision::Milliseconds
+            };
+            expr = date_precision_pass.run(expr);
+        }
 
-    // Populate projection
-    auto projection = std::make_shared<Projection>(
-            command_line_arguments.get_projection_columns().empty()
-                    ? ProjectionMode::ReturnAllColumns
-                    : ProjectionMode::ReturnSelectedColumns
-    );
-    try {
-        for (auto const& column : command_line_arguments.get_projection_columns()) {
-            std::vector<std::string> descriptor_tokens;
-            std::string descriptor_namespace;
-            if (false
-                == clp_s::search::ast::tokenize_column_descriptor(
-                        column,
-                        descriptor_tokens,
-                        descriptor_namespace
-                ))
-            {
-                record_error_and_log(
-                        "projection column tokenization failed",
-                        fmt::format("Can not tokenize invalid column: \"{}\"", column)
-                );
-                return false;
-            }
-            projection->add_column(
-                    ast::ColumnDescriptor::create_from_escaped_tokens(
+        // Narrow against schemas
+        match_pass = std::make_shared<SchemaMatch>(
+                archive_reader->get_schema_tree(),
+                archive_reader->get_schema_map()
+        );
+        if (expr = match_pass->run(expr); std::dynamic_pointer_cast<ast::EmptyExpr>(expr)) {
+            cache_plan();
+            record_early_termination(cTerminationStageSchemaMatching);
+            SPDLOG_INFO("No matching schemas for query '{}'", query);
+            return true;
+        }
+
+        // Populate projection
+        projection = std::make_shared<Projection>(
+                command_line_arguments.get_projection_columns().empty()
+                        ? ProjectionMode::ReturnAllColumns
+                        : ProjectionMode::ReturnSelectedColumns
+        );
+        try {
+            for (auto const& column : command_line_arguments.get_projection_columns()) {
+                std::vector<std::string> descriptor_tokens;
+                std::string descriptor_namespace;
+                if (false
+                    == clp_s::search::ast::tokenize_column_descriptor(
+                            column,
                             descriptor_tokens,
                             descriptor_namespace
-                    )
-            );
+                    ))
+                {
+                    record_error_and_log(
+                            "projection column tokenization failed",
+                            fmt::format("Can not tokenize invalid column: \"{}\"", column)
+                    );
+                    return false;
+                }
+                projection->add_column(
+                        ast::ColumnDescriptor::create_from_escaped_tokens(
+                                descriptor_tokens,
+                                descriptor_namespace
+                        )
+                );
+            }
+        } catch (std::exception const& e) {
+            record_error_and_log("projection resolution failed", e.what());
+            return false;
         }
-    } catch (std::exception const& e) {
-        record_error_and_log("projection resolution failed", e.what());
-        return false;
+        projection->resolve_columns(archive_reader->get_schema_tree());
+        cache_plan();
     }
-    projection->resolve_columns(archive_reader->get_schema_tree());
     archive_reader->set_projection(projection);
 
     std::unique_ptr<OutputHandler> output_handler;
@@ -343,7 +481,8 @@ bool search_archive(
                                         options.collection,
                                         options.batch_size,
                                         options.max_num_results,
-                                        options.dataset
+                                        options.dataset,
+                                        results_timestamp_lower_bound
                                 );
                             } else {
                                 output_handler = clp_s::make_aggregation_output_handler(
@@ -360,12 +499,20 @@ bool search_archive(
                         [&](CommandLineArguments::StdoutOutputHandlerOptions const&) -> void {
                             auto const& aggregator{command_line_arguments.get_aggregator()};
                             if (false == aggregator.has_value()) {
-                                output_handler = std::make_unique<clp_s::StandardOutputHandler>();
+                                if (-1 == results_socket_fd) {
+                                    output_handler
+                                            = std::make_unique<clp_s::StandardOutputHandler>();
+                                } else {
+                                    output_handler = std::make_unique<clp_s::SocketOutputHandler>(
+                                            results_socket_fd
+                                    );
+                                }
                             } else {
                                 output_handler = clp_s::make_aggregation_output_handler(
                                         aggregator.value(),
                                         std::make_unique<clp_s::StdoutSink>(
-                                                archive_reader->get_archive_id()
+                                                archive_reader->get_archive_id(),
+                                                results_socket_fd
                                         )
                                 );
                             }
@@ -397,15 +544,211 @@ bool search_archive(
             command_line_arguments.get_ignore_case()
     );
     auto const success{output.filter()};
+    results_timestamp_lower_bound = output.get_timestamp_lower_bound();
     if (nullptr != telemetry_span) {
         if (false == success) {
             telemetry_span->set_error("archive filtering failed");
         }
         telemetry_span->set_termination_stage(output.get_termination_stage());
         telemetry_span->set_search_result_metrics(output.get_result_metrics());
+        telemetry_span->set_predicate_order_metrics(output.get_predicate_order_metrics());
     }
     return success;
 }
+
+auto search(
+        CommandLineArguments const& command_line_arguments,
+        std::shared_ptr<clp_s::ArchiveCache> const& archive_cache,
+        int results_socket_fd
+) -> bool {
+    auto const& query = command_line_arguments.get_query();
+    auto query_stream = std::istringstream(query);
+    auto expr = kql::parse_kql_expression(query_stream);
+    if (nullptr == expr) {
+        return false;
+    }
+
+    if (std::dynamic_pointer_cast<ast::EmptyExpr>(expr)) {
+        SPDLOG_ERROR("Query '{}' is logically false", query);
+        return false;
+    }
+
+    int reducer_socket_fd{-1};
+    if (std::holds_alternative<CommandLineArguments::ReducerOutputHandlerOptions>(
+                command_line_arguments.get_output_handler_options()
+        ))
+    {
+        auto const& options{std::get<CommandLineArguments::ReducerOutputHandlerOptions>(
+                command_line_arguments.get_output_handler_options()
+        )};
+        reducer_socket_fd
+                = reducer::connect_to_reducer(options.host, options.port, options.job_id);
+        if (-1 == reducer_socket_fd) {
+            SPDLOG_ERROR("Failed to connect to reducer");
+            return false;
+        }
+    }
+
+    auto const success{search_input_paths(
+            command_line_arguments,
+            expr,
+            reducer_socket_fd,
+            results_socket_fd,
+            archive_cache
+    )};
+    if (-1 != reducer_socket_fd) {
+        close(reducer_socket_fd);
+    }
+    return success;
+}
+
+auto search_input_paths(
+        CommandLineArguments const& command_line_arguments,
+        std::shared_ptr<ast::Expression> const& expr,
+        int reducer_socket_fd,
+        int results_socket_fd,
+        std::shared_ptr<clp_s::ArchiveCache> const& archive_cache
+) -> bool {
+    auto archive_reader = std::make_shared<clp_s::ArchiveReader>();
+    archive_reader->set_archive_cache(archive_cache);
+    // Lets the results cache output handler skip records that are older than the latest results
+    // already found in previously searched archives.
+    std::optional<clp_s::epochtime_t> results_timestamp_lower_bound;
+    // Lets archives with the same schemas share the query planning work.
+    QueryPlanCache query_plan_cache;
+    for (auto const& input_path : command_line_arguments.get_input_paths()) {
+        if (std::string::npos != input_path.path.find(clp::ir::cIrFileExtension)) {
+            auto const result{clp_s::search_kv_ir_stream(
+                    input_path,
+                    command_line_arguments,
+                    expr->copy(),
+                    reducer_socket_fd,
+                    results_socket_fd
+            )};
+            if (false == result.has_error()) {
+                continue;
+            }
+
+            auto const error{result.error()};
+            if (std::errc::result_out_of_range == error) {
+                // To support real-time search, we will allow incomplete IR streams.
+                // TODO: Use dedicated error code for this case once issue #904 is resolved.
+                SPDLOG_WARN("IR stream `{}` is truncated", input_path.path);
+                continue;
+            }
+
+            if (KvIrSearchError{KvIrSearchErrorEnum::ProjectionSupportNotImplemented} == error
+                || KvIrSearchError{KvIrSearchErrorEnum::UnsupportedOutputHandlerType} == error
+                || KvIrSearchError{KvIrSearchErrorEnum::AggregationSupportNotImplemented}
+                           == error)
+            {
+                // These errors are treated as non-fatal because they result from unsupported
+                // features. However, this approach may cause archives with this extension to be
+                // skipped if the search uses advanced features that are not yet implemented. To
+                // mitigate this, we log a warning and proceed to search the input as an
+                // archive.
+                SPDLOG_WARN(
+                        "Attempted to search an IR stream using unsupported features. Falling"
+                        " back to searching the input as an archive."
+                );
+            } else if (KvIrSearchError{KvIrSearchErrorEnum::DeserializerCreationFailure}
+                       != error)
+            {
+                // If the error is `DeserializerCreationFailure`, we may continue to treat the
+                // input as an archive and retry. Otherwise, it should be considered as a
+                // non-recoverable failure and return directly.
+                SPDLOG_ERROR(
+                        "Failed to search '{}' as an IR stream, error_category={}, error={}",
+                        input_path.path,
+                        error.category().name(),
+                        error.message()
+                );
+                return false;
+            }
+        }
+
+        std::shared_ptr<SearchTelemetrySpan> telemetry_span;
+        if (command_line_arguments.get_enable_telemetry()) {
+            telemetry_span = std::make_shared<SearchTelemetrySpan>();
+        }
+        clp::overloaded const emit{
+                [telemetry_span](
+                        std::string_view name,
+                        utils::profiling::Measurement measurement
+                ) -> void {
+                    if (nullptr != telemetry_span) {
+                        telemetry_span->set_profiler_measurement(name, measurement);
+                    } else {
+                        utils::profiling::SpdlogEmitter{}(name, measurement);
+                    }
+                },
+                [telemetry_span](std::string_view name, uint64_t value) -> void {
+                    if (nullptr != telemetry_span) {
+                        telemetry_span->set_profiler_counter(name, value);
+                    } else {
+                        utils::profiling::SpdlogEmitter{}(name, value);
+                    }
+                }
+        };
+        utils::profiling::Reporter const profiler_reporter{"search", emit};
+
+        try {
+            archive_reader->open(input_path, command_line_arguments.get_network_auth());
+        } catch (std::exception const& e) {
+            SPDLOG_ERROR("Failed to open archive - {}", e.what());
+            if (nullptr != telemetry_span) {
+                telemetry_span->set_error("failed to open archive");
+            }
+            return false;
+        }
+        if (false
+            == search_archive(
+                    command_line_arguments,
+                    archive_reader,
+                    expr,
+                    reducer_socket_fd,
+                    results_socket_fd,
+                    telemetry_span,
+                    results_timestamp_lower_bound,
+                    &query_plan_cache
+            ))
+        {
+            return false;
+        }
+        archive_reader->close();
+    }
+    return true;
+}
+
+auto serve(CommandLineArguments const& command_line_arguments) -> bool {
+    // Clients may disconnect while their results are being streamed, so report failed writes
+    // instead of being killed by SIGPIPE.
+    std::signal(SIGPIPE, SIG_IGN);
+
+    auto const archive_cache{
+            std::make_shared<clp_s::ArchiveCache>(command_line_arguments.get_archive_cache_size())
+    };
+    clp_s::SearchServer server{
+            command_line_arguments.get_serve_socket_path(),
+            command_line_arguments.get_max_concurrent_queries(),
+            command_line_arguments.get_max_queued_queries(),
+            archive_cache,
+            [&](CommandLineArguments const& search_arguments, int results_socket_fd) -> bool {
+                return search(search_arguments, archive_cache, results_socket_fd);
+            }
+    };
+    auto const success{server.run()};
+
+    auto const metrics{archive_cache->get_metrics()};
+    SPDLOG_INFO(
+            "Archive cache: {} hits, {} misses ({:.2f} hit rate), {} evictions",
+            metrics.num_hits,
+            metrics.num_misses,
+            metrics.get_hit_rate(),
+            metrics.num_evictions
+    );
+    return success;
+}
 }  // namespace
 
 int main(int argc, char const* argv[]) {
@@ -471,123 +814,22 @@ int main(int argc, char const* argv[]) {
             SPDLOG_ERROR("Encountered error during decompression - {}", e.what());
             return 1;
         }
-    } else {
-        auto const& query = command_line_arguments.get_query();
-        auto query_stream = std::istringstream(query);
-        auto expr = kql::parse_kql_expression(query_stream);
-        if (nullptr == expr) {
-            return 1;
-        }
-
-        if (std::dynamic_pointer_cast<ast::EmptyExpr>(expr)) {
-            SPDLOG_ERROR("Query '{}' is logically false", query);
-            return 1;
-        }
+    } else if (CommandLineArguments::Command::Serve == command_line_arguments.get_command()) {
+        try {
+            // Searches run concurrently, so switch to a thread-safe logger.
+            spdlog::drop("stderr");
+            spdlog::set_default_logger(spdlog::stderr_logger_mt("stderr"));
 
-        int reducer_socket_fd{-1};
-        if (std::holds_alternative<CommandLineArguments::ReducerOutputHandlerOptions>(
-                    command_line_arguments.get_output_handler_options()
-            ))
-        {
-            auto const& options{std::get<CommandLineArguments::ReducerOutputHandlerOptions>(
-                    command_line_arguments.get_output_handler_options()
-            )};
-            reducer_socket_fd
-                    = reducer::connect_to_reducer(options.host, options.port, options.job_id);
-            if (-1 == reducer_socket_fd) {
-                SPDLOG_ERROR("Failed to connect to reducer");
+            if (false == serve(command_line_arguments)) {
                 return 1;
             }
+        } catch (std::exception const& e) {
+            SPDLOG_ERROR("Encountered error while serving searches - {}", e.what());
+            return 1;
         }
-
-        auto archive_reader = std::make_shared<clp_s::ArchiveReader>();
-        for (auto const& input_path : command_line_arguments.get_input_paths()) {
-            if (std::string::npos != input_path.path.find(clp::ir::cIrFileExtension)) {
-                auto const result{clp_s::search_kv_ir_stream(
-                        input_path,
-                        command_line_arguments,
-                        expr->copy(),
-                        reducer_socket_fd
-                )};
-                if (false == result.has_error()) {
-                    continue;
-                }
-
-                auto const error{result.error()};
-                if (std::errc::result_out_of_range == error) {
-                    // To support real-time search, we will allow incomplete IR streams.
-                    // TODO: Use dedicated error code for this case once issue #904 is resolved.
-                    SPDLOG_WARN("IR stream `{}` is truncated", input_path.path);
-                    continue;
-                }
-
-                if (KvIrSearchError{KvIrSearchErrorEnum::ProjectionSupportNotImplemented} == error
-                    || KvIrSearchError{KvIrSearchErrorEnum::UnsupportedOutputHandlerType} == error
-                    || KvIrSearchError{KvIrSearchErrorEnum::AggregationSupportNotImplemented}
-                               == error)
-                {
-                    // These errors are treated as non-fatal because they result from unsupported
-                    // features. However, this approach may cause archives with this extension to be
-                    // skipped if the search uses advanced features that are not yet implemented. To
-                    // mitigate this, we log a warning and proceed to search the input as an
-                    // archive.
-                    SPDLOG_WARN(
-                            "Attempted to search an IR stream using unsupported features. Falling"
-                            " back to searching the input as an archive."
-                    );
-                } else if (KvIrSearchError{KvIrSearchErrorEnum::DeserializerCreationFailure}
-                           != error)
-                {
-                    // If the error is `DeserializerCreationFailure`, we may continue to treat the
-                    // input as an archive and retry. Otherwise, it should be considered as a
-                    // non-recoverable failure and return directly.
-                    SPDLOG_ERROR(
-                            "Failed to search '{}' as an IR stream, error_category={}, error={}",
-                            input_path.path,
-                            error.category().name(),
-                            error.message()
-                    );
-                    return 1;
-                }
-            }
-
-            std::shared_ptr<SearchTelemetrySpan> telemetry_span;
-            if (command_line_arguments.get_enable_telemetry()) {
-                telemetry_span = std::make_shared<SearchTelemetrySpan>();
-            }
-            auto emit_measurement = [telemetry_span](
-                                            std::string_view name,
-                                            utils::profiling::Measurement measurement
-                                    ) -> void {
-                if (nullptr != telemetry_span) {
-                    telemetry_span->set_profiler_measurement(name, measurement);
-                } else {
-                    utils::profiling::SpdlogEmitter{}(name, measurement);
-                }
-            };
-            utils::profiling::Reporter const profiler_reporter{"search", emit_measurement};
-
-            try {
-                archive_reader->open(input_path, command_line_arguments.get_network_auth());
-            } catch (std::exception const& e) {
-                SPDLOG_ERROR("Failed to open archive - {}", e.what());
-                if (nullptr != telemetry_span) {
-                    telemetry_span->set_error("failed to open archive");
-                }
-                return 1;
-            }
-            if (false
-                == search_archive(
-                        command_line_arguments,
-                        archive_reader,
-                        expr->copy(),
-                        reducer_socket_fd,
-                        telemetry_span
-                ))
-            {
-                return 1;
-            }
-            archive_reader->close();
+    } else {
+        if (false == search(command_line_arguments, nullptr, -1)) {
+            return 1;
         }
     }
 
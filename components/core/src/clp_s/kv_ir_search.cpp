@@ -15,12 +15,14 @@
 #include <ystdlib/error_handling/ErrorCode.hpp>
 #include <ystdlib/error_handling/Result.hpp>
 
+#include "../clp/BufferedReader.hpp"
 #include "../clp/ErrorCode.hpp"
 #include "../clp/ffi/ir_stream/Deserializer.hpp"
 #include "../clp/ffi/ir_stream/IrUnitType.hpp"
 #include "../clp/ffi/ir_stream/search/QueryHandler.hpp"
 #include "../clp/ffi/KeyValuePairLogEvent.hpp"
 #include "../clp/ffi/SchemaTree.hpp"
+#include "../clp/networking/socket_utils.hpp"
 #include "../clp/ReaderInterface.hpp"
 #include "../clp/spdlog_with_specializations.hpp"
 #include "../clp/streaming_compression/zstd/Decompressor.hpp"
@@ -58,14 +60,18 @@ public:
     /**
      * @param command_line_arguments
      * @param reducer_socket_fd
+     * @param results_socket_fd A socket to write matching log events to, or -1 to write them to
+     * stdout.
      * @return A result containing the created IrUnitHandler on success, or an error code indicating
      * the failure:
      * - KvIrSearchErrorEnum::UnsupportedOutputHandlerType if the output handler type is not
      *   supported.
      */
-    [[nodiscard]] static auto
-    create(CommandLineArguments const& command_line_arguments, int reducer_socket_fd)
-            -> ystdlib::error_handling::Result<IrUnitHandler>;
+    [[nodiscard]] static auto create(
+            CommandLineArguments const& command_line_arguments,
+            int reducer_socket_fd,
+            int results_socket_fd
+    ) -> ystdlib::error_handling::Result<IrUnitHandler>;
 
     // Delete copy constructor and assignment operator
     IrUnitHandler(IrUnitHandler const&) = delete;
@@ -104,7 +110,10 @@ public:
 
 private:
     // Constructor
-    IrUnitHandler() = default;
+    explicit IrUnitHandler(int results_socket_fd) : m_results_socket_fd{results_socket_fd} {}
+
+    // Variables
+    int m_results_socket_fd;
 };
 
 /**
@@ -113,6 +122,7 @@ private:
  * @param command_line_arguments
  * @param query
  * @param reducer_socket_fd
+ * @param results_socket_fd
  * @return A void result on success, or an error code indicating the failure:
  * - KvIrSearchErrorEnum::DeserializerCreationFailure if `clp::ffi::ir_stream::Deserializer::create`
  *   failed. This specific error code is returned instead of propagating the return values of
@@ -126,12 +136,14 @@ private:
         clp::ReaderInterface& stream_reader,
         CommandLineArguments const& command_line_arguments,
         std::shared_ptr<search::ast::Expression> query,
-        int reducer_socket_fd
+        int reducer_socket_fd,
+        int results_socket_fd
 ) -> ystdlib::error_handling::Result<void>;
 
 auto IrUnitHandler::create(
         CommandLineArguments const& command_line_arguments,
-        [[maybe_unused]] int reducer_socket_fd
+        [[maybe_unused]] int reducer_socket_fd,
+        int results_socket_fd
 ) -> ystdlib::error_handling::Result<IrUnitHandler> {
     if (false
         == std::holds_alternative<CommandLineArguments::StdoutOutputHandlerOptions>(
@@ -143,7 +155,7 @@ auto IrUnitHandler::create(
         );
         return KvIrSearchError{KvIrSearchErrorEnum::UnsupportedOutputHandlerType};
     }
-    return IrUnitHandler{};
+    return IrUnitHandler{results_socket_fd};
 }
 
 /**
@@ -173,13 +185,25 @@ auto IrUnitHandler::handle_log_event(
     try {
         constexpr std::string_view cAutoGenKey{"\"auto_generated_kv_pairs\""};
         constexpr std::string_view cUserGenKey{"\"user_generated_kv_pairs\""};
-        std::cout << fmt::format(
+        auto const serialized_log_event{fmt::format(
                 "{{{}:{},{}:{}}}\n",
                 cAutoGenKey,
                 auto_gen_kv_pairs.dump(),
                 cUserGenKey,
                 user_gen_kv_pairs.dump()
-        );
+        )};
+        if (-1 == m_results_socket_fd) {
+            std::cout << serialized_log_event;
+        } else if (clp::ErrorCode_Success
+                   != clp::networking::try_send(
+                           m_results_socket_fd,
+                           serialized_log_event.data(),
+                           serialized_log_event.size()
+                   ))
+        {
+            SPDLOG_ERROR("kv-ir search: Failed to send log event, errno={}", errno);
+            return IRErrorCode::IRErrorCode_Eof;
+        }
     } catch (nlohmann::json::exception const& ex) {
         SPDLOG_ERROR(
                 "kv-ir search: Failed to serialize kv-pair log event into JSON strings."
@@ -196,7 +220,8 @@ auto deserialize_and_search_kv_ir_stream(
         clp::ReaderInterface& stream_reader,
         CommandLineArguments const& command_line_arguments,
         std::shared_ptr<search::ast::Expression> query,
-        int reducer_socket_fd
+        int reducer_socket_fd,
+        int results_socket_fd
 ) -> ystdlib::error_handling::Result<void> {
     auto trivial_new_projected_schema_tree_node_callback
             = []([[maybe_unused]] bool is_auto_generated,
@@ -207,7 +232,7 @@ auto deserialize_and_search_kv_ir_stream(
             QueryHandler<decltype(trivial_new_projected_schema_tree_node_callback)>;
 
     auto ir_unit_handler{YSTDLIB_ERROR_HANDLING_TRYX(
-            IrUnitHandler::create(command_line_arguments, reducer_socket_fd)
+            IrUnitHandler::create(command_line_arguments, reducer_socket_fd, results_socket_fd)
     )};
     auto query_handler{YSTDLIB_ERROR_HANDLING_TRYX(
             QueryHandlerType::create(
@@ -239,7 +264,8 @@ auto search_kv_ir_stream(
         Path const& stream_path,
         CommandLineArguments const& command_line_arguments,
         std::shared_ptr<search::ast::Expression> query,
-        int reducer_socket_fd
+        int reducer_socket_fd,
+        int results_socket_fd
 ) -> ystdlib::error_handling::Result<void> {
     if (false == command_line_arguments.get_projection_columns().empty()) {
         SPDLOG_ERROR("kv-ir search: Projection support is not implemented.");
@@ -271,16 +297,20 @@ auto search_kv_ir_stream(
     query = date_precision_pass.run(query);
 
     try {
-        clp::streaming_compression::zstd::Decompressor decompressor;
+        auto const decompressor{std::make_shared<clp::streaming_compression::zstd::Decompressor>()};
         constexpr size_t cReaderBufferSize{64L * 1024L};  // 64 KiB
-        decompressor.open(*raw_reader, cReaderBufferSize);
+        decompressor->open(*raw_reader, cReaderBufferSize);
+        // Buffer the decompressed stream so that the deserializer can deserialize IR units directly
+        // from the buffer.
+        clp::BufferedReader buffered_reader{decompressor, cReaderBufferSize};
         YSTDLIB_ERROR_HANDLING_TRYV(deserialize_and_search_kv_ir_stream(
-                decompressor,
+                buffered_reader,
                 command_line_arguments,
                 std::move(query),
-                reducer_socket_fd
+                reducer_socket_fd,
+                results_socket_fd
         ));
-        decompressor.close();
+        decompressor->close();
     } catch (clp::TraceableException const& ex) {
         auto const err{ex.get_error_code()};
         if (clp::ErrorCode_errno == err) {
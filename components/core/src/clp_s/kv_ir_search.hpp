@@ -29,6 +29,8 @@ using KvIrSearchError = ystdlib::error_handling::ErrorCode<KvIrSearchErrorEnum>;
  * @param command_line_arguments
  * @param query
  * @param reducer_socket_fd
+ * @param results_socket_fd A socket to stream the matching log events to, or -1 to write them to
+ * stdout.
  * @return A void result on success, or an error code indicating the failure:
  * - KvIrSearchErrorEnum::ClpLegacyError if a `clp::TraceableException` is caught.
  * - KvIrSearchErrorEnum::AggregationSupportNotImplemented if an aggregation is requested.
@@ -41,7 +43,8 @@ using KvIrSearchError = ystdlib::error_handling::ErrorCode<KvIrSearchErrorEnum>;
         Path const& stream_path,
         CommandLineArguments const& command_line_arguments,
         std::shared_ptr<search::ast::Expression> query,
-        int reducer_socket_fd
+        int reducer_socket_fd,
+        int results_socket_fd
 ) -> ystdlib::error_handling::Result<void>;
 }  // namespace clp_s
 
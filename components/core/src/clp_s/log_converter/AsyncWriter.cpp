@@ -0,0 +1,140 @@
+#include "AsyncWriter.hpp"
+
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+
+#include "../../clp/Defs.h"
+#include "../../clp/ErrorCode.hpp"
+#include "../../clp/WriterInterface.hpp"
+
+namespace clp_s::log_converter {
+AsyncWriter::AsyncWriter(clp::WriterInterface& writer, size_t num_buffers)
+        : m_writer{writer},
+          m_buffers(num_buffers > 0 ? num_buffers : 1) {
+    for (size_t i{0}; i < m_buffers.size(); ++i) {
+        m_free_buffer_ids.push_back(i);
+    }
+    m_writer_thread = std::make_unique<WriterThread>(*this);
+    m_writer_thread->start();
+}
+
+AsyncWriter::~AsyncWriter() {
+    if (m_is_closed) {
+        return;
+    }
+    try {
+        stop_writer_thread();
+    } catch (...) {
+        // Destructors must not throw, and there's no caller to report the failure to
+    }
+}
+
+auto AsyncWriter::write(char const* data, size_t data_length) -> void {
+    if (m_is_closed) {
+        throw OperationFailed(clp::ErrorCode_NotInit, __FILENAME__, __LINE__);
+    }
+    if (0 == data_length) {
+        return;
+    }
+
+    size_t buffer_id{};
+    {
+        std::unique_lock<std::mutex> buffer_lock{m_buffer_mutex};
+        m_producer_cv.wait(buffer_lock, [&] {
+            return false == m_free_buffer_ids.empty() || nullptr != m_writer_exception;
+        });
+        rethrow_writer_exception();
+        buffer_id = m_free_buffer_ids.back();
+        m_free_buffer_ids.pop_back();
+    }
+
+    // The buffer is owned by this thread until it's queued, so it can be filled without the lock
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    m_buffers[buffer_id].assign(data, data + data_length);
+    m_pos += data_length;
+
+    std::unique_lock<std::mutex> const buffer_lock{m_buffer_mutex};
+    m_filled_buffer_ids.push(buffer_id);
+    m_writer_thread_cv.notify_all();
+}
+
+auto AsyncWriter::flush() -> void {
+    {
+        std::unique_lock<std::mutex> buffer_lock{m_buffer_mutex};
+        m_producer_cv.wait(buffer_lock, [&] {
+            return (m_filled_buffer_ids.empty() && false == m_is_writer_thread_busy)
+                   || nullptr != m_writer_exception;
+        });
+        rethrow_writer_exception();
+    }
+
+    // The writer thread is idle until more data is queued, so the other writer can be flushed from
+    // this thread.
+    if (false == m_is_closed) {
+        m_writer.flush();
+    }
+}
+
+auto AsyncWriter::close() -> void {
+    if (m_is_closed) {
+        return;
+    }
+    stop_writer_thread();
+    m_is_closed = true;
+
+    std::unique_lock<std::mutex> const buffer_lock{m_buffer_mutex};
+    rethrow_writer_exception();
+}
+
+auto AsyncWriter::stop_writer_thread() -> void {
+    {
+        std::unique_lock<std::mutex> const buffer_lock{m_buffer_mutex};
+        m_stop_requested = true;
+        m_writer_thread_cv.notify_all();
+    }
+    m_writer_thread->join();
+}
+
+auto AsyncWriter::rethrow_writer_exception() const -> void {
+    if (nullptr != m_writer_exception) {
+        std::rethrow_exception(m_writer_exception);
+    }
+}
+
+auto AsyncWriter::WriterThread::thread_method() -> void {
+    std::unique_lock<std::mutex> buffer_lock{m_writer.m_buffer_mutex};
+    while (true) {
+        m_writer.m_writer_thread_cv.wait(buffer_lock, [&] {
+            return false == m_writer.m_filled_buffer_ids.empty() || m_writer.m_stop_requested;
+        });
+        if (m_writer.m_filled_buffer_ids.empty()) {
+            // Stop requested and all queued buffers have been written
+            break;
+        }
+        auto const buffer_id{m_writer.m_filled_buffer_ids.front()};
+        m_writer.m_filled_buffer_ids.pop();
+        m_writer.m_is_writer_thread_busy = true;
+
+        buffer_lock.unlock();
+        std::exception_ptr writer_exception;
+        try {
+            auto const& buffer{m_writer.m_buffers[buffer_id]};
+            m_writer.m_writer.write(buffer.data(), buffer.size());
+        } catch (...) {
+            writer_exception = std::current_exception();
+        }
+        buffer_lock.lock();
+
+        m_writer.m_is_writer_thread_busy = false;
+        m_writer.m_free_buffer_ids.push_back(buffer_id);
+        m_writer.m_producer_cv.notify_all();
+        if (nullptr != writer_exception) {
+            // Stop writing since the data after the failed write would be corrupted anyway
+            m_writer.m_writer_exception = writer_exception;
+            break;
+        }
+    }
+}
+}  // namespace clp_s::log_converter
@@ -0,0 +1,141 @@
+#ifndef CLP_S_LOG_CONVERTER_ASYNCWRITER_HPP
+#define CLP_S_LOG_CONVERTER_ASYNCWRITER_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <vector>
+
+#include "../../clp/ErrorCode.hpp"
+#include "../../clp/Thread.hpp"
+#include "../../clp/WriterInterface.hpp"
+
+namespace clp_s::log_converter {
+/**
+ * Writer that forwards data to another writer on a background thread, so that the work done by the
+ * other writer (e.g., compression) overlaps with the work done to produce the data.
+ *
+ * Data is copied into a bounded ring of buffers, which the background thread writes to the other
+ * writer in order. If all buffers are waiting to be written, `write` blocks until one is free.
+ *
+ * If writing to the other writer fails, the exception is rethrown by the next call to `write`,
+ * `flush`, or `close`.
+ */
+class AsyncWriter : public clp::WriterInterface {
+public:
+    // Constants
+    static constexpr size_t cDefaultNumBuffers{4};
+
+    // Constructors
+    /**
+     * Constructs the writer and starts its background thread.
+     * @param writer The writer to forward data to, which must outlive this writer.
+     * @param num_buffers The number of buffers that may be waiting to be written at once.
+     * @throw clp::Thread::OperationFailed if the background thread couldn't be started.
+     */
+    explicit AsyncWriter(clp::WriterInterface& writer, size_t num_buffers = cDefaultNumBuffers);
+
+    // Delete copy/move constructors and assignment operators since this class' synchronization
+    // primitives are non-copyable and non-moveable.
+    AsyncWriter(AsyncWriter const&) = delete;
+    AsyncWriter(AsyncWriter&&) = delete;
+    auto operator=(AsyncWriter const&) -> AsyncWriter& = delete;
+    auto operator=(AsyncWriter&&) -> AsyncWriter& = delete;
+
+    // Destructor
+    /**
+     * Writes any buffered data and stops the background thread, if `close` hasn't been called.
+     */
+    ~AsyncWriter() override;
+
+    // Methods implementing `clp::WriterInterface`
+    /**
+     * Queues the given data to be written by the background thread.
+     * @param data
+     * @param data_length
+     * @throw clp::WriterInterface::OperationFailed if the writer is closed.
+     * @throw Any exception thrown by the other writer while writing previously queued data.
+     */
+    auto write(char const* data, size_t data_length) -> void override;
+
+    /**
+     * Waits until all queued data has been written, and then flushes the other writer.
+     * @throw Any exception thrown by the other writer.
+     */
+    auto flush() -> void override;
+
+    [[nodiscard]] auto try_seek_from_begin([[maybe_unused]] size_t pos) -> clp::ErrorCode override {
+        return clp::ErrorCode_Unsupported;
+    }
+
+    [[nodiscard]] auto try_seek_from_current([[maybe_unused]] off_t offset)
+            -> clp::ErrorCode override {
+        return clp::ErrorCode_Unsupported;
+    }
+
+    /**
+     * @param pos Returns the number of bytes written to this writer.
+     * @return ErrorCode_Success
+     */
+    [[nodiscard]] auto try_get_pos(size_t& pos) const -> clp::ErrorCode override {
+        pos = m_pos;
+        return clp::ErrorCode_Success;
+    }
+
+    // Methods
+    /**
+     * Writes all queued data and stops the background thread. The other writer isn't closed.
+     * @throw Any exception thrown by the other writer while writing queued data.
+     */
+    auto close() -> void;
+
+private:
+    /**
+     * This class implements clp::Thread to write queued buffers to the other writer.
+     */
+    class WriterThread : public clp::Thread {
+    public:
+        // Constructor
+        explicit WriterThread(AsyncWriter& writer) : m_writer{writer} {}
+
+    private:
+        // Methods implementing `clp::Thread`
+        auto thread_method() -> void final;
+
+        AsyncWriter& m_writer;
+    };
+
+    // Methods
+    /**
+     * Stops the background thread after it writes all queued buffers.
+     */
+    auto stop_writer_thread() -> void;
+
+    /**
+     * Rethrows the exception thrown by the other writer, if any.
+     */
+    auto rethrow_writer_exception() const -> void;
+
+    clp::WriterInterface& m_writer;
+    size_t m_pos{0};
+    bool m_is_closed{false};
+
+    std::vector<std::vector<char>> m_buffers;
+    std::vector<size_t> m_free_buffer_ids;
+    std::queue<size_t> m_filled_buffer_ids;
+    bool m_is_writer_thread_busy{false};
+    bool m_stop_requested{false};
+    std::exception_ptr m_writer_exception;
+
+    std::mutex m_buffer_mutex;
+    std::condition_variable m_producer_cv;
+    std::condition_variable m_writer_thread_cv;
+
+    std::unique_ptr<WriterThread> m_writer_thread;
+};
+}  // namespace clp_s::log_converter
+
+#endif  // CLP_S_LOG_CONVERTER_ASYNCWRITER_HPP
@@ -148,6 +148,13 @@ auto CommandLineArguments::parse_arguments(int argc, char const** argv)
                 "no-compress-converted-files",
                 po::bool_switch(&no_compress_converted_files),
                 "Disable compression on the converted KV-IR files."
+        )(
+                "threads,t",
+                po::value<size_t>(&m_num_threads)
+                    ->value_name("NUM_THREADS")
+                    ->default_value(m_num_threads),
+                "Number of input files to convert in parallel. Each file is additionally"
+                " compressed and written on its own background thread."
         );
         // clang-format on
 
@@ -204,6 +211,10 @@ auto CommandLineArguments::parse_arguments(int argc, char const** argv)
             throw std::invalid_argument("Max event size must be greater than zero.");
         }
 
+        if (0 == m_num_threads) {
+            throw std::invalid_argument("Number of threads must be greater than zero.");
+        }
+
         m_compress_converted_files = false == no_compress_converted_files;
     } catch (std::exception& e) {
         SPDLOG_ERROR("{}", e.what());
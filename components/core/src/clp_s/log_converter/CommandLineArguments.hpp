@@ -1,10 +1,12 @@
-#ifndef CLP_S_COMMANDLINEARGUMENTS_HPP
-#define CLP_S_COMMANDLINEARGUMENTS_HPP
+#ifndef CLP_S_LOG_CONVERTER_COMMANDLINEARGUMENTS_HPP
+#define CLP_S_LOG_CONVERTER_COMMANDLINEARGUMENTS_HPP
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <vector>
 
 #include "../InputConfig.hpp"
@@ -41,6 +43,8 @@ public:
         return m_compress_converted_files;
     }
 
+    [[nodiscard]] auto get_num_threads() const -> size_t { return m_num_threads; }
+
 private:
     // Methods
     void print_basic_usage() const;
@@ -52,7 +56,8 @@ private:
     std::string m_output_dir{"./"};
     size_t m_max_log_event_size{512ULL * 1024ULL * 1024ULL};  // 512 MiB
     bool m_compress_converted_files{true};
+    size_t m_num_threads{std::max<size_t>(1, std::thread::hardware_concurrency())};
 };
 }  // namespace clp_s::log_converter
 
-#endif  // CLP_S_COMMANDLINEARGUMENTS_HPP
+#endif  // CLP_S_LOG_CONVERTER_COMMANDLINEARGUMENTS_HPP
@@ -24,6 +24,8 @@
 #include <clp/ir/types.hpp>
 #include <clp/streaming_compression/zstd/Compressor.hpp>
 
+#include "AsyncWriter.hpp"
+
 namespace clp_s::log_converter {
 namespace {
 constexpr msgpack::object_map cEmptyMap{.size = 0U, .ptr = nullptr};
@@ -60,16 +62,22 @@ auto LogSerializer::create(
         return std::errc::no_such_file_or_directory;
     }
 
-    if (false == compress_with_zstd) {
-        return LogSerializer{std::move(serializer), std::move(nested_writers)};
+    if (compress_with_zstd) {
+        try {
+            auto compressor{std::make_unique<clp::streaming_compression::zstd::Compressor>()};
+            compressor->open(*nested_writers.back().get());
+            nested_writers.emplace_back(std::move(compressor));
+        } catch (std::exception const&) {
+            return std::errc::protocol_error;
+        }
     }
 
+    // Compress and write the serialized IR on a background thread, so that it overlaps with parsing
+    // and serializing the following log events.
     try {
-        auto compressor{std::make_unique<clp::streaming_compression::zstd::Compressor>()};
-        compressor->open(*nested_writers.back().get());
-        nested_writers.emplace_back(std::move(compressor));
+        nested_writers.emplace_back(std::make_unique<AsyncWriter>(*nested_writers.back().get()));
     } catch (std::exception const&) {
-        return std::errc::protocol_error;
+        return std::errc::resource_unavailable_try_again;
     }
     return LogSerializer{std::move(serializer), std::move(nested_writers)};
 }
@@ -17,6 +17,8 @@
 #include <clp/type_utils.hpp>
 #include <clp/WriterInterface.hpp>
 
+#include "AsyncWriter.hpp"
+
 namespace clp_s::log_converter {
 /**
  * Utility class that generates KV-IR corresponding to a converted input file.
@@ -33,6 +35,8 @@ public:
      * failure:
      * - std::errc::no_such_file_or_directory if a `clp::FileWriter` fails to open an output file.
      * - std::errc::protocol_error if a `clp::zstd::Compressor` fails to open a compression stream.
+     * - std::errc::resource_unavailable_try_again if the thread that compresses and writes the
+     *   output couldn't be started.
      * - Forwards `clp::ffi::ir_stream::Serializer<>::create()`'s return values.
      */
     [[nodiscard]] static auto create(
@@ -51,7 +55,13 @@ public:
     [[nodiscard]] auto operator=(LogSerializer&&) -> LogSerializer& = default;
 
     // Destructor
-    ~LogSerializer() = default;
+    ~LogSerializer() {
+        // Destroy the writers from furthest to closest to the output sink, since each writer may
+        // still write to the next one while being destroyed.
+        while (false == m_nested_writers.empty()) {
+            m_nested_writers.pop_back();
+        }
+    }
 
     // Methods
     /**
@@ -84,8 +94,13 @@ public:
         flush_buffer();
         m_nested_writers.back()->write_numeric_value(clp::ffi::ir_stream::cProtocol::Eof);
         for (auto it{m_nested_writers.rbegin()}; it != m_nested_writers.rend(); ++it) {
-            if (auto compressor{dynamic_cast<clp::streaming_compression::Compressor*>(it->get())};
-                nullptr != compressor)
+            if (auto async_writer{dynamic_cast<AsyncWriter*>(it->get())}; nullptr != async_writer)
+            {
+                async_writer->close();
+            } else if (auto compressor{
+                               dynamic_cast<clp::streaming_compression::Compressor*>(it->get())
+                       };
+                       nullptr != compressor)
             {
                 compressor->close();
             } else if (auto file_writer{dynamic_cast<clp::FileWriter*>(it->get())};
@@ -126,7 +141,7 @@ private:
 
     clp::ffi::ir_stream::Serializer<clp::ir::eight_byte_encoded_variable_t> m_serializer;
     // Nested writers are ordered from closest to furthest from output sink. Typically, this will
-    // look like `FileWriter` <- `Compressor`.
+    // look like `FileWriter` <- `Compressor` <- `AsyncWriter`.
     // NOTE: This class depends on there being at least one writer in `m_nested_writers` at all
     // times.
     std::vector<std::unique_ptr<clp::WriterInterface>> m_nested_writers;
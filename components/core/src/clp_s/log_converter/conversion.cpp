@@ -0,0 +1,184 @@
+#include "conversion.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <filesystem>
+#include <memory>
+#include <string>
+#include <system_error>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
+#include <spdlog/spdlog.h>
+
+#include "../../clp/ReaderInterface.hpp"
+#include "../InputConfig.hpp"
+#include "../Utils.hpp"
+#include "CommandLineArguments.hpp"
+#include "LogConverter.hpp"
+
+namespace clp_s::log_converter {
+namespace {
+/**
+ * Converts an input path according to the command line arguments.
+ * @param path
+ * @param log_converter
+ * @param command_line_arguments
+ * @return Whether conversion was successful.
+ */
+[[nodiscard]] auto convert_path(
+        clp_s::Path const& path,
+        LogConverter& log_converter,
+        CommandLineArguments const& command_line_arguments
+) -> bool;
+
+auto convert_path(
+        clp_s::Path const& path,
+        LogConverter& log_converter,
+        CommandLineArguments const& command_line_arguments
+) -> bool {
+    auto [nested_readers, file_type] = clp_s::try_create_reader_and_deduce_type_with_retries(
+            path,
+            command_line_arguments.get_network_auth()
+    );
+
+    switch (file_type) {
+        case clp_s::FileType::LogText:
+        case clp_s::FileType::EmptyFile: {
+            auto const convert_result{log_converter.convert_file(
+                    path,
+                    nested_readers.back().get(),
+                    command_line_arguments.get_output_dir(),
+                    command_line_arguments.get_compress_converted_files()
+            )};
+            if (convert_result.has_error()) {
+                auto const& error{convert_result.error()};
+                SPDLOG_ERROR(
+                        "Failed to convert input {} to structured representation: {} - {}",
+                        path.path,
+                        error.category().name(),
+                        error.message()
+                );
+                return false;
+            }
+            break;
+        }
+        case clp_s::FileType::Unknown: {
+            if (false == nested_readers.empty()
+                && clp_s::NetworkUtils::check_and_log_curl_error(
+                        path.path,
+                        nested_readers.front().get()
+                ))
+            {
+                return false;
+            }
+
+            auto log_text_handler = [&](std::shared_ptr<clp::ReaderInterface> reader,
+                                        std::string const& file_path) -> bool {
+                // Use member path for output filename
+                auto const convert_result{log_converter.convert_file(
+                        path,
+                        reader.get(),
+                        command_line_arguments.get_output_dir(),
+                        command_line_arguments.get_compress_converted_files()
+                )};
+                if (convert_result.has_error()) {
+                    auto const& error{convert_result.error()};
+                    SPDLOG_ERROR(
+                            "Failed to convert archive member {} to structured representation: "
+                            "{} - {}",
+                            file_path,
+                            error.category().name(),
+                            error.message()
+                    );
+                    return false;
+                }
+                return true;
+            };
+
+            auto other_handler = [&](std::shared_ptr<clp::ReaderInterface> reader,
+                                     std::string const& file_path) -> bool {
+                SPDLOG_ERROR("Received input that was not unstructured log-text: {}.", file_path);
+                return false;
+            };
+
+            if (false == nested_readers.empty()
+                && clp_s::try_process_general_purpose_archive_with_libarchive(
+                        nested_readers.back(),
+                        path,
+                        path.path,
+                        other_handler,
+                        other_handler,
+                        log_text_handler,
+                        log_text_handler
+                ))
+            {
+                break;
+            }
+        }
+        case clp_s::FileType::Json:
+        case clp_s::FileType::KeyValueIr:
+        case clp_s::FileType::Zstd:
+        default: {
+            if (false == nested_readers.empty()) {
+                clp_s::NetworkUtils::check_and_log_curl_error(
+                        path.path,
+                        nested_readers.front().get()
+                );
+            }
+            SPDLOG_ERROR("Received input that was not unstructured logtext: {}.", path.path);
+            return false;
+        }
+    }
+
+    return true;
+}
+}  // namespace
+
+auto convert_files(CommandLineArguments const& command_line_arguments) -> bool {
+    std::error_code ec{};
+    if (false == std::filesystem::create_directory(command_line_arguments.get_output_dir(), ec)
+        && ec)
+    {
+        SPDLOG_ERROR(
+                "Can not create output directory {} - {}",
+                command_line_arguments.get_output_dir(),
+                ec.message()
+        );
+        return false;
+    }
+
+    auto const& input_paths{command_line_arguments.get_input_paths()};
+    std::atomic_size_t next_path_idx{0};
+    std::atomic_bool failed{false};
+    auto run_worker = [&]() -> void {
+        // Each worker reuses its own converter (and so its parser and buffer) for all of its files
+        auto log_converter{LogConverter::create(command_line_arguments.get_max_log_event_size())};
+        while (false == failed) {
+            auto const path_idx{next_path_idx++};
+            if (path_idx >= input_paths.size()) {
+                break;
+            }
+            auto const& path{input_paths[path_idx]};
+            try {
+                if (false == convert_path(path, log_converter, command_line_arguments)) {
+                    failed = true;
+                }
+            } catch (std::exception const& e) {
+                SPDLOG_ERROR("Failed to convert input {} - {}", path.path, e.what());
+                failed = true;
+            }
+        }
+    };
+
+    auto const num_threads{std::min(command_line_arguments.get_num_threads(), input_paths.size())};
+    boost::asio::thread_pool workers(num_threads);
+    for (size_t i{0}; i < num_threads; ++i) {
+        boost::asio::post(workers, run_worker);
+    }
+    workers.join();
+    return false == failed;
+}
+}  // namespace clp_s::log_converter
@@ -0,0 +1,16 @@
+#ifndef CLP_S_LOG_CONVERTER_CONVERSION_HPP
+#define CLP_S_LOG_CONVERTER_CONVERSION_HPP
+
+#include "CommandLineArguments.hpp"
+
+namespace clp_s::log_converter {
+/**
+ * Converts all files according to the command line arguments, converting up to
+ * `command_line_arguments.get_num_threads()` files in parallel.
+ * @param command_line_arguments
+ * @return Whether conversion was successful.
+ */
+[[nodiscard]] auto convert_files(CommandLineArguments const& command_line_arguments) -> bool;
+}  // namespace clp_s::log_converter
+
+#endif  // CLP_S_LOG_CONVERTER_CONVERSION_HPP
@@ -1,151 +1,17 @@
-#include <cstdint>
 #include <exception>
-#include <filesystem>
-#include <string_view>
-#include <system_error>
-#include <utility>
 
 #include <spdlog/sinks/stdout_sinks.h>
 #include <spdlog/spdlog.h>
 
-#include "../../clp/ReaderInterface.hpp"
-#include "../InputConfig.hpp"
-#include "../Utils.hpp"
 #include "CommandLineArguments.hpp"
-#include "LogConverter.hpp"
+#include "conversion.hpp"
 
 using clp_s::log_converter::CommandLineArguments;
-using clp_s::log_converter::LogConverter;
-
-namespace {
-/**
- * Converts all files according to the command line arguments.
- * @param command_line_arguments
- * @return Whether conversion was successful.
- */
-[[nodiscard]] auto convert_files(CommandLineArguments const& command_line_arguments) -> bool;
-
-auto convert_files(CommandLineArguments const& command_line_arguments) -> bool {
-    auto log_converter{LogConverter::create(command_line_arguments.get_max_log_event_size())};
-
-    std::error_code ec{};
-    if (false == std::filesystem::create_directory(command_line_arguments.get_output_dir(), ec)
-        && ec)
-    {
-        SPDLOG_ERROR(
-                "Can not create output directory {} - {}",
-                command_line_arguments.get_output_dir(),
-                ec.message()
-        );
-        return false;
-    }
-
-    for (auto const& path : command_line_arguments.get_input_paths()) {
-        auto [nested_readers, file_type] = clp_s::try_create_reader_and_deduce_type_with_retries(
-                path,
-                command_line_arguments.get_network_auth()
-        );
-
-        switch (file_type) {
-            case clp_s::FileType::LogText:
-            case clp_s::FileType::EmptyFile: {
-                auto const convert_result{log_converter.convert_file(
-                        path,
-                        nested_readers.back().get(),
-                        command_line_arguments.get_output_dir(),
-                        command_line_arguments.get_compress_converted_files()
-                )};
-                if (convert_result.has_error()) {
-                    auto const& error{convert_result.error()};
-                    SPDLOG_ERROR(
-                            "Failed to convert input {} to structured representation: {} - {}",
-                            path.path,
-                            error.category().name(),
-                            error.message()
-                    );
-                    return false;
-                }
-                break;
-            }
-            case clp_s::FileType::Unknown: {
-                if (false == nested_readers.empty()
-                    && clp_s::NetworkUtils::check_and_log_curl_error(
-                            path.path,
-                            nested_readers.front().get()
-                    ))
-                {
-                    return false;
-                }
-
-                auto log_text_handler = [&](std::shared_ptr<clp::ReaderInterface> reader,
-                                            std::string const& file_path) -> bool {
-                    // Use member path for output filename
-                    auto const convert_result{log_converter.convert_file(
-                            path,
-                            reader.get(),
-                            command_line_arguments.get_output_dir(),
-                            command_line_arguments.get_compress_converted_files()
-                    )};
-                    if (convert_result.has_error()) {
-                        auto const& error{convert_result.error()};
-                        SPDLOG_ERROR(
-                                "Failed to convert archive member {} to structured representation: "
-                                "{} - {}",
-                                file_path,
-                                error.category().name(),
-                                error.message()
-                        );
-                        return false;
-                    }
-                    return true;
-                };
-
-                auto other_handler = [&](std::shared_ptr<clp::ReaderInterface> reader,
-                                         std::string const& file_path) -> bool {
-                    SPDLOG_ERROR(
-                            "Received input that was not unstructured log-text: {}.",
-                            file_path
-                    );
-                    return false;
-                };
-
-                if (false == nested_readers.empty()
-                    && clp_s::try_process_general_purpose_archive_with_libarchive(
-                            nested_readers.back(),
-                            path,
-                            path.path,
-                            other_handler,
-                            other_handler,
-                            log_text_handler,
-                            log_text_handler
-                    ))
-                {
-                    break;
-                }
-            }
-            case clp_s::FileType::Json:
-            case clp_s::FileType::KeyValueIr:
-            case clp_s::FileType::Zstd:
-            default: {
-                if (false == nested_readers.empty()) {
-                    clp_s::NetworkUtils::check_and_log_curl_error(
-                            path.path,
-                            nested_readers.front().get()
-                    );
-                }
-                SPDLOG_ERROR("Received input that was not unstructured logtext: {}.", path.path);
-                return false;
-            }
-        }
-    }
-
-    return true;
-}
-}  // namespace
+using clp_s::log_converter::convert_files;
 
 auto main(int argc, char const** argv) -> int {
     try {
-        auto stderr_logger = spdlog::stderr_logger_st("stderr");
+        auto stderr_logger = spdlog::stderr_logger_mt("stderr");
         spdlog::set_default_logger(stderr_logger);
         spdlog::set_pattern("%Y-%m-%dT%H:%M:%S.%e%z [%l] %v");
     } catch (std::exception& e) {
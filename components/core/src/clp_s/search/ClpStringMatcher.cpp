@@ -0,0 +1,265 @@
+#include "ClpStringMatcher.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <regex_utils/RegexMatcher.hpp>
+#include <string_utils/string_utils.hpp>
+
+#include <clp/ir/types.hpp>
+#include <clp/Query.hpp>
+#include <clp_s/ColumnReader.hpp>
+#include <clp_s/DictionaryEntry.hpp>
+
+namespace clp_s::search {
+ClpStringMatcher::ClpStringMatcher(clp::Query query)
+        : m_query{std::move(query)},
+          m_search_string{m_query.get_search_string()} {
+    if (m_query.get_ignore_case()) {
+        clp::string_utils::to_lower(m_search_string);
+    }
+
+    // The search string is clean, so every escape character is followed by the escaped character.
+    for (size_t i{0}; i < m_search_string.size(); ++i) {
+        auto const c{m_search_string[i]};
+        if ('\\' == c) {
+            ++i;
+            m_pattern.push_back({PatternTokenType::Char, m_search_string[i]});
+        } else if ('*' == c) {
+            m_pattern.push_back({PatternTokenType::AnyString, c});
+        } else if ('?' == c) {
+            m_pattern.push_back({PatternTokenType::AnyChar, c});
+        } else {
+            m_pattern.push_back({PatternTokenType::Char, c});
+        }
+    }
+
+    // A regex has to be matched against the whole value, so there's no point in matching values
+    // incrementally.
+    if (m_query.regex_match_required() || m_pattern.size() > cMaxIncrementalPatternSize) {
+        return;
+    }
+    m_can_match_incrementally = true;
+    for (size_t i{0}; i < m_pattern.size(); ++i) {
+        auto const token_mask{uint64_t{1} << i};
+        auto const& token{m_pattern[i]};
+        switch (token.type) {
+            case PatternTokenType::Char: {
+                auto const c{static_cast<unsigned char>(token.c)};
+                m_char_masks[c] |= token_mask;
+                // The search string is lowercase, so also match the character's uppercase form.
+                if (m_query.get_ignore_case()) {
+                    m_char_masks[static_cast<unsigned char>(std::toupper(c))] |= token_mask;
+                }
+                break;
+            }
+            case PatternTokenType::AnyChar:
+                for (auto& char_mask : m_char_masks) {
+                    char_mask |= token_mask;
+                }
+                break;
+            case PatternTokenType::AnyString:
+                m_any_string_mask |= token_mask;
+                break;
+        }
+    }
+    for (auto i{m_pattern.size()}; i > 0 && PatternTokenType::AnyString == m_pattern[i - 1].type;
+         --i)
+    {
+        m_any_string_suffix_mask |= uint64_t{1} << (i - 1);
+    }
+    m_match_mask = uint64_t{1} << m_pattern.size();
+}
+
+auto ClpStringMatcher::matches(ClpStringColumnReader& reader, uint64_t cur_message) -> bool {
+    auto const logtype_id{static_cast<size_t>(reader.get_encoded_id(cur_message))};
+    if (logtype_id >= m_logtype_matches.size()) {
+        m_logtype_matches.resize(logtype_id + 1, LogtypeMatch::Unknown);
+    }
+    auto& logtype_match{m_logtype_matches[logtype_id]};
+    if (LogtypeMatch::Unknown == logtype_match) {
+        logtype_match = classify_logtype(reader.get_logtype_entry(cur_message));
+    }
+    if (LogtypeMatch::Never == logtype_match) {
+        return false;
+    }
+    if (LogtypeMatch::Always == logtype_match) {
+        return true;
+    }
+    if (m_can_match_incrementally) {
+        return matches_incrementally(reader, cur_message);
+    }
+
+    m_value.clear();
+    reader.extract_string_value_into_buffer(cur_message, m_value);
+    if (m_query.regex_match_required()) {
+        return m_query.get_regex_matcher()->matches(m_value);
+    }
+    if (m_query.get_ignore_case()) {
+        clp::string_utils::to_lower(m_value);
+    }
+    return clp::string_utils::wildcard_match_unsafe_case_sensitive(m_value, m_search_string);
+}
+
+auto ClpStringMatcher::matches_incrementally(ClpStringColumnReader& reader, uint64_t cur_message)
+        -> bool {
+    auto const& entry{reader.get_logtype_entry(cur_message)};
+    auto const encoded_vars{reader.get_encoded_vars(cur_message)};
+    std::string_view const logtype{entry.get_value()};
+
+    // Match the static text and variables in the order they appear in the value, decoding each
+    // variable only once the static text before it still leaves the match undecided.
+    auto states{add_empty_any_string_matches(1)};
+    size_t static_text_begin{0};
+    size_t var_ix{0};
+    clp::ir::VariablePlaceholder placeholder{};
+    for (size_t i{0}; i < entry.get_num_placeholders(); ++i) {
+        auto const placeholder_pos{entry.get_placeholder_info(i, placeholder)};
+        states = consume(
+                logtype.substr(static_text_begin, placeholder_pos - static_text_begin),
+                states
+        );
+        static_text_begin = placeholder_pos + 1;
+        if (is_decided(states)) {
+            return 0 != states;
+        }
+        if (clp::ir::VariablePlaceholder::Escape == placeholder) {
+            continue;
+        }
+        auto const var{reader.decode_variable(encoded_vars[var_ix++], placeholder, m_value)};
+        states = consume(var, states);
+        if (is_decided(states)) {
+            return 0 != states;
+        }
+    }
+    states = consume(logtype.substr(static_text_begin), states);
+    return 0 != (states & m_match_mask);
+}
+
+auto ClpStringMatcher::consume(std::string_view text, uint64_t states) const -> uint64_t {
+    for (auto const c : text) {
+        // Each `*` token can match the character and stay put, while each other token can match
+        // the character and advance to the next token.
+        states = ((states & m_char_masks[static_cast<unsigned char>(c)]) << 1)
+                 | (states & m_any_string_mask);
+        states = add_empty_any_string_matches(states);
+        if (is_decided(states)) {
+            break;
+        }
+    }
+    return states;
+}
+
+auto ClpStringMatcher::add_empty_any_string_matches(uint64_t states) const -> uint64_t {
+    while (true) {
+        auto const next_states{states | ((states & m_any_string_mask) << 1)};
+        if (next_states == states) {
+            return states;
+        }
+        states = next_states;
+    }
+}
+
+auto ClpStringMatcher::classify_logtype(LogTypeDictionaryEntry const& entry) const
+        -> LogtypeMatch {
+    auto const& value{entry.get_value()};
+    std::vector<LogtypeToken> logtype;
+    logtype.reserve(value.size());
+    auto const append_static_text = [&](size_t begin, size_t end) {
+        for (size_t i{begin}; i < end; ++i) {
+            auto c{value[i]};
+            if (m_query.get_ignore_case()) {
+                c = static_cast<char>(std::tolower(static_cast<unsigned char>(c)));
+            }
+            logtype.push_back({false, c});
+        }
+    };
+
+    // Tokenize the logtype the same way its values are decoded, except that each variable becomes
+    // a single token.
+    size_t static_text_begin{0};
+    clp::ir::VariablePlaceholder placeholder{};
+    for (size_t i{0}; i < entry.get_num_placeholders(); ++i) {
+        auto const placeholder_pos{entry.get_placeholder_info(i, placeholder)};
+        append_static_text(static_text_begin, placeholder_pos);
+        if (clp::ir::VariablePlaceholder::Escape != placeholder) {
+            logtype.push_back({true, '\0'});
+        }
+        static_text_begin = placeholder_pos + 1;
+    }
+    append_static_text(static_text_begin, value.size());
+
+    if (false == matches_logtype(logtype, true)) {
+        return LogtypeMatch::Never;
+    }
+    if (m_query.regex_match_required() || false == matches_logtype(logtype, false)) {
+        return LogtypeMatch::Maybe;
+    }
+    return LogtypeMatch::Always;
+}
+
+auto ClpStringMatcher::matches_logtype(
+        std::vector<LogtypeToken> const& logtype,
+        bool variables_match_anything
+) const -> bool {
+    // `reachable[i]` records whether the first `i` pattern tokens can match the logtype tokens
+    // before the current one.
+    auto const pattern_size{m_pattern.size()};
+    std::vector<uint8_t> reachable(pattern_size + 1, 0);
+    std::vector<uint8_t> next_reachable(pattern_size + 1, 0);
+    reachable[0] = 1;
+    for (size_t logtype_ix{0}; true; ++logtype_ix) {
+        auto const is_end{logtype.size() == logtype_ix};
+        auto const is_variable{false == is_end && logtype[logtype_ix].is_variable};
+
+        // Match pattern tokens without consuming the current logtype token: `*` can match nothing,
+        // and a variable can match any pattern token if `variables_match_anything` is set.
+        for (size_t i{0}; i < pattern_size; ++i) {
+            if (0 != reachable[i]
+                && (PatternTokenType::AnyString == m_pattern[i].type
+                    || (is_variable && variables_match_anything)))
+            {
+                reachable[i + 1] = 1;
+            }
+        }
+        if (is_end) {
+            return 0 != reachable[pattern_size];
+        }
+
+        // Consume the current logtype token.
+        std::fill(next_reachable.begin(), next_reachable.end(), 0);
+        for (size_t i{0}; i <= pattern_size; ++i) {
+            if (0 == reachable[i]) {
+                continue;
+            }
+            auto const is_any_string{
+                    i < pattern_size && PatternTokenType::AnyString == m_pattern[i].type
+            };
+            if (is_variable) {
+                if (variables_match_anything || is_any_string) {
+                    next_reachable[i] = 1;
+                }
+                continue;
+            }
+            if (is_any_string) {
+                next_reachable[i] = 1;
+            } else if (i < pattern_size
+                       && (PatternTokenType::AnyChar == m_pattern[i].type
+                           || m_pattern[i].c == logtype[logtype_ix].c))
+            {
+                next_reachable[i + 1] = 1;
+            }
+        }
+        std::swap(reachable, next_reachable);
+        if (std::ranges::none_of(reachable, [](uint8_t r) { return 0 != r; })) {
+            return false;
+        }
+    }
+}
+}  // namespace clp_s::search
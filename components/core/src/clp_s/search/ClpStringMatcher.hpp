@@ -0,0 +1,154 @@
+#ifndef CLP_S_SEARCH_CLPSTRINGMATCHER_HPP
+#define CLP_S_SEARCH_CLPSTRINGMATCHER_HPP
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <clp/Query.hpp>
+#include <clp_s/ColumnReader.hpp>
+#include <clp_s/DictionaryEntry.hpp>
+
+namespace clp_s::search {
+/**
+ * Matches the values of CLP string columns against a query's search string and, if the query
+ * requires it, the query's regex.
+ *
+ * A value is only decoded if its logtype might match. Each logtype is compared against the search
+ * string once, treating each of its variables as an arbitrary string, which classifies the logtype
+ * as one of:
+ * - never matching, in which case its values are rejected without being decoded;
+ * - always matching (i.e., matching regardless of its variables' values), in which case its values
+ *   are accepted without being decoded, unless the query also requires a regex match;
+ * - possibly matching, in which case its values are matched against the search string as they're
+ *   decoded, one variable at a time, so that the variables after the point where the value is
+ *   known to match or not are never decoded.
+ *
+ * Values that must also match the query's regex, or that are searched for with a search string too
+ * long to match incrementally, are fully decoded before being matched.
+ */
+class ClpStringMatcher {
+public:
+    // Constructors
+    explicit ClpStringMatcher(clp::Query query);
+
+    // Methods
+    [[nodiscard]] auto get_query() const -> clp::Query const& { return m_query; }
+
+    /**
+     * @param reader
+     * @param cur_message
+     * @return Whether the value at `cur_message` in `reader` matches the query's search string
+     * (and regex, if the query requires one).
+     */
+    [[nodiscard]] auto matches(ClpStringColumnReader& reader, uint64_t cur_message) -> bool;
+
+private:
+    // Types
+    enum class LogtypeMatch : uint8_t {
+        Unknown = 0,
+        Never,
+        Maybe,
+        Always,
+    };
+
+    enum class PatternTokenType : uint8_t {
+        Char,
+        AnyChar,
+        AnyString,
+    };
+
+    struct PatternToken {
+        PatternTokenType type;
+        char c;
+    };
+
+    struct LogtypeToken {
+        bool is_variable;
+        char c;
+    };
+
+    // Constants
+    // The largest number of pattern tokens whose match states fit in a `uint64_t`, along with the
+    // state after the last token.
+    static constexpr size_t cMaxIncrementalPatternSize{63};
+
+    // Methods
+    /**
+     * Decodes the value at `cur_message` in `reader` one variable at a time, matching the search
+     * string against it as it's decoded.
+     * @param reader
+     * @param cur_message
+     * @return Whether the value matches the search string.
+     */
+    [[nodiscard]] auto matches_incrementally(ClpStringColumnReader& reader, uint64_t cur_message)
+            -> bool;
+
+    /**
+     * Advances the given pattern match states past the given text.
+     * @param text
+     * @param states A bit set where bit `i` indicates that the first `i` pattern tokens match the
+     * text consumed so far.
+     * @return The advanced states, which may be returned before consuming all of `text` if they
+     * show that the value never or always matches.
+     */
+    [[nodiscard]] auto consume(std::string_view text, uint64_t states) const -> uint64_t;
+
+    /**
+     * @param states
+     * @return The given pattern match states, plus the states reachable by having `*` tokens
+     * match nothing.
+     */
+    [[nodiscard]] auto add_empty_any_string_matches(uint64_t states) const -> uint64_t;
+
+    /**
+     * @param states
+     * @return Whether the given pattern match states show that the value never or always matches,
+     * regardless of the rest of the value.
+     */
+    [[nodiscard]] auto is_decided(uint64_t states) const -> bool {
+        return 0 == states || 0 != (states & m_any_string_suffix_mask);
+    }
+
+    /**
+     * @param entry
+     * @return How values with the given logtype can match the search string.
+     */
+    [[nodiscard]] auto classify_logtype(LogTypeDictionaryEntry const& entry) const -> LogtypeMatch;
+
+    /**
+     * Matches the search string against a tokenized logtype.
+     * @param logtype
+     * @param variables_match_anything Whether a variable may match any part of the search string,
+     * as opposed to only a part consisting of a single `*`.
+     * @return Whether the search string can match the logtype.
+     */
+    [[nodiscard]] auto matches_logtype(
+            std::vector<LogtypeToken> const& logtype,
+            bool variables_match_anything
+    ) const -> bool;
+
+    // Variables
+    clp::Query m_query;
+    std::vector<PatternToken> m_pattern;
+    std::string m_search_string;
+
+    // Bit masks over the pattern tokens, used to match values incrementally
+    bool m_can_match_incrementally{false};
+    // Indexed by character, with bit `i` set if the `i`-th pattern token matches the character
+    std::array<uint64_t, 256> m_char_masks{};
+    uint64_t m_any_string_mask{0};
+    // The `*` tokens at the end of the pattern, which match the rest of any value
+    uint64_t m_any_string_suffix_mask{0};
+    uint64_t m_match_mask{0};
+
+    // Indexed by logtype ID
+    std::vector<LogtypeMatch> m_logtype_matches;
+    std::string m_value;
+};
+}  // namespace clp_s::search
+
+#endif  // CLP_S_SEARCH_CLPSTRINGMATCHER_HPP
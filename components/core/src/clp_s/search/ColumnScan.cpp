@@ -3,16 +3,16 @@
 #include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <optional>
-#include <string>
-#include <unordered_set>
+#include <type_traits>
 #include <vector>
 
-#include <string_utils/string_utils.hpp>
-
 #include <clp/Query.hpp>
 #include <clp_s/ColumnReader.hpp>
+#include <clp_s/search/ClpStringMatcher.hpp>
+#include <clp_s/search/VariableIdSet.hpp>
 
 #include "ast/AndExpr.hpp"
 #include "ast/Expression.hpp"
@@ -52,6 +52,22 @@ template <typename T>
  */
 auto invert(ColumnScan::Bitmap& bitmap) -> void;
 
+/**
+ * Marks the messages whose value in an integer column satisfies the given comparison, by
+ * translating the comparison into ranges of values that are evaluated on the column's encoded
+ * values.
+ * @param reader Column reader to scan.
+ * @param operation Filter operation to apply.
+ * @param operand Operand from the filter expression.
+ * @param bitmap Bitmap in which to set the entries of matching messages.
+ */
+auto mark_matching_integers(
+        Int64ColumnReader const& reader,
+        FilterOperation operation,
+        int64_t operand,
+        ColumnScan::Bitmap& bitmap
+) -> void;
+
 /**
  * Builds a bitmap for a filter over a basic typed column.
  * @param num_messages Number of messages represented by the bitmap.
@@ -73,13 +89,15 @@ template <typename T>
 /**
  * Checks whether a CLP string value matches a query.
  * @param reader Column reader containing the value to check.
- * @param query Query to match against.
+ * @param matcher Matcher for the query to match against.
  * @param message_index Message index to check.
  * @return Whether the message index's string value matches the query.
  */
-[[nodiscard]] auto
-clp_string_matches(ClpStringColumnReader* reader, clp::Query const& query, uint64_t message_index)
-        -> bool;
+[[nodiscard]] auto clp_string_matches(
+        ClpStringColumnReader* reader,
+        ClpStringMatcher& matcher,
+        uint64_t message_index
+) -> bool;
 
 /**
  * Builds a bitmap for a filter over a CLP string column.
@@ -87,7 +105,7 @@ clp_string_matches(ClpStringColumnReader* reader, clp::Query const& query, uint6
  * @param reader_map Column readers keyed by column ID.
  * @param column_id ID of the column to scan.
  * @param operation Equality operation to apply.
- * @param query Query to match against.
+ * @param matcher Matcher for the query to match against.
  * @return A bitmap indexed by message number, with nonzero entries for matching messages.
  */
 [[nodiscard]] auto build_clp_string_filter(
@@ -95,7 +113,7 @@ clp_string_matches(ClpStringColumnReader* reader, clp::Query const& query, uint6
         ColumnScan::ClpStringReaderMap const& reader_map,
         int32_t column_id,
         FilterOperation operation,
-        clp::Query* query
+        ClpStringMatcher* matcher
 ) -> ColumnScan::Bitmap;
 
 /**
@@ -112,7 +130,7 @@ clp_string_matches(ClpStringColumnReader* reader, clp::Query const& query, uint6
         ColumnScan::VarStringReaderMap const& reader_map,
         int32_t column_id,
         FilterOperation operation,
-        std::unordered_set<int64_t> const& matching_vars
+        VariableIdSet const& matching_vars
 ) -> ColumnScan::Bitmap;
 
 /**
@@ -179,6 +197,49 @@ auto invert(ColumnScan::Bitmap& bitmap) -> void {
     }
 }
 
+auto mark_matching_integers(
+        Int64ColumnReader const& reader,
+        FilterOperation operation,
+        int64_t operand,
+        ColumnScan::Bitmap& bitmap
+) -> void {
+    constexpr auto cMin{std::numeric_limits<int64_t>::min()};
+    constexpr auto cMax{std::numeric_limits<int64_t>::max()};
+    switch (operation) {
+        case FilterOperation::EQ:
+            reader.mark_values_in_range(operand, operand, bitmap);
+            break;
+        case FilterOperation::NEQ:
+            if (operand > cMin) {
+                reader.mark_values_in_range(cMin, operand - 1, bitmap);
+            }
+            if (operand < cMax) {
+                reader.mark_values_in_range(operand + 1, cMax, bitmap);
+            }
+            break;
+        case FilterOperation::LT:
+            if (operand > cMin) {
+                reader.mark_values_in_range(cMin, operand - 1, bitmap);
+            }
+            break;
+        case FilterOperation::LTE:
+            reader.mark_values_in_range(cMin, operand, bitmap);
+            break;
+        case FilterOperation::GT:
+            if (operand < cMax) {
+                reader.mark_values_in_range(operand + 1, cMax, bitmap);
+            }
+            break;
+        case FilterOperation::GTE:
+            reader.mark_values_in_range(operand, cMax, bitmap);
+            break;
+        case FilterOperation::EXISTS:
+        case FilterOperation::NEXISTS:
+            reader.mark_values_in_range(cMin, cMax, bitmap);
+            break;
+    }
+}
+
 template <typename T>
 [[nodiscard]] auto build_basic_filter(
         uint64_t num_messages,
@@ -193,6 +254,14 @@ template <typename T>
         return bitmap;
     }
     for (auto* reader : readers->second) {
+        if constexpr (std::is_same_v<T, int64_t>) {
+            if (auto const* int_reader = dynamic_cast<Int64ColumnReader const*>(reader);
+                nullptr != int_reader)
+            {
+                mark_matching_integers(*int_reader, operation, operand, bitmap);
+                continue;
+            }
+        }
         for (uint64_t message_index{0}; message_index < num_messages; ++message_index) {
             auto const value = std::get<T>(reader->extract_value(message_index));
             bitmap[message_index] |= compare(operation, value, operand) ? 1 : 0;
@@ -201,23 +270,14 @@ template <typename T>
     return bitmap;
 }
 
-[[nodiscard]] auto
-clp_string_matches(ClpStringColumnReader* reader, clp::Query const& query, uint64_t message_index)
-        -> bool {
-    std::optional<std::string> value;
-    auto const matches_wildcard = [&]() -> bool {
-        if (false == value.has_value()) {
-            value.emplace(std::get<std::string>(reader->extract_value(message_index)));
-        }
-        return clp::string_utils::wildcard_match_unsafe(
-                value.value(),
-                query.get_search_string(),
-                false == query.get_ignore_case()
-        );
-    };
-
+[[nodiscard]] auto clp_string_matches(
+        ClpStringColumnReader* reader,
+        ClpStringMatcher& matcher,
+        uint64_t message_index
+) -> bool {
+    auto const& query{matcher.get_query()};
     if (false == query.contains_sub_queries()) {
-        return matches_wildcard();
+        return matcher.matches(*reader, message_index);
     }
 
     auto const encoded_id = reader->get_encoded_id(message_index);
@@ -228,10 +288,10 @@ clp_string_matches(ClpStringColumnReader* reader, clp::Query const& query, uint6
         {
             return false;
         }
-        if (false == subquery.wildcard_match_required()) {
+        if (false == subquery.wildcard_match_required() && false == query.regex_match_required()) {
             return true;
         }
-        return matches_wildcard();
+        return matcher.matches(*reader, message_index);
     });
 }
 
@@ -240,14 +300,15 @@ clp_string_matches(ClpStringColumnReader* reader, clp::Query const& query, uint6
         ColumnScan::ClpStringReaderMap const& reader_map,
         int32_t column_id,
         FilterOperation operation,
-        clp::Query* query
+        ClpStringMatcher* matcher
 ) -> ColumnScan::Bitmap {
     ColumnScan::Bitmap bitmap(num_messages, 0);
-    if (nullptr == query) {
+    if (nullptr == matcher) {
         std::fill(bitmap.begin(), bitmap.end(), FilterOperation::NEQ == operation ? 1 : 0);
         return bitmap;
     }
-    if (query->search_string_matches_all()) {
+    auto const& query{matcher->get_query()};
+    if (query.search_string_matches_all() && false == query.regex_match_required()) {
         std::fill(bitmap.begin(), bitmap.end(), FilterOperation::EQ == operation ? 1 : 0);
         return bitmap;
     }
@@ -257,7 +318,7 @@ clp_string_matches(ClpStringColumnReader* reader, clp::Query const& query, uint6
     }
     for (auto* reader : readers->second) {
         for (uint64_t message_index{0}; message_index < num_messages; ++message_index) {
-            auto const matched = clp_string_matches(reader, *query, message_index);
+            auto const matched = clp_string_matches(reader, *matcher, message_index);
             bitmap[message_index] |= ((FilterOperation::EQ == operation) == matched) ? 1 : 0;
         }
     }
@@ -269,20 +330,19 @@ clp_string_matches(ClpStringColumnReader* reader, clp::Query const& query, uint6
         ColumnScan::VarStringReaderMap const& reader_map,
         int32_t column_id,
         FilterOperation operation,
-        std::unordered_set<int64_t> const& matching_vars
+        VariableIdSet const& matching_vars
 ) -> ColumnScan::Bitmap {
     ColumnScan::Bitmap bitmap(num_messages, 0);
     auto const readers = reader_map.find(column_id);
     if (reader_map.end() == readers) {
         return bitmap;
     }
-    for (auto* reader : readers->second) {
-        for (uint64_t message_index{0}; message_index < num_messages; ++message_index) {
-            auto const matched = matching_vars.contains(
-                    static_cast<int64_t>(reader->get_variable_id(message_index))
-            );
-            bitmap[message_index] |= ((FilterOperation::EQ == operation) == matched) ? 1 : 0;
-        }
+    auto const is_equality{FilterOperation::EQ == operation};
+    for (auto const* reader : readers->second) {
+        reader->mark_matching_variable_ids(
+                [&](uint64_t id) { return is_equality == matching_vars.contains(id); },
+                bitmap
+        );
     }
     return bitmap;
 }
@@ -600,13 +660,13 @@ auto ColumnScan::build_filter(
             );
         }
         case LiteralType::ClpStringT: {
-            auto* const query = clp_queries.at(filter);
+            auto* const matcher = clp_queries.at(filter);
             return build_clp_string_filter(
                     m_num_messages,
                     clp_string_readers,
                     column_id,
                     operation,
-                    query
+                    matcher
             );
         }
         case LiteralType::VarStringT: {
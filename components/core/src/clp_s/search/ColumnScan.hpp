@@ -5,12 +5,12 @@
 #include <memory>
 #include <optional>
 #include <unordered_map>
-#include <unordered_set>
 #include <vector>
 
-#include <clp/Query.hpp>
 #include <clp_s/ColumnReader.hpp>
 #include <clp_s/SchemaReader.hpp>
+#include <clp_s/search/ClpStringMatcher.hpp>
+#include <clp_s/search/VariableIdSet.hpp>
 #include <clp_s/search/ast/Expression.hpp>
 #include <clp_s/search/ast/FilterExpr.hpp>
 
@@ -23,8 +23,8 @@ public:
     using VarStringReaderMap
             = std::unordered_map<int32_t, std::vector<VariableStringColumnReader*>>;
     using TimestampReaderMap = std::unordered_map<int32_t, TimestampColumnReader*>;
-    using ClpQueryMap = std::unordered_map<ast::Expression*, clp::Query*>;
-    using VarMatchMap = std::unordered_map<ast::Expression*, std::unordered_set<int64_t>*>;
+    using ClpQueryMap = std::unordered_map<ast::Expression*, ClpStringMatcher*>;
+    using VarMatchMap = std::unordered_map<ast::Expression*, VariableIdSet*>;
 
     /**
      * Attempts to build a column scan for the given expression over the given ERT.
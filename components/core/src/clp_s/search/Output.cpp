@@ -1,9 +1,15 @@
 #include "Output.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <memory>
+#include <optional>
+#include <utility>
 #include <vector>
 
 #include <spdlog/spdlog.h>
+#include <utils/profiling/Counter.hpp>
+#include <utils/profiling/ScopedProfiler.hpp>
 
 #include "../../clp/type_utils.hpp"
 #include "../SchemaTree.hpp"
@@ -81,6 +87,19 @@ bool Output::filter() {
         return true;
     }
 
+    // When the output handler only keeps the latest results, search the tables that may contain
+    // the latest records first, so that the remaining tables (or the whole archive) can be skipped
+    // once they can't contain records newer than the results found so far.
+    std::vector<epochtime_t> schema_latest_timestamps;
+    if (m_output_handler->keeps_latest_results_only()) {
+        schema_latest_timestamps = order_schemas_by_latest_timestamp(matched_schemas);
+        if (is_at_or_below_timestamp_lower_bound(schema_latest_timestamps.front())) {
+            m_termination_stage = cTerminationStageLatestResultsPruning;
+            m_archive_reader->close();
+            return true;
+        }
+    }
+
     m_archive_reader->read_variable_dictionary();
     m_archive_reader->read_log_type_dictionary();
 
@@ -98,24 +117,53 @@ bool Output::filter() {
     std::string message;
     auto const archive_id = m_archive_reader->get_archive_id();
     bool scanned_any_ert{false};
-    for (int32_t schema_id : matched_schemas) {
+    bool pruned_remaining_schemas{false};
+    for (size_t i{0}; i < matched_schemas.size(); ++i) {
+        auto const schema_id{matched_schemas[i]};
+        if (false == schema_latest_timestamps.empty()
+            && is_at_or_below_timestamp_lower_bound(schema_latest_timestamps[i]))
+        {
+            // The schemas are ordered by their latest timestamp, so none of the remaining schemas
+            // can contain newer records either.
+            pruned_remaining_schemas = true;
+            break;
+        }
+        [[maybe_unused]] auto const num_table_records{
+                m_archive_reader->get_num_messages_for_schema(schema_id)
+        };
         if (EvaluatedValue::False == m_query_runner.schema_init(schema_id)) {
+            PROFILE_COUNT("records_pruned_by_schema_init", num_table_records);
+            continue;
+        }
+        if (false == m_query_runner.packed_stream_may_contain_matches(schema_id)) {
+            PROFILE_COUNT("records_pruned_by_packed_stream_index", num_table_records);
+            ++m_result_metrics.num_schemas_pruned_by_packed_stream_index;
             continue;
         }
         scanned_any_ert = true;
 
+        PROFILE_SCOPE("scan_schema_table");
         auto& reader = m_archive_reader->read_schema_table(
                 schema_id,
                 m_output_handler->should_output_metadata(),
                 m_should_marshal_records
         );
         auto& filter = m_query_runner.prepare_filter(reader);
+        [[maybe_unused]] auto const num_matching_records_before_scan{
+                m_result_metrics.num_archive_records_matching_query
+        };
 
         bool schema_has_match{false};
         if (m_output_handler->should_output_metadata()) {
             epochtime_t timestamp{};
             int64_t log_event_idx{};
-            while (reader.get_next_message_with_metadata(message, timestamp, log_event_idx, filter))
+            while (reader.get_next_message_with_metadata(
+                    message,
+                    timestamp,
+                    log_event_idx,
+                    filter,
+                    m_output_handler->get_timestamp_lower_bound()
+            ))
             {
                 schema_has_match = true;
                 ++m_result_metrics.num_archive_records_matching_query;
@@ -131,6 +179,17 @@ bool Output::filter() {
         if (schema_has_match) {
             ++m_result_metrics.num_schemas_with_matches;
         }
+        [[maybe_unused]] auto const num_table_matching_records{
+                m_result_metrics.num_archive_records_matching_query
+                - num_matching_records_before_scan
+        };
+        if (m_query_runner.uses_column_scan()) {
+            PROFILE_COUNT("records_scanned_by_column_scan", num_table_records);
+            PROFILE_COUNT("records_matched_by_column_scan", num_table_matching_records);
+        } else {
+            PROFILE_COUNT("records_scanned_by_row_filter", num_table_records);
+            PROFILE_COUNT("records_matched_by_row_filter", num_table_matching_records);
+        }
         auto ecode = m_output_handler->flush();
         if (ErrorCode::ErrorCodeSuccess != ecode) {
             SPDLOG_ERROR(
@@ -140,8 +199,13 @@ bool Output::filter() {
             return false;
         }
     }
-    m_termination_stage
-            = scanned_any_ert ? cTerminationStageErtScan : cTerminationStageDictionarySearch;
+    if (scanned_any_ert) {
+        m_termination_stage = cTerminationStageErtScan;
+    } else if (pruned_remaining_schemas) {
+        m_termination_stage = cTerminationStageLatestResultsPruning;
+    } else {
+        m_termination_stage = cTerminationStageDictionarySearch;
+    }
     auto ecode = m_output_handler->finish();
     if (ErrorCode::ErrorCodeSuccess != ecode) {
         SPDLOG_ERROR(
@@ -152,4 +216,44 @@ bool Output::filter() {
     }
     return true;
 }
+
+auto Output::order_schemas_by_latest_timestamp(std::vector<int32_t>& schema_ids)
+        -> std::vector<epochtime_t> {
+    // Per-table time ranges aren't stored in the archive, so the latest timestamp of a table with
+    // the authoritative timestamp column is bounded by the end of the column's range. Records in
+    // tables without the column are reported with a timestamp of 0.
+    auto const timestamp_dict{m_archive_reader->get_timestamp_dictionary()};
+    auto const authoritative_timestamp_end{timestamp_dict->get_authoritative_timestamp_end()};
+    auto const& timestamp_column_ids{timestamp_dict->get_authoritative_timestamp_column_ids()};
+    auto const schema_map{m_archive_reader->get_schema_map()};
+
+    std::vector<std::pair<epochtime_t, int32_t>> latest_timestamp_and_schema_ids;
+    latest_timestamp_and_schema_ids.reserve(schema_ids.size());
+    for (auto const schema_id : schema_ids) {
+        epochtime_t latest_timestamp{0};
+        if (authoritative_timestamp_end.has_value()) {
+            for (auto const column_id : schema_map->at(schema_id)) {
+                if (timestamp_column_ids.contains(column_id)) {
+                    latest_timestamp = authoritative_timestamp_end.value();
+                    break;
+                }
+            }
+        }
+        latest_timestamp_and_schema_ids.emplace_back(latest_timestamp, schema_id);
+    }
+    std::stable_sort(
+            latest_timestamp_and_schema_ids.begin(),
+            latest_timestamp_and_schema_ids.end(),
+            [](auto const& lhs, auto const& rhs) { return lhs.first > rhs.first; }
+    );
+
+    std::vector<epochtime_t> latest_timestamps;
+    latest_timestamps.reserve(schema_ids.size());
+    schema_ids.clear();
+    for (auto const& [latest_timestamp, schema_id] : latest_timestamp_and_schema_ids) {
+        latest_timestamps.emplace_back(latest_timestamp);
+        schema_ids.emplace_back(schema_id);
+    }
+    return latest_timestamps;
+}
 }  // namespace clp_s::search
@@ -2,6 +2,7 @@
 #define CLP_S_SEARCH_OUTPUT_HPP
 
 #include <map>
+#include <optional>
 #include <set>
 #include <stack>
 #include <string>
@@ -9,6 +10,7 @@
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
+#include <vector>
 
 #include <clp_s/search/SearchTelemetry.hpp>
 
@@ -56,6 +58,14 @@ public:
         return m_result_metrics;
     }
 
+    /**
+     * @return The predicate orders chosen for the schemas searched during the last call to
+     * `filter`.
+     */
+    [[nodiscard]] auto get_predicate_order_metrics() const -> PredicateOrderMetrics const& {
+        return m_query_runner.get_predicate_order_metrics();
+    }
+
     /**
      * @return The stage at which the last call to `filter` stopped processing the archive.
      */
@@ -63,7 +73,33 @@ public:
         return m_termination_stage;
     }
 
+    /**
+     * @return The output handler's timestamp lower bound after the last call to `filter`.
+     */
+    [[nodiscard]] auto get_timestamp_lower_bound() const -> std::optional<epochtime_t> {
+        return m_output_handler->get_timestamp_lower_bound();
+    }
+
 private:
+    // Methods
+    /**
+     * Orders the given schemas by the latest timestamp any of their records may have, newest first.
+     * @param schema_ids
+     * @return The latest timestamp each of the reordered schemas' records may have.
+     */
+    auto order_schemas_by_latest_timestamp(std::vector<int32_t>& schema_ids)
+            -> std::vector<epochtime_t>;
+
+    /**
+     * @param timestamp
+     * @return Whether a record with the given timestamp can't change the output handler's output.
+     */
+    [[nodiscard]] auto is_at_or_below_timestamp_lower_bound(epochtime_t timestamp) const -> bool {
+        auto const lower_bound{m_output_handler->get_timestamp_lower_bound()};
+        return lower_bound.has_value() && timestamp <= lower_bound.value();
+    }
+
+    // Variables
     QueryRunner m_query_runner;
     std::shared_ptr<ArchiveReader> m_archive_reader;
     std::shared_ptr<ast::Expression> m_expr;
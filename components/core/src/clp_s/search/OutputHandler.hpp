@@ -1,6 +1,7 @@
 #ifndef CLP_S_SEARCH_OUTPUTHANDLER_HPP
 #define CLP_S_SEARCH_OUTPUTHANDLER_HPP
 
+#include <optional>
 #include <string_view>
 #include <vector>
 
@@ -54,6 +55,22 @@ public:
      */
     [[nodiscard]] virtual auto finish() -> ErrorCode { return ErrorCode::ErrorCodeSuccess; }
 
+    /**
+     * Output handlers that only keep the results with the latest timestamps can use this to let
+     * the search skip records, tables, and archives that can't change their output.
+     * @return A timestamp such that any record with a timestamp less than or equal to it won't
+     * change the output, or std::nullopt if any record may change the output.
+     */
+    [[nodiscard]] virtual auto get_timestamp_lower_bound() const -> std::optional<epochtime_t> {
+        return std::nullopt;
+    }
+
+    /**
+     * @return Whether the handler only keeps the results with the latest timestamps, in which case
+     * the search may visit tables in any order.
+     */
+    [[nodiscard]] virtual auto keeps_latest_results_only() const -> bool { return false; }
+
     [[nodiscard]] auto should_output_metadata() const -> bool { return m_should_output_metadata; }
 
     [[nodiscard]] auto should_marshal_records() const -> bool { return m_should_marshal_records; }
@@ -0,0 +1,142 @@
+#include "QueryPlanCache.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include "../archive_constants.hpp"
+#include "../ArchiveReader.hpp"
+#include "../ReaderUtils.hpp"
+#include "../SchemaTree.hpp"
+#include "ast/Expression.hpp"
+#include "ast/FilterExpr.hpp"
+
+namespace clp_s::search {
+namespace {
+/**
+ * Combines `value` into `hash` using the boost::hash_combine mixing constant.
+ * @param hash
+ * @param value
+ */
+auto combine_hash(size_t& hash, size_t value) -> void;
+
+/**
+ * @param schema_tree
+ * @param schema_map
+ * @return A fingerprint of the given schema tree and schema map.
+ */
+auto compute_fingerprint(SchemaTree const& schema_tree, ReaderUtils::SchemaMap const& schema_map)
+        -> size_t;
+
+/**
+ * @param lhs
+ * @param rhs
+ * @return Whether the two schema trees have identical nodes.
+ */
+auto schema_trees_are_equal(SchemaTree const& lhs, SchemaTree const& rhs) -> bool;
+
+auto combine_hash(size_t& hash, size_t value) -> void {
+    constexpr size_t cHashMixingConstant{0x9e37'79b9ULL};
+    hash ^= value + cHashMixingConstant + (hash << 6) + (hash >> 2);
+}
+
+auto compute_fingerprint(SchemaTree const& schema_tree, ReaderUtils::SchemaMap const& schema_map)
+        -> size_t {
+    size_t fingerprint{0ULL};
+    for (auto const& node : schema_tree.get_nodes()) {
+        combine_hash(fingerprint, std::hash<int32_t>{}(node.get_parent_id()));
+        combine_hash(fingerprint, std::hash<size_t>{}(static_cast<size_t>(node.get_type())));
+        combine_hash(fingerprint, std::hash<std::string_view>{}(node.get_key_name()));
+    }
+    for (auto const& [schema_id, schema] : schema_map) {
+        combine_hash(fingerprint, std::hash<int32_t>{}(schema_id));
+        for (auto const node_id : schema) {
+            combine_hash(fingerprint, std::hash<int32_t>{}(node_id));
+        }
+    }
+    return fingerprint;
+}
+
+auto schema_trees_are_equal(SchemaTree const& lhs, SchemaTree const& rhs) -> bool {
+    auto const& lhs_nodes{lhs.get_nodes()};
+    auto const& rhs_nodes{rhs.get_nodes()};
+    if (lhs_nodes.size() != rhs_nodes.size()) {
+        return false;
+    }
+    for (size_t i{0}; i < lhs_nodes.size(); ++i) {
+        auto const& lhs_node{lhs_nodes[i]};
+        auto const& rhs_node{rhs_nodes[i]};
+        if (lhs_node.get_parent_id() != rhs_node.get_parent_id()
+            || lhs_node.get_type() != rhs_node.get_type()
+            || lhs_node.get_key_name() != rhs_node.get_key_name())
+        {
+            return false;
+        }
+    }
+    return true;
+}
+}  // namespace
+
+QueryPlanCache::Key::Key(ArchiveReader& archive_reader)
+        : m_schema_tree{archive_reader.get_schema_tree()},
+          m_schema_map{archive_reader.get_schema_map()},
+          m_authoritative_timestamp_column{archive_reader.get_timestamp_dictionary()
+                                                   ->get_authoritative_timestamp_tokenized_column()
+          },
+          m_has_deprecated_timestamp_format{archive_reader.has_deprecated_timestamp_format()},
+          m_fingerprint{compute_fingerprint(*m_schema_tree, *m_schema_map)} {}
+
+auto QueryPlanCache::Key::operator==(Key const& rhs) const -> bool {
+    if (m_fingerprint != rhs.m_fingerprint
+        || m_has_deprecated_timestamp_format != rhs.m_has_deprecated_timestamp_format
+        || m_authoritative_timestamp_column != rhs.m_authoritative_timestamp_column)
+    {
+        return false;
+    }
+    if (m_schema_tree != rhs.m_schema_tree
+        && false == schema_trees_are_equal(*m_schema_tree, *rhs.m_schema_tree))
+    {
+        return false;
+    }
+    return m_schema_map == rhs.m_schema_map || *m_schema_map == *rhs.m_schema_map;
+}
+
+auto QueryPlanCache::is_cacheable(std::shared_ptr<ast::Expression> const& normalized_expr)
+        -> bool {
+    std::vector<ast::Expression*> work_list{normalized_expr.get()};
+    while (false == work_list.empty()) {
+        auto* cur_expr{work_list.back()};
+        work_list.pop_back();
+        if (cur_expr->has_only_expression_operands()) {
+            for (auto it{cur_expr->op_begin()}; cur_expr->op_end() != it; ++it) {
+                work_list.emplace_back(static_cast<ast::Expression*>(it->get()));
+            }
+        } else if (auto* filter_expr{dynamic_cast<ast::FilterExpr*>(cur_expr)};
+                   nullptr != filter_expr)
+        {
+            if (constants::cRangeIndexNamespace == filter_expr->get_column()->get_namespace()) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+auto QueryPlanCache::find(Key const& key) -> std::shared_ptr<Plan const> {
+    auto const it{m_key_to_plan.find(key)};
+    if (m_key_to_plan.end() == it) {
+        ++m_metrics.num_misses;
+        return nullptr;
+    }
+    ++m_metrics.num_hits;
+    return it->second;
+}
+
+auto QueryPlanCache::insert(Key key, std::shared_ptr<Plan const> plan) -> void {
+    m_key_to_plan.insert_or_assign(std::move(key), std::move(plan));
+}
+}  // namespace clp_s::search
@@ -0,0 +1,111 @@
+#ifndef CLP_S_SEARCH_QUERYPLANCACHE_HPP
+#define CLP_S_SEARCH_QUERYPLANCACHE_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "../ArchiveReader.hpp"
+#include "../ReaderUtils.hpp"
+#include "../SchemaTree.hpp"
+#include "ast/Expression.hpp"
+#include "Projection.hpp"
+#include "SchemaMatch.hpp"
+
+namespace clp_s::search {
+/**
+ * A cache of query plans shared by the archives searched with a single query.
+ *
+ * Apart from the range index and timestamp index checks, planning a query for an archive only
+ * depends on the archive's schema tree, schema map, authoritative timestamp column, and timestamp
+ * format. Archives that agree on all of these (e.g., small archives compressed from the same kind
+ * of logs) can share a plan, so planning only needs to happen once per distinct archive shape.
+ *
+ * Plans are keyed by a fingerprint of the schema tree and schema map. Since fingerprints can
+ * collide, the key also holds the schema tree and schema map themselves, which are compared in
+ * full when fingerprints match.
+ *
+ * Cached plans are shared between searches, so callers must treat them as immutable.
+ */
+class QueryPlanCache {
+public:
+    // Types
+    /**
+     * The archive-independent result of planning a query.
+     */
+    struct Plan {
+        // The query after adding timestamp conditions and normalizing it
+        std::shared_ptr<ast::Expression> normalized_expr;
+        // The query after schema matching, or an `EmptyExpr` if no schemas matched
+        std::shared_ptr<ast::Expression> expr;
+        std::shared_ptr<SchemaMatch> schema_match;
+        // The resolved projection, or null if no schemas matched
+        std::shared_ptr<Projection> projection;
+    };
+
+    class Key {
+    public:
+        // Constructors
+        explicit Key(ArchiveReader& archive_reader);
+
+        // Methods
+        [[nodiscard]] auto get_fingerprint() const -> size_t { return m_fingerprint; }
+
+        [[nodiscard]] auto operator==(Key const& rhs) const -> bool;
+
+    private:
+        std::shared_ptr<SchemaTree> m_schema_tree;
+        std::shared_ptr<ReaderUtils::SchemaMap> m_schema_map;
+        std::optional<std::pair<std::vector<std::string>, std::string>>
+                m_authoritative_timestamp_column;
+        bool m_has_deprecated_timestamp_format{false};
+        size_t m_fingerprint{0ULL};
+    };
+
+    struct KeyHash {
+        auto operator()(Key const& key) const -> size_t { return key.get_fingerprint(); }
+    };
+
+    struct Metrics {
+        uint64_t num_hits{0ULL};
+        uint64_t num_misses{0ULL};
+    };
+
+    // Methods
+    /**
+     * @param normalized_expr
+     * @return Whether a plan for `normalized_expr` can be shared between archives. Queries that
+     * filter on the range index can't, since the range index is rewritten into per-archive log
+     * event index ranges before schema matching.
+     */
+    [[nodiscard]] static auto is_cacheable(std::shared_ptr<ast::Expression> const& normalized_expr)
+            -> bool;
+
+    /**
+     * @param key
+     * @return The plan cached for `key`, or null if no plan has been cached.
+     */
+    [[nodiscard]] auto find(Key const& key) -> std::shared_ptr<Plan const>;
+
+    /**
+     * Caches a plan, replacing any plan already cached for `key`.
+     * @param key
+     * @param plan
+     */
+    auto insert(Key key, std::shared_ptr<Plan const> plan) -> void;
+
+    [[nodiscard]] auto get_metrics() const -> Metrics const& { return m_metrics; }
+
+private:
+    // Variables
+    std::unordered_map<Key, std::shared_ptr<Plan const>, KeyHash> m_key_to_plan;
+    Metrics m_metrics;
+};
+}  // namespace clp_s::search
+
+#endif  // CLP_S_SEARCH_QUERYPLANCACHE_HPP
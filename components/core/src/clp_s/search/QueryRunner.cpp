@@ -1,11 +1,18 @@
 #include "QueryRunner.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <string_view>
 #include <utility>
 #include <vector>
 
 #include <log_surgeon/Lexer.hpp>
+#include <regex_utils/RegexMatcher.hpp>
 #include <string_utils/string_utils.hpp>
+#include <utils/profiling/ScopedProfiler.hpp>
 
 #include "../../clp/Defs.h"
 #include "../../clp/GrepCore.hpp"
@@ -21,6 +28,7 @@
 #include "ast/Literal.hpp"
 #include "ast/OrExpr.hpp"
 #include "ast/SearchUtils.hpp"
+#include "ClpStringMatcher.hpp"
 #include "ColumnScan.hpp"
 #include "EvaluateTimestampIndex.hpp"
 
@@ -41,6 +49,7 @@ using clp_s::search::ast::OrExpr;
 namespace clp_s::search {
 void QueryRunner::global_init() {
     populate_internal_columns();
+    PROFILE_SCOPE("dictionary_search");
     populate_string_queries(m_expr);
 }
 
@@ -59,6 +68,12 @@ auto QueryRunner::schema_init(int32_t schema_id) -> EvaluatedValue {
     }
 
     add_wildcard_columns_to_searched_columns();
+    if (EvaluatedValue::Unknown == m_expression_value) {
+        if (order_predicates(m_expr.get()).reordered) {
+            ++m_predicate_order_metrics.num_reordered_schemas;
+        }
+        m_predicate_order_metrics.orders.emplace(describe_predicate_order(m_expr.get()));
+    }
     return m_expression_value;
 }
 
@@ -139,6 +154,355 @@ auto QueryRunner::prepare_filter(SchemaReader& reader) -> FilterClass& {
     return *this;
 }
 
+auto QueryRunner::packed_stream_may_contain_matches(int32_t schema_id) const -> bool {
+    if (EvaluatedValue::Unknown != m_expression_value) {
+        return EvaluatedValue::False != m_expression_value;
+    }
+
+    auto const& index{m_archive_reader->get_packed_stream_dictionary_index()};
+    auto const stream_id{m_archive_reader->get_stream_id_for_schema(schema_id)};
+    if (stream_id >= index.logtype_ids.size()) {
+        return true;
+    }
+    return expression_may_match_packed_stream(
+            m_expr.get(),
+            index.logtype_ids[stream_id],
+            index.var_ids[stream_id]
+    );
+}
+
+auto QueryRunner::expression_may_match_packed_stream(
+        Expression* expr,
+        std::vector<uint64_t> const& logtype_ids,
+        std::vector<uint64_t> const& var_ids
+) const -> bool {
+    if (expr->is_inverted()) {
+        return true;
+    }
+
+    if (nullptr != dynamic_cast<AndExpr*>(expr)) {
+        return std::all_of(expr->op_begin(), expr->op_end(), [&](auto const& op) -> bool {
+            return expression_may_match_packed_stream(
+                    static_cast<Expression*>(op.get()),
+                    logtype_ids,
+                    var_ids
+            );
+        });
+    }
+    if (nullptr != dynamic_cast<OrExpr*>(expr)) {
+        return std::any_of(expr->op_begin(), expr->op_end(), [&](auto const& op) -> bool {
+            return expression_may_match_packed_stream(
+                    static_cast<Expression*>(op.get()),
+                    logtype_ids,
+                    var_ids
+            );
+        });
+    }
+
+    auto* filter = dynamic_cast<FilterExpr*>(expr);
+    if (nullptr == filter || FilterOperation::EQ != filter->get_operation()
+        || filter->get_column()->is_pure_wildcard())
+    {
+        return true;
+    }
+
+    auto const contains = [](std::vector<uint64_t> const& ids, uint64_t id) -> bool {
+        return std::binary_search(ids.begin(), ids.end(), id);
+    };
+    switch (filter->get_column()->get_literal_type()) {
+        case LiteralType::ClpStringT: {
+            auto const it{m_expr_clp_query.find(expr)};
+            if (m_expr_clp_query.end() == it || nullptr == it->second) {
+                return true;
+            }
+            auto const* q{&it->second->get_query()};
+            if (q->search_string_matches_all() || false == q->contains_sub_queries()) {
+                return true;
+            }
+            for (auto const& subquery : q->get_sub_queries()) {
+                auto const& possible_logtypes{subquery.get_possible_logtypes()};
+                if (std::none_of(
+                            possible_logtypes.begin(),
+                            possible_logtypes.end(),
+                            [&](auto logtype_id) {
+                                return contains(logtype_ids, static_cast<uint64_t>(logtype_id));
+                            }
+                    ))
+                {
+                    continue;
+                }
+
+                bool vars_may_match{true};
+                for (auto const& var : subquery.get_vars()) {
+                    if (false == var.is_dict_var()) {
+                        continue;
+                    }
+                    if (var.is_precise_var()) {
+                        vars_may_match = contains(var_ids, var.get_var_dict_id());
+                    } else {
+                        auto const& possible_var_ids{var.get_possible_var_dict_ids()};
+                        vars_may_match = std::any_of(
+                                possible_var_ids.begin(),
+                                possible_var_ids.end(),
+                                [&](auto var_id) { return contains(var_ids, var_id); }
+                        );
+                    }
+                    if (false == vars_may_match) {
+                        break;
+                    }
+                }
+                if (vars_may_match) {
+                    return true;
+                }
+            }
+            return false;
+        }
+        case LiteralType::VarStringT: {
+            auto const it{m_expr_var_match_map.find(expr)};
+            if (m_expr_var_match_map.end() == it || nullptr == it->second) {
+                return true;
+            }
+            return std::ranges::any_of(it->second->get_ids(), [&](uint64_t var_id) {
+                return contains(var_ids, var_id);
+            });
+        }
+        default:
+            return true;
+    }
+}
+
+auto QueryRunner::order_predicates(Expression* expr) -> PredicateEstimate {
+    auto const invert = [&](PredicateEstimate estimate) -> PredicateEstimate {
+        if (expr->is_inverted()) {
+            estimate.selectivity = 1.0 - estimate.selectivity;
+        }
+        return estimate;
+    };
+
+    auto* filter = dynamic_cast<FilterExpr*>(expr);
+    if (nullptr != filter) {
+        return invert(estimate_filter(filter));
+    }
+
+    bool const is_and{nullptr != dynamic_cast<AndExpr*>(expr)};
+    auto& op_list{expr->get_op_list()};
+    std::vector<std::pair<PredicateEstimate, std::shared_ptr<ast::Value>>> ops;
+    ops.reserve(op_list.size());
+    bool reordered{false};
+    for (auto const& op : op_list) {
+        auto const estimate{order_predicates(static_cast<Expression*>(op.get()))};
+        reordered |= estimate.reordered;
+        ops.emplace_back(estimate, op);
+    }
+
+    // Evaluating an AND (OR) stops at the first operand that's false (true), so operands are
+    // ordered by their cost per unit probability of stopping the evaluation. This ordering
+    // minimizes the expected evaluation cost when operands are independent.
+    auto const get_rank = [&](PredicateEstimate const& estimate) -> double {
+        constexpr double cMinStopProbability{1e-6};
+        auto const stop_probability{is_and ? 1.0 - estimate.selectivity : estimate.selectivity};
+        return estimate.cost / std::max(stop_probability, cMinStopProbability);
+    };
+    std::stable_sort(ops.begin(), ops.end(), [&](auto const& lhs, auto const& rhs) {
+        return get_rank(lhs.first) < get_rank(rhs.first);
+    });
+
+    PredicateEstimate result{.cost = 0.0, .selectivity = is_and ? 1.0 : 0.0, .reordered = false};
+    double continue_probability{1.0};
+    auto op_it{op_list.begin()};
+    for (auto const& [estimate, op] : ops) {
+        reordered |= op_it->get() != op.get();
+        *op_it++ = op;
+        result.cost += continue_probability * estimate.cost;
+        if (is_and) {
+            continue_probability *= estimate.selectivity;
+            result.selectivity *= estimate.selectivity;
+        } else {
+            continue_probability *= 1.0 - estimate.selectivity;
+            result.selectivity = 1.0 - continue_probability;
+        }
+    }
+    result.reordered = reordered;
+    return invert(result);
+}
+
+auto QueryRunner::estimate_filter(FilterExpr* filter) const -> PredicateEstimate {
+    // Relative costs of evaluating a filter on one record, by column type
+    constexpr double cNumericCost{1.0};
+    constexpr double cVarStringCost{2.0};
+    constexpr double cTimestampCost{2.0};
+    constexpr double cClpStringCost{8.0};
+    constexpr double cWildcardColumnCost{16.0};
+    constexpr double cArrayCost{64.0};
+
+    // Default selectivities, by operation
+    constexpr double cEqualitySelectivity{0.1};
+    constexpr double cRangeSelectivity{1.0 / 3};
+    constexpr double cExistsSelectivity{0.9};
+
+    double selectivity{0.5};
+    auto const op{filter->get_operation()};
+    switch (op) {
+        case FilterOperation::EQ:
+            selectivity = cEqualitySelectivity;
+            break;
+        case FilterOperation::NEQ:
+            selectivity = 1.0 - cEqualitySelectivity;
+            break;
+        case FilterOperation::LT:
+        case FilterOperation::GT:
+        case FilterOperation::LTE:
+        case FilterOperation::GTE:
+            selectivity = cRangeSelectivity;
+            break;
+        case FilterOperation::EXISTS:
+            selectivity = cExistsSelectivity;
+            break;
+        case FilterOperation::NEXISTS:
+            selectivity = 1.0 - cExistsSelectivity;
+            break;
+    }
+
+    // Refines the selectivity of an EQ or NEQ filter given the fraction of dictionary entries that
+    // can match it.
+    auto const apply_dictionary_match_fraction = [&](size_t num_matches, size_t num_entries) {
+        if (0 == num_entries || (FilterOperation::EQ != op && FilterOperation::NEQ != op)) {
+            return;
+        }
+        auto const fraction{std::min(
+                1.0,
+                static_cast<double>(num_matches) / static_cast<double>(num_entries)
+        )};
+        selectivity = FilterOperation::EQ == op ? fraction : 1.0 - fraction;
+    };
+
+    auto* column = filter->get_column().get();
+    if (column->is_pure_wildcard()) {
+        return {.cost = cWildcardColumnCost, .selectivity = selectivity, .reordered = false};
+    }
+
+    double cost{cNumericCost};
+    switch (column->get_literal_type()) {
+        case LiteralType::ClpStringT: {
+            cost = cClpStringCost;
+            auto const it{m_expr_clp_query.find(filter)};
+            if (m_expr_clp_query.end() == it || nullptr == it->second) {
+                break;
+            }
+            auto const* q{&it->second->get_query()};
+            if (q->search_string_matches_all()) {
+                apply_dictionary_match_fraction(1, 1);
+                break;
+            }
+            size_t num_possible_logtypes{0};
+            for (auto const& subquery : q->get_sub_queries()) {
+                num_possible_logtypes += subquery.get_possible_logtypes().size();
+            }
+            apply_dictionary_match_fraction(
+                    num_possible_logtypes,
+                    m_log_dict->get_entries().size()
+            );
+            break;
+        }
+        case LiteralType::VarStringT: {
+            cost = cVarStringCost;
+            auto const it{m_expr_var_match_map.find(filter)};
+            if (m_expr_var_match_map.end() != it && nullptr != it->second) {
+                apply_dictionary_match_fraction(
+                        it->second->size(),
+                        m_var_dict->get_entries().size()
+                );
+            }
+            break;
+        }
+        case LiteralType::TimestampT:
+            cost = cTimestampCost;
+            break;
+        case LiteralType::ArrayT:
+            cost = cArrayCost;
+            break;
+        default:
+            break;
+    }
+    return {.cost = cost, .selectivity = selectivity, .reordered = false};
+}
+
+auto QueryRunner::describe_predicate_order(Expression* expr) -> std::string {
+    std::string description{expr->is_inverted() ? "not " : ""};
+    auto* filter = dynamic_cast<FilterExpr*>(expr);
+    if (nullptr == filter) {
+        description += nullptr != dynamic_cast<AndExpr*>(expr) ? "and(" : "or(";
+        for (auto it{expr->op_begin()}; expr->op_end() != it; ++it) {
+            if (expr->op_begin() != it) {
+                description += ',';
+            }
+            description += describe_predicate_order(static_cast<Expression*>(it->get()));
+        }
+        description += ')';
+        return description;
+    }
+
+    auto const* column{filter->get_column().get()};
+    if (column->is_pure_wildcard()) {
+        description += "wildcard";
+    } else {
+        switch (column->get_literal_type()) {
+            case LiteralType::IntegerT:
+                description += "int";
+                break;
+            case LiteralType::FloatT:
+                description += "float";
+                break;
+            case LiteralType::ClpStringT:
+                description += "clp_string";
+                break;
+            case LiteralType::VarStringT:
+                description += "var_string";
+                break;
+            case LiteralType::BooleanT:
+                description += "bool";
+                break;
+            case LiteralType::ArrayT:
+                description += "array";
+                break;
+            case LiteralType::TimestampT:
+                description += "timestamp";
+                break;
+            default:
+                description += "unknown";
+                break;
+        }
+    }
+
+    switch (filter->get_operation()) {
+        case FilterOperation::EXISTS:
+            description += ":exists";
+            break;
+        case FilterOperation::NEXISTS:
+            description += ":nexists";
+            break;
+        case FilterOperation::EQ:
+            description += ":eq";
+            break;
+        case FilterOperation::NEQ:
+            description += ":neq";
+            break;
+        case FilterOperation::LT:
+            description += ":lt";
+            break;
+        case FilterOperation::GT:
+            description += ":gt";
+            break;
+        case FilterOperation::LTE:
+            description += ":lte";
+            break;
+        case FilterOperation::GTE:
+            description += ":gte";
+            break;
+    }
+    return description;
+}
+
 std::string& QueryRunner::get_cached_decompressed_unstructured_array(int32_t column_id) {
     auto it = m_extracted_unstructured_arrays.find(column_id);
     if (m_extracted_unstructured_arrays.end() != it) {
@@ -243,19 +607,19 @@ bool QueryRunner::evaluate_wildcard_filter(FilterExpr* expr, int32_t schema) {
             subtree_type.has_value() && constants::cMetadataSubtreeType == subtree_type.value()
     };
     if (column->matches_type(LiteralType::ClpStringT)) {
-        auto* q = m_expr_clp_query.at(expr);
+        auto* matcher = m_expr_clp_query.at(expr);
         for (auto const& entry : m_clp_string_readers) {
             if (false == matches_metadata && m_metadata_columns.contains(entry.first)) {
                 continue;
             }
-            if (evaluate_clp_string_filter(op, q, entry.second)) {
+            if (evaluate_clp_string_filter(op, matcher, entry.second)) {
                 return true;
             }
         }
     }
 
     if (column->matches_type(LiteralType::VarStringT)) {
-        std::unordered_set<int64_t>* matching_vars = m_expr_var_match_map[expr];
+        auto const* matching_vars = m_expr_var_match_map[expr];
         for (auto const& entry : m_var_string_readers) {
             if (false == matches_metadata && m_metadata_columns.contains(entry.first)) {
                 continue;
@@ -322,18 +686,18 @@ bool QueryRunner::evaluate_filter(FilterExpr* expr, int32_t schema) {
     auto* column = expr->get_column().get();
     int32_t column_id = column->get_column_id();
     auto literal = expr->get_operand();
-    clp::Query* q = nullptr;
-    std::unordered_set<int64_t>* matching_vars = nullptr;
+    ClpStringMatcher* matcher = nullptr;
+    VariableIdSet const* matching_vars = nullptr;
     switch (column->get_literal_type()) {
         case LiteralType::IntegerT:
             return evaluate_int_filter(expr->get_operation(), column_id, literal);
         case LiteralType::FloatT:
             return evaluate_float_filter(expr->get_operation(), column_id, literal);
         case LiteralType::ClpStringT:
-            q = m_expr_clp_query.at(expr);
+            matcher = m_expr_clp_query.at(expr);
             return evaluate_clp_string_filter(
                     expr->get_operation(),
-                    q,
+                    matcher,
                     m_clp_string_readers[column_id]
             );
         case LiteralType::VarStringT:
@@ -462,7 +826,7 @@ bool QueryRunner::evaluate_float_filter_core(FilterOperation op, double value, d
 
 bool QueryRunner::evaluate_clp_string_filter(
         FilterOperation op,
-        clp::Query* q,
+        ClpStringMatcher* matcher,
         std::vector<ClpStringColumnReader*> const& readers
 ) const {
     if (FilterOperation::EXISTS == op || FilterOperation::NEXISTS == op) {
@@ -473,11 +837,12 @@ bool QueryRunner::evaluate_clp_string_filter(
         return false;
     }
 
-    if (nullptr == q) {
+    if (nullptr == matcher) {
         return op == FilterOperation::NEQ;
     }
 
-    if (q->search_string_matches_all()) {
+    auto const* q{&matcher->get_query()};
+    if (q->search_string_matches_all() && false == q->regex_match_required()) {
         return op == FilterOperation::EQ;
     }
 
@@ -488,12 +853,8 @@ bool QueryRunner::evaluate_clp_string_filter(
         if (q->contains_sub_queries()) {
             for (auto const& subquery : q->get_sub_queries()) {
                 if (subquery.matches_logtype(id) && subquery.matches_vars(vars)) {
-                    if (subquery.wildcard_match_required()) {
-                        matched = clp::string_utils::wildcard_match_unsafe(
-                                std::get<std::string>(reader->extract_value(m_cur_message)),
-                                q->get_search_string(),
-                                !q->get_ignore_case()
-                        );
+                    if (q->regex_match_required() || subquery.wildcard_match_required()) {
+                        matched = matcher->matches(*reader, m_cur_message);
                     } else {
                         matched = true;
                     }
@@ -501,11 +862,7 @@ bool QueryRunner::evaluate_clp_string_filter(
                 }
             }
         } else {
-            matched = clp::string_utils::wildcard_match_unsafe(
-                    std::get<std::string>(reader->extract_value(m_cur_message)),
-                    q->get_search_string(),
-                    !q->get_ignore_case()
-            );
+            matched = matcher->matches(*reader, m_cur_message);
         }
 
         if ((op == FilterOperation::EQ) == matched) {
@@ -518,7 +875,7 @@ bool QueryRunner::evaluate_clp_string_filter(
 bool QueryRunner::evaluate_var_string_filter(
         FilterOperation op,
         std::vector<VariableStringColumnReader*> const& readers,
-        std::unordered_set<int64_t>* matching_vars
+        VariableIdSet const* matching_vars
 ) const {
     if (FilterOperation::EXISTS == op || FilterOperation::NEXISTS == op) {
         return true;
@@ -529,8 +886,7 @@ bool QueryRunner::evaluate_var_string_filter(
     }
 
     for (VariableStringColumnReader* reader : readers) {
-        int64_t id = reader->get_variable_id(m_cur_message);
-        bool matched = matching_vars->count(id) > 0;
+        bool matched = matching_vars->contains(reader->get_variable_id(m_cur_message));
 
         if ((FilterOperation::EQ == op) == matched) {
             return true;
@@ -539,6 +895,17 @@ bool QueryRunner::evaluate_var_string_filter(
     return false;
 }
 
+auto QueryRunner::array_search_string_matches(std::string_view value) const -> bool {
+    if (nullptr != m_array_search_regex) {
+        return m_array_search_regex->matches(value);
+    }
+    return clp::string_utils::wildcard_match_unsafe(
+            value,
+            m_array_search_string,
+            false == m_ignore_case
+    );
+}
+
 bool QueryRunner::evaluate_array_filter(
         FilterOperation op,
         DescriptorList const& unresolved_tokens,
@@ -556,6 +923,7 @@ bool QueryRunner::evaluate_array_filter(
     m_maybe_string = !(op == FilterOperation::EXISTS || op == FilterOperation::NEXISTS)
                      && (operand->as_var_string(m_array_search_string, op)
                          || operand->as_clp_string(m_array_search_string, op));
+    m_array_search_regex = operand->get_regex_matcher(false == m_ignore_case);
     double tmp_double;
     int64_t tmp_int;
     m_maybe_number = !(op == FilterOperation::EXISTS || op == FilterOperation::NEXISTS)
@@ -595,11 +963,7 @@ bool QueryRunner::evaluate_array_filter_value(
         } break;
         case simdjson::ondemand::json_type::string: {
             if (true == m_maybe_string && unresolved_tokens.size() == cur_idx
-                && clp::string_utils::wildcard_match_unsafe(
-                        item.get_string().value(),
-                        m_array_search_string,
-                        false == m_ignore_case
-                ))
+                && array_search_string_matches(item.get_string().value()))
             {
                 match = op == FilterOperation::EQ;
             }
@@ -707,6 +1071,7 @@ bool QueryRunner::evaluate_wildcard_array_filter(
     // duplicate effort on every item
     m_maybe_string = operand->as_var_string(m_array_search_string, op)
                      || operand->as_clp_string(m_array_search_string, op);
+    m_array_search_regex = operand->get_regex_matcher(false == m_ignore_case);
 
     return evaluate_wildcard_array_filter(array, op, operand);
 }
@@ -735,12 +1100,7 @@ bool QueryRunner::evaluate_wildcard_array_filter(
                 if (false == m_maybe_string) {
                     break;
                 }
-                if (clp::string_utils::wildcard_match_unsafe(
-                            item.get_string().value(),
-                            m_array_search_string,
-                            false == m_ignore_case
-                    ))
-                {
+                if (array_search_string_matches(item.get_string().value())) {
                     match |= op == FilterOperation::EQ;
                 }
                 break;
@@ -809,12 +1169,7 @@ bool QueryRunner::evaluate_wildcard_array_filter(
                 if (false == m_maybe_string) {
                     break;
                 }
-                if (clp::string_utils::wildcard_match_unsafe(
-                            item.get_string().value(),
-                            m_array_search_string,
-                            false == m_ignore_case
-                    ))
-                {
+                if (array_search_string_matches(item.get_string().value())) {
                     match |= op == FilterOperation::EQ;
                 }
                 break;
@@ -906,40 +1261,49 @@ void QueryRunner::populate_string_queries(std::shared_ptr<Expression> const& exp
         && !(filter->get_operation() == FilterOperation::EXISTS
              || filter->get_operation() == FilterOperation::NEXISTS))
     {
+        // A regex is searched for using its wildcard superset (the operand's string value), and
+        // the strings matching the superset are then verified against the regex.
+        auto const regex_matcher{filter->get_operand()->get_regex_matcher(false == m_ignore_case)};
+
         if (filter->get_column()->matches_type(LiteralType::ClpStringT)) {
             std::string query_string;
             filter->get_operand()->as_clp_string(query_string, filter->get_operation());
 
-            if (m_string_query_map.count(query_string)) {
+            auto key{get_string_query_key(*filter->get_operand(), query_string)};
+            if (m_string_query_map.count(key)) {
                 return;
             }
 
             // search on log type dictionary
             clp::epochtime_t placeholder_timestamp{};
             log_surgeon::lexers::ByteLexer placeholder_lexer;
-            m_string_query_map.emplace(
+            auto query_processing_result{clp::GrepCore::process_raw_query(
+                    *m_log_dict,
+                    *m_var_dict,
                     query_string,
-                    clp::GrepCore::process_raw_query(
-                            *m_log_dict,
-                            *m_var_dict,
-                            query_string,
-                            placeholder_timestamp,
-                            placeholder_timestamp,
-                            m_ignore_case,
-                            placeholder_lexer,
-                            true
-                    )
-            );
+                    placeholder_timestamp,
+                    placeholder_timestamp,
+                    m_ignore_case,
+                    placeholder_lexer,
+                    true
+            )};
+            std::optional<ClpStringMatcher> matcher;
+            if (query_processing_result.has_value()) {
+                query_processing_result->set_regex_matcher(regex_matcher);
+                matcher.emplace(std::move(query_processing_result.value()));
+            }
+            m_string_query_map.emplace(std::move(key), std::move(matcher));
         }
 
         if (filter->get_column()->matches_type(LiteralType::VarStringT)) {
             std::string query_string;
             filter->get_operand()->as_var_string(query_string, filter->get_operation());
-            if (m_string_var_match_map.count(query_string)) {
+            auto key{get_string_query_key(*filter->get_operand(), query_string)};
+            if (m_string_var_match_map.count(key)) {
                 return;
             }
 
-            std::unordered_set<int64_t>& matching_vars = m_string_var_match_map[query_string];
+            std::vector<uint64_t> matching_vars;
             if (false == ast::has_unescaped_wildcards(query_string)) {
                 auto const unescaped_query_string{clp::string_utils::unescape_string(query_string)};
                 auto const entries = m_var_dict->get_entry_matching_value(
@@ -948,7 +1312,7 @@ void QueryRunner::populate_string_queries(std::shared_ptr<Expression> const& exp
                 );
 
                 for (auto const& entry : entries) {
-                    matching_vars.insert(entry->get_id());
+                    matching_vars.push_back(entry->get_id());
                 }
             } else {
                 std::unordered_set<VariableDictionaryEntry const*> matching_entries;
@@ -958,13 +1322,26 @@ void QueryRunner::populate_string_queries(std::shared_ptr<Expression> const& exp
                         matching_entries
                 );
                 for (auto const& entry : matching_entries) {
-                    matching_vars.emplace(entry->get_id());
+                    if (nullptr != regex_matcher
+                        && false == regex_matcher->matches(entry->get_value()))
+                    {
+                        continue;
+                    }
+                    matching_vars.push_back(entry->get_id());
                 }
             }
+            m_string_var_match_map.emplace(std::move(key), VariableIdSet{std::move(matching_vars)});
         }
     }
 }
 
+auto QueryRunner::get_string_query_key(Literal const& literal, std::string query_string) const
+        -> StringQueryKey {
+    auto const regex_matcher{literal.get_regex_matcher(false == m_ignore_case)};
+    return {std::move(query_string),
+            nullptr == regex_matcher ? std::string{} : regex_matcher->get_regex()};
+}
+
 void QueryRunner::populate_internal_columns() {
     int32_t metadata_subtree_root_node_id = m_schema_tree->get_metadata_subtree_node_id();
     if (-1 == metadata_subtree_root_node_id) {
@@ -1117,10 +1494,11 @@ EvaluatedValue QueryRunner::constant_propagate(std::shared_ptr<Expression> const
                 // FIXME: throw
                 return EvaluatedValue::False;
             }
+            auto const key{get_string_query_key(*filter->get_operand(), filter_string)};
             if (filter->get_column()->matches_type(LiteralType::ClpStringT)) {
-                auto& query_processing_result = m_string_query_map.at(filter_string);
-                if (query_processing_result.has_value()) {
-                    m_expr_clp_query[expr.get()] = &(query_processing_result.value());
+                auto& matcher = m_string_query_map.at(key);
+                if (matcher.has_value()) {
+                    m_expr_clp_query[expr.get()] = &(matcher.value());
                     matches_clp_string = true;
                 } else {
                     m_expr_clp_query[expr.get()] = nullptr;
@@ -1128,7 +1506,7 @@ EvaluatedValue QueryRunner::constant_propagate(std::shared_ptr<Expression> const
                 has_clp_string = wildcard->matches_type(LiteralType::ClpStringT);
             }
             if (filter->get_column()->matches_type(LiteralType::VarStringT)) {
-                m_expr_var_match_map[expr.get()] = &m_string_var_match_map.at(filter_string);
+                m_expr_var_match_map[expr.get()] = &m_string_var_match_map.at(key);
                 has_var_string = wildcard->matches_type(LiteralType::VarStringT);
                 matches_var_string = !m_expr_var_match_map.at(expr.get())->empty();
             }
@@ -1170,9 +1548,11 @@ EvaluatedValue QueryRunner::constant_propagate(std::shared_ptr<Expression> const
             filter->get_operand()->as_clp_string(filter_string, filter->get_operation());
 
             // set up string query for this filter
-            auto& query_processing_result = m_string_query_map.at(filter_string);
-            if (query_processing_result.has_value()) {
-                m_expr_clp_query[expr.get()] = &(query_processing_result.value());
+            auto& matcher = m_string_query_map.at(
+                    get_string_query_key(*filter->get_operand(), filter_string)
+            );
+            if (matcher.has_value()) {
+                m_expr_clp_query[expr.get()] = &(matcher.value());
                 return EvaluatedValue::Unknown;
             } else {
                 m_expr_clp_query[expr.get()] = nullptr;
@@ -1191,7 +1571,9 @@ EvaluatedValue QueryRunner::constant_propagate(std::shared_ptr<Expression> const
             filter->get_operand()->as_var_string(filter_string, filter->get_operation());
 
             // set up string query for this filter
-            m_expr_var_match_map[expr.get()] = &m_string_var_match_map.at(filter_string);
+            m_expr_var_match_map[expr.get()] = &m_string_var_match_map.at(
+                    get_string_query_key(*filter->get_operand(), filter_string)
+            );
 
             // use string queries to potentially propagate known result
             if (m_expr_var_match_map.at(expr.get())->empty()) {
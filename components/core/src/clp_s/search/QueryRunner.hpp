@@ -9,6 +9,7 @@
 #include <set>
 #include <stack>
 #include <string>
+#include <string_view>
 #include <unordered_map>
 #include <unordered_set>
 #include <utility>
@@ -16,7 +17,10 @@
 
 #include <simdjson.h>
 
+#include <clp_s/search/ClpStringMatcher.hpp>
 #include <clp_s/search/ColumnScan.hpp>
+#include <clp_s/search/SearchTelemetry.hpp>
+#include <clp_s/search/VariableIdSet.hpp>
 
 #include "../../clp/Query.hpp"
 #include "../ArchiveReader.hpp"
@@ -82,7 +86,9 @@ public:
      * It clears any previous schema-specific data and initializes internal data structures required
      * for query execution based on the provided schema ID. Then it performs constant propagation on
      * the expression. If the expression evaluates to false, it returns EvaluatedValue::False.
-     * Otherwise, it sets the wildcard matching type mask.
+     * Otherwise, it sets the wildcard matching type mask and orders the expression's predicates by
+     * their estimated cost and selectivity so that evaluating a record can stop as early as
+     * possible.
      *
      * @param schema_id
      */
@@ -98,6 +104,31 @@ public:
      */
     [[nodiscard]] auto prepare_filter(SchemaReader& reader) -> FilterClass&;
 
+    /**
+     * @return Whether the filter selected by the last call to `prepare_filter` is a column scan
+     * rather than a row-by-row filter.
+     */
+    [[nodiscard]] auto uses_column_scan() const -> bool { return nullptr != m_column_scan; }
+
+    /**
+     * Checks whether the packed stream containing a given schema table can contain any records
+     * matching the query, based on the set of logtype and variable dictionary IDs that the archive
+     * records for each packed stream.
+     *
+     * Note: This method must be called after schema_init.
+     *
+     * @param schema_id
+     * @return false if no record in the schema table can match the query, and true otherwise.
+     */
+    [[nodiscard]] auto packed_stream_may_contain_matches(int32_t schema_id) const -> bool;
+
+    /**
+     * @return The predicate orders chosen by `schema_init` for all schemas initialized so far.
+     */
+    [[nodiscard]] auto get_predicate_order_metrics() const -> PredicateOrderMetrics const& {
+        return m_predicate_order_metrics;
+    }
+
 protected:
     // Methods inherited from FilterClass
     auto filter(uint64_t cur_message) -> bool override;
@@ -116,12 +147,27 @@ protected:
     void initialize_reader(int32_t column_id, BaseColumnReader* column_reader);
 
 private:
+    // A string query's search string and, if it's a regex query, its regex (or an empty string
+    // otherwise)
+    using StringQueryKey = std::pair<std::string, std::string>;
+
     enum class ExpressionType : uint8_t {
         And,
         Or,
         Filter
     };
 
+    /**
+     * The estimated cost of evaluating an expression on one record, and the estimated fraction of
+     * records for which it's true.
+     */
+    struct PredicateEstimate {
+        double cost;
+        double selectivity;
+        // Whether ordering the expression's predicates changed their order
+        bool reordered;
+    };
+
     std::shared_ptr<ArchiveReader> m_archive_reader;
     std::shared_ptr<ast::Expression> m_expr;
     std::shared_ptr<SchemaMatch> m_match;
@@ -139,10 +185,10 @@ private:
 
     std::shared_ptr<ReaderUtils::SchemaMap> m_schemas;
 
-    std::map<std::string, std::optional<clp::Query>> m_string_query_map;
-    std::map<std::string, std::unordered_set<int64_t>> m_string_var_match_map;
-    std::unordered_map<ast::Expression*, clp::Query*> m_expr_clp_query;
-    std::unordered_map<ast::Expression*, std::unordered_set<int64_t>*> m_expr_var_match_map;
+    std::map<StringQueryKey, std::optional<ClpStringMatcher>> m_string_query_map;
+    std::map<StringQueryKey, VariableIdSet> m_string_var_match_map;
+    std::unordered_map<ast::Expression*, ClpStringMatcher*> m_expr_clp_query;
+    std::unordered_map<ast::Expression*, VariableIdSet*> m_expr_var_match_map;
     std::unordered_map<int32_t, std::vector<ClpStringColumnReader*>> m_clp_string_readers;
     std::unordered_map<int32_t, std::vector<VariableStringColumnReader*>> m_var_string_readers;
     std::unordered_map<int32_t, TimestampColumnReader*> m_timestamp_readers;
@@ -164,9 +210,11 @@ private:
 
     simdjson::ondemand::parser m_array_parser;
     std::string m_array_search_string;
+    std::shared_ptr<clp::regex_utils::RegexMatcher const> m_array_search_regex;
     bool m_maybe_string{false};
     bool m_maybe_number{false};
     std::unique_ptr<ColumnScan> m_column_scan;
+    PredicateOrderMetrics m_predicate_order_metrics;
 
     /**
      * Initializes the variables. Init is called once for each schema after which filter is called
@@ -249,13 +297,13 @@ private:
     /**
      * Evaluates a clp string filter expression
      * @param op
-     * @param q
+     * @param matcher
      * @param readers
      * @return true if the expression evaluates to true, false otherwise
      */
     auto evaluate_clp_string_filter(
             ast::FilterOperation op,
-            clp::Query* q,
+            ClpStringMatcher* matcher,
             std::vector<ClpStringColumnReader*> const& readers
     ) const -> bool;
 
@@ -269,7 +317,7 @@ private:
     auto evaluate_var_string_filter(
             ast::FilterOperation op,
             std::vector<VariableStringColumnReader*> const& readers,
-            std::unordered_set<int64_t>* matching_vars
+            VariableIdSet const* matching_vars
     ) const -> bool;
 
     /**
@@ -364,6 +412,13 @@ private:
             std::shared_ptr<ast::Literal> const& operand
     ) const -> bool;
 
+    /**
+     * @param value
+     * @return Whether an array's string element matches the current array filter's regex, if any,
+     * or its search string otherwise.
+     */
+    [[nodiscard]] auto array_search_string_matches(std::string_view value) const -> bool;
+
     /**
      * Evaluates a wildcard array filter expression
      * @param op
@@ -416,12 +471,59 @@ private:
             std::shared_ptr<ast::Literal> const& operand
     ) -> bool;
 
+    /**
+     * Checks whether an expression can evaluate to true for records in a packed stream, given the
+     * dictionary IDs referenced by the stream. Only non-inverted equality filters on string columns
+     * can be ruled out; every other expression is conservatively assumed to match.
+     * @param expr
+     * @param logtype_ids The sorted logtype dictionary IDs referenced by the packed stream.
+     * @param var_ids The sorted variable dictionary IDs referenced by the packed stream.
+     * @return false if the expression can't match any record in the stream, and true otherwise.
+     */
+    auto expression_may_match_packed_stream(
+            ast::Expression* expr,
+            std::vector<uint64_t> const& logtype_ids,
+            std::vector<uint64_t> const& var_ids
+    ) const -> bool;
+
+    /**
+     * Orders the operands of every AND and OR expression in `expr` (recursively) so that the
+     * cheapest operands most likely to decide the expression's value are evaluated first.
+     * @param expr
+     * @return The estimate for `expr` after ordering.
+     */
+    auto order_predicates(ast::Expression* expr) -> PredicateEstimate;
+
+    /**
+     * Estimates a filter's cost from its column's type, and its selectivity from the fraction of
+     * dictionary entries it can match (for string columns) or its operation (otherwise).
+     * @param filter
+     * @return The estimate for `filter`, ignoring whether it's inverted.
+     */
+    [[nodiscard]] auto estimate_filter(ast::FilterExpr* filter) const -> PredicateEstimate;
+
+    /**
+     * @param expr
+     * @return A description of the evaluation order of `expr`'s predicates, using only their column
+     * types and operations.
+     */
+    [[nodiscard]] static auto describe_predicate_order(ast::Expression* expr) -> std::string;
+
     /**
      * Populates the string queries
      * @param expr
      */
     void populate_string_queries(std::shared_ptr<ast::Expression> const& expr);
 
+    /**
+     * @param literal
+     * @param query_string The literal's string value.
+     * @return The key of the literal's string query in `m_string_query_map` and
+     * `m_string_var_match_map`.
+     */
+    [[nodiscard]] auto get_string_query_key(ast::Literal const& literal, std::string query_string)
+            const -> StringQueryKey;
+
     /**
      * Populates the set of internal columns that get ignored during dynamic wildcard expansion.
      */
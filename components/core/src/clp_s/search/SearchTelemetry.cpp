@@ -11,6 +11,7 @@
 #include <vector>
 
 #include <opentelemetry/nostd/shared_ptr.h>
+#include <opentelemetry/nostd/span.h>
 #include <opentelemetry/nostd/string_view.h>
 #include <opentelemetry/trace/provider.h>
 #include <opentelemetry/trace/scope.h>
@@ -73,9 +74,17 @@ constexpr std::string_view cAttrNumArchiveRecordsMatchingQuery{
 };
 constexpr std::string_view cAttrNumMatchedSchemas{"clp.query.num_matched_schemas"};
 constexpr std::string_view cAttrNumSchemasWithMatches{"clp.query.num_schemas_with_matches"};
+constexpr std::string_view cAttrNumSchemasPrunedByPackedStreamIndex{
+        "clp.query.num_schemas_pruned_by_packed_stream_index"
+};
+constexpr std::string_view cAttrNumReorderedSchemas{
+        "clp.query.predicate_order.num_reordered_schemas"
+};
+constexpr std::string_view cAttrPredicateOrders{"clp.query.predicate_order.orders"};
 constexpr std::string_view cAttrTerminationStage{"clp.query.termination_stage"};
 
 constexpr std::string_view cAttrProfilerPhaseCallCountSuffix{".call_count"};
+constexpr std::string_view cAttrProfilerCounterSuffix{".count"};
 constexpr std::string_view cAttrProfilerPhaseDurationSuffix{".duration_millisecs"};
 
 /**
@@ -335,6 +344,29 @@ public:
                 to_nostd_string_view(cAttrNumSchemasWithMatches),
                 to_int64_attribute(metrics.num_schemas_with_matches)
         );
+        m_span->SetAttribute(
+                to_nostd_string_view(cAttrNumSchemasPrunedByPackedStreamIndex),
+                to_int64_attribute(metrics.num_schemas_pruned_by_packed_stream_index)
+        );
+    }
+
+    auto set_predicate_order_metrics(PredicateOrderMetrics const& metrics) -> void {
+        m_span->SetAttribute(
+                to_nostd_string_view(cAttrNumReorderedSchemas),
+                to_int64_attribute(metrics.num_reordered_schemas)
+        );
+        std::vector<opentelemetry::nostd::string_view> orders;
+        orders.reserve(metrics.orders.size());
+        for (auto const& order : metrics.orders) {
+            orders.emplace_back(to_nostd_string_view(order));
+        }
+        m_span->SetAttribute(
+                to_nostd_string_view(cAttrPredicateOrders),
+                opentelemetry::nostd::span<opentelemetry::nostd::string_view const>{
+                        orders.data(),
+                        orders.size()
+                }
+        );
     }
 
     auto set_termination_stage(std::string_view termination_stage) -> void {
@@ -357,6 +389,16 @@ public:
         );
     }
 
+    auto set_profiler_counter(std::string_view name, uint64_t value) -> void {
+        m_span->SetAttribute(
+                to_nostd_string_view(
+                        std::string{cTracerName} + "." + std::string{name}
+                        + std::string{cAttrProfilerCounterSuffix}
+                ),
+                to_int64_attribute(value)
+        );
+    }
+
 private:
     // Data members
     opentelemetry::nostd::shared_ptr<opentelemetry::trace::Span> m_span;
@@ -387,6 +429,11 @@ auto SearchTelemetrySpan::set_search_result_metrics(SearchResultMetrics const& m
     m_impl->set_search_result_metrics(metrics);
 }
 
+auto SearchTelemetrySpan::set_predicate_order_metrics(PredicateOrderMetrics const& metrics)
+        -> void {
+    m_impl->set_predicate_order_metrics(metrics);
+}
+
 auto SearchTelemetrySpan::set_termination_stage(std::string_view termination_stage) -> void {
     m_impl->set_termination_stage(termination_stage);
 }
@@ -398,6 +445,10 @@ auto SearchTelemetrySpan::set_profiler_measurement(
     m_impl->set_profiler_measurement(name, measurement);
 }
 
+auto SearchTelemetrySpan::set_profiler_counter(std::string_view name, uint64_t value) -> void {
+    m_impl->set_profiler_counter(name, value);
+}
+
 auto QueryShapeMetrics::create(
         std::shared_ptr<ast::Expression> const& expr,
         std::optional<epochtime_t> search_begin_ts,
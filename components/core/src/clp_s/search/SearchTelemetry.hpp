@@ -5,6 +5,8 @@
 #include <cstdint>
 #include <memory>
 #include <optional>
+#include <set>
+#include <string>
 #include <string_view>
 
 #include <utils/profiling/Stopwatch.hpp>
@@ -21,6 +23,7 @@ constexpr std::string_view cTerminationStageTimeRangeMatchingAfterColumnResoluti
 constexpr std::string_view cTerminationStageSchemaMatching{"schema_matching"};
 constexpr std::string_view cTerminationStageErtScan{"ert_scan"};
 constexpr std::string_view cTerminationStageDictionarySearch{"dictionary_search"};
+constexpr std::string_view cTerminationStageLatestResultsPruning{"latest_results_pruning"};
 
 /**
  * Counts of how the columns referenced by a query's predicates use wildcards.
@@ -81,6 +84,17 @@ struct SearchResultMetrics {
     uint64_t num_archive_records_matching_query{};
     uint64_t num_matched_schemas{};
     uint64_t num_schemas_with_matches{};
+    uint64_t num_schemas_pruned_by_packed_stream_index{};
+};
+
+/**
+ * The predicate evaluation orders chosen for the schemas searched in a single archive.
+ */
+struct PredicateOrderMetrics {
+    uint64_t num_reordered_schemas{};
+    // The distinct evaluation orders, described by predicate column types and operations (e.g.,
+    // `and(int:eq,clp_string:eq)`) so that no query content is recorded.
+    std::set<std::string> orders;
 };
 
 /**
@@ -140,6 +154,13 @@ public:
      */
     auto set_search_result_metrics(SearchResultMetrics const& metrics) -> void;
 
+    /**
+     * Records the predicate evaluation orders chosen while searching the archive.
+     *
+     * @param metrics
+     */
+    auto set_predicate_order_metrics(PredicateOrderMetrics const& metrics) -> void;
+
     /**
      * Records the stage at which the search stopped processing the archive.
      *
@@ -158,6 +179,14 @@ public:
     auto set_profiler_measurement(std::string_view name, utils::profiling::Measurement measurement)
             -> void;
 
+    /**
+     * Records the span attribute `<tracer name>.<name>.count`.
+     *
+     * @param name The profiler counter name.
+     * @param value
+     */
+    auto set_profiler_counter(std::string_view name, uint64_t value) -> void;
+
 private:
     // Types
     class Impl;
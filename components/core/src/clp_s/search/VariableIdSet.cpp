@@ -0,0 +1,21 @@
+#include "VariableIdSet.hpp"
+
+#include <algorithm>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+namespace clp_s::search {
+VariableIdSet::VariableIdSet(std::vector<uint64_t> ids) : m_ids{std::move(ids)} {
+    std::sort(m_ids.begin(), m_ids.end());
+    m_ids.erase(std::unique(m_ids.begin(), m_ids.end()), m_ids.end());
+    if (m_ids.size() <= cMaxSortedArraySize || m_ids.back() >= cMaxBitmapSize) {
+        return;
+    }
+
+    m_bitmap.resize(m_ids.back() + 1, 0);
+    for (auto const id : m_ids) {
+        m_bitmap[id] = 1;
+    }
+}
+}  // namespace clp_s::search
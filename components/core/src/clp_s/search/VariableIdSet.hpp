@@ -0,0 +1,61 @@
+#ifndef CLP_S_SEARCH_VARIABLEIDSET_HPP
+#define CLP_S_SEARCH_VARIABLEIDSET_HPP
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace clp_s::search {
+/**
+ * An immutable set of variable dictionary IDs, e.g., the IDs of the variables matching a string
+ * query, optimized for testing whether IDs read from a column are in the set.
+ *
+ * Small sets are stored as a sorted array, which is searched directly. Larger sets are also stored
+ * as a dense bitmap indexed by ID, so that each test is a single load, unless their largest ID
+ * would make the bitmap larger than `cMaxBitmapSize`.
+ */
+class VariableIdSet {
+public:
+    // Constants
+    // The largest set stored without a bitmap.
+    static constexpr size_t cMaxSortedArraySize{16};
+    // The size of the largest bitmap, in bytes (one per ID up to the set's largest ID).
+    static constexpr size_t cMaxBitmapSize{16ULL * 1024 * 1024};  // 16 MiB
+
+    // Constructors
+    VariableIdSet() = default;
+
+    /**
+     * @param ids The IDs in the set, in any order and possibly with duplicates.
+     */
+    explicit VariableIdSet(std::vector<uint64_t> ids);
+
+    // Methods
+    [[nodiscard]] auto empty() const -> bool { return m_ids.empty(); }
+
+    [[nodiscard]] auto size() const -> size_t { return m_ids.size(); }
+
+    /**
+     * @return The IDs in the set, in ascending order.
+     */
+    [[nodiscard]] auto get_ids() const -> std::vector<uint64_t> const& { return m_ids; }
+
+    /**
+     * @param id
+     * @return Whether `id` is in the set.
+     */
+    [[nodiscard]] auto contains(uint64_t id) const -> bool {
+        if (m_bitmap.empty()) {
+            return std::binary_search(m_ids.begin(), m_ids.end(), id);
+        }
+        return id < m_bitmap.size() && 0 != m_bitmap[id];
+    }
+
+private:
+    std::vector<uint64_t> m_ids;
+    std::vector<uint8_t> m_bitmap;
+};
+}  // namespace clp_s::search
+
+#endif  // CLP_S_SEARCH_VARIABLEIDSET_HPP
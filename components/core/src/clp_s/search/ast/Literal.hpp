@@ -3,12 +3,17 @@
 
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <string>
 #include <type_traits>
 
 #include "FilterOperation.hpp"
 #include "Value.hpp"
 
+namespace clp::regex_utils {
+class RegexMatcher;
+}  // namespace clp::regex_utils
+
 namespace clp_s::search::ast {
 /**
  * An enum representing all of the Literal types that can show up in the AST.
@@ -107,6 +112,17 @@ public:
     virtual bool as_timestamp() { return false; }
 
     virtual bool as_any(FilterOperation op) { return false; }
+
+    /**
+     * @param case_sensitive_match
+     * @return The regex that matching strings must contain a match for, or nullptr if the literal
+     * isn't a regex. A regex literal's string value (see `as_clp_string` and `as_var_string`) is a
+     * wildcard query matching a superset of the strings the regex matches.
+     */
+    [[nodiscard]] virtual auto get_regex_matcher(bool case_sensitive_match) const
+            -> std::shared_ptr<clp::regex_utils::RegexMatcher const> {
+        return nullptr;
+    }
 };
 }  // namespace clp_s::search::ast
 
@@ -167,6 +167,9 @@ auto unescape_kql_internal(std::string const& value, std::string& unescaped, boo
             case '#':
                 unescaped.push_back('#');
                 break;
+            case '/':
+                unescaped.push_back('/');
+                break;
             default:
                 return false;
         }
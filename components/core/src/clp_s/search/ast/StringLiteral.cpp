@@ -1,15 +1,40 @@
 #include "StringLiteral.hpp"
 
+#include <memory>
 #include <sstream>
+#include <string_view>
+
+#include <regex_utils/RegexMatcher.hpp>
+#include <ystdlib/error_handling/Result.hpp>
 
 #include "SearchUtils.hpp"
 
+using clp::regex_utils::RegexMatcher;
+
 namespace clp_s::search::ast {
 std::shared_ptr<Literal> StringLiteral::create(std::string const& v) {
     return std::shared_ptr<Literal>(static_cast<Literal*>(new StringLiteral(v)));
 }
 
+auto StringLiteral::create_regex(std::string_view regex)
+        -> ystdlib::error_handling::Result<std::shared_ptr<Literal>> {
+    auto regex_matcher{std::make_shared<RegexMatcher const>(
+            YSTDLIB_ERROR_HANDLING_TRYX(RegexMatcher::create(regex, false))
+    )};
+    auto case_insensitive_regex_matcher{std::make_shared<RegexMatcher const>(
+            YSTDLIB_ERROR_HANDLING_TRYX(RegexMatcher::create(regex, true))
+    )};
+    auto* literal{new StringLiteral(regex_matcher->get_wildcard_superset())};
+    literal->m_regex_matcher = std::move(regex_matcher);
+    literal->m_case_insensitive_regex_matcher = std::move(case_insensitive_regex_matcher);
+    return std::shared_ptr<Literal>(static_cast<Literal*>(literal));
+}
+
 void StringLiteral::print() const {
+    if (nullptr != m_regex_matcher) {
+        get_print_stream() << "/" << m_regex_matcher->get_regex() << "/";
+        return;
+    }
     get_print_stream() << "\"" << m_v << "\"";
 }
 
@@ -48,12 +73,18 @@ bool StringLiteral::as_var_string(std::string& ret, FilterOperation op) {
 }
 
 bool StringLiteral::as_float(double& ret, FilterOperation op) {
+    if (nullptr != m_regex_matcher) {
+        return false;
+    }
     std::istringstream ss(m_v);
     ss >> std::noskipws >> ret;
     return !ss.fail() && ss.eof();
 }
 
 bool StringLiteral::as_int(int64_t& ret, FilterOperation op) {
+    if (nullptr != m_regex_matcher) {
+        return false;
+    }
     std::istringstream ss(m_v);
     ss >> std::noskipws >> ret;
     if (false == ss.fail() && ss.eof()) {
@@ -75,6 +106,9 @@ bool StringLiteral::as_bool(bool& ret, FilterOperation op) {
     {
         return false;
     }
+    if (nullptr != m_regex_matcher) {
+        return false;
+    }
     if (m_v == "true") {
         ret = true;
         return true;
@@ -86,10 +120,13 @@ bool StringLiteral::as_bool(bool& ret, FilterOperation op) {
 }
 
 bool StringLiteral::as_null(FilterOperation op) {
-    return (op == FilterOperation::EQ || op == FilterOperation::NEQ) && m_v == "null";
+    return (op == FilterOperation::EQ || op == FilterOperation::NEQ) && nullptr == m_regex_matcher
+           && m_v == "null";
 }
 
 bool StringLiteral::as_any(FilterOperation op) {
-    return (op == FilterOperation::EQ || op == FilterOperation::NEQ) && m_v == "*";
+    // A regex literal whose superset is "*" doesn't necessarily match any string
+    return (op == FilterOperation::EQ || op == FilterOperation::NEQ) && nullptr == m_regex_matcher
+           && m_v == "*";
 }
 }  // namespace clp_s::search::ast
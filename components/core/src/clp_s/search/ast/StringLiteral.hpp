@@ -3,6 +3,10 @@
 
 #include <memory>
 #include <string>
+#include <string_view>
+#include <utility>
+
+#include <ystdlib/error_handling/Result.hpp>
 
 #include "Literal.hpp"
 #include "SearchUtils.hpp"
@@ -28,6 +32,18 @@ public:
      */
     static std::shared_ptr<Literal> create(std::string const& v);
 
+    /**
+     * Create a StringLiteral that matches strings containing a match for the given regex. The
+     * literal's string value is the regex's wildcard superset, so that it can be used to prune
+     * candidate strings before they're verified against the regex.
+     * @param regex
+     * @return A result containing the new StringLiteral on success, or an error code indicating the
+     * failure:
+     * - Forwards `clp::regex_utils::RegexMatcher::create`'s return values on failure.
+     */
+    static auto create_regex(std::string_view regex)
+            -> ystdlib::error_handling::Result<std::shared_ptr<Literal>>;
+
     /**
      * @return Reference to underlying string
      */
@@ -57,9 +73,17 @@ public:
 
     bool as_any(FilterOperation op) override;
 
+    [[nodiscard]] auto get_regex_matcher(bool case_sensitive_match) const
+            -> std::shared_ptr<clp::regex_utils::RegexMatcher const> override {
+        return case_sensitive_match ? m_regex_matcher : m_case_insensitive_regex_matcher;
+    }
+
 private:
     std::string m_v;
     literal_type_bitmask_t m_string_type;
+    // Only set for regex literals
+    std::shared_ptr<clp::regex_utils::RegexMatcher const> m_regex_matcher;
+    std::shared_ptr<clp::regex_utils::RegexMatcher const> m_case_insensitive_regex_matcher;
 
     // Constructor
     explicit StringLiteral(std::string v) : m_v(std::move(v)), m_string_type(0) {
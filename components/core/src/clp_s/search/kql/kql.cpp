@@ -1,7 +1,10 @@
 #include <any>
+#include <cstddef>
 #include <iostream>
+#include <optional>
 #include <stdexcept>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <antlr4-runtime.h>
@@ -154,6 +157,28 @@ public:
         }
     }
 
+    /**
+     * @param text An unquoted literal
+     * @return The body of the regex if `text` is a regex literal (i.e., it's surrounded by '/'), or
+     * std::nullopt otherwise. Escape sequences in the body are passed to the regex verbatim.
+     */
+    static std::optional<std::string> get_regex_body(std::string const& text) {
+        constexpr size_t cMinRegexLiteralLength{3};
+        if (text.length() < cMinRegexLiteralLength || '/' != text.front() || '/' != text.back()) {
+            return std::nullopt;
+        }
+        return text.substr(1, text.length() - 2);
+    }
+
+    static std::shared_ptr<Literal> create_regex_literal(std::string const& regex) {
+        auto result{StringLiteral::create_regex(regex)};
+        if (result.has_error()) {
+            SPDLOG_ERROR("Can not parse invalid regex /{}/: {}", regex, result.error().message());
+            throw std::runtime_error{"Invalid literal."};
+        }
+        return std::move(result.value());
+    }
+
     static std::shared_ptr<Literal> create_literal(std::string const& text) {
         std::string token;
         if (false == clp_s::search::ast::unescape_kql_value(text, token)) {
@@ -175,9 +200,13 @@ public:
     std::any visitLiteral(KqlParser::LiteralContext* ctx) override {
         if (nullptr != ctx->QUOTED_STRING()) {
             return create_literal(unquote_string(ctx->QUOTED_STRING()->getText()));
-        } else {
-            return create_literal(ctx->UNQUOTED_LITERAL()->getText());
         }
+        // Only unquoted values can be regexes, so a quoted value like "/var/log/" stays a string
+        auto const text{ctx->UNQUOTED_LITERAL()->getText()};
+        if (auto const regex{get_regex_body(text)}; regex.has_value()) {
+            return create_regex_literal(regex.value());
+        }
+        return create_literal(text);
     }
 
     std::any visitStart(KqlParser::StartContext* ctx) override {
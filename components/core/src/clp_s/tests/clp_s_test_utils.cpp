@@ -1,5 +1,6 @@
 #include "clp_s_test_utils.hpp"
 
+#include <cstddef>
 #include <filesystem>
 #include <optional>
 #include <string>
@@ -18,11 +19,11 @@ auto compress_archive(
         std::optional<std::string> timestamp_key,
         bool retain_float_format,
         bool single_file_archive,
-        bool structurize_arrays
+        bool structurize_arrays,
+        size_t min_table_size
 ) -> std::vector<clp_s::ArchiveStats> {
     constexpr auto cDefaultTargetEncodedSize{8ULL * 1024 * 1024 * 1024};  // 8 GiB
     constexpr auto cDefaultMaxDocumentSize{512ULL * 1024 * 1024};  // 512 MiB
-    constexpr auto cDefaultMinTableSize{1ULL * 1024 * 1024};  // 1 MiB
     constexpr auto cDefaultCompressionLevel{3};
     constexpr auto cDefaultPrintArchiveStats{false};
 
@@ -37,7 +38,7 @@ auto compress_archive(
     parser_option.archives_dir = archive_directory;
     parser_option.target_encoded_size = cDefaultTargetEncodedSize;
     parser_option.max_document_size = cDefaultMaxDocumentSize;
-    parser_option.min_table_size = cDefaultMinTableSize;
+    parser_option.min_table_size = min_table_size;
     parser_option.compression_level = cDefaultCompressionLevel;
     parser_option.print_archive_stats = cDefaultPrintArchiveStats;
     parser_option.retain_float_format = retain_float_format;
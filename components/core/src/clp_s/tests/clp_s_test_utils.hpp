@@ -1,6 +1,7 @@
 #ifndef CLP_S_TEST_UTILS_HPP
 #define CLP_S_TEST_UTILS_HPP
 
+#include <cstddef>
 #include <optional>
 #include <string>
 #include <vector>
@@ -8,6 +9,9 @@
 #include "../src/clp_s/ArchiveWriter.hpp"
 #include "../src/clp_s/InputConfig.hpp"
 
+// Tables are packed into streams of at least this many bytes by default
+constexpr size_t cDefaultTestMinTableSize{1ULL * 1024 * 1024};  // 1 MiB
+
 /**
  * Compresses a file into an archive directory according to a given set of configuration options.
  *
@@ -19,6 +23,7 @@
  * @param retain_float_format
  * @param single_file_archive
  * @param structurize_arrays
+ * @param min_table_size The minimum size of each packed stream of tables.
  * @return Statistics for every compressed archive.
  */
 [[nodiscard]] auto compress_archive(
@@ -27,6 +32,7 @@
         std::optional<std::string> timestamp_key,
         bool retain_float_format,
         bool single_file_archive,
-        bool structurize_arrays
+        bool structurize_arrays,
+        size_t min_table_size = cDefaultTestMinTableSize
 ) -> std::vector<clp_s::ArchiveStats>;
 #endif  // CLP_S_TEST_UTILS_HPP
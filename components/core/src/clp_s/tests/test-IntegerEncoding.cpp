@@ -0,0 +1,174 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <limits>
+#include <random>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+
+#include "../src/clp_s/BufferViewReader.hpp"
+#include "../src/clp_s/ErrorCode.hpp"
+#include "../src/clp_s/FileWriter.hpp"
+#include "../src/clp_s/IntegerEncoding.hpp"
+#include "../src/clp_s/ZstdCompressor.hpp"
+#include "../src/clp_s/ZstdDecompressor.hpp"
+
+using clp_s::BufferViewReader;
+using clp_s::cIntegerEncodingHeaderSize;
+using clp_s::EncodedIntegerSpan;
+using clp_s::IntegerEncoding;
+
+namespace {
+constexpr std::string_view cTestFilePath{"test-IntegerEncoding.zst"};
+constexpr size_t cNumValues{10'000};
+constexpr size_t cNumRangeQueries{100};
+
+/**
+ * Encodes the given values, decodes them, and checks that the decoded values (and the values
+ * marked by range queries and predicates on the decoded column) match the given values.
+ * @tparam T
+ * @param values
+ * @param expected_encoding The encoding that `write_encoded_integers` should choose.
+ */
+template <typename T>
+auto test_round_trip(std::vector<T> const& values, IntegerEncoding expected_encoding) -> void;
+
+template <typename T>
+auto test_round_trip(std::vector<T> const& values, IntegerEncoding expected_encoding) -> void {
+    size_t encoded_size{};
+    {
+        clp_s::FileWriter file_writer;
+        file_writer.open(
+                std::string{cTestFilePath},
+                clp_s::FileWriter::OpenMode::CreateForWriting
+        );
+        clp_s::ZstdCompressor compressor;
+        compressor.open(file_writer);
+        clp_s::write_encoded_integers(std::span<T const>{values}, compressor);
+        encoded_size = compressor.get_uncompressed_pos();
+        compressor.close();
+        file_writer.close();
+    }
+    REQUIRE(encoded_size <= values.size() * sizeof(T) + cIntegerEncodingHeaderSize);
+
+    std::vector<char> buffer(encoded_size);
+    clp_s::ZstdDecompressor decompressor;
+    REQUIRE(clp_s::ErrorCodeSuccess == decompressor.open(std::string{cTestFilePath}));
+    REQUIRE(clp_s::ErrorCodeSuccess
+            == decompressor.try_read_exact_length(buffer.data(), buffer.size()));
+    decompressor.close();
+    std::filesystem::remove(cTestFilePath);
+
+    BufferViewReader reader{buffer.data(), buffer.size()};
+    EncodedIntegerSpan<T> encoded_values;
+    encoded_values.load(reader, values.size(), true);
+    REQUIRE(0 == reader.get_remaining_size());
+    REQUIRE(expected_encoding == encoded_values.get_encoding());
+    REQUIRE(values.size() == encoded_values.size());
+
+    for (size_t i{0}; i < values.size(); ++i) {
+        REQUIRE(values[i] == encoded_values[i]);
+    }
+    for (size_t i{values.size()}; i > 0; --i) {
+        REQUIRE(values[i - 1] == encoded_values[i - 1]);
+    }
+
+    if (values.empty()) {
+        return;
+    }
+    std::mt19937_64 generator{std::random_device{}()};
+    std::uniform_int_distribution<size_t> index_distribution{0, values.size() - 1};
+    for (size_t i{0}; i < cNumRangeQueries; ++i) {
+        auto lower{values[index_distribution(generator)]};
+        auto upper{values[index_distribution(generator)]};
+        if (lower > upper) {
+            std::swap(lower, upper);
+        }
+        std::vector<uint8_t> bitmap(values.size(), 0);
+        encoded_values.mark_values_in_range(lower, upper, bitmap);
+        for (size_t j{0}; j < values.size(); ++j) {
+            REQUIRE((lower <= values[j] && values[j] <= upper) == (1 == bitmap[j]));
+        }
+    }
+
+    auto const is_even = [](T value) -> bool { return 0 == value % 2; };
+    std::vector<uint8_t> bitmap(values.size(), 0);
+    encoded_values.mark_matching_values(is_even, bitmap);
+    for (size_t i{0}; i < values.size(); ++i) {
+        REQUIRE(is_even(values[i]) == (1 == bitmap[i]));
+    }
+}
+}  // namespace
+
+TEMPLATE_TEST_CASE(
+        "clp-s-integer-encoding-round-trip",
+        "[clp-s][IntegerEncoding]",
+        int64_t,
+        uint64_t
+) {
+    std::mt19937_64 generator{std::random_device{}()};
+    std::vector<TestType> values;
+
+    SECTION("Values with a small range are bit-packed.") {
+        auto const frame_of_reference{std::numeric_limits<TestType>::max() / 2};
+        std::uniform_int_distribution<TestType> distribution{0, 1000};
+        for (size_t i{0}; i < cNumValues; ++i) {
+            values.push_back(frame_of_reference + distribution(generator));
+        }
+        test_round_trip(values, IntegerEncoding::BitPacked);
+    }
+
+    SECTION("Values with long runs are run-length encoded.") {
+        std::uniform_int_distribution<TestType> distribution{
+                std::numeric_limits<TestType>::min(),
+                std::numeric_limits<TestType>::max()
+        };
+        auto value{distribution(generator)};
+        for (size_t i{0}; i < cNumValues; ++i) {
+            if (0 == i % 1000) {
+                value = distribution(generator);
+            }
+            values.push_back(value);
+        }
+        test_round_trip(values, IntegerEncoding::RunLength);
+    }
+
+    SECTION("Values with the full range are stored raw.") {
+        std::uniform_int_distribution<TestType> distribution{
+                std::numeric_limits<TestType>::min(),
+                std::numeric_limits<TestType>::max()
+        };
+        for (size_t i{0}; i < cNumValues; ++i) {
+            values.push_back(distribution(generator));
+        }
+        values.push_back(std::numeric_limits<TestType>::min());
+        values.push_back(std::numeric_limits<TestType>::max());
+        test_round_trip(values, IntegerEncoding::Raw);
+    }
+
+    SECTION("An empty column is stored raw.") {
+        test_round_trip(values, IntegerEncoding::Raw);
+    }
+}
+
+TEST_CASE("clp-s-integer-encoding-unencoded-column", "[clp-s][IntegerEncoding]") {
+    std::vector<int64_t> values{-1, 0, 1};
+    BufferViewReader reader{
+            reinterpret_cast<char*>(values.data()),
+            values.size() * sizeof(int64_t)
+    };
+    EncodedIntegerSpan<int64_t> encoded_values;
+    encoded_values.load(reader, values.size(), false);
+    REQUIRE(0 == reader.get_remaining_size());
+    REQUIRE(IntegerEncoding::Raw == encoded_values.get_encoding());
+    for (size_t i{0}; i < values.size(); ++i) {
+        REQUIRE(values[i] == encoded_values[i]);
+    }
+}
@@ -0,0 +1,96 @@
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "../src/clp_s/search/VariableIdSet.hpp"
+
+using clp_s::search::VariableIdSet;
+
+namespace {
+/**
+ * Checks that the set contains exactly the given IDs by testing every ID up to a little past the
+ * largest one, as well as each ID's neighbours.
+ * @param set
+ * @param ids The expected IDs, in any order and possibly with duplicates.
+ */
+auto check_contains_exactly(VariableIdSet const& set, std::vector<uint64_t> ids) -> void;
+
+auto check_contains_exactly(VariableIdSet const& set, std::vector<uint64_t> ids) -> void {
+    std::sort(ids.begin(), ids.end());
+    ids.erase(std::unique(ids.begin(), ids.end()), ids.end());
+    REQUIRE(ids == set.get_ids());
+    REQUIRE(ids.size() == set.size());
+    REQUIRE(ids.empty() == set.empty());
+
+    auto const is_expected = [&](uint64_t id) -> bool {
+        return std::binary_search(ids.cbegin(), ids.cend(), id);
+    };
+    constexpr uint64_t cMaxDenselyCheckedId{1000};
+    for (uint64_t id{0}; id <= cMaxDenselyCheckedId; ++id) {
+        REQUIRE(is_expected(id) == set.contains(id));
+    }
+    for (auto const id : ids) {
+        REQUIRE(set.contains(id));
+        if (id > 0) {
+            REQUIRE(is_expected(id - 1) == set.contains(id - 1));
+        }
+        if (id < std::numeric_limits<uint64_t>::max()) {
+            REQUIRE(is_expected(id + 1) == set.contains(id + 1));
+        }
+    }
+    REQUIRE(is_expected(std::numeric_limits<uint64_t>::max())
+            == set.contains(std::numeric_limits<uint64_t>::max()));
+}
+}  // namespace
+
+TEST_CASE("clp-s-variable-id-set", "[clp-s][VariableIdSet]") {
+    SECTION("An empty set contains no IDs.") {
+        check_contains_exactly(VariableIdSet{}, {});
+        check_contains_exactly(VariableIdSet{std::vector<uint64_t>{}}, {});
+    }
+
+    SECTION("Sets up to the maximum sorted array size are stored as a sorted array.") {
+        std::vector<uint64_t> ids;
+        for (size_t i{0}; i < VariableIdSet::cMaxSortedArraySize; ++i) {
+            ids.push_back((VariableIdSet::cMaxSortedArraySize - i) * 7);
+        }
+        check_contains_exactly(VariableIdSet{ids}, ids);
+
+        // Duplicates are removed, so they don't push the set past the sorted array size
+        auto ids_with_duplicates{ids};
+        ids_with_duplicates.insert(ids_with_duplicates.end(), ids.cbegin(), ids.cend());
+        VariableIdSet const set{ids_with_duplicates};
+        REQUIRE(VariableIdSet::cMaxSortedArraySize == set.size());
+        check_contains_exactly(set, ids_with_duplicates);
+    }
+
+    SECTION("Sets larger than the maximum sorted array size are also stored as a bitmap.") {
+        std::vector<uint64_t> ids;
+        for (size_t i{0}; i <= VariableIdSet::cMaxSortedArraySize; ++i) {
+            ids.push_back((VariableIdSet::cMaxSortedArraySize - i) * 7);
+        }
+        ids.push_back(ids.front());
+        check_contains_exactly(VariableIdSet{ids}, ids);
+
+        // The largest ID a bitmap can hold
+        ids.push_back(VariableIdSet::cMaxBitmapSize - 1);
+        check_contains_exactly(VariableIdSet{ids}, ids);
+    }
+
+    SECTION("Sets whose bitmap would be too large are only stored as a sorted array.") {
+        std::vector<uint64_t> ids;
+        for (size_t i{0}; i <= VariableIdSet::cMaxSortedArraySize; ++i) {
+            ids.push_back(i * 3);
+        }
+        ids.push_back(VariableIdSet::cMaxBitmapSize);
+        check_contains_exactly(VariableIdSet{ids}, ids);
+
+        // A bitmap up to this ID couldn't be allocated at all
+        ids.push_back(std::numeric_limits<uint64_t>::max() - 1);
+        check_contains_exactly(VariableIdSet{ids}, ids);
+    }
+}
@@ -0,0 +1,166 @@
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <tuple>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "../src/clp_s/ArchiveCache.hpp"
+#include "../src/clp_s/ArchiveReader.hpp"
+#include "../src/clp_s/InputConfig.hpp"
+#include "clp_s_test_utils.hpp"
+#include "TestOutputCleaner.hpp"
+
+using clp_s::ArchiveCache;
+
+namespace {
+constexpr size_t cCapacityInBytes{100};
+constexpr size_t cEntrySizeInBytes{40};
+constexpr size_t cDictionaryCacheCapacityInBytes{64ULL * 1024 * 1024};
+constexpr std::string_view cTestArchiveDirectory{"test-archive-cache-archive"};
+constexpr std::string_view cTestInputFile{"test_log_files/test_search.jsonl"};
+
+/**
+ * @param archive_id
+ * @param index
+ * @return A cache key for the packed stream with the given index in the given archive.
+ */
+auto get_stream_key(std::string const& archive_id, size_t index) -> ArchiveCache::Key;
+
+auto get_stream_key(std::string const& archive_id, size_t index) -> ArchiveCache::Key {
+    return {archive_id, ArchiveCache::Section::PackedStream, index};
+}
+
+/**
+ * @param archive_path
+ * @param archive_cache
+ * @return The log type dictionary read by an `ArchiveReader` that is closed and destroyed before
+ * returning.
+ */
+auto read_log_type_dictionary_with_transient_reader(
+        std::string const& archive_path,
+        std::shared_ptr<ArchiveCache> const& archive_cache
+) -> std::shared_ptr<clp_s::LogTypeDictionaryReader>;
+
+auto read_log_type_dictionary_with_transient_reader(
+        std::string const& archive_path,
+        std::shared_ptr<ArchiveCache> const& archive_cache
+) -> std::shared_ptr<clp_s::LogTypeDictionaryReader> {
+    clp_s::ArchiveReader archive_reader;
+    archive_reader.set_archive_cache(archive_cache);
+    archive_reader.open(
+            clp_s::Path{.source = clp_s::InputSource::Filesystem, .path = archive_path},
+            clp_s::NetworkAuthOption{}
+    );
+    archive_reader.read_dictionaries_and_metadata();
+    auto log_type_dictionary{archive_reader.get_log_type_dictionary()};
+    archive_reader.close();
+    return log_type_dictionary;
+}
+}  // namespace
+
+TEST_CASE("clp-s-archive-cache", "[clp-s][ArchiveCache]") {
+    ArchiveCache cache{cCapacityInBytes};
+
+    SECTION("Cached values are returned and counted as hits.") {
+        REQUIRE(nullptr == cache.get<int>(get_stream_key("a", 0)));
+        cache.put(get_stream_key("a", 0), std::make_shared<int>(0), cEntrySizeInBytes);
+        auto const value{cache.get<int>(get_stream_key("a", 0))};
+        REQUIRE(nullptr != value);
+        REQUIRE(0 == *value);
+        REQUIRE(nullptr == cache.get<int>({"a", ArchiveCache::Section::SchemaTree}));
+
+        auto const metrics{cache.get_metrics()};
+        REQUIRE(1 == metrics.num_hits);
+        REQUIRE(2 == metrics.num_misses);
+        REQUIRE(1 == metrics.num_entries);
+        REQUIRE(cEntrySizeInBytes == metrics.size_in_bytes);
+        REQUIRE(1.0 / 3.0 == metrics.get_hit_rate());
+    }
+
+    SECTION("The least recently used entry is evicted when the cache is full.") {
+        cache.put(get_stream_key("a", 0), std::make_shared<int>(0), cEntrySizeInBytes);
+        cache.put(get_stream_key("a", 1), std::make_shared<int>(1), cEntrySizeInBytes);
+        REQUIRE(nullptr != cache.get<int>(get_stream_key("a", 0)));
+        cache.put(get_stream_key("a", 2), std::make_shared<int>(2), cEntrySizeInBytes);
+
+        REQUIRE(nullptr != cache.get<int>(get_stream_key("a", 0)));
+        REQUIRE(nullptr == cache.get<int>(get_stream_key("a", 1)));
+        REQUIRE(nullptr != cache.get<int>(get_stream_key("a", 2)));
+        REQUIRE(1 == cache.get_metrics().num_evictions);
+        REQUIRE(2 * cEntrySizeInBytes == cache.get_metrics().size_in_bytes);
+    }
+
+    SECTION("Values larger than the cache aren't cached.") {
+        cache.put(get_stream_key("a", 0), std::make_shared<int>(0), cCapacityInBytes + 1);
+        REQUIRE(nullptr == cache.get<int>(get_stream_key("a", 0)));
+        REQUIRE(0 == cache.get_metrics().num_entries);
+    }
+
+    SECTION("Evicted values remain valid while in use.") {
+        cache.put(get_stream_key("a", 0), std::make_shared<int>(0), cEntrySizeInBytes);
+        auto const value{cache.get<int>(get_stream_key("a", 0))};
+        cache.clear();
+        REQUIRE(nullptr == cache.get<int>(get_stream_key("a", 0)));
+        REQUIRE(0 == *value);
+    }
+
+    SECTION("Entries can be evicted per archive.") {
+        cache.put(get_stream_key("a", 0), std::make_shared<int>(0), cEntrySizeInBytes);
+        cache.put(get_stream_key("b", 0), std::make_shared<int>(1), cEntrySizeInBytes);
+        REQUIRE(1 == cache.evict_archive("a"));
+        REQUIRE(nullptr == cache.get<int>(get_stream_key("a", 0)));
+        REQUIRE(nullptr != cache.get<int>(get_stream_key("b", 0)));
+    }
+
+    SECTION("Shrinking the cache evicts entries.") {
+        cache.put(get_stream_key("a", 0), std::make_shared<int>(0), cEntrySizeInBytes);
+        cache.put(get_stream_key("a", 1), std::make_shared<int>(1), cEntrySizeInBytes);
+        cache.set_capacity(cEntrySizeInBytes);
+        REQUIRE(1 == cache.get_metrics().num_entries);
+        REQUIRE(nullptr != cache.get<int>(get_stream_key("a", 1)));
+    }
+}
+
+TEST_CASE("clp-s-archive-cache-dictionaries-outlive-readers", "[clp-s][ArchiveCache]") {
+    TestOutputCleaner const test_cleanup{{std::string{cTestArchiveDirectory}}};
+    auto const input_path{std::filesystem::path{__FILE__}.parent_path() / cTestInputFile};
+    std::ignore = compress_archive(
+            input_path.string(),
+            std::string{cTestArchiveDirectory},
+            std::nullopt,
+            false,
+            true,
+            false
+    );
+
+    auto const archive_cache{std::make_shared<ArchiveCache>(cDictionaryCacheCapacityInBytes)};
+    for (auto const& entry : std::filesystem::directory_iterator{cTestArchiveDirectory}) {
+        auto const archive_path{entry.path().string()};
+        auto const dictionary{
+                read_log_type_dictionary_with_transient_reader(archive_path, archive_cache)
+        };
+        REQUIRE(nullptr != dictionary);
+        REQUIRE(false == dictionary->get_entries().empty());
+
+        // The reader that read the dictionary has been destroyed along with its adaptor, so the
+        // dictionary must remain usable without it.
+        std::vector<std::string> values;
+        for (auto const& dictionary_entry : dictionary->get_entries()) {
+            values.emplace_back(dictionary_entry.get_value());
+        }
+
+        auto const cached_dictionary{
+                read_log_type_dictionary_with_transient_reader(archive_path, archive_cache)
+        };
+        REQUIRE(dictionary == cached_dictionary);
+        REQUIRE(values.size() == cached_dictionary->get_entries().size());
+        for (size_t i{0}; i < values.size(); ++i) {
+            REQUIRE(values[i] == cached_dictionary->get_value(i));
+        }
+    }
+}
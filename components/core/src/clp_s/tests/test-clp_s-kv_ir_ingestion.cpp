@@ -0,0 +1,129 @@
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
+#include <msgpack.hpp>
+#include <nlohmann/json.hpp>
+
+#include "../src/clp/ffi/ir_stream/protocol_constants.hpp"
+#include "../src/clp/ffi/ir_stream/Serializer.hpp"
+#include "../src/clp/ir/types.hpp"
+#include "clp_s_test_utils.hpp"
+#include "TestOutputCleaner.hpp"
+
+namespace {
+using clp::ffi::ir_stream::Serializer;
+
+constexpr std::string_view cTestKvIrIngestionArchiveDirectory{"test-kv-ir-ingestion-archive"};
+constexpr std::string_view cTestKvIrIngestionInputFile{"test-kv-ir-ingestion.clp"};
+constexpr size_t cNumLogEvents{200'000};
+
+/**
+ * @param idx
+ * @return A log event with a mix of value types, resembling a typical structured log event.
+ */
+auto create_log_event(size_t idx) -> nlohmann::json;
+
+/**
+ * Writes a KV-IR stream containing `num_log_events` log events to the given path.
+ *
+ * This helper uses `REQUIRE...` statements to assert that serialization was successful.
+ *
+ * @param path
+ * @param num_log_events
+ */
+auto write_kv_ir_stream(std::string const& path, size_t num_log_events) -> void;
+
+auto create_log_event(size_t idx) -> nlohmann::json {
+    return {{"timestamp", 1'700'000'000'000 + idx},
+            {"level", 0 == idx % 10 ? "WARN" : "INFO"},
+            {"message", fmt::format("Request {} completed in {} ms", idx, idx % 1000)},
+            {"context",
+             {{"thread_id", idx % 16},
+              {"success", 0 != idx % 7},
+              {"load", static_cast<double>(idx % 100) / 100.0},
+              {"tags", nlohmann::json::array({"a", idx % 3})}}}};
+}
+
+auto write_kv_ir_stream(std::string const& path, size_t num_log_events) -> void {
+    auto serializer_result{Serializer<clp::ir::four_byte_encoded_variable_t>::create()};
+    REQUIRE_FALSE(serializer_result.has_error());
+    auto& serializer{serializer_result.value()};
+
+    auto const empty_map_bytes{nlohmann::json::to_msgpack(nlohmann::json::object())};
+    auto const empty_map_handle{msgpack::unpack(
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+            reinterpret_cast<char const*>(empty_map_bytes.data()),
+            empty_map_bytes.size()
+    )};
+
+    std::ofstream ir_file{path, std::ios::binary};
+    REQUIRE(ir_file.is_open());
+    auto const flush_ir_buf = [&]() -> void {
+        auto const ir_buf_view{serializer.get_ir_buf_view()};
+        ir_file.write(
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                reinterpret_cast<char const*>(ir_buf_view.data()),
+                static_cast<std::streamsize>(ir_buf_view.size())
+        );
+        serializer.clear_ir_buf();
+    };
+
+    for (size_t idx{0}; idx < num_log_events; ++idx) {
+        auto const msgpack_bytes{nlohmann::json::to_msgpack(create_log_event(idx))};
+        auto const msgpack_handle{msgpack::unpack(
+                // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+                reinterpret_cast<char const*>(msgpack_bytes.data()),
+                msgpack_bytes.size()
+        )};
+        REQUIRE_FALSE(serializer
+                              .serialize_msgpack_map(
+                                      empty_map_handle.get().via.map,
+                                      msgpack_handle.get().via.map
+                              )
+                              .has_error());
+        flush_ir_buf();
+    }
+
+    flush_ir_buf();
+    ir_file.put(static_cast<char>(clp::ffi::ir_stream::cProtocol::Eof));
+    ir_file.close();
+    REQUIRE_FALSE(ir_file.fail());
+}
+}  // namespace
+
+// Hidden by default since it's a benchmark rather than a correctness test. Run it explicitly with
+// the `[benchmark]` tag.
+TEST_CASE("clp-s-kv-ir-ingestion-throughput", "[.][benchmark][clp-s][kv-ir]") {
+    TestOutputCleaner const test_cleanup{
+            {std::string{cTestKvIrIngestionArchiveDirectory},
+             std::string{cTestKvIrIngestionInputFile}}
+    };
+    write_kv_ir_stream(std::string{cTestKvIrIngestionInputFile}, cNumLogEvents);
+
+    auto const start_time{std::chrono::steady_clock::now()};
+    auto const archive_stats{compress_archive(
+            std::string{cTestKvIrIngestionInputFile},
+            std::string{cTestKvIrIngestionArchiveDirectory},
+            std::nullopt,
+            false,
+            false,
+            false
+    )};
+    std::chrono::duration<double> const duration{std::chrono::steady_clock::now() - start_time};
+    REQUIRE_FALSE(archive_stats.empty());
+
+    WARN(fmt::format(
+            "Ingested {} KV-IR log events in {:.3f} s ({:.0f} events/s).",
+            cNumLogEvents,
+            duration.count(),
+            static_cast<double>(cNumLogEvents) / duration.count()
+    ));
+}
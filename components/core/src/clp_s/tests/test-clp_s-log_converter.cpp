@@ -0,0 +1,248 @@
+#include <sys/types.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <fmt/format.h>
+
+#include "../src/clp/ErrorCode.hpp"
+#include "../src/clp/WriterInterface.hpp"
+#include "../src/clp_s/log_converter/AsyncWriter.hpp"
+#include "../src/clp_s/log_converter/CommandLineArguments.hpp"
+#include "../src/clp_s/log_converter/conversion.hpp"
+#include "TestOutputCleaner.hpp"
+
+constexpr std::string_view cTestLogConverterInputDirectory{"test-log-converter-input"};
+constexpr std::string_view cTestLogConverterSerialOutputDirectory{
+        "test-log-converter-serial-output"
+};
+constexpr std::string_view cTestLogConverterParallelOutputDirectory{
+        "test-log-converter-parallel-output"
+};
+constexpr size_t cNumInputFiles{8};
+// Enough log events per file for its serialized IR to be flushed through the `AsyncWriter` many
+// times
+constexpr size_t cNumLogEventsPerInputFile{5000};
+constexpr size_t cNumParallelThreads{4};
+
+namespace {
+/**
+ * Writer that appends the data written to it to a string, and that can be made to fail.
+ */
+class StringWriter : public clp::WriterInterface {
+public:
+    // Constructors
+    /**
+     * @param num_writes_before_failure The number of writes that succeed before every later write
+     * throws.
+     */
+    explicit StringWriter(size_t num_writes_before_failure = SIZE_MAX)
+            : m_num_writes_before_failure{num_writes_before_failure} {}
+
+    // Methods implementing `clp::WriterInterface`
+    auto write(char const* data, size_t data_length) -> void override {
+        if (m_num_writes >= m_num_writes_before_failure) {
+            throw OperationFailed(clp::ErrorCode_Failure, __FILENAME__, __LINE__);
+        }
+        ++m_num_writes;
+        m_data.append(data, data_length);
+    }
+
+    auto flush() -> void override {}
+
+    [[nodiscard]] auto try_seek_from_begin([[maybe_unused]] size_t pos) -> clp::ErrorCode override {
+        return clp::ErrorCode_Unsupported;
+    }
+
+    [[nodiscard]] auto try_seek_from_current([[maybe_unused]] off_t offset)
+            -> clp::ErrorCode override {
+        return clp::ErrorCode_Unsupported;
+    }
+
+    [[nodiscard]] auto try_get_pos(size_t& pos) const -> clp::ErrorCode override {
+        pos = m_data.size();
+        return clp::ErrorCode_Success;
+    }
+
+    // Methods
+    [[nodiscard]] auto get_data() const -> std::string const& { return m_data; }
+
+private:
+    size_t m_num_writes_before_failure;
+    size_t m_num_writes{0};
+    std::string m_data;
+};
+
+/**
+ * Writes text log files with distinct contents into the input directory.
+ * @return The paths of the written files.
+ */
+auto write_input_files() -> std::vector<std::string>;
+
+/**
+ * Converts the given files with log-converter's command line interface.
+ * @param input_paths
+ * @param output_dir
+ * @param num_threads
+ * @return Whether conversion was successful.
+ */
+auto convert_files(
+        std::vector<std::string> const& input_paths,
+        std::string_view output_dir,
+        size_t num_threads
+) -> bool;
+
+/**
+ * @param dir
+ * @return The contents of every file in the given directory, sorted. Converted files are named
+ * randomly, but each one's contents include the path of its input file.
+ */
+auto get_sorted_file_contents(std::string_view dir) -> std::vector<std::string>;
+
+auto write_input_files() -> std::vector<std::string> {
+    std::filesystem::create_directory(cTestLogConverterInputDirectory);
+    std::vector<std::string> input_paths;
+    for (size_t file_idx{0}; file_idx < cNumInputFiles; ++file_idx) {
+        auto const path{
+                (std::filesystem::path{cTestLogConverterInputDirectory}
+                 / fmt::format("input-{}.log", file_idx))
+                        .string()
+        };
+        std::ofstream file{path};
+        for (size_t event_idx{0}; event_idx < cNumLogEventsPerInputFile; ++event_idx) {
+            file << fmt::format(
+                    "2024-01-01 00:{:02}:{:02}.{:03} INFO [worker-{}] Processed request {} in {} "
+                    "ms\n",
+                    (event_idx / 60) % 60,
+                    event_idx % 60,
+                    event_idx % 1000,
+                    file_idx,
+                    event_idx,
+                    (event_idx * (file_idx + 1)) % 997
+            );
+        }
+        REQUIRE(file.good());
+        input_paths.emplace_back(path);
+    }
+    return input_paths;
+}
+
+auto convert_files(
+        std::vector<std::string> const& input_paths,
+        std::string_view output_dir,
+        size_t num_threads
+) -> bool {
+    std::vector<std::string> args{
+            "log-converter",
+            "--output-dir",
+            std::string{output_dir},
+            "--threads",
+            std::to_string(num_threads)
+    };
+    args.insert(args.end(), input_paths.cbegin(), input_paths.cend());
+    std::vector<char const*> argv;
+    std::transform(
+            args.cbegin(),
+            args.cend(),
+            std::back_inserter(argv),
+            [](std::string const& arg) { return arg.c_str(); }
+    );
+
+    clp_s::log_converter::CommandLineArguments command_line_arguments{"log-converter"};
+    REQUIRE(clp_s::log_converter::CommandLineArguments::ParsingResult::Success
+            == command_line_arguments.parse_arguments(static_cast<int>(argv.size()), argv.data()));
+    return clp_s::log_converter::convert_files(command_line_arguments);
+}
+
+auto get_sorted_file_contents(std::string_view dir) -> std::vector<std::string> {
+    std::vector<std::string> contents;
+    for (auto const& entry : std::filesystem::directory_iterator{dir}) {
+        std::ifstream file{entry.path(), std::ios::binary};
+        contents.emplace_back(
+                std::istreambuf_iterator<char>{file},
+                std::istreambuf_iterator<char>{}
+        );
+    }
+    std::sort(contents.begin(), contents.end());
+    return contents;
+}
+}  // namespace
+
+TEST_CASE("clp-s-log-converter-async-writer", "[clp-s][log-converter]") {
+    constexpr size_t cNumBuffers{2};
+    constexpr size_t cNumWrites{1000};
+
+    SECTION("Data is written in order") {
+        StringWriter string_writer;
+        std::string expected_data;
+        {
+            clp_s::log_converter::AsyncWriter async_writer{string_writer, cNumBuffers};
+            for (size_t i{0}; i < cNumWrites; ++i) {
+                auto const data{std::to_string(i) + ","};
+                async_writer.write(data.data(), data.size());
+                expected_data += data;
+            }
+            size_t pos{};
+            REQUIRE(clp::ErrorCode_Success == async_writer.try_get_pos(pos));
+            REQUIRE(expected_data.size() == pos);
+
+            async_writer.flush();
+            REQUIRE(expected_data == string_writer.get_data());
+            async_writer.close();
+        }
+        REQUIRE(expected_data == string_writer.get_data());
+    }
+
+    SECTION("An error on the background thread reaches the caller") {
+        constexpr size_t cNumWritesBeforeFailure{3};
+        StringWriter string_writer{cNumWritesBeforeFailure};
+        clp_s::log_converter::AsyncWriter async_writer{string_writer, cNumBuffers};
+        std::string const data{"data"};
+        for (size_t i{0}; i <= cNumWritesBeforeFailure; ++i) {
+            // Depending on how far the background thread has gotten, the failure may already be
+            // reported here
+            try {
+                async_writer.write(data.data(), data.size());
+            } catch (clp::WriterInterface::OperationFailed const&) {
+                break;
+            }
+        }
+
+        // Once the failure has happened, every later call reports it
+        REQUIRE_THROWS_AS(async_writer.flush(), clp::WriterInterface::OperationFailed);
+        REQUIRE_THROWS_AS(
+                async_writer.write(data.data(), data.size()),
+                clp::WriterInterface::OperationFailed
+        );
+        REQUIRE_THROWS_AS(async_writer.close(), clp::WriterInterface::OperationFailed);
+        REQUIRE(cNumWritesBeforeFailure * data.size() == string_writer.get_data().size());
+    }
+}
+
+TEST_CASE("clp-s-log-converter-parallel-conversion", "[clp-s][log-converter]") {
+    TestOutputCleaner const test_cleanup{
+            {std::string{cTestLogConverterInputDirectory},
+             std::string{cTestLogConverterSerialOutputDirectory},
+             std::string{cTestLogConverterParallelOutputDirectory}}
+    };
+
+    auto const input_paths{write_input_files()};
+    REQUIRE(convert_files(input_paths, cTestLogConverterSerialOutputDirectory, 1));
+    REQUIRE(convert_files(
+            input_paths,
+            cTestLogConverterParallelOutputDirectory,
+            cNumParallelThreads
+    ));
+
+    auto const serial_contents{get_sorted_file_contents(cTestLogConverterSerialOutputDirectory)};
+    REQUIRE(cNumInputFiles == serial_contents.size());
+    REQUIRE(serial_contents == get_sorted_file_contents(cTestLogConverterParallelOutputDirectory));
+}
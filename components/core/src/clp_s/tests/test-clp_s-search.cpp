@@ -1,6 +1,9 @@
+#include <algorithm>
 #include <cstddef>
+#include <cstdint>
 #include <exception>
 #include <filesystem>
+#include <fstream>
 #include <memory>
 #include <optional>
 #include <set>
@@ -15,6 +18,7 @@
 #include <fmt/format.h>
 #include <nlohmann/json.hpp>
 
+#include "../src/clp/string_utils/string_utils.hpp"
 #include "../src/clp_s/archive_constants.hpp"
 #include "../src/clp_s/ArchiveReader.hpp"
 #include "../src/clp_s/InputConfig.hpp"
@@ -33,7 +37,9 @@
 #include "../src/clp_s/search/kql/kql.hpp"
 #include "../src/clp_s/search/Output.hpp"
 #include "../src/clp_s/search/Projection.hpp"
+#include "../src/clp_s/search/QueryPlanCache.hpp"
 #include "../src/clp_s/search/SchemaMatch.hpp"
+#include "../src/clp_s/search/SearchTelemetry.hpp"
 #include "../src/clp_s/Utils.hpp"
 #include "clp_s_test_utils.hpp"
 #include "TestOutputCleaner.hpp"
@@ -44,25 +50,97 @@ constexpr std::string_view cTestSearchInputFile{"test_search.jsonl"};
 constexpr std::string_view cTestSearchFormattedFloatFile{"test_search_formatted_float.jsonl"};
 constexpr std::string_view cTestSearchFloatTimestampFile{"test_search_float_timestamp.jsonl"};
 constexpr std::string_view cTestSearchIntTimestampFile{"test_search_int_timestamp.jsonl"};
+constexpr std::string_view cTestSearchClpStringFile{"test_search_clp_string.jsonl"};
+constexpr std::string_view cTestSearchPackedStreamsFile{"test_search_packed_streams.jsonl"};
 constexpr std::string_view cTestIdxKey{"idx"};
 constexpr std::string_view cTestTimestampKey{"timestamp"};
+constexpr std::string_view cTestMsgKey{"msg"};
 
 namespace {
+/**
+ * A `VectorOutputHandler` that only keeps results newer than a fixed timestamp lower bound, like a
+ * handler that keeps the latest results and has already been filled by earlier archives.
+ */
+class LatestResultsVectorOutputHandler : public clp_s::VectorOutputHandler {
+public:
+    // Constructors
+    LatestResultsVectorOutputHandler(
+            std::vector<QueryResult>& output,
+            clp_s::epochtime_t timestamp_lower_bound
+    )
+            : clp_s::VectorOutputHandler{output},
+              m_timestamp_lower_bound{timestamp_lower_bound} {}
+
+    // Methods inherited from OutputHandler
+    [[nodiscard]] auto get_timestamp_lower_bound() const
+            -> std::optional<clp_s::epochtime_t> override {
+        return m_timestamp_lower_bound;
+    }
+
+    [[nodiscard]] auto keeps_latest_results_only() const -> bool override { return true; }
+
+private:
+    clp_s::epochtime_t m_timestamp_lower_bound;
+};
+
 auto get_test_input_path_relative_to_tests_dir(std::string_view test_input_path)
         -> std::filesystem::path;
 auto get_test_input_local_path(std::string_view test_input_path) -> std::string;
 auto create_first_record_match_metadata_query() -> std::shared_ptr<clp_s::search::ast::Expression>;
-void
-search(std::string const& query, bool ignore_case, std::vector<int64_t> const& expected_results);
+void search(
+        std::string const& query,
+        bool ignore_case,
+        std::vector<int64_t> const& expected_results,
+        std::set<std::string>* predicate_orders = nullptr,
+        clp_s::search::SearchResultMetrics* result_metrics = nullptr,
+        std::optional<clp_s::epochtime_t> timestamp_lower_bound = std::nullopt
+);
 void search(
         std::shared_ptr<clp_s::search::ast::Expression> expr,
         bool ignore_case,
-        std::vector<int64_t> const& expected_results
+        std::vector<int64_t> const& expected_results,
+        std::set<std::string>* predicate_orders = nullptr,
+        clp_s::search::SearchResultMetrics* result_metrics = nullptr,
+        std::optional<clp_s::epochtime_t> timestamp_lower_bound = std::nullopt
 );
+/**
+ * Searches for every permutation of the given operands joined by `op`, requiring that each
+ * permutation returns the expected results.
+ * @param operands
+ * @param op
+ * @param expected_results
+ * @return The predicate orders chosen for each permutation, in the order the permutations were
+ * searched.
+ */
+auto search_operand_permutations(
+        std::vector<std::string> operands,
+        std::string_view op,
+        std::vector<int64_t> const& expected_results
+) -> std::vector<std::set<std::string>>;
 void validate_results(
         std::vector<clp_s::VectorOutputHandler::QueryResult> const& results,
         std::vector<int64_t> const& expected_results
 );
+/**
+ * Converts a wildcard string into a KQL string value that the KQL parser turns back into the same
+ * wildcard string. Wildcards and escape sequences are kept as is since KQL uses the same syntax for
+ * them.
+ * @param wildcard_string
+ * @return The KQL string value, without the surrounding quotes.
+ */
+auto wildcard_string_to_kql_value(std::string_view wildcard_string) -> std::string;
+/**
+ * Finds the records in a test input file whose `msg` field matches a wildcard string.
+ * @param test_input_path
+ * @param wildcard_string
+ * @param case_sensitive_match
+ * @return The `idx` of every matching record.
+ */
+auto get_records_with_msg_matching(
+        std::string_view test_input_path,
+        std::string_view wildcard_string,
+        bool case_sensitive_match
+) -> std::vector<int64_t>;
 
 auto get_test_input_path_relative_to_tests_dir(std::string_view test_input_path)
         -> std::filesystem::path {
@@ -129,17 +207,33 @@ void validate_results(
     REQUIRE(results.size() == expected_results.size());
 }
 
-void
-search(std::string const& query, bool ignore_case, std::vector<int64_t> const& expected_results) {
+void search(
+        std::string const& query,
+        bool ignore_case,
+        std::vector<int64_t> const& expected_results,
+        std::set<std::string>* predicate_orders,
+        clp_s::search::SearchResultMetrics* result_metrics,
+        std::optional<clp_s::epochtime_t> timestamp_lower_bound
+) {
     auto query_stream = std::istringstream{query};
     auto expr = clp_s::search::kql::parse_kql_expression(query_stream);
-    search(expr, ignore_case, expected_results);
+    search(
+            expr,
+            ignore_case,
+            expected_results,
+            predicate_orders,
+            result_metrics,
+            timestamp_lower_bound
+    );
 }
 
 void search(
         std::shared_ptr<clp_s::search::ast::Expression> expr,
         bool ignore_case,
-        std::vector<int64_t> const& expected_results
+        std::vector<int64_t> const& expected_results,
+        std::set<std::string>* predicate_orders,
+        clp_s::search::SearchResultMetrics* result_metrics,
+        std::optional<clp_s::epochtime_t> timestamp_lower_bound
 ) {
     REQUIRE(nullptr != expr);
     REQUIRE(nullptr == std::dynamic_pointer_cast<clp_s::search::ast::EmptyExpr>(expr));
@@ -186,7 +280,15 @@ void search(
         archive_expr = match_pass->run(archive_expr);
         REQUIRE(nullptr != archive_expr);
 
-        auto output_handler = std::make_unique<clp_s::VectorOutputHandler>(results);
+        std::unique_ptr<clp_s::VectorOutputHandler> output_handler;
+        if (timestamp_lower_bound.has_value()) {
+            output_handler = std::make_unique<LatestResultsVectorOutputHandler>(
+                    results,
+                    timestamp_lower_bound.value()
+            );
+        } else {
+            output_handler = std::make_unique<clp_s::VectorOutputHandler>(results);
+        }
         clp_s::search::Output output_pass(
                 match_pass,
                 archive_expr,
@@ -195,11 +297,76 @@ void search(
                 ignore_case
         );
         output_pass.filter();
+        if (nullptr != predicate_orders) {
+            auto const& orders{output_pass.get_predicate_order_metrics().orders};
+            predicate_orders->insert(orders.begin(), orders.end());
+        }
+        if (nullptr != result_metrics) {
+            result_metrics->num_schemas_pruned_by_packed_stream_index
+                    += output_pass.get_result_metrics().num_schemas_pruned_by_packed_stream_index;
+        }
         archive_reader->close();
     }
 
     validate_results(results, expected_results);
 }
+
+auto search_operand_permutations(
+        std::vector<std::string> operands,
+        std::string_view op,
+        std::vector<int64_t> const& expected_results
+) -> std::vector<std::set<std::string>> {
+    std::vector<std::set<std::string>> predicate_orders;
+    std::sort(operands.begin(), operands.end());
+    do {
+        std::string query;
+        for (auto const& operand : operands) {
+            if (false == query.empty()) {
+                query += fmt::format(" {} ", op);
+            }
+            query += operand;
+        }
+        CAPTURE(query);
+        REQUIRE_NOTHROW(search(query, false, expected_results, &predicate_orders.emplace_back()));
+    } while (std::next_permutation(operands.begin(), operands.end()));
+    return predicate_orders;
+}
+
+auto wildcard_string_to_kql_value(std::string_view wildcard_string) -> std::string {
+    std::string kql_value;
+    for (auto const c : wildcard_string) {
+        if ('"' == c) {
+            kql_value += R"(\")";
+        } else if (static_cast<unsigned char>(c) < 0x20) {
+            kql_value += fmt::format("\\u{:04x}", static_cast<unsigned char>(c));
+        } else {
+            kql_value += c;
+        }
+    }
+    return kql_value;
+}
+
+auto get_records_with_msg_matching(
+        std::string_view test_input_path,
+        std::string_view wildcard_string,
+        bool case_sensitive_match
+) -> std::vector<int64_t> {
+    std::vector<int64_t> matching_records;
+    std::ifstream input_file{get_test_input_local_path(test_input_path)};
+    std::string line;
+    while (std::getline(input_file, line)) {
+        auto const record = nlohmann::json::parse(line);
+        if (clp::string_utils::wildcard_match_unsafe(
+                    record[cTestMsgKey].get<std::string>(),
+                    wildcard_string,
+                    case_sensitive_match
+            ))
+        {
+            matching_records.push_back(record[cTestIdxKey].get<int64_t>());
+        }
+    }
+    return matching_records;
+}
 }  // namespace
 
 TEST_CASE("clp-s-search", "[clp-s][search]") {
@@ -323,6 +490,29 @@ TEST_CASE("clp-s-search-float-timestamp", "[clp-s][search]") {
         CAPTURE(query);
         REQUIRE_NOTHROW(search(query, false, expected_results));
     }
+
+    // Searches that only keep the latest results prune records, tables, and archives by comparing
+    // the lower bound (in milliseconds) against the timestamp column's range and values, so those
+    // must be in milliseconds too.
+    std::vector<std::pair<clp_s::epochtime_t, std::vector<int64_t>>> const
+            timestamp_lower_bounds_and_results{
+                    {1'759'417'024'000, {0, 1, 2}},
+                    {1'759'417'024'150, {1, 2}},
+                    {1'759'417'024'250, {2}},
+                    {1'759'417'024'350, {}}
+            };
+    for (auto const& [timestamp_lower_bound, expected_results] : timestamp_lower_bounds_and_results)
+    {
+        CAPTURE(timestamp_lower_bound);
+        REQUIRE_NOTHROW(search(
+                R"aa(timestamp > timestamp("1759417023"))aa",
+                false,
+                expected_results,
+                nullptr,
+                nullptr,
+                timestamp_lower_bound
+        ));
+    }
 }
 
 TEST_CASE("clp-s-search-epoch-timestamp", "[clp-s][search]") {
@@ -355,3 +545,267 @@ TEST_CASE("clp-s-search-epoch-timestamp", "[clp-s][search]") {
         REQUIRE_NOTHROW(search(query, false, expected_results));
     }
 }
+
+TEST_CASE("clp-s-search-predicate-order", "[clp-s][search]") {
+    TestOutputCleaner const test_cleanup{{std::string{cTestSearchArchiveDirectory}}};
+
+    REQUIRE_NOTHROW(
+            std::ignore = compress_archive(
+                    get_test_input_local_path(cTestSearchInputFile),
+                    std::string{cTestSearchArchiveDirectory},
+                    std::string{cTestIdxKey},
+                    false,
+                    false,
+                    false
+            )
+    );
+
+    SECTION("Reordering operands doesn't change the results") {
+        std::ignore = search_operand_permutations(
+                {R"aa(idx > 0)aa", R"aa(msg: "*Abc123*")aa", R"aa(NOT idx: 3)aa"},
+                "AND",
+                {1, 2, 4, 5, 6}
+        );
+        std::ignore = search_operand_permutations(
+                {R"aa(idx: 0)aa", R"aa(msg: "*Abc123*")aa", R"aa(ambiguous_varstring: "a*e")aa"},
+                "OR",
+                {0, 1, 2, 3, 4, 5, 6, 10, 11, 12}
+        );
+        std::ignore = search_operand_permutations(
+                {R"aa((idx < 3 OR idx > 11))aa", R"aa(msg: "*Abc123*")aa"},
+                "AND",
+                {1, 2}
+        );
+    }
+
+    SECTION("The chosen order doesn't depend on the query's operand order") {
+        // Each operand has a different estimated rank, so there are no ties to break by position
+        auto const and_orders{search_operand_permutations(
+                {R"aa(idx: 1)aa", R"aa(idx > 0)aa", R"aa(NOT idx: 3)aa"},
+                "AND",
+                {1}
+        )};
+        auto const or_orders{search_operand_permutations(
+                {R"aa(idx: 0)aa", R"aa(idx > 12)aa", R"aa(NOT idx: 5)aa"},
+                "OR",
+                {0, 1, 2, 3, 4, 6, 7, 8, 9, 10, 11, 12, 13}
+        )};
+        for (auto const& orders : {and_orders, or_orders}) {
+            REQUIRE_FALSE(orders.front().empty());
+            for (auto const& permutation_orders : orders) {
+                REQUIRE(orders.front() == permutation_orders);
+            }
+        }
+    }
+
+    SECTION("The chosen order is deterministic") {
+        constexpr std::string_view cQuery{
+                R"aa(msg: "*Abc123*" AND (idx < 3 OR ambiguous_varstring: "a*e") AND NOT idx: 2)aa"
+        };
+        std::set<std::string> first_orders;
+        REQUIRE_NOTHROW(search(std::string{cQuery}, false, {1}, &first_orders));
+        REQUIRE_FALSE(first_orders.empty());
+        for (size_t i{0}; i < 3; ++i) {
+            std::set<std::string> orders;
+            REQUIRE_NOTHROW(search(std::string{cQuery}, false, {1}, &orders));
+            REQUIRE(first_orders == orders);
+        }
+    }
+}
+
+TEST_CASE("clp-s-search-query-plan-cache", "[clp-s][search]") {
+    auto const parse_query = [](std::string const& query) {
+        auto query_stream = std::istringstream{query};
+        return clp_s::search::kql::parse_kql_expression(query_stream);
+    };
+    REQUIRE(clp_s::search::QueryPlanCache::is_cacheable(
+            parse_query(R"aa(idx: 0 AND msg: "*Abc*")aa")
+    ));
+    REQUIRE(false
+            == clp_s::search::QueryPlanCache::is_cacheable(
+                    parse_query(R"aa(idx: 0 AND NOT $_filename: "clp string")aa")
+            ));
+
+    TestOutputCleaner const test_cleanup{{std::string{cTestSearchArchiveDirectory}}};
+
+    // Compress the same input twice so that both archives have the same schemas
+    for (size_t i{0}; i < 2; ++i) {
+        REQUIRE_NOTHROW(
+                std::ignore = compress_archive(
+                        get_test_input_local_path(cTestSearchInputFile),
+                        std::string{cTestSearchArchiveDirectory},
+                        std::string{cTestIdxKey},
+                        false,
+                        false,
+                        false
+                )
+        );
+    }
+
+    clp_s::search::QueryPlanCache query_plan_cache;
+    auto const plan{std::make_shared<clp_s::search::QueryPlanCache::Plan const>()};
+    size_t num_archives{0};
+    for (auto const& entry : std::filesystem::directory_iterator(cTestSearchArchiveDirectory)) {
+        auto archive_reader = std::make_shared<clp_s::ArchiveReader>();
+        archive_reader->open(
+                clp_s::Path{.source{clp_s::InputSource::Filesystem}, .path{entry.path().string()}},
+                clp_s::NetworkAuthOption{}
+        );
+        clp_s::search::QueryPlanCache::Key key{*archive_reader};
+        if (0 == num_archives) {
+            REQUIRE(nullptr == query_plan_cache.find(key));
+            query_plan_cache.insert(std::move(key), plan);
+        } else {
+            REQUIRE(plan == query_plan_cache.find(key));
+        }
+        archive_reader->close();
+        ++num_archives;
+    }
+    REQUIRE(2 == num_archives);
+    REQUIRE(1 == query_plan_cache.get_metrics().num_hits);
+    REQUIRE(1 == query_plan_cache.get_metrics().num_misses);
+}
+
+TEST_CASE("clp-s-search-clp-string", "[clp-s][search]") {
+    // Each wildcard string is also matched against the original values, so that searching CLP
+    // strings (which skips decoding values whose logtype decides the match) is checked against
+    // plain wildcard matching. The values contain variables of every type, literal wildcards,
+    // backslashes, and variable placeholder characters, so their logtypes contain escaped
+    // placeholders.
+    std::vector<std::string> const wildcard_strings{
+            "*",
+            "Task 1234 finished in 56 ms",
+            "task*",
+            "*finished*",
+            "*in ? ms",
+            "*in ?? ms",
+            "*in ??? ms",
+            "*1234*",
+            "*34 fin*",
+            "Task ?234*",
+            "*k 12*",
+            "*=alice4? logged*",
+            "*10.0.0.?",
+            R"(*\**)",
+            R"(*\?*)",
+            R"(* \* and \? *)",
+            R"(*\\*)",
+            R"(escape \\ before ??)",
+            R"(*C:\\temp\\log??*)",
+            "*\x11*",
+            "placeholders ? and ? near 99",
+            "placeholders ?*? near*",
+            "a? b? c?",
+            "a?b*",
+            "a? ?2*",
+            "*1 b*",
+            "*?3",
+            "*-12 and 0x*",
+            "*3.14e? end",
+            "*ms",
+            "?*",
+            "??",
+            "no variables here at all",
+            "no match here"
+    };
+
+    TestOutputCleaner const test_cleanup{{std::string{cTestSearchArchiveDirectory}}};
+
+    REQUIRE_NOTHROW(
+            std::ignore = compress_archive(
+                    get_test_input_local_path(cTestSearchClpStringFile),
+                    std::string{cTestSearchArchiveDirectory},
+                    std::string{cTestIdxKey},
+                    false,
+                    false,
+                    false
+            )
+    );
+
+    for (auto const& wildcard_string : wildcard_strings) {
+        for (auto const ignore_case : {false, true}) {
+            auto const query{fmt::format(
+                    R"aa({}: "{}")aa",
+                    cTestMsgKey,
+                    wildcard_string_to_kql_value(wildcard_string)
+            )};
+            CAPTURE(query);
+            CAPTURE(ignore_case);
+            REQUIRE_NOTHROW(search(
+                    query,
+                    ignore_case,
+                    get_records_with_msg_matching(
+                            cTestSearchClpStringFile,
+                            wildcard_string,
+                            false == ignore_case
+                    )
+            ));
+        }
+    }
+}
+
+TEST_CASE("clp-s-search-packed-stream-dictionary-index", "[clp-s][search]") {
+    // Every query, its results, and the number of schema tables the packed stream dictionary index
+    // should prune when each table is in its own packed stream. Tables are pruned when their stream
+    // doesn't contain any of the query's possible logtypes, or when it contains a possible logtype
+    // but not the dictionary variables the query requires alongside it.
+    struct QueryAndResults {
+        std::string query;
+        std::vector<int64_t> results;
+        uint64_t num_pruned_schemas_with_per_table_streams;
+    };
+    std::vector<QueryAndResults> const queries_and_results{
+            {R"aa(msg: "user alice logged in from 10.0.0.1")aa", {0}, 3},
+            {R"aa(msg: "disk quota exceeded on host-17a")aa", {2}, 3},
+            {R"aa(msg: "disk quota exceeded on host-23b")aa", {3}, 3},
+            {R"aa(tag: "alpha")aa", {4}, 1},
+            {R"aa(tag: "beta")aa", {5}, 1},
+            {R"aa(NOT tag: "alpha")aa", {5}, 0},
+            {R"aa(msg: "user alice logged in from 10.0.0.1" OR tag: "beta")aa", {0, 5}, 4}
+    };
+
+    // With a minimum table size of one byte, every table is in its own packed stream (the input has
+    // one schema per record), while with the default minimum table size every table is in the same
+    // packed stream.
+    constexpr size_t cNumSchemas{6};
+    auto const has_per_table_streams = GENERATE(true, false);
+    size_t const min_table_size{has_per_table_streams ? 1 : cDefaultTestMinTableSize};
+    size_t const expected_num_streams{has_per_table_streams ? cNumSchemas : 1};
+
+    TestOutputCleaner const test_cleanup{{std::string{cTestSearchArchiveDirectory}}};
+
+    REQUIRE_NOTHROW(
+            std::ignore = compress_archive(
+                    get_test_input_local_path(cTestSearchPackedStreamsFile),
+                    std::string{cTestSearchArchiveDirectory},
+                    std::string{cTestIdxKey},
+                    false,
+                    false,
+                    false,
+                    min_table_size
+            )
+    );
+
+    for (auto const& entry : std::filesystem::directory_iterator(cTestSearchArchiveDirectory)) {
+        clp_s::ArchiveReader archive_reader;
+        archive_reader.open(
+                clp_s::Path{.source{clp_s::InputSource::Filesystem}, .path{entry.path().string()}},
+                clp_s::NetworkAuthOption{}
+        );
+        auto const& index{archive_reader.get_packed_stream_dictionary_index()};
+        REQUIRE(expected_num_streams == index.logtype_ids.size());
+        REQUIRE(expected_num_streams == index.var_ids.size());
+        for (auto const schema_id : archive_reader.get_schema_ids()) {
+            REQUIRE(archive_reader.get_stream_id_for_schema(schema_id) < expected_num_streams);
+        }
+        archive_reader.close();
+    }
+
+    for (auto const& [query, results, num_pruned_schemas] : queries_and_results) {
+        CAPTURE(query);
+        clp_s::search::SearchResultMetrics result_metrics;
+        REQUIRE_NOTHROW(search(query, false, results, nullptr, &result_metrics));
+        REQUIRE((has_per_table_streams ? num_pruned_schemas : 0)
+                == result_metrics.num_schemas_pruned_by_packed_stream_index);
+    }
+}
@@ -0,0 +1,220 @@
+#include <sys/socket.h>
+
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <vector>
+
+#include <boost/asio.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <nlohmann/json.hpp>
+
+#include "../src/clp_s/ArchiveCache.hpp"
+#include "../src/clp_s/CommandLineArguments.hpp"
+#include "../src/clp_s/SearchServer.hpp"
+#include "TestOutputCleaner.hpp"
+
+using boost::asio::local::stream_protocol;
+using clp_s::ArchiveCache;
+using clp_s::CommandLineArguments;
+using clp_s::SearchServer;
+
+namespace {
+constexpr std::string_view cSocketPath{"test-search-server.sock"};
+constexpr std::string_view cSearchRequest{R"(["s", "test-search-server-archive", "*"])"};
+constexpr size_t cMaxConcurrentQueries{2};
+constexpr size_t cMaxQueuedQueries{2};
+constexpr size_t cArchiveCacheCapacity{1024};
+constexpr size_t cArchiveCacheEntrySize{16};
+constexpr auto cConnectRetryInterval{std::chrono::milliseconds{10}};
+constexpr size_t cMaxNumConnectAttempts{500};
+constexpr auto cShutdownTimeout{std::chrono::seconds{10}};
+
+/**
+ * Connects to the server, retrying until it starts listening.
+ * @param io_context
+ * @return The connected socket.
+ */
+auto connect_to_server(boost::asio::io_context& io_context) -> stream_protocol::socket;
+
+/**
+ * Reads from the socket until the server closes the connection.
+ * @param socket
+ * @return The lines that the server sent.
+ */
+auto read_lines_until_eof(stream_protocol::socket& socket) -> std::vector<std::string>;
+
+/**
+ * Sends a request and reads the server's reply.
+ * @param request
+ * @return The lines that the server sent.
+ */
+auto send_request(std::string_view request) -> std::vector<std::string>;
+
+auto connect_to_server(boost::asio::io_context& io_context) -> stream_protocol::socket {
+    stream_protocol::socket socket{io_context};
+    boost::system::error_code error;
+    for (size_t i{0}; i < cMaxNumConnectAttempts; ++i) {
+        socket.connect(stream_protocol::endpoint{std::string{cSocketPath}}, error);
+        if (false == error.failed()) {
+            return socket;
+        }
+        socket.close(error);
+        std::this_thread::sleep_for(cConnectRetryInterval);
+    }
+    FAIL("Failed to connect to the search server.");
+    return socket;
+}
+
+auto read_lines_until_eof(stream_protocol::socket& socket) -> std::vector<std::string> {
+    std::string reply;
+    boost::system::error_code error;
+    boost::asio::read(socket, boost::asio::dynamic_buffer(reply), error);
+    REQUIRE(boost::asio::error::eof == error);
+
+    std::vector<std::string> lines;
+    size_t line_begin{0};
+    for (auto line_end{reply.find('\n')}; std::string::npos != line_end;
+         line_end = reply.find('\n', line_begin))
+    {
+        lines.emplace_back(reply.substr(line_begin, line_end - line_begin));
+        line_begin = line_end + 1;
+    }
+    REQUIRE(reply.size() == line_begin);
+    return lines;
+}
+
+auto send_request(std::string_view request) -> std::vector<std::string> {
+    boost::asio::io_context io_context;
+    auto socket{connect_to_server(io_context)};
+    boost::asio::write(socket, boost::asio::buffer(std::string{request} + '\n'));
+    return read_lines_until_eof(socket);
+}
+}  // namespace
+
+TEST_CASE("clp-s-search-server", "[clp-s][SearchServer]") {
+    TestOutputCleaner const test_cleanup{{std::string{cSocketPath}}};
+
+    std::vector<std::string> const results{"result 0\n", "result 1\n"};
+    auto const archive_cache{std::make_shared<ArchiveCache>(cArchiveCacheCapacity)};
+    SearchServer server{
+            std::string{cSocketPath},
+            cMaxConcurrentQueries,
+            cMaxQueuedQueries,
+            archive_cache,
+            [&](CommandLineArguments const& command_line_arguments, int results_socket_fd)
+                    -> bool {
+                if ("fail" == command_line_arguments.get_query()) {
+                    return false;
+                }
+                for (auto const& result : results) {
+                    if (-1 == ::send(results_socket_fd, result.data(), result.size(), 0)) {
+                        return false;
+                    }
+                }
+                return true;
+            }
+    };
+    auto server_future{std::async(std::launch::async, [&]() -> bool { return server.run(); })};
+
+    SECTION("Results are streamed before the status line.") {
+        auto const lines{send_request(cSearchRequest)};
+        REQUIRE(3 == lines.size());
+        REQUIRE(results[0] == lines[0] + '\n');
+        REQUIRE(results[1] == lines[1] + '\n');
+        REQUIRE(nlohmann::json{{"success", true}} == nlohmann::json::parse(lines[2]));
+    }
+
+    SECTION("Failed searches are reported in the status line.") {
+        auto const lines{send_request(R"(["s", "test-search-server-archive", "fail"])")};
+        REQUIRE(1 == lines.size());
+        auto const response = nlohmann::json::parse(lines[0]);
+        REQUIRE(false == response.at("success").get<bool>());
+        REQUIRE("search failed" == response.at("error").get<std::string>());
+    }
+
+    SECTION("Malformed requests are rejected.") {
+        for (auto const request : {std::string_view{"not json"}, std::string_view{R"(["x"])"}}) {
+            auto const lines{send_request(request)};
+            REQUIRE(1 == lines.size());
+            REQUIRE(false == nlohmann::json::parse(lines[0]).at("success").get<bool>());
+        }
+    }
+
+    SECTION("Control requests report and evict archive cache entries.") {
+        auto const put_entry = [&](std::string const& archive_id, size_t index) -> void {
+            archive_cache->put(
+                    ArchiveCache::Key{archive_id, ArchiveCache::Section::PackedStream, index},
+                    std::make_shared<int>(0),
+                    cArchiveCacheEntrySize
+            );
+        };
+        put_entry("archive-0", 0);
+        put_entry("archive-0", 1);
+        put_entry("archive-1", 0);
+        REQUIRE(nullptr
+                == archive_cache->get<int>(
+                        ArchiveCache::Key{"archive-2", ArchiveCache::Section::PackedStream, 0}
+                ));
+
+        auto const send_control_request = [](nlohmann::json const& request) -> nlohmann::json {
+            auto const lines{send_request(request.dump())};
+            REQUIRE(1 == lines.size());
+            return nlohmann::json::parse(lines[0]);
+        };
+
+        auto response = send_control_request(nlohmann::json::object({{"type", "stats"}}));
+        REQUIRE(response.at("success").get<bool>());
+        auto const& stats = response.at("archive_cache");
+        REQUIRE(3 == stats.at("num_insertions").get<size_t>());
+        REQUIRE(3 == stats.at("num_entries").get<size_t>());
+        REQUIRE(0 == stats.at("num_hits").get<size_t>());
+        REQUIRE(1 == stats.at("num_misses").get<size_t>());
+        REQUIRE(3 * cArchiveCacheEntrySize == stats.at("size_in_bytes").get<size_t>());
+        REQUIRE(cArchiveCacheCapacity == stats.at("capacity_in_bytes").get<size_t>());
+
+        response = send_control_request(
+                nlohmann::json::object({{"type", "evict"}, {"archive_id", "archive-0"}})
+        );
+        REQUIRE(response.at("success").get<bool>());
+        REQUIRE(2 == response.at("num_evicted_entries").get<size_t>());
+        REQUIRE(1 == archive_cache->get_metrics().num_entries);
+
+        response = send_control_request(nlohmann::json::object({{"type", "evict"}}));
+        REQUIRE(response.at("success").get<bool>());
+        REQUIRE(1 == response.at("num_evicted_entries").get<size_t>());
+        REQUIRE(0 == archive_cache->get_metrics().num_entries);
+
+        for (auto const& request :
+             {nlohmann::json::object({{"type", "unknown"}}),
+              nlohmann::json::object({{"type", "evict"}, {"archive_id", 0}}),
+              nlohmann::json::object()})
+        {
+            REQUIRE(false == send_control_request(request).at("success").get<bool>());
+        }
+    }
+
+    SECTION("Shutdown doesn't wait for idle clients.") {
+        boost::asio::io_context io_context;
+        auto idle_socket{connect_to_server(io_context)};
+        // Wait until the server has accepted the connection and started reading its request.
+        REQUIRE(1 == send_request(R"(["x"])").size());
+
+        server.stop();
+        REQUIRE(std::future_status::ready == server_future.wait_for(cShutdownTimeout));
+
+        auto const lines{read_lines_until_eof(idle_socket)};
+        REQUIRE(1 == lines.size());
+        auto const response = nlohmann::json::parse(lines[0]);
+        REQUIRE(false == response.at("success").get<bool>());
+        REQUIRE("server is shutting down" == response.at("error").get<std::string>());
+    }
+
+    server.stop();
+    REQUIRE(std::future_status::ready == server_future.wait_for(cShutdownTimeout));
+    REQUIRE(server_future.get());
+}
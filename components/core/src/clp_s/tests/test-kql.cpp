@@ -6,6 +6,7 @@
 #include <catch2/generators/catch_generators.hpp>
 #include <fmt/base.h>
 #include <fmt/format.h>
+#include <regex_utils/RegexMatcher.hpp>
 #include <spdlog/spdlog.h>
 
 #include "../src/clp_s/search/ast/AndExpr.hpp"
@@ -333,6 +334,55 @@ TEST_CASE("Test parsing KQL", "[KQL]") {
         REQUIRE(column_token == *it);
     }
 
+    SECTION("Regex values") {
+        auto translated_pair = GENERATE(
+                std::pair{"key: /ab+c/", "ab+c"},
+                std::pair{"key: /^task_[0-9]+$/", "^task_[0-9]+$"},
+                std::pair{"key: /a\\.b|c\\(d/", "a\\.b|c\\(d"},
+                std::pair{"key: /a/b/", "a/b"}
+        );
+        stringstream query{translated_pair.first};
+        auto filter = std::dynamic_pointer_cast<FilterExpr>(parse_kql_expression(query));
+        REQUIRE(nullptr != filter);
+        REQUIRE(nullptr != filter->get_operand());
+        REQUIRE(FilterOperation::EQ == filter->get_operation());
+        auto const regex_matcher = filter->get_operand()->get_regex_matcher(true);
+        REQUIRE(nullptr != regex_matcher);
+        REQUIRE(translated_pair.second == regex_matcher->get_regex());
+        REQUIRE(regex_matcher->get_regex()
+                == filter->get_operand()->get_regex_matcher(false)->get_regex());
+
+        // The literal's string value is the regex's wildcard superset
+        std::string extracted_value;
+        REQUIRE((filter->get_operand()->as_var_string(extracted_value, FilterOperation::EQ)
+                 || filter->get_operand()->as_clp_string(extracted_value, FilterOperation::EQ)));
+        REQUIRE(regex_matcher->get_wildcard_superset() == extracted_value);
+    }
+
+    SECTION("Values that aren't regexes") {
+        auto translated_pair = GENERATE(
+                std::pair{"key: \"/var/log/\"", "/var/log/"},
+                std::pair{"key: \"/ab+c/\"", "/ab+c/"},
+                std::pair{"key: \"\\/a/\"", "/a/"},
+                std::pair{"key: //", "//"},
+                std::pair{"key: /", "/"}
+        );
+        stringstream query{translated_pair.first};
+        auto filter = std::dynamic_pointer_cast<FilterExpr>(parse_kql_expression(query));
+        REQUIRE(nullptr != filter);
+        REQUIRE(nullptr != filter->get_operand());
+        REQUIRE(nullptr == filter->get_operand()->get_regex_matcher(true));
+        std::string extracted_value;
+        REQUIRE(filter->get_operand()->as_var_string(extracted_value, FilterOperation::EQ));
+        REQUIRE(translated_pair.second == extracted_value);
+    }
+
+    SECTION("Invalid regex values") {
+        auto query = GENERATE("key: /a[b/", "key: /a**/", "key: /+a/");
+        stringstream invalid_regex{query};
+        REQUIRE(nullptr == parse_kql_expression(invalid_regex));
+    }
+
     SECTION("Timestamp expressions are parsed correctly.") {
         auto const [query, expected_operation] = GENERATE(
                 std::make_pair(
@@ -0,0 +1,349 @@
+#include "CompiledTimestampPattern.hpp"
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string_view>
+
+#include <date/date.h>
+#include <ystdlib/error_handling/Result.hpp>
+
+#include "../Defs.hpp"
+#include "ErrorCode.hpp"
+#include "TimestampParser.hpp"
+
+namespace clp_s::timestamp_parser {
+namespace {
+constexpr int cMinParsedDay{1};
+constexpr int cMaxParsedDay{31};
+constexpr int cMinParsedMonth{1};
+constexpr int cMaxParsedMonth{12};
+constexpr int cTwoDigitYearOffsetBoundary{69};
+constexpr int cTwoDigitYearLowOffset{1900};
+constexpr int cTwoDigitYearHighOffset{2000};
+constexpr int cMaxParsedHour24HourClock{23};
+constexpr int cMaxParsedMinute{59};
+constexpr int cMaxParsedSecond{59};
+constexpr int cLeapSecond{60};
+
+constexpr int cDefaultYear{1970};
+constexpr int cDefaultMonth{1};
+constexpr int cDefaultDay{1};
+
+constexpr int cMillisecondsToNanoseconds{1'000'000};
+constexpr int cMicrosecondsToNanoseconds{1000};
+
+constexpr std::string_view cJsonEscapedBackslash{R"(\\)"};
+
+/**
+ * @param specifier
+ * @return The width of the field captured by `specifier`, or std::nullopt if `specifier` doesn't
+ * capture a fixed-width numeric field.
+ */
+[[nodiscard]] auto get_fixed_field_length(char specifier) -> std::optional<size_t>;
+
+/**
+ * @param specifier
+ * @return Whether `specifier` captures part of the date or the hour.
+ */
+[[nodiscard]] auto is_date_or_hour_specifier(char specifier) -> bool;
+
+/**
+ * Converts a fixed-width field made up of padded decimal digits to a number, accepting exactly the
+ * same digit strings as `parse_timestamp`.
+ * @param field
+ * @param padding_character
+ * @return A result containing the number, or an error code indicating the failure:
+ * - ErrorCodeEnum::IncompatibleTimestampPattern if a space-padded field is also zero-padded.
+ * - ErrorCodeEnum::UnsupportedTimestampContent if the field contains anything other than padding
+ *   followed by decimal digits.
+ */
+[[nodiscard]] auto
+convert_fixed_width_field_to_number(std::string_view field, char padding_character)
+        -> ystdlib::error_handling::Result<int>;
+
+auto get_fixed_field_length(char specifier) -> std::optional<size_t> {
+    switch (specifier) {
+        case 'y':
+        case 'm':
+        case 'd':
+        case 'e':
+        case 'H':
+        case 'k':
+        case 'M':
+        case 'S':
+        case 'J':
+            return 2;
+        case '3':
+            return 3;
+        case 'Y':
+            return 4;
+        case '6':
+            return 6;
+        case '9':
+            return 9;
+        default:
+            return std::nullopt;
+    }
+}
+
+auto is_date_or_hour_specifier(char specifier) -> bool {
+    switch (specifier) {
+        case 'y':
+        case 'Y':
+        case 'm':
+        case 'd':
+        case 'e':
+        case 'H':
+        case 'k':
+            return true;
+        default:
+            return false;
+    }
+}
+
+auto convert_fixed_width_field_to_number(std::string_view field, char padding_character)
+        -> ystdlib::error_handling::Result<int> {
+    size_t idx{};
+    if (' ' == padding_character) {
+        for (; idx < field.size() - 1 && ' ' == field[idx]; ++idx) {}
+        if (field.size() - idx > 1 && '0' == field[idx]) {
+            return ErrorCode{ErrorCodeEnum::IncompatibleTimestampPattern};
+        }
+    }
+
+    int number{};
+    for (; idx < field.size(); ++idx) {
+        auto const c{field[idx]};
+        if (c < '0' || c > '9') {
+            return ErrorCode{ErrorCodeEnum::UnsupportedTimestampContent};
+        }
+        constexpr int cTen{10};
+        number = number * cTen + (c - '0');
+    }
+    return number;
+}
+}  // namespace
+
+auto CompiledTimestampPattern::create(TimestampPattern const& pattern, bool is_json_literal)
+        -> std::optional<CompiledTimestampPattern> {
+    if (false == pattern.uses_date_type_representation() || pattern.uses_twelve_hour_clock()) {
+        return std::nullopt;
+    }
+
+    CompiledTimestampPattern compiled_pattern;
+    auto& timestamp_template{compiled_pattern.m_template};
+    auto& literal_spans{compiled_pattern.m_literal_spans};
+    auto const append_literal = [&](std::string_view literal) {
+        if (literal.empty()) {
+            return;
+        }
+        auto const offset{timestamp_template.size()};
+        if (false == literal_spans.empty()
+            && literal_spans.back().first + literal_spans.back().second == offset)
+        {
+            literal_spans.back().second += literal.size();
+        } else {
+            literal_spans.emplace_back(offset, literal.size());
+        }
+        timestamp_template.append(literal);
+    };
+
+    auto const raw_pattern{pattern.get_pattern()};
+    bool const should_skip_quotes{pattern.is_quoted_pattern() && false == is_json_literal};
+    size_t pattern_idx{should_skip_quotes ? size_t{1} : size_t{0}};
+    size_t const pattern_end_idx{
+            raw_pattern.length() - (should_skip_quotes ? size_t{1} : size_t{0})
+    };
+    bool escaped{false};
+    bool has_date_or_hour_field{false};
+    for (; pattern_idx < pattern_end_idx; ++pattern_idx) {
+        auto const c{raw_pattern[pattern_idx]};
+        if (false == escaped) {
+            if ('\\' == c) {
+                escaped = true;
+            } else {
+                append_literal(raw_pattern.substr(pattern_idx, 1));
+            }
+            continue;
+        }
+
+        escaped = false;
+        if (auto const optional_field_length{get_fixed_field_length(c)};
+            optional_field_length.has_value())
+        {
+            auto const offset{timestamp_template.size()};
+            auto const field_length{optional_field_length.value()};
+            compiled_pattern.m_fields.emplace_back(Field{offset, field_length, c});
+            timestamp_template.append(field_length, '\0');
+
+            // Fields are appended in order, so the date and hour range starts at the first such
+            // field and ends at the last one
+            if (is_date_or_hour_specifier(c)) {
+                if (false == has_date_or_hour_field) {
+                    compiled_pattern.m_date_and_hour_begin_offset = offset;
+                    has_date_or_hour_field = true;
+                }
+                compiled_pattern.m_date_and_hour_end_offset = offset + field_length;
+            }
+            continue;
+        }
+
+        switch (c) {
+            case 'z':
+            case 'o': {
+                auto const& optional_timezone_info{pattern.get_optional_timezone_info()};
+                if (false == optional_timezone_info.has_value()) {
+                    return std::nullopt;
+                }
+                auto const& timezone_info{optional_timezone_info.value()};
+                append_literal(
+                        raw_pattern.substr(pattern_idx + 2ULL, timezone_info.timestamp_length)
+                );
+                compiled_pattern.m_timezone_offset_in_minutes = timezone_info.offset;
+                pattern_idx += timezone_info.pattern_length;
+                break;
+            }
+            case '\\':
+                append_literal(is_json_literal ? cJsonEscapedBackslash : "\\");
+                break;
+            default:
+                // Variable-width format specifiers and CAT sequences can't be compiled
+                return std::nullopt;
+        }
+    }
+    if (escaped) {
+        return std::nullopt;
+    }
+
+    return compiled_pattern;
+}
+
+auto CompiledTimestampPattern::parse(std::string_view timestamp)
+        -> ystdlib::error_handling::Result<epochtime_t> {
+    if (timestamp.size() != m_template.size()) {
+        return ErrorCode{ErrorCodeEnum::IncompatibleTimestampPattern};
+    }
+    for (auto const& [offset, length] : m_literal_spans) {
+        if (timestamp.substr(offset, length)
+            != std::string_view{m_template}.substr(offset, length))
+        {
+            return ErrorCode{ErrorCodeEnum::IncompatibleTimestampPattern};
+        }
+    }
+
+    auto const date_and_hour{timestamp.substr(
+            m_date_and_hour_begin_offset,
+            m_date_and_hour_end_offset - m_date_and_hour_begin_offset
+    )};
+    bool const can_reuse_date_and_hour{
+            m_has_cached_date_and_hour && date_and_hour == m_cached_date_and_hour
+    };
+
+    int parsed_year{cDefaultYear};
+    int parsed_month{cDefaultMonth};
+    int parsed_day{cDefaultDay};
+    int parsed_hour{};
+    int parsed_minute{};
+    int parsed_second{};
+    int parsed_subsecond_nanoseconds{};
+    for (auto const& field : m_fields) {
+        if (can_reuse_date_and_hour && is_date_or_hour_specifier(field.specifier)) {
+            continue;
+        }
+
+        auto const content{timestamp.substr(field.offset, field.length)};
+        char const padding_character{
+                ('e' == field.specifier || 'k' == field.specifier) ? ' ' : '0'
+        };
+        auto const number{YSTDLIB_ERROR_HANDLING_TRYX(
+                convert_fixed_width_field_to_number(content, padding_character)
+        )};
+        switch (field.specifier) {
+            case 'y':
+                parsed_year = number
+                              + (number >= cTwoDigitYearOffsetBoundary ? cTwoDigitYearLowOffset
+                                                                       : cTwoDigitYearHighOffset);
+                break;
+            case 'Y':
+                parsed_year = number;
+                break;
+            case 'm':
+                if (number < cMinParsedMonth || number > cMaxParsedMonth) {
+                    return ErrorCode{ErrorCodeEnum::IncompatibleTimestampPattern};
+                }
+                parsed_month = number;
+                break;
+            case 'd':
+            case 'e':
+                if (number < cMinParsedDay || number > cMaxParsedDay) {
+                    return ErrorCode{ErrorCodeEnum::IncompatibleTimestampPattern};
+                }
+                parsed_day = number;
+                break;
+            case 'H':
+            case 'k':
+                if (number > cMaxParsedHour24HourClock) {
+                    return ErrorCode{ErrorCodeEnum::IncompatibleTimestampPattern};
+                }
+                parsed_hour = number;
+                break;
+            case 'M':
+                if (number > cMaxParsedMinute) {
+                    return ErrorCode{ErrorCodeEnum::IncompatibleTimestampPattern};
+                }
+                parsed_minute = number;
+                break;
+            case 'S':
+                if (number > cMaxParsedSecond) {
+                    return ErrorCode{ErrorCodeEnum::IncompatibleTimestampPattern};
+                }
+                parsed_second = number;
+                break;
+            case 'J':
+                if (cLeapSecond != number) {
+                    return ErrorCode{ErrorCodeEnum::IncompatibleTimestampPattern};
+                }
+                parsed_second = cMaxParsedSecond;
+                break;
+            case '3':
+                parsed_subsecond_nanoseconds = number * cMillisecondsToNanoseconds;
+                break;
+            case '6':
+                parsed_subsecond_nanoseconds = number * cMicrosecondsToNanoseconds;
+                break;
+            case '9':
+                parsed_subsecond_nanoseconds = number;
+                break;
+            default:
+                return ErrorCode{ErrorCodeEnum::InvalidTimestampPattern};
+        }
+    }
+
+    if (false == can_reuse_date_and_hour) {
+        auto const year_month_day{date::year(parsed_year) / parsed_month / parsed_day};
+        if (false == year_month_day.ok()) {
+            return ErrorCode{ErrorCodeEnum::InvalidDate};
+        }
+        auto const date_and_hour_time_point{
+                date::sys_days{year_month_day} + std::chrono::hours{parsed_hour}
+        };
+        m_cached_date_and_hour_epoch_nanoseconds
+                = std::chrono::duration_cast<std::chrono::nanoseconds>(
+                          date_and_hour_time_point.time_since_epoch()
+                )
+                          .count();
+        m_cached_date_and_hour.assign(date_and_hour);
+        m_has_cached_date_and_hour = true;
+    }
+
+    auto const time_since_date_and_hour{
+            std::chrono::minutes{parsed_minute} + std::chrono::seconds{parsed_second}
+            + std::chrono::nanoseconds{parsed_subsecond_nanoseconds}
+            - std::chrono::minutes{m_timezone_offset_in_minutes}
+    };
+    return m_cached_date_and_hour_epoch_nanoseconds
+           + std::chrono::duration_cast<std::chrono::nanoseconds>(time_since_date_and_hour).count();
+}
+}  // namespace clp_s::timestamp_parser
@@ -0,0 +1,89 @@
+#ifndef CLP_S_TIMESTAMP_PARSER_COMPILEDTIMESTAMPPATTERN_HPP
+#define CLP_S_TIMESTAMP_PARSER_COMPILEDTIMESTAMPPATTERN_HPP
+
+#include <cstddef>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <ystdlib/error_handling/Result.hpp>
+
+#include "../Defs.hpp"
+#include "TimestampParser.hpp"
+
+namespace clp_s::timestamp_parser {
+/**
+ * A timestamp pattern compiled into a specialized parser for fixed-width date-time timestamps.
+ *
+ * Patterns made up of only literals, fixed-width numeric format specifiers (\y, \Y, \m, \d, \e, \H,
+ * \k, \M, \S, \J, \3, \6, \9), fixed timezones (\z{...}, \o{...,...}), and literal backslashes
+ * place every field at the same offset in every timestamp they match. A compiled pattern parses
+ * such timestamps by checking their length and separators, and then converting each field in
+ * place, without interpreting the pattern.
+ *
+ * Consecutive timestamps usually share their date and hour, so the compiled pattern also caches the
+ * epoch time of the last date and hour it parsed, and reuses it while the timestamp's date and hour
+ * fields are unchanged.
+ *
+ * `parse_timestamp` remains the reference parser: the compiled pattern only handles fields made up
+ * of (padded) decimal digits, and reports any other content as unsupported so that the caller can
+ * fall back to `parse_timestamp`.
+ */
+class CompiledTimestampPattern {
+public:
+    // Factory functions
+    /**
+     * @param pattern A timestamp pattern without CAT sequences.
+     * @param is_json_literal Whether the timestamps that will be parsed are JSON literals or raw
+     * UTF-8 strings.
+     * @return The compiled pattern, or std::nullopt if `pattern` isn't a fixed-width date-time
+     * pattern.
+     */
+    [[nodiscard]] static auto create(TimestampPattern const& pattern, bool is_json_literal)
+            -> std::optional<CompiledTimestampPattern>;
+
+    // Methods
+    /**
+     * Parses a timestamp.
+     * @param timestamp
+     * @return A result containing the timestamp in epoch nanoseconds, or an error code indicating
+     * the failure:
+     * - ErrorCodeEnum::IncompatibleTimestampPattern if the pattern is not able to exactly consume
+     *   the timestamp.
+     * - ErrorCodeEnum::InvalidDate if the timestamp's fields don't form a valid date.
+     * - ErrorCodeEnum::UnsupportedTimestampContent if a field contains content other than padded
+     *   decimal digits, in which case the timestamp must be parsed with `parse_timestamp`.
+     */
+    [[nodiscard]] auto parse(std::string_view timestamp)
+            -> ystdlib::error_handling::Result<epochtime_t>;
+
+private:
+    // Types
+    struct Field {
+        size_t offset;
+        size_t length;
+        char specifier;
+    };
+
+    // Constructor
+    CompiledTimestampPattern() = default;
+
+    // Variables
+    // The timestamp's literal content at the offsets covered by `m_literal_spans`
+    std::string m_template;
+    std::vector<std::pair<size_t, size_t>> m_literal_spans;
+    std::vector<Field> m_fields;
+    int m_timezone_offset_in_minutes{};
+
+    // The range of the timestamp covering its date and hour fields
+    size_t m_date_and_hour_begin_offset{};
+    size_t m_date_and_hour_end_offset{};
+    bool m_has_cached_date_and_hour{false};
+    std::string m_cached_date_and_hour;
+    epochtime_t m_cached_date_and_hour_epoch_nanoseconds{};
+};
+}  // namespace clp_s::timestamp_parser
+
+#endif  // CLP_S_TIMESTAMP_PARSER_COMPILEDTIMESTAMPPATTERN_HPP
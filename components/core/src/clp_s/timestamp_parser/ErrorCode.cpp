@@ -29,6 +29,8 @@ auto ErrorCategory::message(ErrorCodeEnum error_enum) const -> std::string {
             return "Timestamp pattern contains an unsupported escape sequence";
         case ErrorCodeEnum::InvalidCharacter:
             return "Timestamp pattern contains an unsupported character";
+        case ErrorCodeEnum::UnsupportedTimestampContent:
+            return "Timestamp contains content that the compiled timestamp pattern can't parse";
         default:
             return "Unknown error code enum";
     }
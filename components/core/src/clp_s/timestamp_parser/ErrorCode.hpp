@@ -12,7 +12,8 @@ enum class ErrorCodeEnum : uint8_t {
     InvalidDate,
     InvalidTimezoneOffset,
     InvalidEscapeSequence,
-    InvalidCharacter
+    InvalidCharacter,
+    UnsupportedTimestampContent
 };
 
 using ErrorCode = ystdlib::error_handling::ErrorCode<ErrorCodeEnum>;
@@ -0,0 +1,204 @@
+#include <chrono>
+#include <cstddef>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch_message.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <fmt/core.h>
+#include <fmt/format.h>
+
+#include "../../Defs.hpp"
+#include "../CompiledTimestampPattern.hpp"
+#include "../ErrorCode.hpp"
+#include "../TimestampParser.hpp"
+
+namespace clp_s::timestamp_parser::test {
+namespace {
+constexpr size_t cNumBenchmarkTimestamps{1'000'000};
+
+/**
+ * Asserts that a compiled pattern parses `timestamp` exactly like `parse_timestamp`, unless it
+ * reports the timestamp's content as unsupported.
+ * @param compiled_pattern
+ * @param pattern
+ * @param timestamp
+ * @param is_json_literal
+ */
+void assert_compiled_pattern_matches_parse_timestamp(
+        CompiledTimestampPattern& compiled_pattern,
+        TimestampPattern const& pattern,
+        std::string_view timestamp,
+        bool is_json_literal
+);
+
+void assert_compiled_pattern_matches_parse_timestamp(
+        CompiledTimestampPattern& compiled_pattern,
+        TimestampPattern const& pattern,
+        std::string_view timestamp,
+        bool is_json_literal
+) {
+    CAPTURE(pattern.get_pattern());
+    CAPTURE(timestamp);
+    CAPTURE(is_json_literal);
+
+    std::string generated_pattern;
+    auto const expected_result{
+            parse_timestamp(timestamp, pattern, is_json_literal, generated_pattern)
+    };
+    // Parse twice so that the second parse exercises the cached date and hour.
+    for (size_t i{0}; i < 2; ++i) {
+        auto const result{compiled_pattern.parse(timestamp)};
+        if (result.has_error()
+            && ErrorCode{ErrorCodeEnum::UnsupportedTimestampContent} == result.error())
+        {
+            continue;
+        }
+        REQUIRE((expected_result.has_error() == result.has_error()));
+        if (false == result.has_error()) {
+            REQUIRE((expected_result.value().first == result.value()));
+        }
+    }
+}
+}  // namespace
+
+TEST_CASE("compiled_timestamp_pattern_create", "[clp-s][timestamp-parser]") {
+    SECTION("Fixed-width date-time patterns are compiled.") {
+        auto const pattern{GENERATE(
+                R"(\Y-\m-\d \H:\M:\S.\3)",
+                R"(\Y-\m-\dT\H:\M:\S.\6\z{+08:00})",
+                R"(\d/\m/\Y \H:\M:\S,\9 \o{PST,-0800})",
+                R"(\y/\m/\e \k:\M:\J)",
+                R"(\Y\\\m)"
+        )};
+        auto const timestamp_pattern_result{TimestampPattern::create(pattern)};
+        REQUIRE_FALSE(timestamp_pattern_result.has_error());
+        REQUIRE(CompiledTimestampPattern::create(timestamp_pattern_result.value(), false)
+                        .has_value());
+        REQUIRE(CompiledTimestampPattern::create(timestamp_pattern_result.value(), true)
+                        .has_value());
+    }
+
+    SECTION("Variable-width, 12-hour clock, and epoch patterns aren't compiled.") {
+        auto const pattern{GENERATE(
+                R"(\Y-\B-\d \H:\M:\S)",
+                R"(\A \Y-\m-\d \H:\M:\S)",
+                R"(\Y-\m-\d \I:\M:\S \p)",
+                R"(\Y-\m-\d \H:\M:\S.\T)",
+                R"(\E)",
+                R"(\L)"
+        )};
+        auto const timestamp_pattern_result{TimestampPattern::create(pattern)};
+        REQUIRE_FALSE(timestamp_pattern_result.has_error());
+        REQUIRE_FALSE(CompiledTimestampPattern::create(timestamp_pattern_result.value(), false)
+                              .has_value());
+    }
+}
+
+TEST_CASE("compiled_timestamp_pattern_parse", "[clp-s][timestamp-parser]") {
+    std::vector<std::string> const patterns{
+            R"(\Y-\m-\d \H:\M:\S.\3)",
+            R"(\Y-\m-\dT\H:\M:\S.\6\z{+08:00})",
+            R"("\y/\m/\e \k:\M:\J")",
+            R"(\d/\m/\Y \H:\M:\S,\9 \o{PST,-0800})",
+            R"(\Y\\\m)"
+    };
+    std::vector<std::string> const timestamps{
+            "2024-02-29 23:59:59.123",
+            "2023-02-29 00:00:00.000",
+            "2024-13-01 00:00:00.000",
+            "2024-01-01 -1:00:00.000",
+            "2024-01-01 1:00:00.0000",
+            "0000-01-01 00:00:00.000",
+            "2024-05-06T07:08:09.123456+08:00",
+            "2024-05-06T07:08:09.123456+08:01",
+            R"("99/12/ 5  3:04:60")",
+            R"("01/01/05 03:04:60")",
+            R"("-1/12/ 5  3:04:60")",
+            R"("99/12/ 5  3:04:59")",
+            "31/12/1999 23:59:59,000000001 PST",
+            "01/01/2000 00:00:00,999999999 PST",
+            R"(2024\05)",
+            R"(2024\\05)"
+    };
+
+    for (auto const& pattern : patterns) {
+        auto const timestamp_pattern_result{TimestampPattern::create(pattern)};
+        REQUIRE_FALSE(timestamp_pattern_result.has_error());
+        auto const& timestamp_pattern{timestamp_pattern_result.value()};
+        for (bool const is_json_literal : {false, true}) {
+            auto optional_compiled_pattern{
+                    CompiledTimestampPattern::create(timestamp_pattern, is_json_literal)
+            };
+            REQUIRE(optional_compiled_pattern.has_value());
+            for (auto const& timestamp : timestamps) {
+                assert_compiled_pattern_matches_parse_timestamp(
+                        optional_compiled_pattern.value(),
+                        timestamp_pattern,
+                        timestamp,
+                        is_json_literal
+                );
+            }
+        }
+    }
+}
+
+/**
+ * Measures the throughput of parsing timestamps with `parse_timestamp` and with a compiled
+ * pattern. Hidden by default; run it explicitly with the `[benchmark]` tag.
+ */
+TEST_CASE("compiled_timestamp_pattern_throughput", "[.][benchmark][clp-s][timestamp-parser]") {
+    auto const timestamp_pattern_result{TimestampPattern::create(R"(\Y-\m-\dT\H:\M:\S.\3)")};
+    REQUIRE_FALSE(timestamp_pattern_result.has_error());
+    auto const& timestamp_pattern{timestamp_pattern_result.value()};
+    auto optional_compiled_pattern{CompiledTimestampPattern::create(timestamp_pattern, false)};
+    REQUIRE(optional_compiled_pattern.has_value());
+
+    // Consecutive timestamps a few milliseconds apart, like those in a typical log file
+    std::vector<std::string> timestamps;
+    timestamps.reserve(cNumBenchmarkTimestamps);
+    for (size_t i{0}; i < cNumBenchmarkTimestamps; ++i) {
+        constexpr size_t cMillisecondsBetweenTimestamps{7};
+        auto const milliseconds{i * cMillisecondsBetweenTimestamps};
+        timestamps.emplace_back(fmt::format(
+                "2024-05-06T{:02}:{:02}:{:02}.{:03}",
+                milliseconds / 3'600'000 % 24,
+                milliseconds / 60'000 % 60,
+                milliseconds / 1000 % 60,
+                milliseconds % 1000
+        ));
+    }
+
+    auto const measure_records_per_second = [&](auto&& parse) -> double {
+        epochtime_t checksum{0};
+        auto const begin{std::chrono::steady_clock::now()};
+        for (auto const& timestamp : timestamps) {
+            checksum += parse(timestamp);
+        }
+        std::chrono::duration<double> const elapsed{std::chrono::steady_clock::now() - begin};
+        REQUIRE((0 != checksum));
+        return static_cast<double>(timestamps.size()) / elapsed.count();
+    };
+
+    std::string generated_pattern;
+    auto const general_records_per_second{
+            measure_records_per_second([&](std::string_view timestamp) -> epochtime_t {
+                return parse_timestamp(timestamp, timestamp_pattern, false, generated_pattern)
+                        .value()
+                        .first;
+            })
+    };
+    auto const compiled_records_per_second{
+            measure_records_per_second([&](std::string_view timestamp) -> epochtime_t {
+                return optional_compiled_pattern->parse(timestamp).value();
+            })
+    };
+    WARN(fmt::format(
+            "parse_timestamp: {:.0f} records/s; CompiledTimestampPattern: {:.0f} records/s",
+            general_records_per_second,
+            compiled_records_per_second
+    ));
+}
+}  // namespace clp_s::timestamp_parser::test
@@ -1,13 +1,16 @@
 #ifndef GLT_ENCODEDVARIABLEINTERPRETER_HPP
 #define GLT_ENCODEDVARIABLEINTERPRETER_HPP
 
+#include <cstdint>
 #include <string>
 #include <vector>
 
+#include "ffi/encoding_methods.hpp"
 #include "ir/LogEvent.hpp"
 #include "ir/types.hpp"
 #include "Query.hpp"
 #include "TraceableException.hpp"
+#include "type_utils.hpp"
 #include "VariableDictionaryReader.hpp"
 #include "VariableDictionaryWriter.hpp"
 
@@ -73,6 +76,12 @@ public:
      * @param value
      */
     static void convert_encoded_float_to_string(encoded_variable_t encoded_var, std::string& value);
+    /**
+     * Converts the given encoded float into a double
+     * @param encoded_var
+     * @return The float's value, rounded to the nearest double
+     */
+    static double convert_encoded_float_to_double(encoded_variable_t encoded_var);
 
     /**
      * Parses all variables from a message (while constructing the logtype) and encodes them (adding
@@ -214,6 +223,29 @@ private:
             std::vector<variable_dictionary_id_t>& var_ids
     );
 };
+
+// Defined inline since it's called once per row when filtering columns by variable range
+inline double
+EncodedVariableInterpreter::convert_encoded_float_to_double(encoded_variable_t encoded_var) {
+    // Powers of ten for every decimal position an encoded float can have
+    constexpr double cPowersOfTen[] = {
+            1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11, 1e12, 1e13, 1e14, 1e15,
+            1e16
+    };
+
+    auto encoded_float = bit_cast<uint64_t>(encoded_var);
+
+    // Decode according to the format described in
+    // EncodedVariableInterpreter::convert_string_to_representable_float_var
+    uint8_t decimal_pos = (encoded_float & 0x0F) + 1;
+    encoded_float >>= 8;
+    uint64_t digits = encoded_float & ffi::cEightByteEncodedFloatDigitsBitMask;
+    encoded_float >>= 55;
+    bool is_negative = encoded_float > 0;
+
+    double value = static_cast<double>(digits) / cPowersOfTen[decimal_pos];
+    return is_negative ? -value : value;
+}
 }  // namespace glt
 
 #endif  // GLT_ENCODEDVARIABLEINTERPRETER_HPP
@@ -1,12 +1,18 @@
 #include "Grep.hpp"
 
 #include <algorithm>
+#include <functional>
+#include <iterator>
+#include <memory>
+#include <mutex>
+#include <tuple>
 
 #include <string_utils/string_utils.hpp>
 
 #include "EncodedVariableInterpreter.hpp"
 #include "ir/parsing.hpp"
 #include "ir/types.hpp"
+#include "parallel_search_utils.hpp"
 #include "StringReader.hpp"
 #include "Utils.hpp"
 
@@ -480,6 +486,492 @@ SubQueryMatchabilityResult generate_logtypes_and_vars_for_subquery(
 
     return SubQueryMatchabilityResult::MayMatch;
 }
+
+using BufferedResult = Grep::BufferedResult;
+
+// The tables, decompressor, and buffers of a worker in a parallel segment search. A worker reuses
+// them for all of its tasks, so its memory is bounded by the largest table it searches.
+struct SegmentSearchWorker {
+    streaming_archive::reader::LogtypeTable logtype_table;
+    streaming_archive::reader::CombinedLogtypeTable combined_table;
+    streaming_archive::reader::SingleLogtypeTableManager::CombinedTableDecompressor
+            combined_table_decompressor;
+    vector<size_t> matched_row_ix;
+    vector<bool> wildcard_required;
+    vector<BufferedResult> results;
+};
+
+/**
+ * Output function that appends each result to the vector of BufferedResults in custom_arg
+ * @param orig_file_path
+ * @param compressed_msg
+ * @param decompressed_msg
+ * @param custom_arg
+ */
+void buffer_result(
+        string const& orig_file_path,
+        Message const& compressed_msg,
+        string const& decompressed_msg,
+        void* custom_arg
+);
+
+/**
+ * Outputs a buffered result using the given method
+ * @param result
+ * @param archive
+ * @param output_func
+ * @param output_func_arg
+ */
+void output_buffered_result(
+        BufferedResult const& result,
+        Archive const& archive,
+        Grep::OutputFunc output_func,
+        void* output_func_arg
+);
+
+/**
+ * Outputs buffered results using the given method
+ * @param results
+ * @param archive
+ * @param output_func
+ * @param output_func_arg
+ * @return Number of results output
+ */
+size_t output_buffered_results(
+        vector<BufferedResult> const& results,
+        Archive const& archive,
+        Grep::OutputFunc output_func,
+        void* output_func_arg
+);
+
+/**
+ * Finds the rows of an open logtype table that match the query. The table is filtered one column
+ * at a time (timestamps, then each range-filtered variable) before the remaining rows are matched
+ * against the sub-queries, so columns are only loaded when they're needed.
+ * @param logtype_entry
+ * @param sub_queries The logtype's sub-queries, or empty if every row matches the search string
+ * @param query
+ * @param logtype_table
+ * @param matched_row_ix Returns the indices of the matching rows
+ * @param wildcard_required Returns whether each matching row still requires a wildcard match
+ */
+void find_matching_rows(
+        LogTypeDictionaryEntry const& logtype_entry,
+        vector<LogtypeQuery> const& sub_queries,
+        Query const& query,
+        streaming_archive::reader::LogtypeTable& logtype_table,
+        vector<size_t>& matched_row_ix,
+        vector<bool>& wildcard_required
+);
+
+/**
+ * Searches an open logtype table and outputs any results using the given method
+ * @param logtype_entry
+ * @param sub_queries The logtype's sub-queries, or empty if every row matches the search string
+ * @param query
+ * @param archive
+ * @param logtype_table
+ * @param matched_row_ix Buffer for the indices of the matching rows
+ * @param wildcard_required Buffer for whether each matching row requires a wildcard match
+ * @param output_func
+ * @param output_func_arg
+ * @return Number of matches found
+ * @throw streaming_archive::reader::Archive::OperationFailed if decompression unexpectedly fails
+ */
+size_t search_logtype_table_and_output(
+        LogTypeDictionaryEntry const& logtype_entry,
+        vector<LogtypeQuery> const& sub_queries,
+        Query const& query,
+        Archive& archive,
+        streaming_archive::reader::LogtypeTable& logtype_table,
+        vector<size_t>& matched_row_ix,
+        vector<bool>& wildcard_required,
+        Grep::OutputFunc output_func,
+        void* output_func_arg
+);
+
+/**
+ * Searches the logtype tables in a combined table and buffers any results
+ * @param table_id
+ * @param queries The queries for each logtype in the combined table, in the order the logtypes
+ * are stored
+ * @param query
+ * @param archive
+ * @param combined_table
+ * @param decompressor
+ * @param results Returns the results
+ */
+void search_combined_table_and_buffer(
+        combined_table_id_t table_id,
+        vector<LogtypeQueries> const& queries,
+        Query const& query,
+        Archive& archive,
+        streaming_archive::reader::CombinedLogtypeTable& combined_table,
+        streaming_archive::reader::SingleLogtypeTableManager::CombinedTableDecompressor&
+                decompressor,
+        vector<BufferedResult>& results
+);
+
+/**
+ * @param result_order
+ * @param lhs
+ * @param rhs
+ * @return Whether `lhs` should be output before `rhs` in the given order
+ */
+bool is_result_before(
+        Grep::ResultOrder result_order,
+        BufferedResult const& lhs,
+        BufferedResult const& rhs
+);
+
+/**
+ * Searches the segment's single logtype tables and combined tables concurrently. Each single
+ * logtype table and each combined table is one task, since the logtype tables within a combined
+ * table share one compressed stream. Tasks are numbered with the single logtype tables first.
+ * @param single_table_queries
+ * @param combined_table_queries
+ * @param query
+ * @param num_threads
+ * @param archive
+ * @param handle_task_results Called by the worker that ran a task with the task's index and its
+ * results, which the callee may move from
+ * @throw streaming_archive::reader::Archive::OperationFailed if decompression unexpectedly fails
+ * @throw TimestampPattern::OperationFailed if failed to insert timestamp into message
+ */
+void search_segment_in_parallel(
+        vector<LogtypeQueries> const& single_table_queries,
+        std::map<combined_table_id_t, vector<LogtypeQueries>> const& combined_table_queries,
+        Query const& query,
+        size_t num_threads,
+        Archive& archive,
+        std::function<void(size_t, vector<BufferedResult>&)> const& handle_task_results
+);
+
+void buffer_result(
+        string const& orig_file_path,
+        Message const& compressed_msg,
+        string const& decompressed_msg,
+        void* custom_arg
+) {
+    static_cast<vector<BufferedResult>*>(custom_arg)->push_back(
+            {compressed_msg.get_ts_in_milli(),
+             compressed_msg.get_file_id(),
+             compressed_msg.get_logtype_id(),
+             decompressed_msg}
+    );
+}
+
+void output_buffered_result(
+        BufferedResult const& result,
+        Archive const& archive,
+        Grep::OutputFunc output_func,
+        void* output_func_arg
+) {
+    Message compressed_msg;
+    compressed_msg.set_timestamp(result.timestamp);
+    compressed_msg.set_file_id(result.file_id);
+    compressed_msg.set_logtype_id(result.logtype_id);
+    output_func(
+            archive.get_file_name(result.file_id),
+            compressed_msg,
+            result.decompressed_msg,
+            output_func_arg
+    );
+}
+
+size_t output_buffered_results(
+        vector<BufferedResult> const& results,
+        Archive const& archive,
+        Grep::OutputFunc output_func,
+        void* output_func_arg
+) {
+    for (auto const& result : results) {
+        output_buffered_result(result, archive, output_func, output_func_arg);
+    }
+    return results.size();
+}
+
+void find_matching_rows(
+        LogTypeDictionaryEntry const& logtype_entry,
+        vector<LogtypeQuery> const& sub_queries,
+        Query const& query,
+        streaming_archive::reader::LogtypeTable& logtype_table,
+        vector<size_t>& matched_row_ix,
+        vector<bool>& wildcard_required
+) {
+    matched_row_ix.clear();
+    wildcard_required.clear();
+
+    // Filter rows by timestamp
+    logtype_table.load_timestamp();
+    size_t num_rows = logtype_table.get_num_row();
+    for (size_t row_ix = 0; row_ix < num_rows; row_ix++) {
+        auto ts = logtype_table.get_timestamp_at_offset(row_ix);
+        if (query.timestamp_is_in_search_time_range(ts)) {
+            matched_row_ix.push_back(row_ix);
+        }
+    }
+
+    // Filter rows by each variable's range, loading only the columns that are filtered
+    for (auto const& filter : query.get_variable_range_filters()) {
+        if (matched_row_ix.empty()) {
+            return;
+        }
+        ir::VariablePlaceholder placeholder;
+        logtype_entry.get_variable_info(filter.get_var_ix(), placeholder);
+        filter.filter_rows(
+                placeholder,
+                logtype_table.get_variable_column(filter.get_var_ix()),
+                matched_row_ix
+        );
+    }
+
+    if (sub_queries.empty()) {
+        // The query has no sub-queries, so every remaining row is a match
+        wildcard_required.resize(matched_row_ix.size(), false);
+        return;
+    }
+    if (matched_row_ix.empty()) {
+        return;
+    }
+
+    // Match the remaining rows against the sub-queries
+    auto num_vars = logtype_entry.get_num_variables();
+    vector<encoded_variable_t const*> columns(num_vars);
+    for (size_t var_ix = 0; var_ix < num_vars; var_ix++) {
+        columns[var_ix] = logtype_table.get_variable_column(var_ix);
+    }
+    vector<encoded_variable_t> vars_to_match(num_vars);
+    size_t num_matched_rows = 0;
+    for (auto const row_ix : matched_row_ix) {
+        for (size_t var_ix = 0; var_ix < num_vars; var_ix++) {
+            vars_to_match[var_ix] = columns[var_ix][row_ix];
+        }
+        for (auto const& possible_sub_query : sub_queries) {
+            if (possible_sub_query.matches_vars(vars_to_match)) {
+                wildcard_required.push_back(possible_sub_query.get_wildcard_flag());
+                matched_row_ix[num_matched_rows++] = row_ix;
+                break;
+            }
+        }
+    }
+    matched_row_ix.resize(num_matched_rows);
+}
+
+size_t search_logtype_table_and_output(
+        LogTypeDictionaryEntry const& logtype_entry,
+        vector<LogtypeQuery> const& sub_queries,
+        Query const& query,
+        Archive& archive,
+        streaming_archive::reader::LogtypeTable& logtype_table,
+        vector<size_t>& matched_row_ix,
+        vector<bool>& wildcard_required,
+        Grep::OutputFunc output_func,
+        void* output_func_arg
+) {
+    find_matching_rows(
+            logtype_entry,
+            sub_queries,
+            query,
+            logtype_table,
+            matched_row_ix,
+            wildcard_required
+    );
+
+    size_t num_potential_matches = matched_row_ix.size();
+    if (num_potential_matches == 0) {
+        return 0;
+    }
+
+    // Decompress matches
+    auto num_vars = logtype_entry.get_num_variables();
+    vector<epochtime_t> loaded_ts(num_potential_matches);
+    vector<file_id_t> loaded_file_id(num_potential_matches);
+    vector<encoded_variable_t> loaded_vars(num_potential_matches * num_vars);
+    logtype_table.load_remaining_data_into_vec(
+            loaded_ts,
+            loaded_file_id,
+            loaded_vars,
+            matched_row_ix
+    );
+    return archive.decompress_messages_and_output(
+            logtype_entry.get_id(),
+            loaded_ts,
+            loaded_file_id,
+            loaded_vars,
+            wildcard_required,
+            query,
+            output_func,
+            output_func_arg
+    );
+}
+
+void search_combined_table_and_buffer(
+        combined_table_id_t table_id,
+        vector<LogtypeQueries> const& queries,
+        Query const& query,
+        Archive& archive,
+        streaming_archive::reader::CombinedLogtypeTable& combined_table,
+        streaming_archive::reader::SingleLogtypeTableManager::CombinedTableDecompressor&
+                decompressor,
+        vector<BufferedResult>& results
+) {
+    auto const& logtype_table_manager = archive.get_logtype_table_manager();
+    logtype_table_manager.open_combined_table(table_id, combined_table, decompressor);
+
+    Message compressed_msg;
+    string decompressed_msg;
+    for (auto const& query_for_logtype : queries) {
+        auto logtype_id = query_for_logtype.get_logtype_id();
+        auto const& logtype_entry = archive.get_logtype_dictionary().get_entry(logtype_id);
+        if (false == query.logtype_may_match_variable_ranges(logtype_entry)) {
+            continue;
+        }
+        auto const& sub_queries = query_for_logtype.get_queries();
+        logtype_table_manager.load_logtype_table_from_combine(
+                logtype_id,
+                combined_table,
+                decompressor
+        );
+        compressed_msg.resize_var(logtype_entry.get_num_variables());
+        compressed_msg.set_logtype_id(logtype_id);
+        while (combined_table.get_next_message(compressed_msg)) {
+            if (!query.timestamp_is_in_search_time_range(compressed_msg.get_ts_in_milli())) {
+                continue;
+            }
+            if (false
+                == query.vars_match_variable_ranges(logtype_entry, compressed_msg.get_vars()))
+            {
+                continue;
+            }
+            bool matched = sub_queries.empty();
+            bool required_wild_card = false;
+            for (auto const& possible_sub_query : sub_queries) {
+                if (possible_sub_query.matches_vars(compressed_msg.get_vars())) {
+                    matched = true;
+                    required_wild_card = possible_sub_query.get_wildcard_flag();
+                    break;
+                }
+            }
+            if (!matched) {
+                continue;
+            }
+
+            if (!archive.decompress_message_with_fixed_timestamp_pattern(
+                        compressed_msg,
+                        decompressed_msg
+                ))
+            {
+                throw Archive::OperationFailed(ErrorCode_Failure, __FILENAME__, __LINE__);
+            }
+
+            // Perform wildcard match if required
+            // Check if:
+            // - Sub-query requires wildcard match, or
+            // - no subqueries exist and the search string is not a match-all
+            if ((query.contains_sub_queries() && required_wild_card)
+                || (query.contains_sub_queries() == false
+                    && query.search_string_matches_all() == false))
+            {
+                bool wildcard_matched = wildcard_match_unsafe(
+                        decompressed_msg,
+                        query.get_search_string(),
+                        query.get_ignore_case() == false
+                );
+                if (!wildcard_matched) {
+                    continue;
+                }
+            }
+            results.push_back(
+                    {compressed_msg.get_ts_in_milli(),
+                     compressed_msg.get_file_id(),
+                     logtype_id,
+                     decompressed_msg}
+            );
+        }
+        combined_table.close_logtype_table();
+    }
+    combined_table.close();
+    decompressor.close();
+}
+
+bool is_result_before(
+        Grep::ResultOrder result_order,
+        BufferedResult const& lhs,
+        BufferedResult const& rhs
+) {
+    if (Grep::ResultOrder::File == result_order) {
+        return std::tie(lhs.file_id, lhs.timestamp) < std::tie(rhs.file_id, rhs.timestamp);
+    }
+    return lhs.timestamp < rhs.timestamp;
+}
+
+void search_segment_in_parallel(
+        vector<LogtypeQueries> const& single_table_queries,
+        std::map<combined_table_id_t, vector<LogtypeQueries>> const& combined_table_queries,
+        Query const& query,
+        size_t num_threads,
+        Archive& archive,
+        std::function<void(size_t, vector<BufferedResult>&)> const& handle_task_results
+) {
+    vector<std::pair<combined_table_id_t, vector<LogtypeQueries> const*>> combined_table_tasks;
+    combined_table_tasks.reserve(combined_table_queries.size());
+    for (auto const& [table_id, queries] : combined_table_queries) {
+        combined_table_tasks.emplace_back(table_id, &queries);
+    }
+    size_t const num_single_table_tasks = single_table_queries.size();
+
+    auto const& logtype_table_manager = archive.get_logtype_table_manager();
+    auto make_task_runner = [&]() {
+        return [&, worker = std::make_unique<SegmentSearchWorker>()](size_t task_ix) {
+            auto& results = worker->results;
+            results.clear();
+            if (task_ix < num_single_table_tasks) {
+                auto const& query_for_logtype = single_table_queries[task_ix];
+                auto const& logtype_entry = archive.get_logtype_dictionary().get_entry(
+                        query_for_logtype.get_logtype_id()
+                );
+                if (false == query.logtype_may_match_variable_ranges(logtype_entry)) {
+                    return;
+                }
+                logtype_table_manager.open_logtype_table(
+                        query_for_logtype.get_logtype_id(),
+                        worker->logtype_table
+                );
+                search_logtype_table_and_output(
+                        logtype_entry,
+                        query_for_logtype.get_queries(),
+                        query,
+                        archive,
+                        worker->logtype_table,
+                        worker->matched_row_ix,
+                        worker->wildcard_required,
+                        buffer_result,
+                        &results
+                );
+                worker->logtype_table.close();
+            } else {
+                auto const& [table_id, queries]
+                        = combined_table_tasks[task_ix - num_single_table_tasks];
+                search_combined_table_and_buffer(
+                        table_id,
+                        *queries,
+                        query,
+                        archive,
+                        worker->combined_table,
+                        worker->combined_table_decompressor,
+                        results
+                );
+            }
+            handle_task_results(task_ix, results);
+        };
+    };
+    run_tasks_in_parallel(
+            num_single_table_tasks + combined_table_tasks.size(),
+            num_threads,
+            make_task_runner
+    );
+}
 }  // namespace
 
 std::optional<Query> Grep::process_raw_query(
@@ -1005,8 +1497,8 @@ size_t Grep::output_message_in_combined_segment_within_time_range(
         for (auto const& logtype_id : logtype_order) {
             // load the logtype id
             logtype_table_manager.load_logtype_table_from_combine(logtype_id);
-            auto num_vars
-                    = archive.get_logtype_dictionary().get_entry(logtype_id).get_num_variables();
+            auto const& logtype_entry = archive.get_logtype_dictionary().get_entry(logtype_id);
+            auto num_vars = logtype_entry.get_num_variables();
             compressed_msg.resize_var(num_vars);
             compressed_msg.set_logtype_id(logtype_id);
             while (num_matches < limit) {
@@ -1018,6 +1510,11 @@ size_t Grep::output_message_in_combined_segment_within_time_range(
                 if (!query.timestamp_is_in_search_time_range(compressed_msg.get_ts_in_milli())) {
                     continue;
                 }
+                if (false
+                    == query.vars_match_variable_ranges(logtype_entry, compressed_msg.get_vars()))
+                {
+                    continue;
+                }
                 bool decompress_successful
                         = archive.decompress_message_with_fixed_timestamp_pattern(
                                 compressed_msg,
@@ -1149,7 +1646,8 @@ size_t Grep::search_combined_table_and_output(
         auto const& queries_by_logtype = iter.get_queries();
 
         // Initialize message
-        auto num_vars = archive.get_logtype_dictionary().get_entry(logtype_id).get_num_variables();
+        auto const& logtype_entry = archive.get_logtype_dictionary().get_entry(logtype_id);
+        auto num_vars = logtype_entry.get_num_variables();
         compressed_msg.resize_var(num_vars);
         compressed_msg.set_logtype_id(logtype_id);
 
@@ -1170,6 +1668,11 @@ size_t Grep::search_combined_table_and_output(
             if (found_matched == false) {
                 break;
             }
+            if (false
+                == query.vars_match_variable_ranges(logtype_entry, compressed_msg.get_vars()))
+            {
+                continue;
+            }
             // Decompress match
             bool decompress_successful = archive.decompress_message_with_fixed_timestamp_pattern(
                     compressed_msg,
@@ -1275,4 +1778,137 @@ size_t Grep::search_segment_optimized_and_output(
 
     return num_matches;
 }
+
+size_t Grep::search_segment_with_variable_ranges_and_output(
+        std::vector<LogtypeQueries> const& queries,
+        Query const& query,
+        size_t limit,
+        Archive& archive,
+        OutputFunc output_func,
+        void* output_func_arg
+) {
+    size_t num_matches = 0;
+
+    std::vector<size_t> matched_row_ix;
+    std::vector<bool> wildcard_required;
+
+    auto& logtype_table_manager = archive.get_logtype_table_manager();
+    for (auto const& query_for_logtype : queries) {
+        if (num_matches >= limit) {
+            break;
+        }
+        auto logtype_id = query_for_logtype.get_logtype_id();
+        auto const& logtype_entry = archive.get_logtype_dictionary().get_entry(logtype_id);
+        if (false == query.logtype_may_match_variable_ranges(logtype_entry)) {
+            // Skip the table without loading it
+            continue;
+        }
+
+        logtype_table_manager.open_logtype_table(logtype_id);
+        num_matches += search_logtype_table_and_output(
+                logtype_entry,
+                query_for_logtype.get_queries(),
+                query,
+                archive,
+                logtype_table_manager.logtype_table(),
+                matched_row_ix,
+                wildcard_required,
+                output_func,
+                output_func_arg
+        );
+        logtype_table_manager.close_logtype_table();
+    }
+
+    return num_matches;
+}
+
+size_t Grep::search_segment_in_parallel_and_output(
+        std::vector<LogtypeQueries> const& single_table_queries,
+        std::map<combined_table_id_t, std::vector<LogtypeQueries>> const& combined_table_queries,
+        Query const& query,
+        size_t num_threads,
+        Archive& archive,
+        OutputFunc output_func,
+        void* output_func_arg
+) {
+    std::mutex output_mutex;
+    size_t num_matches = 0;
+    search_segment_in_parallel(
+            single_table_queries,
+            combined_table_queries,
+            query,
+            num_threads,
+            archive,
+            [&](size_t, std::vector<BufferedResult>& task_results) {
+                std::lock_guard<std::mutex> lock(output_mutex);
+                num_matches += output_buffered_results(
+                        task_results,
+                        archive,
+                        output_func,
+                        output_func_arg
+                );
+                task_results.clear();
+            }
+    );
+    return num_matches;
+}
+
+void Grep::search_segment_in_parallel_and_buffer(
+        std::vector<LogtypeQueries> const& single_table_queries,
+        std::map<combined_table_id_t, std::vector<LogtypeQueries>> const& combined_table_queries,
+        Query const& query,
+        size_t num_threads,
+        ResultOrder result_order,
+        Archive& archive,
+        std::vector<BufferedResult>& sorted_results
+) {
+    // Results are buffered per task so that they can be sorted in a deterministic order
+    std::vector<std::vector<BufferedResult>> results_by_task(
+            single_table_queries.size() + combined_table_queries.size()
+    );
+    search_segment_in_parallel(
+            single_table_queries,
+            combined_table_queries,
+            query,
+            num_threads,
+            archive,
+            [&](size_t task_ix, std::vector<BufferedResult>& task_results) {
+                results_by_task[task_ix] = std::move(task_results);
+                task_results.clear();
+            }
+    );
+
+    // Concatenate the results in task order before sorting, so that ties are broken the same way
+    // as a sequential search would
+    sorted_results.clear();
+    for (auto& task_results : results_by_task) {
+        std::move(task_results.begin(), task_results.end(), std::back_inserter(sorted_results));
+        task_results.clear();
+    }
+    std::stable_sort(
+            sorted_results.begin(),
+            sorted_results.end(),
+            [&](BufferedResult const& lhs, BufferedResult const& rhs) {
+                return is_result_before(result_order, lhs, rhs);
+            }
+    );
+}
+
+size_t Grep::output_sorted_results(
+        std::vector<std::vector<BufferedResult>> const& sorted_runs,
+        ResultOrder result_order,
+        Archive const& archive,
+        OutputFunc output_func,
+        void* output_func_arg
+) {
+    return merge_sorted_runs_and_output(
+            sorted_runs,
+            [&](BufferedResult const& lhs, BufferedResult const& rhs) {
+                return is_result_before(result_order, lhs, rhs);
+            },
+            [&](BufferedResult const& result) {
+                output_buffered_result(result, archive, output_func, output_func_arg);
+            }
+    );
+}
 }  // namespace glt
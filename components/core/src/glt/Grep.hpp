@@ -1,8 +1,10 @@
 #ifndef GLT_GREP_HPP
 #define GLT_GREP_HPP
 
+#include <map>
 #include <optional>
 #include <string>
+#include <vector>
 
 #include "Defs.h"
 #include "Query.hpp"
@@ -27,6 +29,24 @@ public:
             void* custom_arg
     );
 
+    // Order in which a parallel search outputs its results
+    enum class ResultOrder : char {
+        // Results are output as soon as each table has been searched
+        None = 'n',
+        Timestamp = 't',
+        // Results are ordered by the order their files were added to the archive, then by
+        // timestamp
+        File = 'f',
+    };
+
+    // A search result buffered until it can be output in order
+    struct BufferedResult {
+        epochtime_t timestamp;
+        file_id_t file_id;
+        logtype_dictionary_id_t logtype_id;
+        std::string decompressed_msg;
+    };
+
     // Methods
     /**
      * Processes a raw user query into a Query
@@ -200,6 +220,101 @@ public:
             OutputFunc output_func,
             void* output_func_arg
     );
+    /**
+     * Searches the segment's single logtype tables with a query that contains variable range
+     * filters and outputs any results using the given method. Each table is filtered one column
+     * at a time (timestamps first, then each range-filtered variable), so only rows within every
+     * range are matched against the sub-queries and decompressed.
+     * @param queries
+     * @param query
+     * @param limit
+     * @param archive
+     * @param output_func
+     * @param output_func_arg
+     * @return Number of matches found
+     * @throw streaming_archive::reader::Archive::OperationFailed if decompression unexpectedly
+     * fails
+     * @throw TimestampPattern::OperationFailed if failed to insert timestamp into message
+     */
+    static size_t search_segment_with_variable_ranges_and_output(
+            std::vector<LogtypeQueries> const& queries,
+            Query const& query,
+            size_t limit,
+            streaming_archive::reader::Archive& archive,
+            OutputFunc output_func,
+            void* output_func_arg
+    );
+    /**
+     * Searches the segment's single logtype tables and combined tables concurrently and outputs
+     * any results using the given method as soon as each table has been searched. Each single
+     * logtype table and each combined table is searched as an independent task by a pool of
+     * workers, where each worker reuses its own tables, decompressor, and buffers across tasks.
+     * @param single_table_queries
+     * @param combined_table_queries
+     * @param query
+     * @param num_threads
+     * @param archive
+     * @param output_func
+     * @param output_func_arg
+     * @return Number of matches found
+     * @throw streaming_archive::reader::Archive::OperationFailed if decompression unexpectedly
+     * fails
+     * @throw TimestampPattern::OperationFailed if failed to insert timestamp into message
+     */
+    static size_t search_segment_in_parallel_and_output(
+            std::vector<LogtypeQueries> const& single_table_queries,
+            std::map<combined_table_id_t, std::vector<LogtypeQueries>> const&
+                    combined_table_queries,
+            Query const& query,
+            size_t num_threads,
+            streaming_archive::reader::Archive& archive,
+            OutputFunc output_func,
+            void* output_func_arg
+    );
+    /**
+     * Searches the segment's tables concurrently like `search_segment_in_parallel_and_output`, but
+     * buffers the results sorted in the given order instead of outputting them, so that the
+     * results of several segments can be merged by `output_sorted_results`.
+     * @param single_table_queries
+     * @param combined_table_queries
+     * @param query
+     * @param num_threads
+     * @param result_order Cannot be ResultOrder::None
+     * @param archive
+     * @param sorted_results Returns the results, sorted by `result_order`. Ties are in the order a
+     * sequential search would find them.
+     * @throw streaming_archive::reader::Archive::OperationFailed if decompression unexpectedly
+     * fails
+     * @throw TimestampPattern::OperationFailed if failed to insert timestamp into message
+     */
+    static void search_segment_in_parallel_and_buffer(
+            std::vector<LogtypeQueries> const& single_table_queries,
+            std::map<combined_table_id_t, std::vector<LogtypeQueries>> const&
+                    combined_table_queries,
+            Query const& query,
+            size_t num_threads,
+            ResultOrder result_order,
+            streaming_archive::reader::Archive& archive,
+            std::vector<BufferedResult>& sorted_results
+    );
+    /**
+     * Merges runs of results that are each sorted in the given order (e.g., one run per segment
+     * from `search_segment_in_parallel_and_buffer`) and outputs them in that order. Ties are
+     * output in the order of their runs.
+     * @param sorted_runs
+     * @param result_order Cannot be ResultOrder::None
+     * @param archive
+     * @param output_func
+     * @param output_func_arg
+     * @return Number of results output
+     */
+    static size_t output_sorted_results(
+            std::vector<std::vector<BufferedResult>> const& sorted_runs,
+            ResultOrder result_order,
+            streaming_archive::reader::Archive const& archive,
+            OutputFunc output_func,
+            void* output_func_arg
+    );
     /**
      * Converted a query of class Query into a set of LogtypeQueries, indexed by logtype_id
      * specifically, a Query could have n subqueries, each subquery has a fixed "vars_to_match" and
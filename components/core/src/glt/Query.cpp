@@ -1,5 +1,7 @@
 #include "Query.hpp"
 
+#include "EncodedVariableInterpreter.hpp"
+
 using std::set;
 using std::string;
 using std::unordered_set;
@@ -59,6 +61,7 @@ bool matches_var(
     }
     return (num_possible_vars == possible_vars_ix);
 }
+
 }  // unnamed namespace
 
 QueryVar::QueryVar(encoded_variable_t precise_non_dict_var) {
@@ -217,6 +220,40 @@ void Query::make_sub_queries_relevant_to_segment(segment_id_t segment_id) {
     m_prev_segment_id = segment_id;
 }
 
+bool Query::logtype_may_match_variable_ranges(LogTypeDictionaryEntry const& logtype_entry) const {
+    for (auto const& filter : m_variable_range_filters) {
+        ir::VariablePlaceholder placeholder;
+        if (SIZE_MAX == logtype_entry.get_variable_info(filter.get_var_ix(), placeholder)) {
+            return false;
+        }
+        if (ir::VariablePlaceholder::Integer != placeholder
+            && ir::VariablePlaceholder::Float != placeholder)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+bool Query::vars_match_variable_ranges(
+        LogTypeDictionaryEntry const& logtype_entry,
+        std::vector<encoded_variable_t> const& vars
+) const {
+    for (auto const& filter : m_variable_range_filters) {
+        ir::VariablePlaceholder placeholder;
+        auto const var_ix = filter.get_var_ix();
+        if (SIZE_MAX == logtype_entry.get_variable_info(var_ix, placeholder)
+            || var_ix >= vars.size())
+        {
+            return false;
+        }
+        if (false == filter.matches(placeholder, vars[var_ix])) {
+            return false;
+        }
+    }
+    return true;
+}
+
 bool LogtypeQuery::matches_vars(std::vector<encoded_variable_t> const& vars) const {
     return matches_var(vars, m_vars, 0, 0);
 }
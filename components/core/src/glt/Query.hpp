@@ -4,11 +4,14 @@
 #include <set>
 #include <string>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 #include "Defs.h"
+#include "ir/types.hpp"
 #include "LogTypeDictionaryEntry.hpp"
 #include "VariableDictionaryEntry.hpp"
+#include "VariableRangeFilter.hpp"
 
 namespace glt {
 /**
@@ -208,6 +211,37 @@ public:
         return m_relevant_sub_queries;
     }
 
+    void set_variable_range_filters(std::vector<VariableRangeFilter> variable_range_filters) {
+        m_variable_range_filters = std::move(variable_range_filters);
+    }
+
+    std::vector<VariableRangeFilter> const& get_variable_range_filters() const {
+        return m_variable_range_filters;
+    }
+
+    bool contains_variable_range_filters() const {
+        return m_variable_range_filters.empty() == false;
+    }
+
+    /**
+     * Checks if the given logtype has a numeric variable at the index of every variable range
+     * filter, i.e., whether any of its messages could pass the filters
+     * @param logtype_entry
+     * @return true if the logtype could match, false otherwise
+     */
+    bool logtype_may_match_variable_ranges(LogTypeDictionaryEntry const& logtype_entry) const;
+
+    /**
+     * Checks if the given variables of a message are within every variable range filter
+     * @param logtype_entry The message's logtype
+     * @param vars
+     * @return true if matched, false otherwise
+     */
+    bool vars_match_variable_ranges(
+            LogTypeDictionaryEntry const& logtype_entry,
+            std::vector<encoded_variable_t> const& vars
+    ) const;
+
 private:
     // Variables
     // Start of search time range (inclusive)
@@ -220,6 +254,7 @@ private:
     std::vector<SubQuery> m_sub_queries;
     std::vector<SubQuery const*> m_relevant_sub_queries;
     segment_id_t m_prev_segment_id{cInvalidSegmentId};
+    std::vector<VariableRangeFilter> m_variable_range_filters;
 };
 
 /**
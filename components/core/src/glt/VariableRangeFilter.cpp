@@ -0,0 +1,162 @@
+#include "VariableRangeFilter.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+#include "EncodedVariableInterpreter.hpp"
+
+using std::invalid_argument;
+using std::string;
+
+namespace glt {
+bool VariableRangeFilter::matches(ir::VariablePlaceholder placeholder, encoded_variable_t var)
+        const {
+    switch (placeholder) {
+        case ir::VariablePlaceholder::Integer: {
+            int64_t integer_lower_bound;
+            int64_t integer_upper_bound;
+            if (false
+                == get_integer_bounds(
+                        m_lower_bound,
+                        m_upper_bound,
+                        integer_lower_bound,
+                        integer_upper_bound
+                ))
+            {
+                return false;
+            }
+            return integer_lower_bound <= var && var <= integer_upper_bound;
+        }
+        case ir::VariablePlaceholder::Float: {
+            auto const value = EncodedVariableInterpreter::convert_encoded_float_to_double(var);
+            return m_lower_bound <= value && value <= m_upper_bound;
+        }
+        default:
+            return false;
+    }
+}
+
+void VariableRangeFilter::filter_rows(
+        ir::VariablePlaceholder placeholder,
+        encoded_variable_t const* column,
+        std::vector<size_t>& rows
+) const {
+    // Each row is written to the next output slot unconditionally, and the slot is only kept if the
+    // row matches. This avoids a hard-to-predict branch per row.
+    size_t num_matched_rows = 0;
+    switch (placeholder) {
+        case ir::VariablePlaceholder::Integer: {
+            // Compare the integers directly rather than converting each of them to a double
+            int64_t integer_lower_bound;
+            int64_t integer_upper_bound;
+            if (false
+                == get_integer_bounds(
+                        m_lower_bound,
+                        m_upper_bound,
+                        integer_lower_bound,
+                        integer_upper_bound
+                ))
+            {
+                break;
+            }
+            for (auto const row_ix : rows) {
+                auto const var = column[row_ix];
+                rows[num_matched_rows] = row_ix;
+                num_matched_rows += static_cast<size_t>(
+                        (integer_lower_bound <= var) & (var <= integer_upper_bound)
+                );
+            }
+            break;
+        }
+        case ir::VariablePlaceholder::Float:
+            for (auto const row_ix : rows) {
+                auto const value = EncodedVariableInterpreter::convert_encoded_float_to_double(
+                        column[row_ix]
+                );
+                rows[num_matched_rows] = row_ix;
+                num_matched_rows += static_cast<size_t>(
+                        (m_lower_bound <= value) & (value <= m_upper_bound)
+                );
+            }
+            break;
+        default:
+            // Dictionary variables can't match a numeric range
+            break;
+    }
+    rows.resize(num_matched_rows);
+}
+
+bool get_integer_bounds(
+        double lower_bound,
+        double upper_bound,
+        int64_t& integer_lower_bound,
+        int64_t& integer_upper_bound
+) {
+    // 2^63, the smallest double that can't be represented as an int64_t
+    constexpr double cInt64Limit = 9'223'372'036'854'775'808.0;
+
+    lower_bound = std::ceil(lower_bound);
+    upper_bound = std::floor(upper_bound);
+    // NOTE: This also handles NaN bounds since all comparisons with NaN are false
+    if (false == (lower_bound <= upper_bound) || lower_bound >= cInt64Limit
+        || upper_bound < -cInt64Limit)
+    {
+        return false;
+    }
+    integer_lower_bound
+            = (lower_bound <= -cInt64Limit) ? INT64_MIN : static_cast<int64_t>(lower_bound);
+    integer_upper_bound
+            = (upper_bound >= cInt64Limit) ? INT64_MAX : static_cast<int64_t>(upper_bound);
+    return true;
+}
+
+VariableRangeFilter parse_variable_range_filter(string const& filter_str) {
+    auto const first_colon_pos = filter_str.find(':');
+    auto const second_colon_pos = (string::npos == first_colon_pos)
+                                          ? string::npos
+                                          : filter_str.find(':', first_colon_pos + 1);
+    if (string::npos == second_colon_pos) {
+        throw invalid_argument("Variable range '" + filter_str + "' isn't of the form IX:MIN:MAX.");
+    }
+    auto const var_ix_str = filter_str.substr(0, first_colon_pos);
+    auto const lower_bound_str
+            = filter_str.substr(first_colon_pos + 1, second_colon_pos - first_colon_pos - 1);
+    auto const upper_bound_str = filter_str.substr(second_colon_pos + 1);
+
+    size_t var_ix;
+    double lower_bound = -std::numeric_limits<double>::infinity();
+    double upper_bound = std::numeric_limits<double>::infinity();
+    try {
+        size_t num_chars_parsed = 0;
+        var_ix = std::stoull(var_ix_str, &num_chars_parsed);
+        if (num_chars_parsed != var_ix_str.length() || '-' == var_ix_str.front()) {
+            throw invalid_argument("Invalid variable index.");
+        }
+        if (false == lower_bound_str.empty()) {
+            lower_bound = std::stod(lower_bound_str, &num_chars_parsed);
+            if (num_chars_parsed != lower_bound_str.length()) {
+                throw invalid_argument("Invalid lower bound.");
+            }
+        }
+        if (false == upper_bound_str.empty()) {
+            upper_bound = std::stod(upper_bound_str, &num_chars_parsed);
+            if (num_chars_parsed != upper_bound_str.length()) {
+                throw invalid_argument("Invalid upper bound.");
+            }
+        }
+    } catch (std::logic_error const&) {
+        throw invalid_argument("Variable range '" + filter_str + "' is invalid.");
+    }
+    if (lower_bound > upper_bound) {
+        throw invalid_argument(
+                "Variable range '" + filter_str + "' is invalid - MIN is greater than MAX."
+        );
+    }
+    return {var_ix, lower_bound, upper_bound};
+}
+}  // namespace glt
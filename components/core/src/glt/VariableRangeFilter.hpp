@@ -0,0 +1,92 @@
+#ifndef GLT_VARIABLERANGEFILTER_HPP
+#define GLT_VARIABLERANGEFILTER_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "Defs.h"
+#include "ir/types.hpp"
+
+namespace glt {
+/**
+ * Class representing a numeric range filter on one of a logtype's encoded variables (e.g., "the 3rd
+ * variable is between 500 and 1000"). Only integer and float variables can match, since dictionary
+ * variables aren't stored as numbers.
+ */
+class VariableRangeFilter {
+public:
+    // Constructors
+    /**
+     * @param var_ix Index of the variable among the logtype's variables
+     * @param lower_bound Inclusive lower bound
+     * @param upper_bound Inclusive upper bound
+     */
+    VariableRangeFilter(size_t var_ix, double lower_bound, double upper_bound)
+            : m_var_ix{var_ix},
+              m_lower_bound{lower_bound},
+              m_upper_bound{upper_bound} {}
+
+    // Methods
+    size_t get_var_ix() const { return m_var_ix; }
+
+    double get_lower_bound() const { return m_lower_bound; }
+
+    double get_upper_bound() const { return m_upper_bound; }
+
+    /**
+     * Checks if the given encoded variable is within the range
+     * @param placeholder The placeholder of the variable in its logtype
+     * @param var
+     * @return true if matched, false otherwise
+     */
+    bool matches(ir::VariablePlaceholder placeholder, encoded_variable_t var) const;
+
+    /**
+     * Removes the rows whose variable isn't within the range, preserving the order of the
+     * remaining rows. The column is scanned in a tight loop without branching on each row's
+     * outcome, so the scan stays cheap even when few rows are filtered out.
+     * @param placeholder The placeholder of the variable in its logtype
+     * @param column The variable's column, containing one encoded variable per row
+     * @param rows Indices of the candidate rows in the column
+     */
+    void filter_rows(
+            ir::VariablePlaceholder placeholder,
+            encoded_variable_t const* column,
+            std::vector<size_t>& rows
+    ) const;
+
+private:
+    // Variables
+    size_t m_var_ix;
+    double m_lower_bound;
+    double m_upper_bound;
+};
+
+/**
+ * Converts an inclusive range of doubles into the equivalent inclusive range of integers
+ * @param lower_bound
+ * @param upper_bound
+ * @param integer_lower_bound
+ * @param integer_upper_bound
+ * @return true if the range contains at least one integer, false otherwise
+ */
+bool get_integer_bounds(
+        double lower_bound,
+        double upper_bound,
+        int64_t& integer_lower_bound,
+        int64_t& integer_upper_bound
+);
+
+/**
+ * Parses a variable range filter of the form "IX:MIN:MAX", where either bound can be omitted to
+ * leave that side of the range unbounded
+ * @param filter_str
+ * @return The parsed filter
+ * @throw std::invalid_argument if the filter is malformed
+ */
+VariableRangeFilter parse_variable_range_filter(std::string const& filter_str);
+}  // namespace glt
+
+#endif  // GLT_VARIABLERANGEFILTER_HPP
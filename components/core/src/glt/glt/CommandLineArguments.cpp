@@ -3,6 +3,7 @@
 #include <fstream>
 #include <iomanip>
 #include <iostream>
+#include <stdexcept>
 
 #include <boost/filesystem/operations.hpp>
 #include <boost/program_options.hpp>
@@ -10,6 +11,7 @@
 #include "../Defs.h"
 #include "../spdlog_with_specializations.hpp"
 #include "../Utils.hpp"
+#include "../VariableRangeFilter.hpp"
 #include "../version.hpp"
 
 namespace po = boost::program_options;
@@ -381,6 +383,31 @@ CommandLineArguments::parse_arguments(int argc, char const* argv[]) {
                     "Obtain wildcard strings from FILE, one per line"
             );
 
+            // Define output controls
+            string result_order_str;
+            po::options_description options_search_output("Output Controls");
+            options_search_output.add_options()(
+                    "threads,t",
+                    po::value<size_t>(&m_num_search_threads)
+                            ->value_name("N")
+                            ->default_value(m_num_search_threads),
+                    "Search each segment's logtype tables using N threads"
+            )(
+                    "order-by",
+                    po::value<string>(&result_order_str)->value_name("ORDER"),
+                    "Output each archive's results ordered by ORDER ('timestamp' or 'file'),"
+                    " merging the results of all its segments. Archives are output in the order"
+                    " they're searched. By default, results are output in the order they're found."
+            )(
+                    "order-buffer-size",
+                    po::value<size_t>(&m_max_ordered_results_size)
+                            ->value_name("SIZE")
+                            ->default_value(m_max_ordered_results_size),
+                    "With --order-by, the maximum size (B) of the results buffered per archive."
+                    " Once exceeded, the buffered results are output and ordering restarts, so"
+                    " each batch of results is ordered but batches may overlap."
+            );
+
             // Define match controls
             po::options_description options_match_control("Match Controls");
             options_match_control.add_options()(
@@ -403,6 +430,11 @@ CommandLineArguments::parse_arguments(int argc, char const* argv[]) {
                     "tle",
                     po::value<epochtime_t>()->value_name("TS"),
                     "Find messages with UNIX timestamp <= TS ms"
+            )(
+                    "var-range",
+                    po::value<vector<string>>()->composing()->value_name("IX:MIN:MAX"),
+                    "Find messages whose IX-th variable (0-based) is an integer or float within "
+                    "[MIN, MAX]; either bound can be omitted. Can be specified multiple times."
             )(
                     "ignore-case,i",
                     po::bool_switch(&m_ignore_case),
@@ -414,6 +446,7 @@ CommandLineArguments::parse_arguments(int argc, char const* argv[]) {
             visible_options.add(options_general);
             visible_options.add(options_search_input);
             visible_options.add(options_match_control);
+            visible_options.add(options_search_output);
 
             // Define hidden positional options (not shown in Boost's program options help message)
             po::options_description hidden_positional_options;
@@ -439,6 +472,7 @@ CommandLineArguments::parse_arguments(int argc, char const* argv[]) {
             all_search_options.add(options_general);
             all_search_options.add(options_search_input);
             all_search_options.add(options_match_control);
+            all_search_options.add(options_search_output);
             all_search_options.add(hidden_positional_options);
 
             vector<string> unrecognized_options
@@ -464,6 +498,12 @@ CommandLineArguments::parse_arguments(int argc, char const* argv[]) {
                 cerr << "  " << get_program_name() << R"( s archives-dir " ERROR ")" << endl;
                 cerr << endl;
 
+                cerr << R"(  # Search archives-dir for " took * ms" where the 2nd var is >= 500)"
+                     << endl;
+                cerr << "  " << get_program_name()
+                     << R"( s --var-range 1:500: archives-dir " took * ms")" << endl;
+                cerr << endl;
+
                 cerr << "Options can be specified on the command line or through a configuration "
                         "file."
                      << endl;
@@ -483,6 +523,31 @@ CommandLineArguments::parse_arguments(int argc, char const* argv[]) {
                 throw invalid_argument("Wildcard string not specified or empty.");
             }
 
+            if (0 == m_num_search_threads) {
+                throw invalid_argument("Number of threads must be greater than 0.");
+            }
+            if (false == result_order_str.empty()) {
+                if ("timestamp" == result_order_str) {
+                    m_result_order = Grep::ResultOrder::Timestamp;
+                } else if ("file" == result_order_str) {
+                    m_result_order = Grep::ResultOrder::File;
+                } else {
+                    throw invalid_argument("Unknown result order '" + result_order_str + "'.");
+                }
+            }
+            if (0 == m_max_ordered_results_size) {
+                throw invalid_argument("Order buffer size must be greater than 0.");
+            }
+
+            // Parse variable ranges
+            if (parsed_command_line_options.count("var-range")) {
+                for (auto const& filter_str :
+                     parsed_command_line_options["var-range"].as<vector<string>>())
+                {
+                    m_variable_range_filters.emplace_back(parse_variable_range_filter(filter_str));
+                }
+            }
+
             // Validate timestamp range and compute m_search_begin_ts and m_search_end_ts
             if (parsed_command_line_options.count("teq")) {
                 if (parsed_command_line_options.count("tgt")
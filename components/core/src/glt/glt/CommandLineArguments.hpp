@@ -9,6 +9,8 @@
 #include "../CommandLineArgumentsBase.hpp"
 #include "../Defs.h"
 #include "../GlobalMetadataDBConfig.hpp"
+#include "../Grep.hpp"
+#include "../Query.hpp"
 
 namespace glt::glt {
 class CommandLineArguments : public CommandLineArgumentsBase {
@@ -39,7 +41,10 @@ public:
               m_ignore_case(false),
               m_output_method(OutputMethod::StdoutText),
               m_search_begin_ts(cEpochTimeMin),
-              m_search_end_ts(cEpochTimeMax) {}
+              m_search_end_ts(cEpochTimeMax),
+              m_num_search_threads(1),
+              m_result_order(Grep::ResultOrder::None),
+              m_max_ordered_results_size(1L * 1024 * 1024 * 1024) {}
 
     // Methods
     ParsingResult parse_arguments(int argc, char const* argv[]) override;
@@ -91,6 +96,16 @@ public:
 
     epochtime_t get_search_end_ts() const { return m_search_end_ts; }
 
+    std::vector<VariableRangeFilter> const& get_variable_range_filters() const {
+        return m_variable_range_filters;
+    }
+
+    size_t get_num_search_threads() const { return m_num_search_threads; }
+
+    Grep::ResultOrder get_result_order() const { return m_result_order; }
+
+    size_t get_max_ordered_results_size() const { return m_max_ordered_results_size; }
+
 private:
     // Methods
     void print_basic_usage() const override;
@@ -121,6 +136,10 @@ private:
     std::string m_file_path;
     OutputMethod m_output_method;
     epochtime_t m_search_begin_ts, m_search_end_ts;
+    std::vector<VariableRangeFilter> m_variable_range_filters;
+    size_t m_num_search_threads;
+    Grep::ResultOrder m_result_order;
+    size_t m_max_ordered_results_size;
 };
 }  // namespace glt::glt
 
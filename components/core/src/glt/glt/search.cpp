@@ -43,33 +43,77 @@ namespace glt::glt {
  * @return true on success, false otherwise
  */
 static bool open_archive(string const& archive_path, Archive& archive_reader);
+/**
+ * Gets the output function for the given output method
+ * @param output_method
+ * @param output_func Returns the output function
+ * @return true on success, false if the output method is unknown
+ */
+static bool get_output_func(
+        CommandLineArguments::OutputMethod output_method,
+        Grep::OutputFunc& output_func
+);
 /**
  * To update
  * @param queries
  * @param output_method
+ * @param num_threads Number of threads to search the segment's tables with
+ * @param result_order
  * @param archive
  * @param segment_id
- * @return The total number of matches found across all files
+ * @param sorted_runs Unless `result_order` is Grep::ResultOrder::None, returns the segment's
+ * results (one sorted run per query) instead of outputting them
+ * @return The total number of matches output across all files
  */
 static size_t search_segments(
         vector<Query>& queries,
         CommandLineArguments::OutputMethod output_method,
+        size_t num_threads,
+        Grep::ResultOrder result_order,
         Archive& archive,
-        size_t segment_id
+        size_t segment_id,
+        vector<vector<Grep::BufferedResult>>& sorted_runs
 );
 /**
  * get all messages in the segment within query's time range
  * if query doesn't have a time range, outputs all messages
  * @param query
  * @param output_method
+ * @param num_threads Number of threads to search the segment's tables with
+ * @param result_order
  * @param archive
- * @param segment_id
- * @return The total number of matches found across all files
+ * @param sorted_runs Unless `result_order` is Grep::ResultOrder::None, returns the segment's
+ * results as a sorted run instead of outputting them
+ * @return The total number of matches output across all files
  */
 static size_t find_message_in_segment_within_time_range(
         Query const& query,
         CommandLineArguments::OutputMethod output_method,
-        Archive& archive
+        size_t num_threads,
+        Grep::ResultOrder result_order,
+        Archive& archive,
+        vector<vector<Grep::BufferedResult>>& sorted_runs
+);
+/**
+ * @param results
+ * @return The approximate memory footprint of the given buffered results
+ */
+static size_t get_buffered_results_size(vector<Grep::BufferedResult> const& results);
+/**
+ * Outputs the buffered runs of results merged in the given order, and then clears them
+ * @param output_method
+ * @param result_order
+ * @param archive
+ * @param sorted_runs
+ * @param num_matches Incremented by the number of results output
+ * @return true on success, false if the output method is unknown
+ */
+static bool output_and_clear_sorted_runs(
+        CommandLineArguments::OutputMethod output_method,
+        Grep::ResultOrder result_order,
+        Archive const& archive,
+        vector<vector<Grep::BufferedResult>>& sorted_runs,
+        size_t& num_matches
 );
 /**
  * Prints search result to stdout in text format
@@ -128,6 +172,23 @@ static GlobalMetadataDB::ArchiveIterator* get_archive_iterator(
     }
 }
 
+static bool get_output_func(
+        CommandLineArguments::OutputMethod const output_method,
+        Grep::OutputFunc& output_func
+) {
+    switch (output_method) {
+        case CommandLineArguments::OutputMethod::StdoutText:
+            output_func = print_result_text;
+            return true;
+        case CommandLineArguments::OutputMethod::StdoutBinary:
+            output_func = print_result_binary;
+            return true;
+        default:
+            SPDLOG_ERROR("Unknown output method - {}", (char)output_method);
+            return false;
+    }
+}
+
 static bool open_archive(string const& archive_path, Archive& archive_reader) {
     ErrorCode error_code;
 
@@ -210,6 +271,7 @@ static bool search(
             );
             if (query_processing_result.has_value()) {
                 auto& query = query_processing_result.value();
+                query.set_variable_range_filters(command_line_args.get_variable_range_filters());
                 no_queries_match = false;
 
                 if (false == query.contains_sub_queries()) {
@@ -237,28 +299,87 @@ static bool search(
         }
 
         if (!no_queries_match) {
+            // With a result order, each segment's results are buffered as sorted runs, which are
+            // merged once every segment in the archive has been searched. To bound memory, the
+            // runs are merged and output early if they outgrow the order buffer, in which case the
+            // archive's results are only ordered within each batch.
+            auto const result_order = command_line_args.get_result_order();
+            vector<vector<Grep::BufferedResult>> sorted_runs;
+            size_t sorted_runs_size = 0;
+            bool order_buffer_overflowed = false;
+            auto bound_sorted_runs = [&](size_t num_runs_before_segment) {
+                for (auto run_ix = num_runs_before_segment; run_ix < sorted_runs.size(); ++run_ix)
+                {
+                    sorted_runs_size += get_buffered_results_size(sorted_runs[run_ix]);
+                }
+                if (sorted_runs_size <= command_line_args.get_max_ordered_results_size()) {
+                    return true;
+                }
+                if (false == order_buffer_overflowed) {
+                    SPDLOG_WARN(
+                            "Archive's results exceed the order buffer size, so they'll only be"
+                            " ordered in batches."
+                    );
+                    order_buffer_overflowed = true;
+                }
+                sorted_runs_size = 0;
+                return output_and_clear_sorted_runs(
+                        command_line_args.get_output_method(),
+                        result_order,
+                        archive,
+                        sorted_runs,
+                        num_matches
+                );
+            };
             if (is_superseding_query) {
                 for (auto segment_id : archive.get_valid_segment()) {
+                    auto const num_runs_before_segment = sorted_runs.size();
                     archive.open_logtype_table_manager(segment_id);
                     // There should be only one query for a superceding query case
                     auto const& query = queries.at(0);
                     num_matches += find_message_in_segment_within_time_range(
                             query,
                             command_line_args.get_output_method(),
-                            archive
+                            command_line_args.get_num_search_threads(),
+                            result_order,
+                            archive,
+                            sorted_runs
                     );
                     archive.close_logtype_table_manager();
+                    if (false == bound_sorted_runs(num_runs_before_segment)) {
+                        return false;
+                    }
                 }
             } else {
                 for (auto segment_id : ids_of_segments_to_search) {
+                    auto const num_runs_before_segment = sorted_runs.size();
                     archive.open_logtype_table_manager(segment_id);
                     num_matches += search_segments(
                             queries,
                             command_line_args.get_output_method(),
+                            command_line_args.get_num_search_threads(),
+                            result_order,
                             archive,
-                            segment_id
+                            segment_id,
+                            sorted_runs
                     );
                     archive.close_logtype_table_manager();
+                    if (false == bound_sorted_runs(num_runs_before_segment)) {
+                        return false;
+                    }
+                }
+            }
+            if (Grep::ResultOrder::None != result_order) {
+                if (false
+                    == output_and_clear_sorted_runs(
+                            command_line_args.get_output_method(),
+                            result_order,
+                            archive,
+                            sorted_runs,
+                            num_matches
+                    ))
+                {
+                    return false;
                 }
             }
             SPDLOG_DEBUG("# matches found: {}", num_matches);
@@ -289,36 +410,111 @@ static bool search(
     return true;
 }
 
+static size_t get_buffered_results_size(vector<Grep::BufferedResult> const& results) {
+    size_t size = results.size() * sizeof(Grep::BufferedResult);
+    for (auto const& result : results) {
+        size += result.decompressed_msg.capacity();
+    }
+    return size;
+}
+
+static bool output_and_clear_sorted_runs(
+        CommandLineArguments::OutputMethod const output_method,
+        Grep::ResultOrder const result_order,
+        Archive const& archive,
+        vector<vector<Grep::BufferedResult>>& sorted_runs,
+        size_t& num_matches
+) {
+    Grep::OutputFunc output_func;
+    if (false == get_output_func(output_method, output_func)) {
+        return false;
+    }
+    num_matches += Grep::output_sorted_results(
+            sorted_runs,
+            result_order,
+            archive,
+            output_func,
+            nullptr
+    );
+    sorted_runs.clear();
+    return true;
+}
+
 static size_t find_message_in_segment_within_time_range(
         Query const& query,
         CommandLineArguments::OutputMethod const output_method,
-        Archive& archive
+        size_t const num_threads,
+        Grep::ResultOrder const result_order,
+        Archive& archive,
+        vector<vector<Grep::BufferedResult>>& sorted_runs
 ) {
     size_t num_matches = 0;
 
     // Setup output method
     Grep::OutputFunc output_func;
-    void* output_func_arg;
-    switch (output_method) {
-        case CommandLineArguments::OutputMethod::StdoutText:
-            output_func = print_result_text;
-            output_func_arg = nullptr;
-            break;
-        case CommandLineArguments::OutputMethod::StdoutBinary:
-            output_func = print_result_binary;
-            output_func_arg = nullptr;
-            break;
-        default:
-            SPDLOG_ERROR("Unknown output method - {}", (char)output_method);
+    void* output_func_arg = nullptr;
+    if (false == get_output_func(output_method, output_func)) {
+        return num_matches;
+    }
+    auto& logtype_table_manager = archive.get_logtype_table_manager();
+    if (num_threads > 1 || Grep::ResultOrder::None != result_order) {
+        // Search every logtype
+        vector<LogtypeQueries> single_table_queries;
+        for (auto logtype_id : logtype_table_manager.get_single_order()) {
+            single_table_queries.emplace_back().set_logtype_id(logtype_id);
+        }
+        std::map<combined_table_id_t, vector<LogtypeQueries>> combined_table_queries;
+        for (auto const& [table_id, logtype_ids] : logtype_table_manager.get_combined_order()) {
+            auto& queries = combined_table_queries[table_id];
+            for (auto logtype_id : logtype_ids) {
+                queries.emplace_back().set_logtype_id(logtype_id);
+            }
+        }
+        if (Grep::ResultOrder::None != result_order) {
+            Grep::search_segment_in_parallel_and_buffer(
+                    single_table_queries,
+                    combined_table_queries,
+                    query,
+                    num_threads,
+                    result_order,
+                    archive,
+                    sorted_runs.emplace_back()
+            );
             return num_matches;
+        }
+        return Grep::search_segment_in_parallel_and_output(
+                single_table_queries,
+                combined_table_queries,
+                query,
+                num_threads,
+                archive,
+                output_func,
+                output_func_arg
+        );
+    }
+    if (query.contains_variable_range_filters()) {
+        // Search every single-table logtype
+        vector<LogtypeQueries> single_table_queries;
+        for (auto logtype_id : logtype_table_manager.get_single_order()) {
+            single_table_queries.emplace_back().set_logtype_id(logtype_id);
+        }
+        num_matches = Grep::search_segment_with_variable_ranges_and_output(
+                single_table_queries,
+                query,
+                SIZE_MAX,
+                archive,
+                output_func,
+                output_func_arg
+        );
+    } else {
+        num_matches = Grep::output_message_in_segment_within_time_range(
+                query,
+                SIZE_MAX,
+                archive,
+                output_func,
+                output_func_arg
+        );
     }
-    num_matches = Grep::output_message_in_segment_within_time_range(
-            query,
-            SIZE_MAX,
-            archive,
-            output_func,
-            output_func_arg
-    );
     num_matches += Grep::output_message_in_combined_segment_within_time_range(
             query,
             SIZE_MAX,
@@ -332,26 +528,19 @@ static size_t find_message_in_segment_within_time_range(
 static size_t search_segments(
         vector<Query>& queries,
         CommandLineArguments::OutputMethod const output_method,
+        size_t const num_threads,
+        Grep::ResultOrder const result_order,
         Archive& archive,
-        size_t segment_id
+        size_t segment_id,
+        vector<vector<Grep::BufferedResult>>& sorted_runs
 ) {
     size_t num_matches = 0;
 
     // Setup output method
     Grep::OutputFunc output_func;
-    void* output_func_arg;
-    switch (output_method) {
-        case CommandLineArguments::OutputMethod::StdoutText:
-            output_func = print_result_text;
-            output_func_arg = nullptr;
-            break;
-        case CommandLineArguments::OutputMethod::StdoutBinary:
-            output_func = print_result_binary;
-            output_func_arg = nullptr;
-            break;
-        default:
-            SPDLOG_ERROR("Unknown output method - {}", (char)output_method);
-            return num_matches;
+    void* output_func_arg = nullptr;
+    if (false == get_output_func(output_method, output_func)) {
+        return num_matches;
     }
 
     for (auto& query : queries) {
@@ -371,15 +560,51 @@ static size_t search_segments(
                 combined_table_queires
         );
 
+        if (Grep::ResultOrder::None != result_order) {
+            Grep::search_segment_in_parallel_and_buffer(
+                    single_table_queries,
+                    combined_table_queires,
+                    query,
+                    num_threads,
+                    result_order,
+                    archive,
+                    sorted_runs.emplace_back()
+            );
+            continue;
+        }
+        if (num_threads > 1) {
+            num_matches += Grep::search_segment_in_parallel_and_output(
+                    single_table_queries,
+                    combined_table_queires,
+                    query,
+                    num_threads,
+                    archive,
+                    output_func,
+                    output_func_arg
+            );
+            continue;
+        }
+
         // first search through the single variable table
-        num_matches += Grep::search_segment_and_output(
-                single_table_queries,
-                query,
-                SIZE_MAX,
-                archive,
-                output_func,
-                output_func_arg
-        );
+        if (query.contains_variable_range_filters()) {
+            num_matches += Grep::search_segment_with_variable_ranges_and_output(
+                    single_table_queries,
+                    query,
+                    SIZE_MAX,
+                    archive,
+                    output_func,
+                    output_func_arg
+            );
+        } else {
+            num_matches += Grep::search_segment_and_output(
+                    single_table_queries,
+                    query,
+                    SIZE_MAX,
+                    archive,
+                    output_func,
+                    output_func_arg
+            );
+        }
         for (auto const& iter : combined_table_queires) {
             combined_table_id_t table_id = iter.first;
             auto const& combined_logtype_queries = iter.second;
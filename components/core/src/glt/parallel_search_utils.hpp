@@ -0,0 +1,125 @@
+#ifndef GLT_PARALLEL_SEARCH_UTILS_HPP
+#define GLT_PARALLEL_SEARCH_UTILS_HPP
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <queue>
+#include <utility>
+#include <vector>
+
+#include <boost/asio/post.hpp>
+#include <boost/asio/thread_pool.hpp>
+
+namespace glt {
+/**
+ * Runs tasks `[0, num_tasks)` on a pool of workers. Workers pull the next task index from a shared
+ * counter, so each task runs exactly once unless a task throws, in which case no new tasks are
+ * started and the first exception is rethrown once every worker has stopped.
+ * @tparam TaskRunnerFactory A callable that returns a task runner, i.e., a callable taking a task
+ * index. Each worker creates its own task runner, so a runner can reuse its state across tasks.
+ * @param num_tasks
+ * @param num_threads The maximum number of workers. At least one worker is used.
+ * @param make_task_runner
+ */
+template <typename TaskRunnerFactory>
+void run_tasks_in_parallel(
+        size_t num_tasks,
+        size_t num_threads,
+        TaskRunnerFactory const& make_task_runner
+) {
+    if (0 == num_tasks) {
+        return;
+    }
+
+    std::atomic_size_t next_task_ix{0};
+    std::atomic_bool stop{false};
+    std::mutex exception_mutex;
+    std::exception_ptr worker_exception;
+    auto run_worker = [&]() {
+        try {
+            auto run_task = make_task_runner();
+            while (false == stop) {
+                auto const task_ix = next_task_ix++;
+                if (task_ix >= num_tasks) {
+                    break;
+                }
+                run_task(task_ix);
+            }
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(exception_mutex);
+            if (nullptr == worker_exception) {
+                worker_exception = std::current_exception();
+            }
+            stop = true;
+        }
+    };
+
+    num_threads = std::max<size_t>(1, std::min(num_threads, num_tasks));
+    boost::asio::thread_pool workers(num_threads);
+    for (size_t i = 0; i < num_threads; ++i) {
+        boost::asio::post(workers, run_worker);
+    }
+    workers.join();
+    if (nullptr != worker_exception) {
+        std::rethrow_exception(worker_exception);
+    }
+}
+
+/**
+ * Merges runs of results that are each sorted by `less`, and outputs them in sorted order. The
+ * merge is stable: equal results are output in the order of their runs, then in their order
+ * within a run, so the output matches stable-sorting the concatenated runs.
+ * @tparam Result
+ * @tparam Less A strict weak ordering of results
+ * @tparam Output A callable taking a result
+ * @param sorted_runs
+ * @param less
+ * @param output
+ * @return The number of results output
+ */
+template <typename Result, typename Less, typename Output>
+size_t merge_sorted_runs_and_output(
+        std::vector<std::vector<Result>> const& sorted_runs,
+        Less const& less,
+        Output const& output
+) {
+    // The heads of the non-empty runs, as (run index, index within run)
+    using RunPosition = std::pair<size_t, size_t>;
+    auto const output_after = [&](RunPosition const& lhs, RunPosition const& rhs) {
+        auto const& lhs_result = sorted_runs[lhs.first][lhs.second];
+        auto const& rhs_result = sorted_runs[rhs.first][rhs.second];
+        if (less(rhs_result, lhs_result)) {
+            return true;
+        }
+        if (less(lhs_result, rhs_result)) {
+            return false;
+        }
+        return lhs.first > rhs.first;
+    };
+    std::priority_queue<RunPosition, std::vector<RunPosition>, decltype(output_after)> heads(
+            output_after
+    );
+    for (size_t run_ix = 0; run_ix < sorted_runs.size(); ++run_ix) {
+        if (false == sorted_runs[run_ix].empty()) {
+            heads.emplace(run_ix, 0);
+        }
+    }
+
+    size_t num_results = 0;
+    while (false == heads.empty()) {
+        auto const [run_ix, result_ix] = heads.top();
+        heads.pop();
+        output(sorted_runs[run_ix][result_ix]);
+        ++num_results;
+        if (result_ix + 1 < sorted_runs[run_ix].size()) {
+            heads.emplace(run_ix, result_ix + 1);
+        }
+    }
+    return num_results;
+}
+}  // namespace glt
+
+#endif  // GLT_PARALLEL_SEARCH_UTILS_HPP
@@ -432,11 +432,14 @@ size_t Archive::decompress_messages_and_output(
     size_t num_vars = logtype_entry.get_num_variables();
     size_t const total_matches = wildcard_required.size();
     std::string decompressed_msg;
-    // The sole purpose of this dummy message is to call output func
+    // The sole purpose of this dummy message is to pass the message's metadata to the output func
     Message dummy_compressed_msg;
+    dummy_compressed_msg.set_logtype_id(logtype_id);
     size_t matches = 0;
     for (size_t ix = 0; ix < total_matches; ix++) {
         decompressed_msg.clear();
+        dummy_compressed_msg.set_timestamp(ts[ix]);
+        dummy_compressed_msg.set_file_id(id[ix]);
 
         // first decompress the message with fixed time stamp
         size_t vars_offset = num_vars * ix;
@@ -85,7 +85,10 @@ void LogtypeTable::open(char const* buffer, LogtypeMetadata const& metadata) {
     m_num_row = m_metadata.num_rows;
     m_num_columns = m_metadata.num_columns;
     m_buffer_size = m_num_row * sizeof(encoded_variable_t);
-    m_read_buffer = std::make_unique<char[]>(m_buffer_size);
+    if (m_buffer_size > m_read_buffer_capacity) {
+        m_read_buffer = std::make_unique<char[]>(m_buffer_size);
+        m_read_buffer_capacity = m_buffer_size;
+    }
     m_read_buffer_ptr = m_read_buffer.get();
     m_ts_loaded = false;
     m_column_loaded.resize(m_num_columns, false);
@@ -184,6 +187,17 @@ void LogtypeTable::load_variable_columns(size_t var_ix_begin, size_t var_ix_end)
     }
 }
 
+encoded_variable_t const* LogtypeTable::get_variable_column(size_t column_ix) {
+    if (!m_is_open) {
+        throw OperationFailed(ErrorCode_Failure, __FILENAME__, __LINE__);
+    }
+    assert(column_ix < m_num_columns);
+    if (m_column_loaded[column_ix] == false) {
+        load_column(column_ix);
+    }
+    return m_column_based_variables.data() + column_ix * m_num_row;
+}
+
 epochtime_t LogtypeTable::get_timestamp_at_offset(size_t offset) {
     if (!m_is_open) {
         throw OperationFailed(ErrorCode_Failure, __FILENAME__, __LINE__);
@@ -32,7 +32,7 @@ public:
 
 class LogtypeTable {
 public:
-    LogtypeTable() : m_read_buffer_ptr(nullptr), m_is_open(false) {}
+    LogtypeTable() : m_read_buffer_ptr(nullptr), m_read_buffer_capacity(0), m_is_open(false) {}
 
     void open(char const* buffer, LogtypeMetadata const& metadata);
     void open_and_load_all(char const* buffer, LogtypeMetadata const& metadata);
@@ -67,6 +67,13 @@ public:
 
     void load_timestamp();
     void load_variable_columns(size_t var_ix_begin, size_t var_ix_end);
+
+    /**
+     * Gets a variable column, loading it first if necessary
+     * @param column_ix
+     * @return Pointer to the column's encoded variables, one per row
+     */
+    encoded_variable_t const* get_variable_column(size_t column_ix);
     void load_remaining_data_into_vec(
             std::vector<epochtime_t>& ts,
             std::vector<file_id_t>& id,
@@ -100,6 +107,9 @@ private:
     std::unique_ptr<char[]> m_read_buffer;
     // helper pointer to avoid get() everytime
     char* m_read_buffer_ptr;
+    // the buffer is only reallocated when a table needs a larger one, so it can be reused across
+    // tables
+    size_t m_read_buffer_capacity;
     size_t m_buffer_size;
 
     char const* m_file_offset;
@@ -70,6 +70,43 @@ void SingleLogtypeTableManager::load_logtype_table_from_combine(
     );
 }
 
+void SingleLogtypeTableManager::open_logtype_table(
+        logtype_dictionary_id_t logtype_id,
+        LogtypeTable& logtype_table
+) const {
+    if (!m_is_open) {
+        throw OperationFailed(ErrorCode_NotInit, __FILENAME__, __LINE__);
+    }
+    logtype_table.open(
+            m_memory_mapped_segment_file.data(),
+            m_logtype_table_metadata.at(logtype_id)
+    );
+}
+
+void SingleLogtypeTableManager::open_combined_table(
+        combined_table_id_t table_id,
+        CombinedLogtypeTable& combined_table,
+        CombinedTableDecompressor& decompressor
+) const {
+    if (!m_is_open) {
+        throw OperationFailed(ErrorCode_NotInit, __FILENAME__, __LINE__);
+    }
+    auto const& table_info = m_combined_table_info.at(table_id);
+    decompressor.open(
+            m_memory_mapped_segment_file.data() + table_info.m_begin_offset,
+            table_info.m_size
+    );
+    combined_table.open(table_id);
+}
+
+void SingleLogtypeTableManager::load_logtype_table_from_combine(
+        logtype_dictionary_id_t logtype_id,
+        CombinedLogtypeTable& combined_table,
+        CombinedTableDecompressor& decompressor
+) const {
+    combined_table.load_logtype_table(logtype_id, decompressor, m_combined_tables_metadata);
+}
+
 // rearrange queries to separate them into single table and combined table ones.
 // also make sure that they are sorted in a way such that the order is same as them on the disk.
 void SingleLogtypeTableManager::rearrange_queries(
@@ -11,6 +11,15 @@
 namespace glt::streaming_archive::reader {
 class SingleLogtypeTableManager : public streaming_archive::reader::LogtypeTableManager {
 public:
+    // Types
+#if USE_PASSTHROUGH_COMPRESSION
+    using CombinedTableDecompressor = streaming_compression::passthrough::Decompressor;
+#elif USE_ZSTD_COMPRESSION
+    using CombinedTableDecompressor = streaming_compression::zstd::Decompressor;
+#else
+    static_assert(false, "Unsupported compression mode.");
+#endif
+
     SingleLogtypeTableManager() : m_logtype_table_loaded(false) {}
 
     void open_logtype_table(logtype_dictionary_id_t logtype_id);
@@ -28,6 +37,41 @@ public:
     void close_combined_table();
     void load_logtype_table_from_combine(logtype_dictionary_id_t logtype_id);
 
+    /**
+     * Opens a logtype table in the segment using the given table instead of the manager's own.
+     * Since every caller-owned table has its own buffers and decompressor, different tables in the
+     * segment can be read concurrently this way.
+     * @param logtype_id
+     * @param logtype_table
+     */
+    void open_logtype_table(logtype_dictionary_id_t logtype_id, LogtypeTable& logtype_table) const;
+
+    /**
+     * Opens a combined table in the segment using the given table and decompressor instead of the
+     * manager's own
+     * @param table_id
+     * @param combined_table
+     * @param decompressor
+     */
+    void open_combined_table(
+            combined_table_id_t table_id,
+            CombinedLogtypeTable& combined_table,
+            CombinedTableDecompressor& decompressor
+    ) const;
+
+    /**
+     * Loads a logtype table from a combined table opened with the overload of
+     * `open_combined_table` above
+     * @param logtype_id
+     * @param combined_table
+     * @param decompressor
+     */
+    void load_logtype_table_from_combine(
+            logtype_dictionary_id_t logtype_id,
+            CombinedLogtypeTable& combined_table,
+            CombinedTableDecompressor& decompressor
+    ) const;
+
     void rearrange_queries(
             std::unordered_map<logtype_dictionary_id_t, LogtypeQueries> const& src_queries,
             std::vector<LogtypeQueries>& single_table_queries,
@@ -45,13 +89,7 @@ private:
     CombinedLogtypeTable m_combined_tables;
 
     // compressor for combined table. try to reuse only one compressor
-#if USE_PASSTHROUGH_COMPRESSION
-    streaming_compression::passthrough::Decompressor m_combined_table_decompressor;
-#elif USE_ZSTD_COMPRESSION
-    streaming_compression::zstd::Decompressor m_combined_table_decompressor;
-#else
-    static_assert(false, "Unsupported compression mode.");
-#endif
+    CombinedTableDecompressor m_combined_table_decompressor;
 };
 }  // namespace glt::streaming_archive::reader
 
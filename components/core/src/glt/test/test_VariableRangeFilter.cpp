@@ -0,0 +1,257 @@
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "../Defs.h"
+#include "../EncodedVariableInterpreter.hpp"
+#include "../ffi/encoding_methods.hpp"
+#include "../ir/types.hpp"
+#include "../VariableRangeFilter.hpp"
+
+namespace glt::test {
+namespace {
+/**
+ * @param float_str
+ * @return The given float encoded as an eight-byte float variable.
+ */
+auto encode_float(std::string_view float_str) -> encoded_variable_t;
+
+/**
+ * @param filter
+ * @param placeholder
+ * @param column
+ * @return The indices of the rows in `column` that `filter` keeps.
+ */
+auto filter_all_rows(
+        VariableRangeFilter const& filter,
+        ir::VariablePlaceholder placeholder,
+        std::vector<encoded_variable_t> const& column
+) -> std::vector<size_t>;
+
+auto encode_float(std::string_view float_str) -> encoded_variable_t {
+    encoded_variable_t encoded_var{};
+    REQUIRE(ffi::encode_float_string(float_str, encoded_var));
+    return encoded_var;
+}
+
+auto filter_all_rows(
+        VariableRangeFilter const& filter,
+        ir::VariablePlaceholder placeholder,
+        std::vector<encoded_variable_t> const& column
+) -> std::vector<size_t> {
+    std::vector<size_t> rows(column.size());
+    for (size_t i{0}; i < rows.size(); ++i) {
+        rows[i] = i;
+    }
+    filter.filter_rows(placeholder, column.data(), rows);
+
+    // The row-at-a-time check must agree with the column scan
+    std::vector<size_t> matched_rows;
+    for (size_t i{0}; i < column.size(); ++i) {
+        if (filter.matches(placeholder, column[i])) {
+            matched_rows.push_back(i);
+        }
+    }
+    REQUIRE(matched_rows == rows);
+    return rows;
+}
+}  // namespace
+
+TEST_CASE("glt_convert_encoded_float_to_double", "[glt][VariableRangeFilter]") {
+    REQUIRE(
+            0.5 == EncodedVariableInterpreter::convert_encoded_float_to_double(encode_float("0.5"))
+    );
+    REQUIRE(
+            -12.25
+            == EncodedVariableInterpreter::convert_encoded_float_to_double(encode_float("-12.25"))
+    );
+    REQUIRE(
+            0.001
+            == EncodedVariableInterpreter::convert_encoded_float_to_double(encode_float(".001"))
+    );
+    REQUIRE(
+            123456789012345.6
+            == EncodedVariableInterpreter::convert_encoded_float_to_double(
+                    encode_float("123456789012345.6")
+            )
+    );
+    REQUIRE(
+            -0.1234567890123456
+            == EncodedVariableInterpreter::convert_encoded_float_to_double(
+                    encode_float("-.1234567890123456")
+            )
+    );
+    // Negative zero compares equal to zero
+    auto const negative_zero{encode_float("-0.0")};
+    REQUIRE(0.0 == EncodedVariableInterpreter::convert_encoded_float_to_double(negative_zero));
+}
+
+TEST_CASE("glt_get_integer_bounds", "[glt][VariableRangeFilter]") {
+    constexpr double cInfinity{std::numeric_limits<double>::infinity()};
+    int64_t integer_lower_bound{0};
+    int64_t integer_upper_bound{0};
+
+    SECTION("Integer bounds are kept as is") {
+        REQUIRE(get_integer_bounds(-5.0, 10.0, integer_lower_bound, integer_upper_bound));
+        REQUIRE(-5 == integer_lower_bound);
+        REQUIRE(10 == integer_upper_bound);
+    }
+
+    SECTION("Fractional bounds are rounded inwards") {
+        REQUIRE(get_integer_bounds(-5.5, 10.5, integer_lower_bound, integer_upper_bound));
+        REQUIRE(-5 == integer_lower_bound);
+        REQUIRE(10 == integer_upper_bound);
+
+        REQUIRE(get_integer_bounds(0.1, 0.9 + 1, integer_lower_bound, integer_upper_bound));
+        REQUIRE(1 == integer_lower_bound);
+        REQUIRE(1 == integer_upper_bound);
+    }
+
+    SECTION("Ranges without integers are rejected") {
+        REQUIRE_FALSE(get_integer_bounds(0.1, 0.9, integer_lower_bound, integer_upper_bound));
+        REQUIRE_FALSE(get_integer_bounds(-0.9, -0.1, integer_lower_bound, integer_upper_bound));
+        REQUIRE_FALSE(get_integer_bounds(2.0, 1.0, integer_lower_bound, integer_upper_bound));
+        REQUIRE_FALSE(get_integer_bounds(
+                std::nan(""),
+                1.0,
+                integer_lower_bound,
+                integer_upper_bound
+        ));
+    }
+
+    SECTION("Bounds beyond int64_t are clamped or rejected") {
+        REQUIRE(get_integer_bounds(
+                -cInfinity,
+                cInfinity,
+                integer_lower_bound,
+                integer_upper_bound
+        ));
+        REQUIRE(INT64_MIN == integer_lower_bound);
+        REQUIRE(INT64_MAX == integer_upper_bound);
+
+        REQUIRE_FALSE(get_integer_bounds(
+                1e19,
+                cInfinity,
+                integer_lower_bound,
+                integer_upper_bound
+        ));
+        REQUIRE_FALSE(get_integer_bounds(
+                -cInfinity,
+                -1e19,
+                integer_lower_bound,
+                integer_upper_bound
+        ));
+    }
+}
+
+TEST_CASE("glt_variable_range_filter", "[glt][VariableRangeFilter]") {
+    SECTION("Integer bounds are inclusive") {
+        VariableRangeFilter const filter{0, -10.0, 10.0};
+        std::vector<encoded_variable_t> const column{-11, -10, -1, 0, 10, 11, INT64_MIN, INT64_MAX};
+        REQUIRE(std::vector<size_t>{1, 2, 3, 4}
+                == filter_all_rows(filter, ir::VariablePlaceholder::Integer, column));
+    }
+
+    SECTION("Fractional bounds exclude the integers outside them") {
+        VariableRangeFilter const filter{0, -9.5, 9.5};
+        std::vector<encoded_variable_t> const column{-10, -9, 9, 10};
+        REQUIRE(std::vector<size_t>{1, 2}
+                == filter_all_rows(filter, ir::VariablePlaceholder::Integer, column));
+    }
+
+    SECTION("Float bounds are inclusive") {
+        VariableRangeFilter const filter{0, -1.5, 2.25};
+        std::vector<encoded_variable_t> const column{
+                encode_float("-1.6"),
+                encode_float("-1.5"),
+                encode_float("-0.0"),
+                encode_float("2.25"),
+                encode_float("2.26"),
+                encode_float("100.0")
+        };
+        REQUIRE(std::vector<size_t>{1, 2, 3}
+                == filter_all_rows(filter, ir::VariablePlaceholder::Float, column));
+    }
+
+    SECTION("Unbounded sides match everything") {
+        constexpr double cInfinity{std::numeric_limits<double>::infinity()};
+        VariableRangeFilter const filter{0, -cInfinity, 0.0};
+        std::vector<encoded_variable_t> const column{INT64_MIN, -1, 0, 1, INT64_MAX};
+        REQUIRE(std::vector<size_t>{0, 1, 2}
+                == filter_all_rows(filter, ir::VariablePlaceholder::Integer, column));
+    }
+
+    SECTION("Dictionary variables never match") {
+        VariableRangeFilter const filter{0, 0.0, 100.0};
+        std::vector<encoded_variable_t> const column{0, 1, 2};
+        REQUIRE(filter_all_rows(filter, ir::VariablePlaceholder::Dictionary, column).empty());
+    }
+
+    SECTION("Only candidate rows are kept, in order") {
+        VariableRangeFilter const filter{0, 0.0, 5.0};
+        std::vector<encoded_variable_t> const column{1, 7, 2, 3, 9, 4};
+        std::vector<size_t> rows{0, 1, 3, 4, 5};
+        filter.filter_rows(ir::VariablePlaceholder::Integer, column.data(), rows);
+        REQUIRE(std::vector<size_t>{0, 3, 5} == rows);
+    }
+}
+
+TEST_CASE("glt_parse_variable_range_filter", "[glt][VariableRangeFilter]") {
+    constexpr double cInfinity{std::numeric_limits<double>::infinity()};
+
+    SECTION("Both bounds") {
+        auto const filter{parse_variable_range_filter("2:-1.5:300")};
+        REQUIRE(2 == filter.get_var_ix());
+        REQUIRE(-1.5 == filter.get_lower_bound());
+        REQUIRE(300.0 == filter.get_upper_bound());
+    }
+
+    SECTION("Omitted bounds are unbounded") {
+        auto filter{parse_variable_range_filter("0::10")};
+        REQUIRE(-cInfinity == filter.get_lower_bound());
+        REQUIRE(10.0 == filter.get_upper_bound());
+
+        filter = parse_variable_range_filter("1:-10:");
+        REQUIRE(-10.0 == filter.get_lower_bound());
+        REQUIRE(cInfinity == filter.get_upper_bound());
+
+        filter = parse_variable_range_filter("3::");
+        REQUIRE(-cInfinity == filter.get_lower_bound());
+        REQUIRE(cInfinity == filter.get_upper_bound());
+    }
+
+    SECTION("Equal bounds") {
+        auto const filter{parse_variable_range_filter("0:5:5")};
+        REQUIRE(5.0 == filter.get_lower_bound());
+        REQUIRE(5.0 == filter.get_upper_bound());
+    }
+
+    SECTION("Malformed filters") {
+        std::vector<std::string> const malformed_filters{
+                "",
+                "0",
+                "0:1",
+                ":1:2",
+                "-1:1:2",
+                "x:1:2",
+                "1x:1:2",
+                "0:a:2",
+                "0:1:2b",
+                "0:1:2:3",
+                "0:2:1",
+                "18446744073709551616:1:2"
+        };
+        for (auto const& filter_str : malformed_filters) {
+            CAPTURE(filter_str);
+            REQUIRE_THROWS_AS(parse_variable_range_filter(filter_str), std::invalid_argument);
+        }
+    }
+}
+}  // namespace glt::test
@@ -0,0 +1,129 @@
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <random>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "../parallel_search_utils.hpp"
+
+namespace glt::test {
+namespace {
+// A result's sort key and the position it was created at, to check that ties are output stably
+using Result = std::pair<int, size_t>;
+
+/**
+ * @param lhs
+ * @param rhs
+ * @return Whether `lhs` sorts before `rhs`, ignoring their creation positions.
+ */
+auto is_key_less(Result const& lhs, Result const& rhs) -> bool;
+
+auto is_key_less(Result const& lhs, Result const& rhs) -> bool {
+    return lhs.first < rhs.first;
+}
+}  // namespace
+
+TEST_CASE("glt_run_tasks_in_parallel", "[glt][parallel_search_utils]") {
+    constexpr size_t cNumTasks{1000};
+    constexpr size_t cNumThreads{8};
+
+    SECTION("Every task runs exactly once on a bounded number of workers") {
+        std::vector<std::atomic_size_t> num_runs_by_task(cNumTasks);
+        std::atomic_size_t num_workers{0};
+        run_tasks_in_parallel(cNumTasks, cNumThreads, [&]() {
+            ++num_workers;
+            return [&](size_t task_ix) { ++num_runs_by_task[task_ix]; };
+        });
+        REQUIRE(num_workers >= 1);
+        REQUIRE(num_workers <= cNumThreads);
+        REQUIRE(std::all_of(
+                num_runs_by_task.cbegin(),
+                num_runs_by_task.cend(),
+                [](std::atomic_size_t const& num_runs) { return 1 == num_runs; }
+        ));
+    }
+
+    SECTION("The number of workers is bounded by the number of tasks") {
+        constexpr size_t cNumFewTasks{2};
+        std::atomic_size_t num_workers{0};
+        run_tasks_in_parallel(cNumFewTasks, cNumThreads, [&]() {
+            ++num_workers;
+            return [](size_t) {};
+        });
+        REQUIRE(num_workers <= cNumFewTasks);
+
+        num_workers = 0;
+        run_tasks_in_parallel(0, cNumThreads, [&]() {
+            ++num_workers;
+            return [](size_t) {};
+        });
+        REQUIRE(0 == num_workers);
+    }
+
+    SECTION("A task's exception reaches the caller and stops new tasks") {
+        constexpr size_t cFailingTaskIx{10};
+        std::atomic_size_t num_tasks_run{0};
+        REQUIRE_THROWS_AS(
+                run_tasks_in_parallel(
+                        cNumTasks,
+                        cNumThreads,
+                        [&]() {
+                            return [&](size_t task_ix) {
+                                ++num_tasks_run;
+                                if (cFailingTaskIx == task_ix) {
+                                    throw std::runtime_error("Task failed.");
+                                }
+                            };
+                        }
+                ),
+                std::runtime_error
+        );
+        REQUIRE(num_tasks_run < cNumTasks);
+    }
+}
+
+TEST_CASE("glt_merge_sorted_runs_and_output", "[glt][parallel_search_utils]") {
+    constexpr size_t cNumRuns{16};
+    constexpr size_t cMaxRunSize{100};
+    constexpr int cMaxKey{50};
+    constexpr unsigned cSeed{42};
+
+    std::mt19937 generator{cSeed};
+    std::uniform_int_distribution<size_t> run_size_distribution{0, cMaxRunSize};
+    std::uniform_int_distribution<int> key_distribution{0, cMaxKey};
+
+    // Keys are drawn from a small range so that runs contain many ties, and some runs are empty
+    std::vector<std::vector<Result>> sorted_runs(cNumRuns);
+    std::vector<Result> expected_results;
+    size_t position{0};
+    for (auto& run : sorted_runs) {
+        auto const run_size{run_size_distribution(generator)};
+        for (size_t i{0}; i < run_size; ++i) {
+            run.emplace_back(key_distribution(generator), position++);
+        }
+        std::stable_sort(run.begin(), run.end(), is_key_less);
+        expected_results.insert(expected_results.end(), run.cbegin(), run.cend());
+    }
+    sorted_runs.emplace_back();
+    std::stable_sort(expected_results.begin(), expected_results.end(), is_key_less);
+
+    std::vector<Result> results;
+    auto const num_results{merge_sorted_runs_and_output(
+            sorted_runs,
+            is_key_less,
+            [&](Result const& result) { results.push_back(result); }
+    )};
+    REQUIRE(expected_results.size() == num_results);
+    REQUIRE(expected_results == results);
+
+    std::vector<std::vector<Result>> const no_runs;
+    REQUIRE(0
+            == merge_sorted_runs_and_output(no_runs, is_key_less, [](Result const&) {
+                   FAIL("No results should be output.");
+               }));
+}
+}  // namespace glt::test
@@ -1,5 +1,6 @@
 #include "CommandLineArguments.hpp"
 
+#include <filesystem>
 #include <iostream>
 
 #include <boost/program_options.hpp>
@@ -46,6 +47,22 @@ CommandLineArguments::parse_arguments(int argc, char const* argv[]) {
             po::value<int>(&m_upsert_interval)
                 ->default_value(m_upsert_interval),
             "Interval for upserting timeline aggregation results (ms)"
+        )(
+            "num-threads",
+            po::value<int>(&m_num_threads)
+                ->default_value(m_num_threads),
+            "Number of threads used to receive and reduce results"
+        )(
+            "memory-budget",
+            po::value<size_t>(&m_memory_budget)
+                ->default_value(m_memory_budget),
+            "Memory (in bytes) the aggregated results may use before they're spilled to disk"
+            " (0 = unlimited)"
+        )(
+            "spill-dir",
+            po::value<std::string>(&m_spill_dir)
+                ->value_name("DIR"),
+            "Directory to spill aggregated results to (defaults to the system's temp directory)"
         );
 
         po::options_description all_options;
@@ -96,6 +113,14 @@ CommandLineArguments::parse_arguments(int argc, char const* argv[]) {
         if (m_upsert_interval <= 0) {
             throw std::invalid_argument("upsert-interval cannot be <= 0.");
         }
+
+        if (m_num_threads <= 0) {
+            throw std::invalid_argument("num-threads cannot be <= 0.");
+        }
+
+        if (m_spill_dir.empty()) {
+            m_spill_dir = (std::filesystem::temp_directory_path() / "clp-reducer-spill").string();
+        }
     } catch (std::exception& e) {
         SPDLOG_ERROR("Failed to validate command line arguments - {}", e.what());
         print_basic_usage();
@@ -1,7 +1,10 @@
 #ifndef REDUCER_COMMANDLINEARGUMENTS_HPP
 #define REDUCER_COMMANDLINEARGUMENTS_HPP
 
+#include <algorithm>
+#include <cstddef>
 #include <string>
+#include <thread>
 
 #include "../clp/CommandLineArgumentsBase.hpp"
 
@@ -30,6 +33,12 @@ public:
 
     [[nodiscard]] int get_upsert_interval() const { return m_upsert_interval; }
 
+    [[nodiscard]] int get_num_threads() const { return m_num_threads; }
+
+    [[nodiscard]] size_t get_memory_budget() const { return m_memory_budget; }
+
+    [[nodiscard]] std::string const& get_spill_dir() const { return m_spill_dir; }
+
 private:
     // Methods
     void print_basic_usage() const override;
@@ -41,6 +50,9 @@ private:
     int m_scheduler_port{7000};
     std::string m_mongodb_uri{"mongodb://localhost:27017/clp-search"};
     int m_upsert_interval{100};  // Milliseconds
+    int m_num_threads{static_cast<int>(std::max(1U, std::thread::hardware_concurrency()))};
+    size_t m_memory_budget{0};  // Bytes
+    std::string m_spill_dir;
 };
 }  // namespace reducer
 
@@ -1,31 +1,426 @@
 #include "CountOperator.hpp"
 
+#include <unistd.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <ios>
+#include <map>
+#include <memory>
+#include <optional>
+#include <set>
+#include <string>
+#include <system_error>
+#include <utility>
+#include <vector>
+
+#include "../clp/ErrorCode.hpp"
+#include "GroupTags.hpp"
+#include "RecordGroup.hpp"
+#include "RecordGroupIterator.hpp"
+
 namespace reducer {
+namespace {
+// Estimated per-entry overhead of the hash table (node, bucket, and GroupTags vector)
+constexpr size_t cHashTableEntryOverhead = 64;
+
+/**
+ * A spill file containing the counts of the groups in one partition.
+ */
+struct SpillPartition {
+    std::filesystem::path path;
+    // The number of times the partition's groups have been split from their original partition
+    size_t depth{0};
+};
+
+/**
+ * @param tags
+ * @param depth The split depth of the partition being divided.
+ * @return The index of the partition that the given group belongs to, when dividing a partition at
+ * the given split depth.
+ */
+size_t get_partition_idx(GroupTags const& tags, size_t depth);
+
+/**
+ * @param tags
+ * @return The estimated number of bytes used to store the given group's count in memory.
+ */
+size_t estimate_entry_size(GroupTags const& tags);
+
+/**
+ * @param path
+ * @param mode Whether to append to or truncate an existing file.
+ * @return A stream that writes to the spill file at the given path.
+ * @throw CountOperator::OperationFailed if the file couldn't be opened.
+ */
+std::ofstream open_spill_file(std::filesystem::path const& path, std::ios::openmode mode);
+
+/**
+ * Closes the given spill files.
+ * @param spill_files
+ * @throw CountOperator::OperationFailed if any file couldn't be written.
+ */
+void close_spill_files(std::map<size_t, std::ofstream>& spill_files);
+
+/**
+ * Deletes the given partition's spill file if it was created by splitting another partition. The
+ * operator's own partitions are kept so that its results can be read again.
+ * @param partition
+ */
+void remove_sub_partition(SpillPartition const& partition);
+
+/**
+ * Writes a count to a spill file as: the number of tags, each tag (length-prefixed), the count.
+ * @param tags
+ * @param count
+ * @param spill_file
+ */
+void write_spilled_count(GroupTags const& tags, int64_t count, std::ofstream& spill_file);
+
+/**
+ * Reads a count written by `write_spilled_count`.
+ * @param spill_file
+ * @param tags Returns the group's tags.
+ * @param count Returns the count.
+ * @return Whether a count was read.
+ * @throw CountOperator::OperationFailed if the spill file is truncated.
+ */
+bool read_spilled_count(std::ifstream& spill_file, GroupTags& tags, int64_t& count);
+
+/**
+ * Reads every count in a spill partition, adding them to the counts in `table`. If the partition's
+ * groups exceed the memory budget, the partition is instead split into sub-partitions (appended to
+ * `sub_partitions`), and `table` is left empty. Sub-partitions are deleted once they're read.
+ * @param partition
+ * @param memory_budget 0 means the partition is never split.
+ * @param table
+ * @param sub_partitions
+ * @throw CountOperator::OperationFailed if the spill files couldn't be read or written.
+ */
+void load_or_split_spill_partition(
+        SpillPartition const& partition,
+        size_t memory_budget,
+        CountOperator::CountTable& table,
+        std::vector<SpillPartition>& sub_partitions
+);
+
+/**
+ * A RecordGroupIterator that exposes the counts in a hash table.
+ */
+class CountTableRecordGroupIterator : public RecordGroupIterator {
+public:
+    CountTableRecordGroupIterator(CountOperator::CountTable const& table, std::string key)
+            : m_table_it{table.cbegin()},
+              m_table_end_it{table.cend()},
+              m_record{std::move(key)},
+              m_group{nullptr, m_record} {}
+
+    RecordGroup& get() override {
+        m_record.set_record_value(m_table_it->second);
+        m_group.set_tags(&m_table_it->first);
+        m_group.reset_record_iterator();
+        return m_group;
+    }
+
+    void next() override { ++m_table_it; }
+
+    bool done() override { return m_table_it == m_table_end_it; }
+
+private:
+    CountOperator::CountTable::const_iterator m_table_it;
+    CountOperator::CountTable::const_iterator m_table_end_it;
+    SingleInt64RecordAdapter m_record;
+    SingleRecordGroup m_group;
+};
+
+/**
+ * A RecordGroupIterator that merges the counts in a set of spill partitions. Only one partition is
+ * loaded into memory at a time, and partitions that don't fit in the memory budget are split until
+ * they do.
+ */
+class SpilledCountRecordGroupIterator : public RecordGroupIterator {
+public:
+    SpilledCountRecordGroupIterator(
+            std::vector<SpillPartition> partitions,
+            size_t memory_budget,
+            std::string key
+    )
+            : m_pending_partitions{partitions.rbegin(), partitions.rend()},
+              m_memory_budget{memory_budget},
+              m_table_it{m_partition.cend()},
+              m_record{std::move(key)},
+              m_group{nullptr, m_record} {
+        load_next_nonempty_partition();
+    }
+
+    // Disable copy and move since m_table_it points into m_partition
+    SpilledCountRecordGroupIterator(SpilledCountRecordGroupIterator const&) = delete;
+    SpilledCountRecordGroupIterator(SpilledCountRecordGroupIterator&&) = delete;
+    SpilledCountRecordGroupIterator& operator=(SpilledCountRecordGroupIterator const&) = delete;
+    SpilledCountRecordGroupIterator& operator=(SpilledCountRecordGroupIterator&&) = delete;
+
+    RecordGroup& get() override {
+        m_record.set_record_value(m_table_it->second);
+        m_group.set_tags(&m_table_it->first);
+        m_group.reset_record_iterator();
+        return m_group;
+    }
+
+    void next() override {
+        ++m_table_it;
+        if (m_table_it == m_partition.cend()) {
+            load_next_nonempty_partition();
+        }
+    }
+
+    bool done() override { return m_table_it == m_partition.cend(); }
+
+private:
+    void load_next_nonempty_partition() {
+        m_partition.clear();
+        while (m_partition.empty() && false == m_pending_partitions.empty()) {
+            auto const partition{std::move(m_pending_partitions.back())};
+            m_pending_partitions.pop_back();
+            // Sub-partitions are pushed onto the stack so they're merged before the next partition
+            load_or_split_spill_partition(
+                    partition,
+                    m_memory_budget,
+                    m_partition,
+                    m_pending_partitions
+            );
+        }
+        m_table_it = m_partition.cbegin();
+    }
+
+    // Stack of partitions that still need to be merged, with the next one at the back
+    std::vector<SpillPartition> m_pending_partitions;
+    size_t m_memory_budget;
+    CountOperator::CountTable m_partition;
+    CountOperator::CountTable::const_iterator m_table_it;
+    SingleInt64RecordAdapter m_record;
+    SingleRecordGroup m_group;
+};
+
+void write_spilled_count(GroupTags const& tags, int64_t count, std::ofstream& spill_file) {
+    uint64_t const num_tags{tags.size()};
+    spill_file.write(reinterpret_cast<char const*>(&num_tags), sizeof(num_tags));
+    for (auto const& tag : tags) {
+        uint64_t const tag_length{tag.size()};
+        spill_file.write(reinterpret_cast<char const*>(&tag_length), sizeof(tag_length));
+        spill_file.write(tag.data(), static_cast<std::streamsize>(tag.size()));
+    }
+    spill_file.write(reinterpret_cast<char const*>(&count), sizeof(count));
+}
+
+bool read_spilled_count(std::ifstream& spill_file, GroupTags& tags, int64_t& count) {
+    uint64_t num_tags{0};
+    spill_file.read(reinterpret_cast<char*>(&num_tags), sizeof(num_tags));
+    if (spill_file.fail()) {
+        if (spill_file.eof() && 0 == spill_file.gcount()) {
+            return false;
+        }
+        throw CountOperator::OperationFailed(clp::ErrorCode_Truncated, __FILENAME__, __LINE__);
+    }
+
+    tags.resize(num_tags);
+    for (auto& tag : tags) {
+        uint64_t tag_length{0};
+        spill_file.read(reinterpret_cast<char*>(&tag_length), sizeof(tag_length));
+        if (spill_file.fail()) {
+            throw CountOperator::OperationFailed(clp::ErrorCode_Truncated, __FILENAME__, __LINE__);
+        }
+        tag.resize(tag_length);
+        spill_file.read(tag.data(), static_cast<std::streamsize>(tag_length));
+        if (spill_file.fail()) {
+            throw CountOperator::OperationFailed(clp::ErrorCode_Truncated, __FILENAME__, __LINE__);
+        }
+    }
+    spill_file.read(reinterpret_cast<char*>(&count), sizeof(count));
+    if (spill_file.fail()) {
+        throw CountOperator::OperationFailed(clp::ErrorCode_Truncated, __FILENAME__, __LINE__);
+    }
+    return true;
+}
+
+size_t get_partition_idx(GroupTags const& tags, size_t depth) {
+    // Mix the depth into the hash and finalize it (using splitmix64's finalizer) so that each split
+    // divides groups independently of previous splits, of the hash table's buckets, and of how
+    // groups are sharded across pipelines.
+    constexpr uint64_t cDepthIncrement{0x9e37'79b9'7f4a'7c15ULL};
+    constexpr uint64_t cMultiplier1{0xbf58'476d'1ce4'e5b9ULL};
+    constexpr uint64_t cMultiplier2{0x94d0'49bb'1331'11ebULL};
+    constexpr int cShift1{30};
+    constexpr int cShift2{27};
+    constexpr int cShift3{31};
+
+    uint64_t hash{GroupTagsHash{}(tags) + depth * cDepthIncrement};
+    hash = (hash ^ (hash >> cShift1)) * cMultiplier1;
+    hash = (hash ^ (hash >> cShift2)) * cMultiplier2;
+    hash ^= hash >> cShift3;
+    return hash % CountOperator::cNumSpillPartitions;
+}
+
+size_t estimate_entry_size(GroupTags const& tags) {
+    size_t size{cHashTableEntryOverhead};
+    for (auto const& tag : tags) {
+        size += sizeof(std::string) + tag.size();
+    }
+    return size;
+}
+
+std::ofstream open_spill_file(std::filesystem::path const& path, std::ios::openmode mode) {
+    std::ofstream spill_file{path, std::ios::binary | mode};
+    if (false == spill_file.is_open()) {
+        throw CountOperator::OperationFailed(clp::ErrorCode_FileNotFound, __FILENAME__, __LINE__);
+    }
+    return spill_file;
+}
+
+void remove_sub_partition(SpillPartition const& partition) {
+    if (0 == partition.depth) {
+        return;
+    }
+    std::error_code error_code;
+    std::filesystem::remove(partition.path, error_code);
+}
+
+void close_spill_files(std::map<size_t, std::ofstream>& spill_files) {
+    for (auto& [partition_idx, spill_file] : spill_files) {
+        spill_file.close();
+        if (spill_file.fail()) {
+            throw CountOperator::OperationFailed(clp::ErrorCode_Failure, __FILENAME__, __LINE__);
+        }
+    }
+}
+
+void load_or_split_spill_partition(
+        SpillPartition const& partition,
+        size_t memory_budget,
+        CountOperator::CountTable& table,
+        std::vector<SpillPartition>& sub_partitions
+) {
+    std::ifstream spill_file{partition.path, std::ios::binary};
+    if (false == spill_file.is_open()) {
+        throw CountOperator::OperationFailed(clp::ErrorCode_FileNotFound, __FILENAME__, __LINE__);
+    }
+
+    GroupTags tags;
+    int64_t count{0};
+    size_t memory_usage{0};
+    bool exceeds_budget{false};
+    while (read_spilled_count(spill_file, tags, count)) {
+        auto [it, inserted] = table.try_emplace(tags, 0);
+        it->second += count;
+        if (false == inserted) {
+            continue;
+        }
+        memory_usage += estimate_entry_size(tags);
+        if (0 != memory_budget && memory_usage > memory_budget
+            && partition.depth < CountOperator::cMaxPartitionSplitDepth)
+        {
+            exceeds_budget = true;
+            break;
+        }
+    }
+    if (false == exceeds_budget) {
+        spill_file.close();
+        remove_sub_partition(partition);
+        return;
+    }
+
+    // Split the partition by moving the loaded counts and the rest of the file's counts into
+    // sub-partitions, so that at most the memory budget is ever loaded.
+    auto const sub_partition_depth{partition.depth + 1};
+    std::map<size_t, std::ofstream> sub_partition_files;
+    auto const write_to_sub_partition = [&](GroupTags const& tags_to_write, int64_t count_to_write) {
+        auto const partition_idx{get_partition_idx(tags_to_write, sub_partition_depth)};
+        auto spill_file_it = sub_partition_files.find(partition_idx);
+        if (sub_partition_files.end() == spill_file_it) {
+            auto sub_partition_path{partition.path};
+            sub_partition_path += "-" + std::to_string(partition_idx);
+            spill_file_it = sub_partition_files
+                                    .try_emplace(
+                                            partition_idx,
+                                            open_spill_file(sub_partition_path, std::ios::trunc)
+                                    )
+                                    .first;
+            sub_partitions.push_back({std::move(sub_partition_path), sub_partition_depth});
+        }
+        write_spilled_count(tags_to_write, count_to_write, spill_file_it->second);
+    };
+    for (auto const& [loaded_tags, loaded_count] : table) {
+        write_to_sub_partition(loaded_tags, loaded_count);
+    }
+    table.clear();
+    while (read_spilled_count(spill_file, tags, count)) {
+        write_to_sub_partition(tags, count);
+    }
+    close_spill_files(sub_partition_files);
+
+    spill_file.close();
+    remove_sub_partition(partition);
+}
+}  // namespace
+
+CountOperator::CountOperator(size_t memory_budget, std::filesystem::path const& spill_dir)
+        : m_memory_budget{memory_budget} {
+    // Give each operator its own directory, since a server may run several pipelines
+    static std::atomic<size_t> next_operator_id{0};
+    m_spill_dir = spill_dir
+                  / ("count-operator-" + std::to_string(getpid()) + "-"
+                     + std::to_string(next_operator_id++));
+}
+
+CountOperator::~CountOperator() {
+    if (false == m_spill_dir.empty()) {
+        std::error_code error_code;
+        std::filesystem::remove_all(m_spill_dir, error_code);
+    }
+}
+
 void CountOperator::push_intra_stage_record_group(
         GroupTags const& tags,
         ConstRecordIterator& record_it
 ) {
-    auto& count = m_group_count[tags];
-
+    int64_t count{0};
     for (; false == record_it.done(); record_it.next()) {
         count += record_it.get().get_int64_value(static_cast<char const*>(cRecordElementKey));
     }
+    add_to_group_count(tags, count);
 }
 
 void CountOperator::push_inter_stage_record_group(
         GroupTags const& tags,
         ConstRecordIterator& record_it
 ) {
-    auto& count = m_group_count[tags];
-
+    int64_t count{0};
     for (; false == record_it.done(); record_it.next()) {
         ++count;
     }
+    add_to_group_count(tags, count);
 }
 
 std::unique_ptr<RecordGroupIterator> CountOperator::get_stored_result_iterator() {
-    return std::make_unique<Int64MapRecordGroupIterator>(
-            m_group_count,
+    if (false == has_spilled()) {
+        return std::make_unique<CountTableRecordGroupIterator>(
+                m_group_count,
+                static_cast<char const*>(cRecordElementKey)
+        );
+    }
+
+    // Spill what's left in memory so that each group's counts are only in its partition
+    spill();
+    std::vector<SpillPartition> partitions;
+    partitions.reserve(m_spilled_partition_paths.size());
+    for (auto const& [partition_idx, path] : m_spilled_partition_paths) {
+        partitions.push_back({path, 0});
+    }
+    return std::make_unique<SpilledCountRecordGroupIterator>(
+            std::move(partitions),
+            m_memory_budget,
             static_cast<char const*>(cRecordElementKey)
     );
 }
@@ -33,10 +428,132 @@ std::unique_ptr<RecordGroupIterator> CountOperator::get_stored_result_iterator()
 std::unique_ptr<RecordGroupIterator> CountOperator::get_stored_result_iterator(
         std::set<GroupTags> const& filtered_tags
 ) {
-    return std::make_unique<FilteredInt64MapRecordGroupIterator>(
-            m_group_count,
-            filtered_tags,
+    if (has_spilled()) {
+        update_spilled_count_index(filtered_tags);
+    }
+
+    m_filtered_group_count.clear();
+    for (auto const& tags : filtered_tags) {
+        std::optional<int64_t> count;
+        if (auto const it = m_group_count.find(tags); m_group_count.cend() != it) {
+            count = it->second;
+        }
+        if (auto const it = m_spilled_count_index.find(tags);
+            m_spilled_count_index.cend() != it && it->second.has_value())
+        {
+            count = count.value_or(0) + it->second.value();
+        }
+        if (count.has_value()) {
+            m_filtered_group_count.emplace(tags, count.value());
+        }
+    }
+
+    return std::make_unique<Int64MapRecordGroupIterator>(
+            m_filtered_group_count,
             static_cast<char const*>(cRecordElementKey)
     );
 }
+
+void CountOperator::add_to_group_count(GroupTags const& tags, int64_t count) {
+    auto [it, inserted] = m_group_count.try_emplace(tags, 0);
+    it->second += count;
+    if (false == inserted) {
+        return;
+    }
+
+    m_memory_usage += estimate_entry_size(tags);
+    if (0 != m_memory_budget && m_memory_usage > m_memory_budget) {
+        spill();
+    }
+}
+
+void CountOperator::spill() {
+    if (m_group_count.empty()) {
+        return;
+    }
+
+    std::error_code error_code;
+    std::filesystem::create_directories(m_spill_dir, error_code);
+    if (error_code) {
+        throw OperationFailed(clp::ErrorCode_Failure, __FILENAME__, __LINE__);
+    }
+
+    std::map<size_t, std::ofstream> spill_files;
+    for (auto const& [tags, count] : m_group_count) {
+        auto const partition_idx = get_partition_idx(tags, 0);
+        auto spill_file_it = spill_files.find(partition_idx);
+        if (spill_files.end() == spill_file_it) {
+            auto const [path_it, path_inserted] = m_spilled_partition_paths.try_emplace(
+                    partition_idx,
+                    m_spill_dir / ("partition-" + std::to_string(partition_idx))
+            );
+            spill_file_it = spill_files
+                                    .try_emplace(
+                                            partition_idx,
+                                            open_spill_file(path_it->second, std::ios::app)
+                                    )
+                                    .first;
+        }
+        write_spilled_count(tags, count, spill_file_it->second);
+
+        if (auto const it = m_spilled_count_index.find(tags); m_spilled_count_index.end() != it) {
+            it->second = it->second.value_or(0) + count;
+        }
+    }
+    close_spill_files(spill_files);
+
+    m_group_count.clear();
+    m_memory_usage = 0;
+}
+
+void CountOperator::update_spilled_count_index(std::set<GroupTags> const& filtered_tags) {
+    std::set<GroupTags> tags_to_index;
+    size_t memory_usage{m_spilled_count_index_memory_usage};
+    for (auto const& tags : filtered_tags) {
+        if (false == m_spilled_count_index.contains(tags)) {
+            tags_to_index.emplace(tags);
+            memory_usage += estimate_entry_size(tags);
+        }
+    }
+    if (tags_to_index.empty()) {
+        return;
+    }
+
+    // Keep the index within the memory budget by rebuilding it for just the filtered groups when
+    // it would exceed the budget
+    if (0 != m_memory_budget && memory_usage > m_memory_budget) {
+        m_spilled_count_index.clear();
+        tags_to_index = filtered_tags;
+        memory_usage = 0;
+        for (auto const& tags : tags_to_index) {
+            memory_usage += estimate_entry_size(tags);
+        }
+    }
+    m_spilled_count_index_memory_usage = memory_usage;
+
+    std::set<size_t> partitions_to_read;
+    for (auto const& tags : tags_to_index) {
+        m_spilled_count_index.emplace(tags, std::nullopt);
+        auto const partition_idx = get_partition_idx(tags, 0);
+        if (m_spilled_partition_paths.contains(partition_idx)) {
+            partitions_to_read.emplace(partition_idx);
+        }
+    }
+
+    GroupTags tags;
+    int64_t count{0};
+    for (auto const partition_idx : partitions_to_read) {
+        std::ifstream spill_file{m_spilled_partition_paths.at(partition_idx), std::ios::binary};
+        if (false == spill_file.is_open()) {
+            throw OperationFailed(clp::ErrorCode_FileNotFound, __FILENAME__, __LINE__);
+        }
+        while (read_spilled_count(spill_file, tags, count)) {
+            if (false == tags_to_index.contains(tags)) {
+                continue;
+            }
+            auto& spilled_count = m_spilled_count_index.at(tags);
+            spilled_count = spilled_count.value_or(0) + count;
+        }
+    }
+}
 }  // namespace reducer
@@ -1,33 +1,148 @@
 #ifndef REDUCER_COUNTOPERATOR_HPP
 #define REDUCER_COUNTOPERATOR_HPP
 
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
 #include <map>
+#include <memory>
+#include <optional>
+#include <set>
 #include <string>
+#include <unordered_map>
 
+#include "../clp/ErrorCode.hpp"
+#include "../clp/TraceableException.hpp"
 #include "GroupTags.hpp"
 #include "Operator.hpp"
 
 namespace reducer {
 /**
  * Count operator that accumulates a count per record group.
+ *
+ * Counts are aggregated in a hash table keyed by the group's tags, so each distinct set of tags is
+ * stored once and looked up by reference. If a memory budget is set and the hash table's estimated
+ * size exceeds it, the table is hash-partitioned and spilled to files in the spill directory. When
+ * the results are requested, the partitions are merged one at a time. A partition whose groups don't
+ * fit in the memory budget is split into sub-partitions using a different hash, recursively, so
+ * merging stays within the budget regardless of how the groups are distributed.
+ *
+ * Filtered result requests (e.g., for periodic upserts of recently updated groups) stream through
+ * the spilled partitions only for groups that they haven't seen before. The spilled counts of the
+ * groups they've seen are kept in a resident index that's updated whenever the operator spills.
  */
 class CountOperator : public Operator {
 public:
+    // Types
+    class OperationFailed : public clp::TraceableException {
+    public:
+        // Constructors
+        OperationFailed(clp::ErrorCode error_code, char const* filename, int line_number)
+                : clp::TraceableException{error_code, filename, line_number} {}
+
+        // Methods
+        [[nodiscard]] char const* what() const noexcept override {
+            return "reducer::CountOperator operation failed";
+        }
+    };
+
+    using CountTable = std::unordered_map<GroupTags, int64_t, GroupTagsHash>;
+
     static constexpr char cRecordElementKey[] = "count";
+    static constexpr size_t cNumSpillPartitions = 16;
+    // The maximum number of times a spill partition is recursively split while merging. Beyond
+    // this, partitions are merged even if they exceed the memory budget.
+    static constexpr size_t cMaxPartitionSplitDepth = 4;
+
+    // Constructors
+    /**
+     * Constructs an operator that keeps all counts in memory.
+     */
+    CountOperator() = default;
 
+    /**
+     * @param memory_budget The estimated number of bytes the in-memory counts may occupy before
+     * they're spilled to disk. 0 means the counts are never spilled.
+     * @param spill_dir A directory under which the operator may create its spill files.
+     */
+    CountOperator(size_t memory_budget, std::filesystem::path const& spill_dir);
+
+    // Disable copy and move since spill files are owned by the operator
+    CountOperator(CountOperator const&) = delete;
+    CountOperator(CountOperator&&) = delete;
+    CountOperator& operator=(CountOperator const&) = delete;
+    CountOperator& operator=(CountOperator&&) = delete;
+
+    // Destructor
+    ~CountOperator() override;
+
+    // Methods
     void
     push_intra_stage_record_group(GroupTags const& tags, ConstRecordIterator& record_it) override;
 
     void
     push_inter_stage_record_group(GroupTags const& tags, ConstRecordIterator& record_it) override;
 
+    /**
+     * @return An iterator over the count of every group. If any counts have been spilled, the
+     * remaining in-memory counts are spilled too, and the partitions are merged while iterating.
+     * @throw CountOperator::OperationFailed if the counts couldn't be spilled or read back.
+     */
     std::unique_ptr<RecordGroupIterator> get_stored_result_iterator() override;
+
+    /**
+     * @param filtered_tags
+     * @return An iterator over the count of every group in `filtered_tags`. Spilled partitions are
+     * only read for groups that aren't in the resident index of spilled counts yet.
+     * @throw CountOperator::OperationFailed if the spilled counts couldn't be read.
+     */
     std::unique_ptr<RecordGroupIterator> get_stored_result_iterator(
             std::set<GroupTags> const& filtered_tags
     ) override;
 
+    [[nodiscard]] bool has_spilled() const { return false == m_spilled_partition_paths.empty(); }
+
 private:
-    std::map<GroupTags, int64_t> m_group_count;
+    // Methods
+    /**
+     * Adds to the count of the given group, spilling the counts to disk if they exceed the memory
+     * budget.
+     * @param tags
+     * @param count
+     */
+    void add_to_group_count(GroupTags const& tags, int64_t count);
+
+    /**
+     * Appends all in-memory counts to their partitions' spill files and clears them from memory.
+     * The counts of groups in the resident spilled-count index are added to the index.
+     * @throw CountOperator::OperationFailed if the counts couldn't be written.
+     */
+    void spill();
+
+    /**
+     * Adds the spilled counts of any of the given groups that aren't in the resident spilled-count
+     * index to the index, by streaming through the partitions they belong to. If the index would
+     * exceed the memory budget, it's rebuilt for only the given groups.
+     * @param filtered_tags
+     * @throw CountOperator::OperationFailed if the spilled counts couldn't be read.
+     */
+    void update_spilled_count_index(std::set<GroupTags> const& filtered_tags);
+
+    // Variables
+    CountTable m_group_count;
+    size_t m_memory_usage{0};
+    size_t m_memory_budget{0};
+
+    std::filesystem::path m_spill_dir;
+    std::map<size_t, std::filesystem::path> m_spilled_partition_paths;
+
+    // Total spilled count of each group that filtered result requests have looked up, or
+    // `std::nullopt` if the group hasn't been spilled.
+    std::unordered_map<GroupTags, std::optional<int64_t>, GroupTagsHash> m_spilled_count_index;
+    size_t m_spilled_count_index_memory_usage{0};
+
+    // Backing storage for the results returned by the filtered result iterator
+    std::map<GroupTags, int64_t> m_filtered_group_count;
 };
 }  // namespace reducer
 
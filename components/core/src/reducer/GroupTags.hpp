@@ -1,12 +1,29 @@
 #ifndef REDUCER_GROUPTAGS_HPP
 #define REDUCER_GROUPTAGS_HPP
 
+#include <cstddef>
+#include <functional>
 #include <string>
 #include <vector>
 
 namespace reducer {
 // We will do something fancier for GroupTags in the future, but this is good enough to get started
 using GroupTags = std::vector<std::string>;
+
+/**
+ * Hash function for GroupTags, so that they can be used as keys in unordered containers.
+ */
+struct GroupTagsHash {
+    size_t operator()(GroupTags const& tags) const {
+        size_t hash{tags.size()};
+        for (auto const& tag : tags) {
+            // Same mixing as boost::hash_combine
+            hash ^= std::hash<std::string>{}(tag) + 0x9e37'79b9'7f4a'7c15ULL + (hash << 6)
+                    + (hash >> 2);
+        }
+        return hash;
+    }
+};
 }  // namespace reducer
 
 #endif  // REDUCER_GROUPTAGS_HPP
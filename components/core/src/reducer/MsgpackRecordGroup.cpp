@@ -0,0 +1,208 @@
+#include "MsgpackRecordGroup.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <string_view>
+
+#include <msgpack.hpp>
+
+#include "../clp/ErrorCode.hpp"
+#include "DeserializedRecordGroup.hpp"
+#include "RecordTypedKeyIterator.hpp"
+
+namespace reducer {
+namespace {
+/**
+ * A RecordTypedKeyIterator over the primitive elements of a msgpack map.
+ */
+class MsgpackRecordTypedKeyIterator : public RecordTypedKeyIterator {
+public:
+    explicit MsgpackRecordTypedKeyIterator(msgpack::object_map const& record)
+            : m_cur{record.ptr},
+              m_end{record.ptr + record.size} {
+        skip_unsupported_elements();
+    }
+
+    TypedRecordKey get() override {
+        return {std::string_view{m_cur->key.via.str.ptr, m_cur->key.via.str.size}, m_type};
+    }
+
+    void next() override {
+        ++m_cur;
+        skip_unsupported_elements();
+    }
+
+    bool done() override { return m_cur == m_end; }
+
+private:
+    /**
+     * Advances the iterator until it points to an element with a string key and a value type that
+     * can be represented by ValueType.
+     */
+    void skip_unsupported_elements() {
+        for (; m_cur != m_end; ++m_cur) {
+            if (msgpack::type::STR != m_cur->key.type) {
+                continue;
+            }
+            switch (m_cur->val.type) {
+                case msgpack::type::POSITIVE_INTEGER:
+                case msgpack::type::NEGATIVE_INTEGER:
+                    m_type = ValueType::Int64;
+                    return;
+                case msgpack::type::FLOAT32:
+                case msgpack::type::FLOAT64:
+                    m_type = ValueType::Double;
+                    return;
+                case msgpack::type::STR:
+                    m_type = ValueType::String;
+                    return;
+                default:
+                    break;
+            }
+        }
+    }
+
+    msgpack::object_kv const* m_cur;
+    msgpack::object_kv const* m_end;
+    ValueType m_type{ValueType::String};
+};
+
+/**
+ * @param map
+ * @param key
+ * @return The value of the element with the given key in the map, or nullptr if it doesn't exist.
+ */
+msgpack::object const* find_map_value(msgpack::object_map const& map, std::string_view key);
+
+/**
+ * Unpacks the serialized data without copying any strings out of it.
+ * @param buf
+ * @param len
+ * @return The unpacked object.
+ */
+msgpack::object_handle unpack_by_reference(char const* buf, size_t len);
+
+msgpack::object const* find_map_value(msgpack::object_map const& map, std::string_view key) {
+    for (auto const* kv = map.ptr; kv != map.ptr + map.size; ++kv) {
+        if (msgpack::type::STR == kv->key.type
+            && key == std::string_view{kv->key.via.str.ptr, kv->key.via.str.size})
+        {
+            return &kv->val;
+        }
+    }
+    return nullptr;
+}
+
+msgpack::object_handle unpack_by_reference(char const* buf, size_t len) {
+    // Returning true tells msgpack to reference (rather than copy) strings in the buffer.
+    msgpack::unpack_reference_func const reference_all
+            = [](msgpack::type::object_type, size_t, void*) -> bool { return true; };
+    return msgpack::unpack(buf, len, reference_all);
+}
+}  // namespace
+
+std::string_view MsgpackRecord::get_string_view(std::string_view key) const {
+    auto const& value = get_value(key);
+    if (msgpack::type::STR != value.type) {
+        throw OperationFailed(clp::ErrorCode_BadParam, __FILENAME__, __LINE__);
+    }
+    return {value.via.str.ptr, value.via.str.size};
+}
+
+int64_t MsgpackRecord::get_int64_value(std::string_view key) const {
+    auto const& value = get_value(key);
+    switch (value.type) {
+        case msgpack::type::POSITIVE_INTEGER:
+            return static_cast<int64_t>(value.via.u64);
+        case msgpack::type::NEGATIVE_INTEGER:
+            return value.via.i64;
+        case msgpack::type::FLOAT32:
+        case msgpack::type::FLOAT64:
+            return static_cast<int64_t>(value.via.f64);
+        default:
+            throw OperationFailed(clp::ErrorCode_BadParam, __FILENAME__, __LINE__);
+    }
+}
+
+double MsgpackRecord::get_double_value(std::string_view key) const {
+    auto const& value = get_value(key);
+    switch (value.type) {
+        case msgpack::type::FLOAT32:
+        case msgpack::type::FLOAT64:
+            return value.via.f64;
+        case msgpack::type::POSITIVE_INTEGER:
+            return static_cast<double>(value.via.u64);
+        case msgpack::type::NEGATIVE_INTEGER:
+            return static_cast<double>(value.via.i64);
+        default:
+            throw OperationFailed(clp::ErrorCode_BadParam, __FILENAME__, __LINE__);
+    }
+}
+
+std::unique_ptr<RecordTypedKeyIterator> MsgpackRecord::typed_key_iter() const {
+    if (nullptr == m_record) {
+        return std::make_unique<EmptyRecordTypedKeyIterator>();
+    }
+    return std::make_unique<MsgpackRecordTypedKeyIterator>(*m_record);
+}
+
+msgpack::object const& MsgpackRecord::get_value(std::string_view key) const {
+    msgpack::object const* value{nullptr};
+    if (nullptr != m_record) {
+        value = find_map_value(*m_record, key);
+    }
+    if (nullptr == value) {
+        throw OperationFailed(clp::ErrorCode_BadParam, __FILENAME__, __LINE__);
+    }
+    return *value;
+}
+
+MsgpackRecordGroup::MsgpackRecordGroup(char const* buf, size_t len) {
+    try {
+        m_handle = unpack_by_reference(buf, len);
+    } catch (std::exception const&) {
+        throw OperationFailed(clp::ErrorCode_Corrupt, __FILENAME__, __LINE__);
+    }
+
+    auto const& record_group = m_handle.get();
+    if (msgpack::type::MAP != record_group.type) {
+        throw OperationFailed(clp::ErrorCode_Corrupt, __FILENAME__, __LINE__);
+    }
+
+    auto const* tags = find_map_value(
+            record_group.via.map,
+            static_cast<char const*>(DeserializedRecordGroup::cGroupTagsKey)
+    );
+    auto const* records = find_map_value(
+            record_group.via.map,
+            static_cast<char const*>(DeserializedRecordGroup::cRecordsKey)
+    );
+    if (nullptr == tags || msgpack::type::ARRAY != tags->type || nullptr == records
+        || msgpack::type::ARRAY != records->type)
+    {
+        throw OperationFailed(clp::ErrorCode_Corrupt, __FILENAME__, __LINE__);
+    }
+
+    m_tags.reserve(tags->via.array.size);
+    for (auto const* tag = tags->via.array.ptr; tag != tags->via.array.ptr + tags->via.array.size;
+         ++tag)
+    {
+        if (msgpack::type::STR != tag->type) {
+            throw OperationFailed(clp::ErrorCode_Corrupt, __FILENAME__, __LINE__);
+        }
+        m_tags.emplace_back(tag->via.str.ptr, tag->via.str.size);
+    }
+
+    for (auto const* record = records->via.array.ptr;
+         record != records->via.array.ptr + records->via.array.size;
+         ++record)
+    {
+        if (msgpack::type::MAP != record->type) {
+            throw OperationFailed(clp::ErrorCode_Corrupt, __FILENAME__, __LINE__);
+        }
+    }
+    m_record_it = MsgpackArrayRecordIterator{records->via.array};
+}
+}  // namespace reducer
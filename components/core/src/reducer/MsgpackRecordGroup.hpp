@@ -0,0 +1,158 @@
+#ifndef REDUCER_MSGPACKRECORDGROUP_HPP
+#define REDUCER_MSGPACKRECORDGROUP_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string_view>
+
+#include <msgpack.hpp>
+
+#include "../clp/ErrorCode.hpp"
+#include "../clp/TraceableException.hpp"
+#include "ConstRecordIterator.hpp"
+#include "GroupTags.hpp"
+#include "Record.hpp"
+#include "RecordGroup.hpp"
+#include "RecordTypedKeyIterator.hpp"
+
+namespace reducer {
+/**
+ * Record implementation which exposes root-level primitive elements of a msgpack map without
+ * copying them.
+ */
+class MsgpackRecord : public Record {
+public:
+    // Types
+    class OperationFailed : public clp::TraceableException {
+    public:
+        // Constructors
+        OperationFailed(clp::ErrorCode error_code, char const* filename, int line_number)
+                : clp::TraceableException{error_code, filename, line_number} {}
+
+        // Methods
+        [[nodiscard]] char const* what() const noexcept override {
+            return "reducer::MsgpackRecord operation failed";
+        }
+    };
+
+    MsgpackRecord() = default;
+
+    explicit MsgpackRecord(msgpack::object_map const* record) : m_record{record} {}
+
+    void set_record(msgpack::object_map const* record) { m_record = record; }
+
+    /**
+     * @param key
+     * @return The string value of the element with the given key.
+     * @throw MsgpackRecord::OperationFailed if the element doesn't exist or isn't a string.
+     */
+    [[nodiscard]] std::string_view get_string_view(std::string_view key) const override;
+
+    /**
+     * @param key
+     * @return The value of the element with the given key, converted to an integer if it's a
+     * float.
+     * @throw MsgpackRecord::OperationFailed if the element doesn't exist or isn't a number.
+     */
+    [[nodiscard]] int64_t get_int64_value(std::string_view key) const override;
+
+    /**
+     * @param key
+     * @return The value of the element with the given key, converted to a double if it's an
+     * integer.
+     * @throw MsgpackRecord::OperationFailed if the element doesn't exist or isn't a number.
+     */
+    [[nodiscard]] double get_double_value(std::string_view key) const override;
+
+    [[nodiscard]] std::unique_ptr<RecordTypedKeyIterator> typed_key_iter() const override;
+
+private:
+    /**
+     * @param key
+     * @return The value of the element with the given key.
+     * @throw MsgpackRecord::OperationFailed if the element doesn't exist.
+     */
+    [[nodiscard]] msgpack::object const& get_value(std::string_view key) const;
+
+    msgpack::object_map const* m_record{nullptr};
+};
+
+/**
+ * A ConstRecordIterator over an array of msgpack maps.
+ */
+class MsgpackArrayRecordIterator : public ConstRecordIterator {
+public:
+    MsgpackArrayRecordIterator() = default;
+
+    explicit MsgpackArrayRecordIterator(msgpack::object_array const& records)
+            : m_cur{records.ptr},
+              m_end{records.ptr + records.size} {
+        update_record();
+    }
+
+    [[nodiscard]] Record const& get() const override { return m_record; }
+
+    void next() override {
+        ++m_cur;
+        update_record();
+    }
+
+    bool done() override { return m_cur == m_end; }
+
+private:
+    void update_record() {
+        if (m_cur != m_end) {
+            m_record.set_record(&m_cur->via.map);
+        }
+    }
+
+    msgpack::object const* m_cur{nullptr};
+    msgpack::object const* m_end{nullptr};
+    MsgpackRecord m_record;
+};
+
+/**
+ * RecordGroup implementation that exposes the records in a serialized record group (as produced by
+ * `reducer::serialize`) directly from the serialized msgpack bytes.
+ *
+ * Unlike DeserializedRecordGroup, this class doesn't build a JSON DOM: strings in the records
+ * reference the serialized buffer, so the buffer must outlive this object.
+ */
+class MsgpackRecordGroup : public RecordGroup {
+public:
+    // Types
+    class OperationFailed : public clp::TraceableException {
+    public:
+        // Constructors
+        OperationFailed(clp::ErrorCode error_code, char const* filename, int line_number)
+                : clp::TraceableException{error_code, filename, line_number} {}
+
+        // Methods
+        [[nodiscard]] char const* what() const noexcept override {
+            return "reducer::MsgpackRecordGroup operation failed";
+        }
+    };
+
+    // Constructors
+    /**
+     * @param buf
+     * @param len
+     * @throw MsgpackRecordGroup::OperationFailed if the buffer doesn't contain a valid serialized
+     * record group.
+     */
+    MsgpackRecordGroup(char const* buf, size_t len);
+
+    // Methods
+    [[nodiscard]] ConstRecordIterator& record_iter() override { return m_record_it; }
+
+    [[nodiscard]] GroupTags const& get_tags() const override { return m_tags; }
+
+private:
+    msgpack::object_handle m_handle;
+    GroupTags m_tags;
+    MsgpackArrayRecordIterator m_record_it;
+};
+}  // namespace reducer
+
+#endif  // REDUCER_MSGPACKRECORDGROUP_HPP
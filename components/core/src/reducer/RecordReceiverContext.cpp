@@ -3,7 +3,7 @@
 #include <cstring>
 
 #include "../clp/spdlog_with_specializations.hpp"
-#include "DeserializedRecordGroup.hpp"
+#include "MsgpackRecordGroup.hpp"
 #include "types.hpp"
 
 namespace reducer {
@@ -63,8 +63,22 @@ bool RecordReceiverContext::read_record_groups_packet() {
         }
         read_head += sizeof(record_size);
 
-        auto record_group = DeserializedRecordGroup{read_head, record_size};
-        m_server_ctx->push_record_group(record_group.get_tags(), record_group.record_iter());
+        try {
+            MsgpackRecordGroup record_group{read_head, record_size};
+            auto const pushed{m_server_ctx->push_record_group(
+                    record_group.get_tags(),
+                    record_group.record_iter()
+            )};
+            if (false == pushed) {
+                return false;
+            }
+        } catch (MsgpackRecordGroup::OperationFailed const& e) {
+            SPDLOG_ERROR("Failed to deserialize record group - {}", e.what());
+            return false;
+        } catch (MsgpackRecord::OperationFailed const& e) {
+            SPDLOG_ERROR("Failed to read record - {}", e.what());
+            return false;
+        }
         m_buf_num_bytes_occupied -= (record_size + sizeof(record_size));
         read_head += record_size;
     }
@@ -1,5 +1,15 @@
 #include "ServerContext.hpp"
 
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <utility>
+#include <vector>
+
 #include <bsoncxx/builder/stream/document.hpp>
 #include <mongocxx/bulk_write.hpp>
 #include <mongocxx/client.hpp>
@@ -52,7 +62,11 @@ vector<uint8_t> serialize_timeline_result(GroupTags const& tags, ConstRecordIter
 // TODO: We should use tcp::v6 and set ip::v6_only to false, but this isn't guaranteed to work; so
 // for now, we use v4 to be safe.
 ServerContext::ServerContext(CommandLineArguments& args)
-        : m_tcp_acceptor{m_ioctx, tcp::endpoint(tcp::v4(), args.get_reducer_port())},
+        : m_control_strand{boost::asio::make_strand(m_ioctx)},
+          m_num_threads{static_cast<size_t>(args.get_num_threads())},
+          m_memory_budget{args.get_memory_budget()},
+          m_spill_dir{args.get_spill_dir()},
+          m_tcp_acceptor{m_ioctx, tcp::endpoint(tcp::v4(), args.get_reducer_port())},
           m_scheduler_socket{m_ioctx},
           m_upsert_timer{m_ioctx},
           m_reducer_host{args.get_reducer_host()},
@@ -70,14 +84,41 @@ ServerContext::ServerContext(CommandLineArguments& args)
 
 void ServerContext::reset() {
     m_ioctx.restart();
-    m_pipeline.reset(nullptr);
+    m_pipeline_shards.clear();
     m_status = ServerStatus::Idle;
     m_job_id = -1;
     m_is_timeline_aggregation = false;
-    m_updated_tags.clear();
     m_num_active_receiver_tasks = 0;
 }
 
+void ServerContext::run() {
+    std::vector<std::exception_ptr> exceptions(m_num_threads);
+    std::vector<std::thread> threads;
+    threads.reserve(m_num_threads - 1);
+    auto run_event_loop = [&](size_t thread_idx) {
+        try {
+            m_ioctx.run();
+        } catch (...) {
+            exceptions[thread_idx] = std::current_exception();
+            // Stop the other threads so that the exception can be handled
+            m_ioctx.stop();
+        }
+    };
+    for (size_t i{1}; i < m_num_threads; ++i) {
+        threads.emplace_back(run_event_loop, i);
+    }
+    run_event_loop(0);
+    for (auto& thread : threads) {
+        thread.join();
+    }
+
+    for (auto const& exception : exceptions) {
+        if (nullptr != exception) {
+            std::rethrow_exception(exception);
+        }
+    }
+}
+
 void ServerContext::stop_event_loop() {
     m_tcp_acceptor.cancel();
     m_scheduler_socket.close();
@@ -132,12 +173,14 @@ bool ServerContext::ack_query_scheduler() {
 }
 
 void ServerContext::decrement_num_active_receiver_tasks() {
-    --m_num_active_receiver_tasks;
-    if (0 == m_num_active_receiver_tasks && ServerStatus::ReceivedAllResults == m_status) {
-        if (false == try_finalize_results()) {
-            m_status = ServerStatus::UnrecoverableFailure;
+    boost::asio::post(m_control_strand, [this]() {
+        --m_num_active_receiver_tasks;
+        if (0 == m_num_active_receiver_tasks && ServerStatus::ReceivedAllResults == m_status) {
+            if (false == try_finalize_results()) {
+                m_status = ServerStatus::UnrecoverableFailure;
+            }
         }
-    }
+    });
 }
 
 void ServerContext::set_up_pipeline(nlohmann::json const& query_config) {
@@ -149,8 +192,21 @@ void ServerContext::set_up_pipeline(nlohmann::json const& query_config) {
     // timeline aggregation.
     // TODO: We'll need to implement more general pipeline initialization once more operators are
     // needed.
-    m_pipeline = std::make_unique<Pipeline>(PipelineInputMode::IntraStage);
-    m_pipeline->add_pipeline_stage(std::make_shared<CountOperator>());
+    // The memory budget is shared evenly between the shards. A budget smaller than the number of
+    // shards is clamped so that it doesn't round down to 0 (unlimited).
+    m_pipeline_shards.clear();
+    size_t shard_memory_budget{0};
+    if (0 != m_memory_budget) {
+        shard_memory_budget = std::max<size_t>(m_memory_budget / m_num_threads, 1);
+    }
+    for (size_t i{0}; i < m_num_threads; ++i) {
+        auto shard = std::make_unique<PipelineShard>();
+        shard->pipeline = std::make_unique<Pipeline>(PipelineInputMode::IntraStage);
+        shard->pipeline->add_pipeline_stage(
+                std::make_shared<CountOperator>(shard_memory_budget, m_spill_dir)
+        );
+        m_pipeline_shards.emplace_back(std::move(shard));
+    }
 
     if (query_config.count(cJobAttributes::TimeBucketSize) > 0
         && false == query_config[cJobAttributes::TimeBucketSize].is_null())
@@ -162,30 +218,56 @@ void ServerContext::set_up_pipeline(nlohmann::json const& query_config) {
     m_mongodb_results_collection = m_mongodb_results_database[collection_name];
 }
 
-void ServerContext::push_record_group(GroupTags const& tags, ConstRecordIterator& record_it) {
+bool ServerContext::push_record_group(GroupTags const& tags, ConstRecordIterator& record_it) {
+    auto& shard = get_pipeline_shard(tags);
+    std::lock_guard<std::mutex> const lock{shard.mutex};
     if (m_is_timeline_aggregation) {
-        m_updated_tags.insert(tags);
+        shard.updated_tags.insert(tags);
     }
-    m_pipeline->push_record_group(tags, record_it);
+    try {
+        shard.pipeline->push_record_group(tags, record_it);
+    } catch (CountOperator::OperationFailed const& e) {
+        handle_pipeline_spill_failure(e);
+        return false;
+    }
+    return true;
 }
 
 bool ServerContext::upsert_timeline_results() {
-    if (m_updated_tags.empty()) {
+    // Serialize the updated results from each shard while holding its lock, so that receivers can
+    // keep pushing record groups while the results are being upserted.
+    vector<std::pair<int64_t, vector<uint8_t>>> results;
+    vector<std::set<GroupTags>> upserted_tags(m_pipeline_shards.size());
+    for (size_t i{0}; i < m_pipeline_shards.size(); ++i) {
+        auto& shard = *m_pipeline_shards[i];
+        std::lock_guard<std::mutex> const lock{shard.mutex};
+        if (shard.updated_tags.empty()) {
+            continue;
+        }
+        try {
+            for (auto group_it = shard.pipeline->finish(shard.updated_tags);
+                 false == group_it->done();
+                 group_it->next())
+            {
+                auto& group = group_it->get();
+                int64_t timestamp{std::stoll(group.get_tags().front())};
+                results.emplace_back(
+                        timestamp,
+                        serialize_timeline_result(group.get_tags(), group.record_iter())
+                );
+            }
+        } catch (CountOperator::OperationFailed const& e) {
+            handle_pipeline_spill_failure(e);
+            return false;
+        }
+        upserted_tags[i].swap(shard.updated_tags);
+    }
+    if (results.empty()) {
         return true;
     }
 
-    bool any_updates = false;
     auto bulk_write = m_mongodb_results_collection.create_bulk_write();
-    vector<vector<uint8_t>> results;
-    for (auto group_it = m_pipeline->finish(m_updated_tags); false == group_it->done();
-         group_it->next())
-    {
-        int64_t timestamp{std::stoll(group_it->get().get_tags().front())};
-
-        auto& group = group_it->get();
-        results.emplace_back(serialize_timeline_result(group.get_tags(), group.record_iter()));
-
-        auto& result = results.back();
+    for (auto const& [timestamp, result] : results) {
         mongocxx::model::replace_one replace_op{
                 bsoncxx::builder::basic::make_document(
                         bsoncxx::builder::basic::kvp("timestamp", timestamp)
@@ -194,16 +276,18 @@ bool ServerContext::upsert_timeline_results() {
         };
         replace_op.upsert(true);
         bulk_write.append(replace_op);
-
-        any_updates = true;
     }
     try {
-        if (any_updates) {
-            bulk_write.execute();
-            m_updated_tags.clear();
-        }
+        bulk_write.execute();
     } catch (mongocxx::bulk_write_exception const& e) {
         SPDLOG_ERROR("Failed to upsert timeline results - {}", e.what());
+
+        // Restore the tags so that they're upserted again if the caller retries
+        for (size_t i{0}; i < m_pipeline_shards.size(); ++i) {
+            auto& shard = *m_pipeline_shards[i];
+            std::lock_guard<std::mutex> const lock{shard.mutex};
+            shard.updated_tags.merge(upserted_tags[i]);
+        }
         return false;
     }
 
@@ -213,14 +297,24 @@ bool ServerContext::upsert_timeline_results() {
 bool ServerContext::publish_pipeline_results() {
     vector<vector<uint8_t>> results;
     vector<bsoncxx::document::view> result_documents;
-    for (auto group_it = m_pipeline->finish(); false == group_it->done(); group_it->next()) {
-        auto& group = group_it->get();
-        results.push_back(
-                serialize(group.get_tags(), group.record_iter(), nlohmann::json::to_bson)
-        );
-
-        vector<uint8_t>& encoded_result = results.back();
-        result_documents.emplace_back(encoded_result.data(), encoded_result.size());
+    for (auto& shard : m_pipeline_shards) {
+        std::lock_guard<std::mutex> const lock{shard->mutex};
+        try {
+            for (auto group_it = shard->pipeline->finish(); false == group_it->done();
+                 group_it->next())
+            {
+                auto& group = group_it->get();
+                results.push_back(
+                        serialize(group.get_tags(), group.record_iter(), nlohmann::json::to_bson)
+                );
+
+                vector<uint8_t>& encoded_result = results.back();
+                result_documents.emplace_back(encoded_result.data(), encoded_result.size());
+            }
+        } catch (CountOperator::OperationFailed const& e) {
+            handle_pipeline_spill_failure(e);
+            return false;
+        }
     }
     try {
         if (result_documents.empty() == false) {
@@ -257,4 +351,22 @@ bool ServerContext::try_finalize_results() {
     // Notify the query scheduler that the results have been pushed
     return ack_query_scheduler();
 }
+
+ServerContext::PipelineShard& ServerContext::get_pipeline_shard(GroupTags const& tags) {
+    auto const shard_idx = GroupTagsHash{}(tags) % m_pipeline_shards.size();
+    return *m_pipeline_shards[shard_idx];
+}
+
+void ServerContext::handle_pipeline_spill_failure(clp::TraceableException const& e) {
+    SPDLOG_ERROR(
+            "Failed to spill reducer pipeline state for job {} - {}:{} {}",
+            m_job_id,
+            e.get_filename(),
+            e.get_line_number(),
+            e.what()
+    );
+    m_status = ServerStatus::UnrecoverableFailure;
+    // The sockets must only be closed from the control strand
+    boost::asio::post(m_control_strand, [this]() { stop_event_loop(); });
+}
 }  // namespace reducer
@@ -1,8 +1,14 @@
 #ifndef REDUCER_SERVERCONTEXT_HPP
 #define REDUCER_SERVERCONTEXT_HPP
 
+#include <atomic>
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <mutex>
 #include <optional>
 #include <set>
+#include <vector>
 
 #include <boost/asio.hpp>
 #include <mongocxx/client.hpp>
@@ -31,6 +37,14 @@ constexpr char TimeBucketSize[] = "count_by_time_bucket_size";
 /**
  * Class which manages interactions with the jobs database and result cache database. Also holds
  * state for the reducer job this server is handling.
+ *
+ * The server's event loop runs on multiple threads. Handlers that manage the job's lifecycle (i.e.,
+ * accepting connections, communicating with the scheduler, tracking active receivers, and
+ * publishing results) run on a single strand, while handlers for each receiver run concurrently
+ * with those of other receivers. To let receivers push record groups concurrently, the reducer
+ * pipeline is split into shards, where each record group is routed to a shard by its tags. Since
+ * a given set of tags always maps to the same shard, the shards' results are disjoint and are
+ * merged by concatenating them when publishing.
  */
 class ServerContext {
 public:
@@ -58,9 +72,10 @@ public:
     void reset();
 
     /**
-     * Executes the server event loop until no tasks remain.
+     * Executes the server event loop on `num_threads` threads until no tasks remain.
+     * @throw The first exception thrown by the event loop on any thread.
      */
-    void run() { m_ioctx.run(); }
+    void run();
 
     /**
      * Stops the event loop by closing the connection to the scheduler, and cancelling any ongoing
@@ -86,12 +101,17 @@ public:
 
     /**
      * Increments the number of active receiver tasks which may receive some results.
+     *
+     * NOTE: This method must be called from a handler running on the control strand.
      */
     void increment_num_active_receiver_tasks() { ++m_num_active_receiver_tasks; }
 
     /**
      * Decrements the number of active receiver tasks, and calls try_finalize_results if the server
      * is in the state ReceivedAllResults and there are no remaining active receiver tasks.
+     *
+     * NOTE: This method may be called from any thread; the decrement is posted to the control
+     * strand.
      */
     void decrement_num_active_receiver_tasks();
 
@@ -102,22 +122,33 @@ public:
     void set_up_pipeline(nlohmann::json const& query_config);
 
     /**
-     * Pushes a record group into the reducer pipeline.
+     * Pushes a record group into the reducer pipeline shard that owns the group's tags. This method
+     * is thread-safe.
+     *
+     * If the pipeline fails to spill its state to disk, the job can't produce correct results, so
+     * the server's status is set to UnrecoverableFailure and the event loop is stopped.
      * @param group_tags The tags in the record group.
      * @param record_it An iterator for the records in the record group.
+     * @return Whether the record group was pushed successfully.
      */
-    void push_record_group(GroupTags const& tags, ConstRecordIterator& record_it);
+    bool push_record_group(GroupTags const& tags, ConstRecordIterator& record_it);
 
     /**
      * Upserts the current set of timeline entries from the reducer pipeline to MongoDB and clears
      * the tags that were updated in the last period. This method is executed repeatedly in the main
      * polling loop while running a reduction pipeline that is set to periodically upsert results.
+     *
+     * If the pipeline's spilled state can't be read or written, the server's status is set to
+     * UnrecoverableFailure.
      * @return Whether the upsert succeeded (or was unnecessary).
      */
     bool upsert_timeline_results();
 
     /**
      * Publishes the reducer pipeline results to MongoDB.
+     *
+     * If the pipeline's spilled state can't be read or written, the server's status is set to
+     * UnrecoverableFailure.
      * @return Whether the publication succeeded.
      */
     bool publish_pipeline_results();
@@ -133,6 +164,13 @@ public:
 
     boost::asio::io_context& get_io_context() { return m_ioctx; }
 
+    /**
+     * @return The strand on which all handlers that manage the job's lifecycle must run.
+     */
+    boost::asio::strand<boost::asio::io_context::executor_type>& get_control_strand() {
+        return m_control_strand;
+    }
+
     boost::asio::ip::tcp::acceptor& get_tcp_acceptor() { return m_tcp_acceptor; }
 
     boost::asio::ip::tcp::socket& get_scheduler_update_socket() { return m_scheduler_socket; }
@@ -143,7 +181,7 @@ public:
 
     [[nodiscard]] int get_reducer_port() const { return m_reducer_port; }
 
-    [[nodiscard]] ServerStatus get_status() const { return m_status; }
+    [[nodiscard]] ServerStatus get_status() const { return m_status.load(); }
 
     void set_status(ServerStatus new_status) { m_status = new_status; }
 
@@ -156,7 +194,36 @@ public:
     [[nodiscard]] int get_upsert_interval() const { return m_upsert_interval; }
 
 private:
+    // Types
+    /**
+     * A partition of the reducer pipeline's state, guarded by its own mutex.
+     */
+    struct PipelineShard {
+        std::mutex mutex;
+        std::unique_ptr<Pipeline> pipeline;
+        std::set<GroupTags> updated_tags;
+    };
+
+    // Methods
+    /**
+     * @param tags
+     * @return The pipeline shard that owns the given tags.
+     */
+    PipelineShard& get_pipeline_shard(GroupTags const& tags);
+
+    /**
+     * Marks the job as having failed unrecoverably because the pipeline couldn't spill its state,
+     * and stops the event loop. This method may be called from any thread.
+     * @param e The exception thrown by the pipeline.
+     */
+    void handle_pipeline_spill_failure(clp::TraceableException const& e);
+
+    // Variables
     boost::asio::io_context m_ioctx;
+    boost::asio::strand<boost::asio::io_context::executor_type> m_control_strand;
+    size_t m_num_threads;
+    size_t m_memory_budget;
+    std::filesystem::path m_spill_dir;
     boost::asio::ip::tcp::acceptor m_tcp_acceptor;
     boost::asio::ip::tcp::socket m_scheduler_socket;
     std::vector<char> m_scheduler_update_buffer;
@@ -165,12 +232,11 @@ private:
     int m_reducer_port;
     int m_num_active_receiver_tasks{0};
 
-    ServerStatus m_status{ServerStatus::Idle};
+    std::atomic<ServerStatus> m_status{ServerStatus::Idle};
     job_id_t m_job_id{-1};
 
-    std::unique_ptr<Pipeline> m_pipeline;
+    std::vector<std::unique_ptr<PipelineShard>> m_pipeline_shards;
     bool m_is_timeline_aggregation{false};
-    std::set<GroupTags> m_updated_tags;
 
     boost::asio::steady_timer m_upsert_timer;
     int m_upsert_interval;
@@ -0,0 +1,282 @@
+// Load generator for the reducer server.
+//
+// This program plays the role of both the query scheduler and the search workers: it waits for a
+// reducer to register, assigns it a count-by-time job, and then simulates `num-senders` concurrent
+// search workers, each sending count-by-time results over its own connection. Once every sender
+// has finished, it notifies the reducer that all results have been sent, waits for the reducer to
+// publish the results, and reports the throughput.
+//
+// NOTE: The reducer publishes results to MongoDB, so the reducer must be able to connect to a
+// MongoDB instance.
+
+#include <unistd.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <map>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <boost/asio.hpp>
+#include <boost/program_options.hpp>
+#include <nlohmann/json.hpp>
+#include <spdlog/sinks/stdout_sinks.h>
+
+#include "../clp/spdlog_with_specializations.hpp"
+#include "CountOperator.hpp"
+#include "network_utils.hpp"
+#include "RecordGroupIterator.hpp"
+#include "ServerContext.hpp"
+#include "types.hpp"
+
+namespace po = boost::program_options;
+using boost::asio::ip::tcp;
+
+namespace {
+struct Options {
+    int scheduler_port{7000};
+    reducer::job_id_t job_id{1};
+    size_t num_senders{64};
+    size_t num_packets_per_sender{100};
+    size_t num_buckets_per_packet{100};
+    int64_t bucket_size{1000};
+};
+
+/**
+ * Parses the command line arguments.
+ * @param argc
+ * @param argv
+ * @param options Returns the parsed options.
+ * @return Whether the program should continue.
+ */
+bool parse_arguments(int argc, char const* argv[], Options& options);
+
+/**
+ * Sends a size-prefixed msgpack message to the reducer over the scheduler connection.
+ * @param socket
+ * @param message
+ */
+void send_scheduler_message(tcp::socket& socket, nlohmann::json const& message);
+
+/**
+ * Waits for the reducer to acknowledge the last scheduler message.
+ * @param socket
+ * @return Whether the acknowledgement was received.
+ */
+bool receive_scheduler_ack(tcp::socket& socket);
+
+/**
+ * Simulates a search worker sending count-by-time results to the reducer.
+ * @param host
+ * @param port
+ * @param sender_idx
+ * @param options
+ * @return Whether all results were sent successfully.
+ */
+bool run_sender(std::string const& host, int port, size_t sender_idx, Options const& options);
+
+bool parse_arguments(int argc, char const* argv[], Options& options) {
+    po::options_description options_description("Options");
+    // clang-format off
+    options_description.add_options()(
+        "help,h",
+        "Print help"
+    )(
+        "scheduler-port",
+        po::value<int>(&options.scheduler_port)->default_value(options.scheduler_port),
+        "Port to listen on for the reducer's registration (the reducer's --scheduler-port)"
+    )(
+        "job-id",
+        po::value<reducer::job_id_t>(&options.job_id)->default_value(options.job_id),
+        "ID of the job to assign to the reducer"
+    )(
+        "num-senders",
+        po::value<size_t>(&options.num_senders)->default_value(options.num_senders),
+        "Number of concurrent senders to simulate"
+    )(
+        "num-packets-per-sender",
+        po::value<size_t>(&options.num_packets_per_sender)
+            ->default_value(options.num_packets_per_sender),
+        "Number of result packets each sender sends"
+    )(
+        "num-buckets-per-packet",
+        po::value<size_t>(&options.num_buckets_per_packet)
+            ->default_value(options.num_buckets_per_packet),
+        "Number of time buckets (record groups) in each result packet"
+    );
+    // clang-format on
+
+    po::variables_map variables;
+    try {
+        po::store(po::parse_command_line(argc, argv, options_description), variables);
+        po::notify(variables);
+    } catch (std::exception const& e) {
+        SPDLOG_ERROR("Failed to parse command line arguments - {}", e.what());
+        return false;
+    }
+    if (variables.count("help")) {
+        std::cerr << "Usage: reducer-load-generator [OPTIONS]" << std::endl;
+        std::cerr << options_description << std::endl;
+        return false;
+    }
+    if (0 == options.num_senders) {
+        SPDLOG_ERROR("num-senders cannot be 0.");
+        return false;
+    }
+    return true;
+}
+
+void send_scheduler_message(tcp::socket& socket, nlohmann::json const& message) {
+    auto const serialized_message = nlohmann::json::to_msgpack(message);
+    size_t const message_size = serialized_message.size();
+    boost::asio::write(socket, boost::asio::buffer(&message_size, sizeof(message_size)));
+    boost::asio::write(socket, boost::asio::buffer(serialized_message));
+}
+
+bool receive_scheduler_ack(tcp::socket& socket) {
+    char ack{0};
+    boost::system::error_code error;
+    boost::asio::read(socket, boost::asio::buffer(&ack, sizeof(ack)), error);
+    return false == error.failed() && 'y' == ack;
+}
+
+bool run_sender(std::string const& host, int port, size_t sender_idx, Options const& options) {
+    auto const socket_fd = reducer::connect_to_reducer(host, port, options.job_id);
+    if (-1 == socket_fd) {
+        SPDLOG_ERROR("Sender {} failed to connect to the reducer", sender_idx);
+        return false;
+    }
+
+    // Each sender reports a different (but overlapping) range of buckets so that the reducer has to
+    // merge counts for the same tags across connections.
+    std::map<int64_t, int64_t> bucket_counts;
+    for (size_t i{0}; i < options.num_buckets_per_packet; ++i) {
+        auto const bucket_idx = static_cast<int64_t>(sender_idx + i);
+        bucket_counts.emplace(bucket_idx * options.bucket_size, 1);
+    }
+
+    bool success{true};
+    for (size_t i{0}; i < options.num_packets_per_sender; ++i) {
+        if (false
+            == reducer::send_pipeline_results(
+                    socket_fd,
+                    std::make_unique<reducer::Int64Int64MapRecordGroupIterator>(
+                            bucket_counts,
+                            static_cast<char const*>(reducer::CountOperator::cRecordElementKey)
+                    )
+            ))
+        {
+            SPDLOG_ERROR("Sender {} failed to send results", sender_idx);
+            success = false;
+            break;
+        }
+    }
+    close(socket_fd);
+    return success;
+}
+}  // namespace
+
+int main(int argc, char const* argv[]) {
+    try {
+        auto stderr_logger = spdlog::stderr_logger_st("stderr");
+        spdlog::set_default_logger(stderr_logger);
+        spdlog::set_pattern("%Y-%m-%dT%H:%M:%S.%e%z [%l] %v");
+    } catch (std::exception& e) {
+        // NOTE: We can't log an exception if the logger couldn't be constructed
+        return 1;
+    }
+
+    Options options;
+    if (false == parse_arguments(argc, argv, options)) {
+        return 1;
+    }
+
+    boost::asio::io_context io_context;
+    tcp::socket scheduler_socket{io_context};
+    std::string reducer_host;
+    int reducer_port{0};
+    try {
+        tcp::acceptor acceptor{io_context, tcp::endpoint(tcp::v4(), options.scheduler_port)};
+        SPDLOG_INFO("Waiting for a reducer to register on port {}", options.scheduler_port);
+        acceptor.accept(scheduler_socket);
+
+        size_t advertisement_size{0};
+        boost::asio::read(
+                scheduler_socket,
+                boost::asio::buffer(&advertisement_size, sizeof(advertisement_size))
+        );
+        std::vector<uint8_t> advertisement(advertisement_size);
+        boost::asio::read(scheduler_socket, boost::asio::buffer(advertisement));
+        auto const parsed_advertisement = nlohmann::json::from_msgpack(advertisement);
+        reducer_host = parsed_advertisement.at("host").get<std::string>();
+        reducer_port = parsed_advertisement.at("port").get<int>();
+
+        nlohmann::json job_config;
+        job_config[reducer::cJobAttributes::JobId] = options.job_id;
+        job_config[reducer::cJobAttributes::TimeBucketSize] = options.bucket_size;
+        send_scheduler_message(scheduler_socket, job_config);
+    } catch (std::exception const& e) {
+        SPDLOG_ERROR("Failed to assign a job to the reducer - {}", e.what());
+        return 1;
+    }
+    if (false == receive_scheduler_ack(scheduler_socket)) {
+        SPDLOG_ERROR("Reducer didn't accept the job");
+        return 1;
+    }
+    SPDLOG_INFO("Reducer at {}:{} accepted job {}", reducer_host, reducer_port, options.job_id);
+
+    auto const start_time = std::chrono::steady_clock::now();
+    std::atomic<size_t> num_failed_senders{0};
+    std::vector<std::thread> senders;
+    senders.reserve(options.num_senders);
+    for (size_t i{0}; i < options.num_senders; ++i) {
+        senders.emplace_back([&, i]() {
+            if (false == run_sender(reducer_host, reducer_port, i, options)) {
+                ++num_failed_senders;
+            }
+        });
+    }
+    for (auto& sender : senders) {
+        sender.join();
+    }
+    auto const send_end_time = std::chrono::steady_clock::now();
+
+    // Tell the reducer all results have been sent, and wait for it to publish them
+    try {
+        send_scheduler_message(scheduler_socket, nlohmann::json::object());
+    } catch (std::exception const& e) {
+        SPDLOG_ERROR("Failed to notify the reducer that all results were sent - {}", e.what());
+        return 1;
+    }
+    if (false == receive_scheduler_ack(scheduler_socket)) {
+        SPDLOG_ERROR("Reducer failed to publish the results");
+        return 1;
+    }
+    auto const end_time = std::chrono::steady_clock::now();
+
+    if (num_failed_senders > 0) {
+        SPDLOG_ERROR("{} of {} senders failed", num_failed_senders.load(), options.num_senders);
+        return 1;
+    }
+
+    auto const num_record_groups = options.num_senders * options.num_packets_per_sender
+                                   * options.num_buckets_per_packet;
+    std::chrono::duration<double> const send_duration = send_end_time - start_time;
+    std::chrono::duration<double> const total_duration = end_time - start_time;
+    SPDLOG_INFO(
+            "Sent {} record groups from {} senders in {:.3f}s ({:.0f} record groups/s); results "
+            "were published after {:.3f}s.",
+            num_record_groups,
+            options.num_senders,
+            send_duration.count(),
+            static_cast<double>(num_record_groups) / send_duration.count(),
+            total_duration.count()
+    );
+    return 0;
+}
@@ -123,7 +123,12 @@ void PeriodicUpsertTask::operator()([[maybe_unused]] boost::system::error_code c
 
     auto& upsert_timer = m_server_ctx->get_upsert_timer();
     upsert_timer.expires_after(std::chrono::milliseconds(m_server_ctx->get_upsert_interval()));
-    upsert_timer.async_wait(PeriodicUpsertTask(m_server_ctx));
+    upsert_timer.async_wait(
+            boost::asio::bind_executor(
+                    m_server_ctx->get_control_strand(),
+                    PeriodicUpsertTask(m_server_ctx)
+            )
+    );
 }
 
 void ReceiveTask::operator()(boost::system::error_code const& error, size_t num_bytes_read) {
@@ -152,10 +157,13 @@ void SchedulerUpdateListenerTask::operator()(
         boost::system::error_code const& error,
         size_t num_bytes_read
 ) {
-    // This can include the scheduler closing the connection because the job has been cancelled
+    // This can include the scheduler closing the connection because the job has been cancelled,
+    // or the server closing it after an unrecoverable failure (which mustn't be downgraded)
     if (0 == num_bytes_read || error.failed()) {
         SPDLOG_ERROR("Closing connection with scheduler due to connection error or shutdown");
-        m_server_ctx->set_status(ServerStatus::RecoverableFailure);
+        if (ServerStatus::UnrecoverableFailure != m_server_ctx->get_status()) {
+            m_server_ctx->set_status(ServerStatus::RecoverableFailure);
+        }
         m_server_ctx->stop_event_loop();
         return;
     }
@@ -209,7 +217,12 @@ void SchedulerUpdateListenerTask::operator()(
             upsert_timer.expires_after(
                     std::chrono::milliseconds(m_server_ctx->get_upsert_interval())
             );
-            upsert_timer.async_wait(PeriodicUpsertTask(m_server_ctx));
+            upsert_timer.async_wait(
+                    boost::asio::bind_executor(
+                            m_server_ctx->get_control_strand(),
+                            PeriodicUpsertTask(m_server_ctx)
+                    )
+            );
         }
 
         // Synchronously notify the scheduler that the reducer is ready
@@ -226,7 +239,9 @@ void SchedulerUpdateListenerTask::operator()(
         m_server_ctx->set_status(ServerStatus::ReceivedAllResults);
 
         if (false == m_server_ctx->try_finalize_results()) {
-            m_server_ctx->set_status(ServerStatus::RecoverableFailure);
+            if (ServerStatus::UnrecoverableFailure != m_server_ctx->get_status()) {
+                m_server_ctx->set_status(ServerStatus::RecoverableFailure);
+            }
             m_server_ctx->stop_event_loop();
             return;
         }
@@ -264,7 +279,10 @@ void ValidateSenderTask::operator()(boost::system::error_code const& error, size
 
 void queue_accept_task(std::shared_ptr<ServerContext> const& ctx) {
     auto rctx = RecordReceiverContext::new_receiver(ctx);
-    ctx->get_tcp_acceptor().async_accept(rctx->get_socket(), AcceptTask(rctx));
+    ctx->get_tcp_acceptor().async_accept(
+            rctx->get_socket(),
+            boost::asio::bind_executor(ctx->get_control_strand(), AcceptTask(rctx))
+    );
 }
 
 void queue_receive_task(std::shared_ptr<RecordReceiverContext> const& ctx) {
@@ -283,7 +301,10 @@ void queue_scheduler_update_listener_task(
             ctx->get_scheduler_update_socket(),
             boost::asio::dynamic_buffer(ctx->get_scheduler_update_buffer()),
             boost::asio::transfer_at_least(1),  // Makes boost::asio forward results right away
-            SchedulerUpdateListenerTask(ctx, current_buffer_occupancy)
+            boost::asio::bind_executor(
+                    ctx->get_control_strand(),
+                    SchedulerUpdateListenerTask(ctx, current_buffer_occupancy)
+            )
     );
 }
 
@@ -405,6 +426,8 @@ int main(int argc, char const* argv[]) {
             SPDLOG_ERROR("Job {} finished with a recoverable error", ctx->get_job_id());
         } else if ((reducer::ServerStatus::UnrecoverableFailure == ctx->get_status())) {
             SPDLOG_CRITICAL("Job {} finished with an unrecoverable error", ctx->get_job_id());
+            // Release the job's pipeline so that any spill files it created are removed
+            ctx->reset();
             return 1;
         } else {
             SPDLOG_CRITICAL(
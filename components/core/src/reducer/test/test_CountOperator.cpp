@@ -0,0 +1,178 @@
+#include <cstddef>
+#include <cstdint>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <random>
+#include <set>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "../ConstRecordIterator.hpp"
+#include "../CountOperator.hpp"
+#include "../GroupTags.hpp"
+#include "../Record.hpp"
+#include "../RecordGroupIterator.hpp"
+
+namespace reducer::test {
+namespace {
+constexpr char cSpillDir[] = "test-count-operator-spill";
+constexpr size_t cNumGroups{1000};
+constexpr size_t cNumPushes{5000};
+constexpr int64_t cMaxCount{100};
+constexpr unsigned cSeed{42};
+
+/**
+ * Pushes a record containing `count` for the given group into the operator.
+ * @param count_operator
+ * @param tags
+ * @param count
+ */
+auto push_count(CountOperator& count_operator, GroupTags const& tags, int64_t count) -> void;
+
+/**
+ * @param result_it
+ * @return The count of each group returned by the iterator.
+ */
+auto collect_counts(RecordGroupIterator& result_it) -> std::map<GroupTags, int64_t>;
+
+/**
+ * @param group_idx
+ * @return The tags of the group with the given index.
+ */
+auto get_group_tags(size_t group_idx) -> GroupTags;
+
+auto push_count(CountOperator& count_operator, GroupTags const& tags, int64_t count) -> void {
+    SingleInt64RecordAdapter record{CountOperator::cRecordElementKey};
+    record.set_record_value(count);
+    SingleRecordIterator record_it{record};
+    count_operator.push_intra_stage_record_group(tags, record_it);
+}
+
+auto collect_counts(RecordGroupIterator& result_it) -> std::map<GroupTags, int64_t> {
+    std::map<GroupTags, int64_t> counts;
+    for (; false == result_it.done(); result_it.next()) {
+        auto& group{result_it.get()};
+        auto& record_it{group.record_iter()};
+        REQUIRE_FALSE(record_it.done());
+        auto const count{record_it.get().get_int64_value(CountOperator::cRecordElementKey)};
+        REQUIRE(counts.emplace(group.get_tags(), count).second);
+    }
+    return counts;
+}
+
+auto get_group_tags(size_t group_idx) -> GroupTags {
+    return {"group", std::to_string(group_idx)};
+}
+}  // namespace
+
+TEST_CASE("count_operator_spill_and_merge", "[reducer][CountOperator]") {
+    // A budget of 1 byte spills on every new group and splits partitions to the maximum depth, a
+    // budget of a few groups splits partitions once or twice, and 0 never spills.
+    size_t memory_budget{0};
+    SECTION("No budget") {
+        memory_budget = 0;
+    }
+    SECTION("Budget smaller than one group") {
+        memory_budget = 1;
+    }
+    SECTION("Budget smaller than a partition") {
+        memory_budget = 4096;
+    }
+    SECTION("Budget larger than a partition") {
+        memory_budget = 65'536;
+    }
+
+    std::filesystem::remove_all(cSpillDir);
+    std::map<GroupTags, int64_t> expected_counts;
+    {
+        CountOperator count_operator{memory_budget, cSpillDir};
+        std::mt19937 generator{cSeed};
+        std::uniform_int_distribution<size_t> group_distribution{0, cNumGroups - 1};
+        std::uniform_int_distribution<int64_t> count_distribution{0, cMaxCount};
+        for (size_t i{0}; i < cNumPushes; ++i) {
+            auto const tags{get_group_tags(group_distribution(generator))};
+            auto const count{count_distribution(generator)};
+            push_count(count_operator, tags, count);
+            expected_counts[tags] += count;
+        }
+        REQUIRE((0 != memory_budget) == count_operator.has_spilled());
+
+        auto result_it{count_operator.get_stored_result_iterator()};
+        REQUIRE(expected_counts == collect_counts(*result_it));
+
+        // Merging mustn't consume the spilled counts
+        result_it = count_operator.get_stored_result_iterator();
+        REQUIRE(expected_counts == collect_counts(*result_it));
+    }
+    // The operator removes its spill files when it's destroyed
+    REQUIRE((false == std::filesystem::exists(cSpillDir) || std::filesystem::is_empty(cSpillDir)));
+    std::filesystem::remove_all(cSpillDir);
+}
+
+TEST_CASE("count_operator_filtered_results", "[reducer][CountOperator]") {
+    constexpr size_t cNumPushesPerInterval{250};
+    constexpr size_t cMemoryBudget{2048};
+
+    auto count_operator_ptr{std::make_unique<CountOperator>(cMemoryBudget, cSpillDir)};
+    auto& count_operator{*count_operator_ptr};
+    std::mt19937 generator{cSeed};
+    std::uniform_int_distribution<size_t> group_distribution{0, cNumGroups - 1};
+    std::uniform_int_distribution<int64_t> count_distribution{0, cMaxCount};
+
+    std::map<GroupTags, int64_t> expected_counts;
+    for (size_t i{0}; i < cNumPushes; i += cNumPushesPerInterval) {
+        // Each interval, upsert the groups that were updated, like the reducer server does
+        std::set<GroupTags> updated_tags;
+        for (size_t j{0}; j < cNumPushesPerInterval; ++j) {
+            auto const tags{get_group_tags(group_distribution(generator))};
+            auto const count{count_distribution(generator)};
+            push_count(count_operator, tags, count);
+            expected_counts[tags] += count;
+            updated_tags.emplace(tags);
+        }
+
+        std::map<GroupTags, int64_t> expected_filtered_counts;
+        for (auto const& tags : updated_tags) {
+            expected_filtered_counts.emplace(tags, expected_counts.at(tags));
+        }
+        auto result_it{count_operator.get_stored_result_iterator(updated_tags)};
+        REQUIRE(expected_filtered_counts == collect_counts(*result_it));
+    }
+    REQUIRE(count_operator.has_spilled());
+
+    // Groups that were never pushed aren't returned
+    std::set<GroupTags> const missing_tags{{"missing"}, get_group_tags(cNumGroups)};
+    auto missing_it{count_operator.get_stored_result_iterator(missing_tags)};
+    REQUIRE(missing_it->done());
+
+    auto result_it{count_operator.get_stored_result_iterator()};
+    REQUIRE(expected_counts == collect_counts(*result_it));
+
+    count_operator_ptr.reset();
+    std::filesystem::remove_all(cSpillDir);
+}
+
+TEST_CASE("count_operator_unwritable_spill_dir", "[reducer][CountOperator]") {
+    // A regular file can't contain the operator's spill directory, regardless of the user's
+    // permissions
+    constexpr char cUnwritableSpillDir[] = "test-count-operator-unwritable-spill-dir";
+    std::filesystem::remove_all(cUnwritableSpillDir);
+    std::ofstream{cUnwritableSpillDir}.close();
+    REQUIRE(std::filesystem::is_regular_file(cUnwritableSpillDir));
+
+    {
+        CountOperator count_operator{1, cUnwritableSpillDir};
+        REQUIRE_THROWS_AS(
+                push_count(count_operator, get_group_tags(0), 1),
+                CountOperator::OperationFailed
+        );
+        REQUIRE_FALSE(count_operator.has_spilled());
+    }
+    // Destroying the operator after a failed spill mustn't throw or touch the file
+    REQUIRE(std::filesystem::is_regular_file(cUnwritableSpillDir));
+    std::filesystem::remove_all(cUnwritableSpillDir);
+}
+}  // namespace reducer::test
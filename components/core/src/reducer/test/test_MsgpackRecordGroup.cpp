@@ -0,0 +1,123 @@
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+#include <nlohmann/json.hpp>
+
+#include "../DeserializedRecordGroup.hpp"
+#include "../GroupTags.hpp"
+#include "../MsgpackRecordGroup.hpp"
+#include "../RecordTypedKeyIterator.hpp"
+
+namespace reducer::test {
+namespace {
+/**
+ * @param record_group
+ * @return The record group serialized as msgpack.
+ */
+auto to_msgpack(nlohmann::json const& record_group) -> std::vector<char>;
+
+auto to_msgpack(nlohmann::json const& record_group) -> std::vector<char> {
+    auto const bytes{nlohmann::json::to_msgpack(record_group)};
+    return {bytes.begin(), bytes.end()};
+}
+}  // namespace
+
+TEST_CASE("msgpack_record_group_typed_getters", "[reducer][MsgpackRecordGroup]") {
+    nlohmann::json const json_record_group{
+            {DeserializedRecordGroup::cGroupTagsKey, {"tag0", "tag1"}},
+            {DeserializedRecordGroup::cRecordsKey,
+             {{{"count", 42},
+               {"negative", -7},
+               {"ratio", 2.5},
+               {"name", "value"},
+               {"nested", {{"key", 1}}}},
+              {{"count", 1}}}}
+    };
+    auto const serialized{to_msgpack(json_record_group)};
+    MsgpackRecordGroup record_group{serialized.data(), serialized.size()};
+
+    REQUIRE(GroupTags{"tag0", "tag1"} == record_group.get_tags());
+
+    auto& record_it{record_group.record_iter()};
+    REQUIRE_FALSE(record_it.done());
+    auto const& record{record_it.get()};
+
+    SECTION("Values of the requested type") {
+        REQUIRE(42 == record.get_int64_value("count"));
+        REQUIRE(-7 == record.get_int64_value("negative"));
+        REQUIRE(2.5 == record.get_double_value("ratio"));
+        REQUIRE("value" == record.get_string_view("name"));
+    }
+
+    SECTION("Numbers are converted like JsonRecord") {
+        REQUIRE(42.0 == record.get_double_value("count"));
+        REQUIRE(-7.0 == record.get_double_value("negative"));
+        REQUIRE(2 == record.get_int64_value("ratio"));
+    }
+
+    SECTION("Missing keys throw") {
+        REQUIRE_THROWS_AS(record.get_int64_value("missing"), MsgpackRecord::OperationFailed);
+        REQUIRE_THROWS_AS(record.get_double_value("missing"), MsgpackRecord::OperationFailed);
+        REQUIRE_THROWS_AS(record.get_string_view("missing"), MsgpackRecord::OperationFailed);
+    }
+
+    SECTION("Mismatched types throw") {
+        REQUIRE_THROWS_AS(record.get_int64_value("name"), MsgpackRecord::OperationFailed);
+        REQUIRE_THROWS_AS(record.get_double_value("name"), MsgpackRecord::OperationFailed);
+        REQUIRE_THROWS_AS(record.get_string_view("count"), MsgpackRecord::OperationFailed);
+        REQUIRE_THROWS_AS(record.get_int64_value("nested"), MsgpackRecord::OperationFailed);
+    }
+
+    SECTION("Typed keys skip unsupported values") {
+        std::vector<std::string> keys;
+        for (auto typed_key_it{record.typed_key_iter()}; false == typed_key_it->done();
+             typed_key_it->next())
+        {
+            keys.emplace_back(typed_key_it->get().get_key());
+        }
+        std::sort(keys.begin(), keys.end());
+        REQUIRE(std::vector<std::string>{"count", "name", "negative", "ratio"} == keys);
+    }
+
+    SECTION("Records are iterated in order") {
+        record_it.next();
+        REQUIRE_FALSE(record_it.done());
+        REQUIRE(1 == record_it.get().get_int64_value("count"));
+        REQUIRE_THROWS_AS(
+                record_it.get().get_int64_value("negative"),
+                MsgpackRecord::OperationFailed
+        );
+        record_it.next();
+        REQUIRE(record_it.done());
+    }
+}
+
+TEST_CASE("msgpack_record_group_malformed", "[reducer][MsgpackRecordGroup]") {
+    auto const require_malformed = [](nlohmann::json const& json_record_group) -> void {
+        auto const serialized{to_msgpack(json_record_group)};
+        REQUIRE_THROWS_AS(
+                MsgpackRecordGroup(serialized.data(), serialized.size()),
+                MsgpackRecordGroup::OperationFailed
+        );
+    };
+
+    require_malformed(nlohmann::json::array({1, 2}));
+    require_malformed({{DeserializedRecordGroup::cGroupTagsKey, {"tag"}}});
+    require_malformed(
+            {{DeserializedRecordGroup::cGroupTagsKey, {1}},
+             {DeserializedRecordGroup::cRecordsKey, nlohmann::json::array()}}
+    );
+    require_malformed(
+            {{DeserializedRecordGroup::cGroupTagsKey, {"tag"}},
+             {DeserializedRecordGroup::cRecordsKey, {1}}}
+    );
+
+    std::vector<char> const truncated{'\x82'};
+    REQUIRE_THROWS_AS(
+            MsgpackRecordGroup(truncated.data(), truncated.size()),
+            MsgpackRecordGroup::OperationFailed
+    );
+}
+}  // namespace reducer::test
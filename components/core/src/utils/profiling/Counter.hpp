@@ -0,0 +1,91 @@
+#ifndef UTILS_PROFILING_COUNTER_HPP
+#define UTILS_PROFILING_COUNTER_HPP
+
+#if defined(CLP_ENABLE_PROFILING) && CLP_ENABLE_PROFILING > 0
+    #include <cstdint>
+    #include <string>
+    #include <string_view>
+
+    #include <utils/profiling/Profiler.hpp>
+#endif
+
+#if defined(CLP_ENABLE_PROFILING) && CLP_ENABLE_PROFILING > 0
+namespace utils::profiling {
+/**
+ * Adds `value` to the counter named <scope_path>.<name> in the active profiler.
+ *
+ * Should only be used through the `PROFILE_COUNT*` macros.
+ * Uses external storage to cache the full name and scope path to avoid allocation/recomputation on
+ * subsequent invocations (with the same name and scope path). If no profiler is active, this is a
+ * no-op.
+ *
+ * @param name The counter name.
+ * @param value
+ * @param cached_full_name Per-call-site cache for the full name. Owned externally.
+ * @param cached_scope_path Per-call-site cache for the scope path that was active when
+ * `cached_full_name` was computed. Owned externally.
+ * @param cached_name Per-call-site cache for the name used to compute `cached_full_name`. Owned
+ * externally.
+ */
+inline auto add_to_counter(
+        std::string_view name,
+        uint64_t value,
+        std::string& cached_full_name,
+        std::string& cached_scope_path,
+        std::string& cached_name
+) -> void {
+    if (nullptr == Profiler::get_active_profiler()) {
+        return;
+    }
+    auto const scope_path{Profiler::get_active_scope_path()};
+    if (scope_path != cached_scope_path || name != cached_name) {
+        cached_scope_path = std::string{scope_path};
+        cached_name = std::string{name};
+        cached_full_name = Profiler::build_full_name(name);
+    }
+    Profiler::add_to_counter(cached_full_name, value);
+}
+}  // namespace utils::profiling
+#endif  // defined(CLP_ENABLE_PROFILING) && CLP_ENABLE_PROFILING > 0
+
+/**
+ * `PROFILE_COUNT` and `PROFILE_COUNT_DEBUG` add a value to a named counter in the current scope.
+ *
+ * Set `CLP_ENABLE_PROFILING=1` to enable `PROFILE_COUNT`, or `CLP_ENABLE_PROFILING=2` to also
+ * enable `PROFILE_COUNT_DEBUG`. When profiling is disabled, both macros expand to no-ops and their
+ * arguments are not evaluated.
+ *
+ * Like `PROFILE_SCOPE`, the macros use `__COUNTER__` and `static thread_local` cache variables to
+ * avoid recomputing the full hierarchical name on repeated invocations at the same nesting level.
+ */
+// NOLINTBEGIN(cppcoreguidelines-macro-usage)
+#if defined(CLP_ENABLE_PROFILING) && CLP_ENABLE_PROFILING > 0
+    #define PROFILE_COUNT_IMPL(counter, name, value) \
+        do { \
+            static thread_local ::std::string _prof_count_full_name_##counter; \
+            static thread_local ::std::string _prof_count_path_##counter; \
+            static thread_local ::std::string _prof_count_name_##counter; \
+            ::utils::profiling::add_to_counter( \
+                    name, \
+                    static_cast<::std::uint64_t>(value), \
+                    _prof_count_full_name_##counter, \
+                    _prof_count_path_##counter, \
+                    _prof_count_name_##counter \
+            ); \
+        } while (false)
+
+    #define PROFILE_COUNT_EXPAND(counter, name, value) PROFILE_COUNT_IMPL(counter, name, value)
+
+    #define PROFILE_COUNT(name, value) PROFILE_COUNT_EXPAND(__COUNTER__, name, value)
+#else
+    #define PROFILE_COUNT(name, value) (void)0
+#endif
+
+#if defined(CLP_ENABLE_PROFILING) && CLP_ENABLE_PROFILING > 1
+    #define PROFILE_COUNT_DEBUG(name, value) PROFILE_COUNT_EXPAND(__COUNTER__, name, value)
+#else
+    #define PROFILE_COUNT_DEBUG(name, value) (void)0
+#endif
+// NOLINTEND(cppcoreguidelines-macro-usage)
+
+#endif  // UTILS_PROFILING_COUNTER_HPP
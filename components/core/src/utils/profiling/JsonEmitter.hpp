@@ -0,0 +1,48 @@
+#ifndef UTILS_PROFILING_JSONEMITTER_HPP
+#define UTILS_PROFILING_JSONEMITTER_HPP
+
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <string_view>
+
+#include <nlohmann/json.hpp>
+#include <utils/profiling/Stopwatch.hpp>
+
+namespace utils::profiling {
+/**
+ * Emit callback that records measurements and counters into a JSON object, keyed by their full
+ * names, e.g.:
+ *
+ * {
+ *   "search.read_packed_stream": {"duration_nanosecs": 1234, "call_count": 2},
+ *   "search.tables.read_bytes": {"count": 5678}
+ * }
+ *
+ * The JSON object is owned externally so it outlives the `Reporter` that emits into it.
+ */
+class JsonEmitter {
+public:
+    // Constructors
+    explicit JsonEmitter(nlohmann::json& json) : m_json{&json} {}
+
+    // Methods
+    auto operator()(std::string_view name, Measurement measurement) const -> void {
+        auto& entry{(*m_json)[std::string{name}]};
+        entry["duration_nanosecs"]
+                = std::chrono::duration_cast<std::chrono::nanoseconds>(measurement.duration)
+                          .count();
+        entry["call_count"] = measurement.call_count;
+    }
+
+    auto operator()(std::string_view name, uint64_t value) const -> void {
+        (*m_json)[std::string{name}]["count"] = value;
+    }
+
+private:
+    // Variables
+    nlohmann::json* m_json;
+};
+}  // namespace utils::profiling
+
+#endif  // UTILS_PROFILING_JSONEMITTER_HPP
@@ -1,6 +1,7 @@
 #ifndef UTILS_PROFILING_PROFILER_HPP
 #define UTILS_PROFILING_PROFILER_HPP
 
+#include <cstdint>
 #include <string>
 #include <string_view>
 
@@ -15,10 +16,10 @@
 namespace utils::profiling {
 #if defined(CLP_ENABLE_PROFILING) && CLP_ENABLE_PROFILING > 0
 /**
- * Thread-local registry of named `Stopwatch` measurements.
+ * Thread-local registry of named `Stopwatch` measurements and counters.
  *
- * The active profiler records `Stopwatch` measurements. If no profiler is active, all measurement
- * methods are no-ops.
+ * The active profiler records `Stopwatch` measurements and counter increments. If no profiler is
+ * active, all measurement and counter methods are no-ops.
  *
  * Hierarchical names are built as `<scope_path>.<name>`, where the scope path is a thread-local
  * stack of `string_view`s pushed/popped by callers. Each entry must point to stable storage that
@@ -143,6 +144,27 @@ public:
         it->second.stop();
     }
 
+    /**
+     * Adds `value` to the counter identified by `full_name`. If it does not yet exist, one is
+     * created. If no profiler is active on the current thread, this is a no-op.
+     *
+     * @param full_name The full counter name.
+     * @param value
+     */
+    static auto add_to_counter(std::string_view full_name, uint64_t value) -> void {
+        auto* const profiler{get_active_profiler()};
+        if (nullptr == profiler) {
+            return;
+        }
+        // Look the counter up before inserting it to avoid allocating its name on every call.
+        if (auto const it{profiler->m_counters.find(full_name)}; profiler->m_counters.end() != it)
+        {
+            it->second += value;
+            return;
+        }
+        profiler->m_counters.emplace(std::string{full_name}, value);
+    }
+
     // Methods
     /**
      * Calls `callback` for each measurement with `call_count > 0`, then clears all measurements.
@@ -162,6 +184,19 @@ public:
         m_stopwatches.clear();
     }
 
+    /**
+     * Calls `callback` for each counter, then clears all counters.
+     *
+     * @param callback A callable taking `(std::string_view name, uint64_t value)`.
+     */
+    template <typename Callback>
+    auto for_each_counter(Callback callback) -> void {
+        for (auto const& [name, value] : m_counters) {
+            callback(std::string_view{name}, value);
+        }
+        m_counters.clear();
+    }
+
 private:
     // Static data members
     static inline thread_local std::vector<Profiler*> m_active_profiler_stack;
@@ -169,6 +204,7 @@ private:
 
     // Data members
     absl::flat_hash_map<std::string, Stopwatch> m_stopwatches;
+    absl::flat_hash_map<std::string, uint64_t> m_counters;
 };
 #else
 /**
@@ -195,9 +231,14 @@ public:
 
     static auto stop_measurement(std::string_view full_name) -> void {}
 
+    static auto add_to_counter(std::string_view full_name, uint64_t value) -> void {}
+
     // Methods
     template <typename Callback>
     auto for_each_measurement(Callback callback) -> void {}
+
+    template <typename Callback>
+    auto for_each_counter(Callback callback) -> void {}
 };
 #endif  // defined(CLP_ENABLE_PROFILING) && CLP_ENABLE_PROFILING > 0
 }  // namespace utils::profiling
@@ -2,6 +2,7 @@
 #define UTILS_PROFILING_REPORTER_HPP
 
 #include <chrono>
+#include <cstdint>
 #include <string_view>
 #include <utility>
 
@@ -17,7 +18,7 @@
 
 namespace utils::profiling {
 /**
- * Emit callback that writes profiler measurements to SPDLOG in milliseconds.
+ * Emit callback that writes profiler measurements (in milliseconds) and counters to SPDLOG.
  */
 struct SpdlogEmitter {
     auto operator()(std::string_view name, Measurement measurement) const -> void {
@@ -28,6 +29,10 @@ struct SpdlogEmitter {
                 measurement.call_count
         );
     }
+
+    auto operator()(std::string_view name, uint64_t value) const -> void {
+        SPDLOG_INFO("{}: {}", name, value);
+    }
 };
 
 #if defined(CLP_ENABLE_PROFILING) && CLP_ENABLE_PROFILING > 0
@@ -37,13 +42,20 @@ struct SpdlogEmitter {
 template <typename F>
 concept MeasurementEmitter = std::invocable<F&, std::string_view, Measurement>;
 
+/**
+ * Concept satisfied by emit callbacks that also accept counters.
+ */
+template <typename F>
+concept CounterEmitter = std::invocable<F&, std::string_view, uint64_t>;
+
 /**
  * RAII wrapper that collects profiler measurements and emits them to a callback on destruction.
  *
  * On construction, the reporter pushes its `Profiler` onto the thread-local active profiler stack
  * and pushes its name onto the thread-local scope path stack, so that any profiling using
  * `Profiler` collected within the `Reporter`'s scope produce hierarchical measurement names. On
- * destruction, it pops both stacks and emits all collected measurements.
+ * destruction, it pops both stacks and emits all collected measurements, followed by all collected
+ * counters if the callback accepts them (see `CounterEmitter`).
  *
  * For multi-threaded profiling, each worker thread should create its own `Reporter`.
  *
@@ -79,7 +91,8 @@ public:
 
     // Destructor
     /**
-     * Pops the active profiler and scope path stacks, then emits the profiler's measurements.
+     * Pops the active profiler and scope path stacks, then emits the profiler's measurements and
+     * counters.
      */
     ~Reporter() {
         Profiler::pop_active_profiler();
@@ -89,6 +102,11 @@ public:
                     m_emit(name, measurement);
                 }
         );
+        if constexpr (CounterEmitter<EmitCallback>) {
+            m_profiler.for_each_counter([this](std::string_view name, uint64_t value) -> void {
+                m_emit(name, value);
+            });
+        }
     }
 
 private:
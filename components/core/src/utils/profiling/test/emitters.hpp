@@ -3,6 +3,7 @@
 
 #include <chrono>
 #include <cstdint>
+#include <map>
 #include <string>
 #include <string_view>
 
@@ -34,6 +35,19 @@ inline auto counting_emit(int& emit_count, std::string& last_name) {
         last_name = std::string{name};
     };
 }
+
+/**
+ * Emit callback that ignores measurements and records the emitted counters.
+ */
+struct CounterRecorder {
+    auto operator()(std::string_view, Measurement) const -> void {}
+
+    auto operator()(std::string_view name, uint64_t value) const -> void {
+        (*counters)[std::string{name}] = value;
+    }
+
+    std::map<std::string, uint64_t>* counters;
+};
 }  // namespace utils::profiling::test
 
 #endif  // UTILS_PROFILING_TEST_EMITTERS_HPP
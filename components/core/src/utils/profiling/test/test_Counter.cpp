@@ -0,0 +1,77 @@
+#include <cstdint>
+#include <map>
+#include <string>
+
+#include <catch2/catch_test_macros.hpp>
+#include <nlohmann/json.hpp>
+
+#undef CLP_ENABLE_PROFILING
+// NOLINTNEXTLINE
+#define CLP_ENABLE_PROFILING 1
+
+#include <utils/profiling/Counter.hpp>
+#include <utils/profiling/JsonEmitter.hpp>
+#include <utils/profiling/Profiler.hpp>
+#include <utils/profiling/Reporter.hpp>
+#include <utils/profiling/ScopedProfiler.hpp>
+#include <utils/profiling/test/emitters.hpp>
+
+namespace utils::profiling::test {
+TEST_CASE("counter_accumulates_multiple_calls", "[Counter]") {
+    std::map<std::string, uint64_t> counters;
+    {
+        Reporter const reporter{"test", CounterRecorder{&counters}};
+        for (uint64_t i{1}; i <= 4; ++i) {
+            PROFILE_COUNT("bytes", i);
+        }
+    }
+    REQUIRE(1 == counters.size());
+    REQUIRE(10 == counters.at("test.bytes"));
+}
+
+TEST_CASE("counter_name_includes_scope_path", "[Counter]") {
+    std::map<std::string, uint64_t> counters;
+    {
+        Reporter const reporter{"test", CounterRecorder{&counters}};
+        PROFILE_COUNT("outer", 1);
+        {
+            PROFILE_SCOPE("scope");
+            PROFILE_COUNT("inner", 2);
+        }
+    }
+    REQUIRE(2 == counters.size());
+    REQUIRE(1 == counters.at("test.outer"));
+    REQUIRE(2 == counters.at("test.scope.inner"));
+}
+
+TEST_CASE("counter_without_reporter_is_noop", "[Counter]") {
+    PROFILE_COUNT("orphan", 1);
+    std::map<std::string, uint64_t> counters;
+    {
+        Reporter const reporter{"test", CounterRecorder{&counters}};
+    }
+    REQUIRE(counters.empty());
+}
+
+TEST_CASE("counters_are_ignored_by_measurement_only_emitters", "[Counter]") {
+    int emit_count{0};
+    std::string last_name;
+    {
+        Reporter const reporter{"test", counting_emit(emit_count, last_name)};
+        PROFILE_COUNT("ignored", 1);
+    }
+    REQUIRE(0 == emit_count);
+}
+
+TEST_CASE("json_emitter_records_measurements_and_counters", "[Counter]") {
+    nlohmann::json json;
+    {
+        Reporter const reporter{"test", JsonEmitter{json}};
+        PROFILE_SCOPE("scope");
+        PROFILE_COUNT("rows", 3);
+    }
+    REQUIRE(1 == json.at("test.scope").at("call_count").get<uint32_t>());
+    REQUIRE(json.at("test.scope").contains("duration_nanosecs"));
+    REQUIRE(3 == json.at("test.scope.rows").at("count").get<uint64_t>());
+}
+}  // namespace utils::profiling::test
@@ -0,0 +1,366 @@
+#include <cstddef>
+#include <cstdint>
+#include <random>
+#include <set>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "../src/clp/Defs.h"
+#include "../src/clp/Query.hpp"
+#include "../src/clp/streaming_archive/reader/CandidateMessageScanner.hpp"
+
+using clp::epochtime_t;
+using clp::logtype_dictionary_id_t;
+using clp::Query;
+using clp::segment_id_t;
+using clp::SubQuery;
+using clp::streaming_archive::reader::CandidateMessageScanner;
+using std::pair;
+using std::set;
+using std::unordered_set;
+using std::vector;
+
+namespace {
+// A candidate's message index and the index of its first variable
+using Candidate = pair<size_t, size_t>;
+
+constexpr segment_id_t cSegmentId{0};
+constexpr logtype_dictionary_id_t cNumLogtypes{200};
+constexpr size_t cMaxNumVarsPerLogtype{3};
+constexpr unsigned cSeed{42};
+
+/**
+ * Columns of a file where the matching logtypes occur at and around block boundaries, as well as
+ * at random positions.
+ */
+struct Columns {
+    vector<logtype_dictionary_id_t> logtypes;
+    vector<epochtime_t> timestamps;
+    vector<size_t> num_vars_per_logtype;
+};
+
+/**
+ * @param matching_logtypes
+ * @return Columns spanning several scan blocks, with a partial final block.
+ */
+auto generate_columns(vector<logtype_dictionary_id_t> const& matching_logtypes) -> Columns;
+
+/**
+ * @param possible_logtypes
+ * @param search_begin_timestamp
+ * @param search_end_timestamp
+ * @return A query with a single sub-query that's relevant to `cSegmentId`.
+ */
+auto make_query(
+        unordered_set<logtype_dictionary_id_t> const& possible_logtypes,
+        epochtime_t search_begin_timestamp,
+        epochtime_t search_end_timestamp
+) -> Query;
+
+/**
+ * Finds the candidates from the given position onwards by checking each message in turn.
+ * @param columns
+ * @param possible_logtypes
+ * @param query
+ * @param msg_ix
+ * @param variables_ix
+ * @return The candidates
+ */
+auto find_candidates_linearly(
+        Columns const& columns,
+        unordered_set<logtype_dictionary_id_t> const& possible_logtypes,
+        Query const& query,
+        size_t msg_ix,
+        size_t variables_ix
+) -> vector<Candidate>;
+
+/**
+ * Finds the candidates from the given position onwards using the scanner, advancing the position
+ * past each candidate like `File::find_message_matching_query` does.
+ * @param scanner
+ * @param columns
+ * @param query
+ * @param msg_ix Returns the position after the last message
+ * @param variables_ix Returns the position after the last variable
+ * @param max_num_candidates The maximum number of candidates to find
+ * @return The candidates
+ */
+auto find_candidates_with_scanner(
+        CandidateMessageScanner& scanner,
+        Columns const& columns,
+        Query const& query,
+        size_t& msg_ix,
+        size_t& variables_ix,
+        size_t max_num_candidates = SIZE_MAX
+) -> vector<Candidate>;
+
+auto generate_columns(vector<logtype_dictionary_id_t> const& matching_logtypes) -> Columns {
+    constexpr size_t cBlockSize{CandidateMessageScanner::cNumMessagesPerBlock};
+    constexpr size_t cNumMessages{3 * cBlockSize + 17};
+    constexpr size_t cRandomMatchPeriod{97};
+
+    std::mt19937 generator{cSeed};
+    std::uniform_int_distribution<size_t> num_vars_distribution{0, cMaxNumVarsPerLogtype};
+    std::uniform_int_distribution<logtype_dictionary_id_t> logtype_distribution{
+            0,
+            cNumLogtypes - 1
+    };
+    std::uniform_int_distribution<size_t> matching_logtype_distribution{
+            0,
+            matching_logtypes.size() - 1
+    };
+
+    Columns columns;
+    for (logtype_dictionary_id_t i{0}; i < cNumLogtypes; ++i) {
+        columns.num_vars_per_logtype.push_back(num_vars_distribution(generator));
+    }
+
+    set<size_t> const boundary_msg_ixs{
+            0,
+            cBlockSize - 1,
+            cBlockSize,
+            2 * cBlockSize - 1,
+            2 * cBlockSize,
+            3 * cBlockSize - 1,
+            3 * cBlockSize,
+            cNumMessages - 1
+    };
+    unordered_set<logtype_dictionary_id_t> const matching_logtype_set{
+            matching_logtypes.cbegin(),
+            matching_logtypes.cend()
+    };
+    for (size_t msg_ix{0}; msg_ix < cNumMessages; ++msg_ix) {
+        logtype_dictionary_id_t logtype_id{};
+        if (boundary_msg_ixs.contains(msg_ix) || 0 == msg_ix % cRandomMatchPeriod) {
+            logtype_id = matching_logtypes[matching_logtype_distribution(generator)];
+        } else {
+            do {
+                logtype_id = logtype_distribution(generator);
+            } while (matching_logtype_set.contains(logtype_id));
+        }
+        columns.logtypes.push_back(logtype_id);
+        columns.timestamps.push_back(static_cast<epochtime_t>(msg_ix));
+    }
+    return columns;
+}
+
+auto make_query(
+        unordered_set<logtype_dictionary_id_t> const& possible_logtypes,
+        epochtime_t search_begin_timestamp,
+        epochtime_t search_end_timestamp
+) -> Query {
+    SubQuery sub_query;
+    sub_query.set_possible_logtypes(possible_logtypes);
+    set<segment_id_t> const segment_ids{cSegmentId};
+    sub_query.calculate_ids_of_matching_segments(
+            [&](logtype_dictionary_id_t) -> set<segment_id_t> const& { return segment_ids; },
+            [&](clp::variable_dictionary_id_t) -> set<segment_id_t> const& { return segment_ids; }
+    );
+
+    Query query{search_begin_timestamp, search_end_timestamp, false, "*", {sub_query}};
+    query.make_sub_queries_relevant_to_segment(cSegmentId);
+    return query;
+}
+
+auto find_candidates_linearly(
+        Columns const& columns,
+        unordered_set<logtype_dictionary_id_t> const& possible_logtypes,
+        Query const& query,
+        size_t msg_ix,
+        size_t variables_ix
+) -> vector<Candidate> {
+    vector<Candidate> candidates;
+    for (; msg_ix < columns.logtypes.size(); ++msg_ix) {
+        auto const logtype_id{columns.logtypes[msg_ix]};
+        if (possible_logtypes.contains(logtype_id)
+            && query.timestamp_is_in_search_time_range(columns.timestamps[msg_ix]))
+        {
+            candidates.emplace_back(msg_ix, variables_ix);
+        }
+        variables_ix += columns.num_vars_per_logtype[logtype_id];
+    }
+    return candidates;
+}
+
+auto find_candidates_with_scanner(
+        CandidateMessageScanner& scanner,
+        Columns const& columns,
+        Query const& query,
+        size_t& msg_ix,
+        size_t& variables_ix,
+        size_t max_num_candidates
+) -> vector<Candidate> {
+    vector<Candidate> candidates;
+    while (candidates.size() < max_num_candidates
+           && scanner.find_next_candidate(query, msg_ix, variables_ix))
+    {
+        candidates.emplace_back(msg_ix, variables_ix);
+        variables_ix += columns.num_vars_per_logtype[columns.logtypes[msg_ix]];
+        ++msg_ix;
+    }
+    return candidates;
+}
+}  // namespace
+
+TEST_CASE("CandidateMessageScanner", "[CandidateMessageScanner]") {
+    // Logtypes in different bitmap words, including the last logtype in the dictionary
+    vector<logtype_dictionary_id_t> const matching_logtypes{3, 64, 130, cNumLogtypes - 1};
+    unordered_set<logtype_dictionary_id_t> const possible_logtypes{
+            matching_logtypes.cbegin(),
+            matching_logtypes.cend()
+    };
+    auto const columns{generate_columns(matching_logtypes)};
+    auto const num_messages{columns.logtypes.size()};
+    size_t num_variables{0};
+    for (auto const logtype_id : columns.logtypes) {
+        num_variables += columns.num_vars_per_logtype[logtype_id];
+    }
+
+    CandidateMessageScanner scanner;
+    scanner.open(
+            columns.logtypes.data(),
+            columns.timestamps.data(),
+            num_messages,
+            columns.num_vars_per_logtype
+    );
+
+    SECTION("Candidates match a linear scan") {
+        epochtime_t search_begin_timestamp{clp::cEpochTimeMin};
+        epochtime_t search_end_timestamp{clp::cEpochTimeMax};
+        SECTION("Unbounded time range") {}
+        SECTION("Time range starting and ending in the middle of blocks") {
+            search_begin_timestamp = 100;
+            search_end_timestamp = 3 * CandidateMessageScanner::cNumMessagesPerBlock - 100;
+        }
+        SECTION("Time range matching only a block boundary") {
+            search_begin_timestamp = CandidateMessageScanner::cNumMessagesPerBlock;
+            search_end_timestamp = CandidateMessageScanner::cNumMessagesPerBlock;
+        }
+
+        auto const query{
+                make_query(possible_logtypes, search_begin_timestamp, search_end_timestamp)
+        };
+        auto const expected_candidates{
+                find_candidates_linearly(columns, possible_logtypes, query, 0, 0)
+        };
+        REQUIRE(false == expected_candidates.empty());
+
+        size_t msg_ix{0};
+        size_t variables_ix{0};
+        REQUIRE(expected_candidates
+                == find_candidates_with_scanner(scanner, columns, query, msg_ix, variables_ix));
+        REQUIRE(num_messages == msg_ix);
+        REQUIRE(num_variables == variables_ix);
+
+        // The end of the columns stays the end
+        REQUIRE(false == scanner.find_next_candidate(query, msg_ix, variables_ix));
+        REQUIRE(num_messages == msg_ix);
+        REQUIRE(num_variables == variables_ix);
+    }
+
+    SECTION("Scanning resumes after the caller moves and resets the scanner") {
+        auto const query{make_query(possible_logtypes, clp::cEpochTimeMin, clp::cEpochTimeMax)};
+        auto const expected_candidates{
+                find_candidates_linearly(columns, possible_logtypes, query, 0, 0)
+        };
+
+        // Stop partway through the first block, then step over a few messages one at a time like
+        // `File::get_next_message` does
+        constexpr size_t cNumCandidatesBeforeMove{3};
+        constexpr size_t cNumMessagesToStepOver{CandidateMessageScanner::cNumMessagesPerBlock};
+        size_t msg_ix{0};
+        size_t variables_ix{0};
+        auto candidates{find_candidates_with_scanner(
+                scanner,
+                columns,
+                query,
+                msg_ix,
+                variables_ix,
+                cNumCandidatesBeforeMove
+        )};
+        REQUIRE(vector<Candidate>(
+                        expected_candidates.cbegin(),
+                        expected_candidates.cbegin() + cNumCandidatesBeforeMove
+                )
+                == candidates);
+
+        for (size_t i{0}; i < cNumMessagesToStepOver; ++i) {
+            variables_ix += columns.num_vars_per_logtype[columns.logtypes[msg_ix]];
+            ++msg_ix;
+        }
+        scanner.reset();
+
+        auto const expected_remaining_candidates{
+                find_candidates_linearly(columns, possible_logtypes, query, msg_ix, variables_ix)
+        };
+        REQUIRE(expected_remaining_candidates
+                == find_candidates_with_scanner(scanner, columns, query, msg_ix, variables_ix));
+        REQUIRE(num_messages == msg_ix);
+        REQUIRE(num_variables == variables_ix);
+    }
+
+    SECTION("A different query restarts the scan from the caller's position") {
+        auto const first_query{
+                make_query({matching_logtypes[0]}, clp::cEpochTimeMin, clp::cEpochTimeMax)
+        };
+        size_t msg_ix{0};
+        size_t variables_ix{0};
+        auto const first_candidates{
+                find_candidates_with_scanner(scanner, columns, first_query, msg_ix, variables_ix, 1)
+        };
+        REQUIRE(1 == first_candidates.size());
+
+        auto const second_query{
+                make_query(possible_logtypes, clp::cEpochTimeMin, clp::cEpochTimeMax)
+        };
+        auto const expected_candidates{find_candidates_linearly(
+                columns,
+                possible_logtypes,
+                second_query,
+                msg_ix,
+                variables_ix
+        )};
+        REQUIRE(expected_candidates
+                == find_candidates_with_scanner(
+                        scanner,
+                        columns,
+                        second_query,
+                        msg_ix,
+                        variables_ix
+                ));
+    }
+
+    SECTION("A query without relevant logtypes has no candidates") {
+        auto query{make_query(possible_logtypes, clp::cEpochTimeMin, clp::cEpochTimeMax)};
+        query.make_sub_queries_relevant_to_segment(cSegmentId + 1);
+        REQUIRE(query.get_relevant_logtypes_bitmap().empty());
+
+        size_t msg_ix{0};
+        size_t variables_ix{0};
+        REQUIRE(false == scanner.find_next_candidate(query, msg_ix, variables_ix));
+        REQUIRE(num_messages == msg_ix);
+        REQUIRE(num_variables == variables_ix);
+    }
+
+    SECTION("A logtype that isn't in the dictionary throws") {
+        auto corrupt_logtypes{columns.logtypes};
+        corrupt_logtypes[CandidateMessageScanner::cNumMessagesPerBlock + 1] = cNumLogtypes;
+        scanner.open(
+                corrupt_logtypes.data(),
+                columns.timestamps.data(),
+                num_messages,
+                columns.num_vars_per_logtype
+        );
+
+        auto const query{make_query(possible_logtypes, clp::cEpochTimeMin, clp::cEpochTimeMax)};
+        size_t msg_ix{0};
+        size_t variables_ix{0};
+        REQUIRE_THROWS_AS(
+                find_candidates_with_scanner(scanner, columns, query, msg_ix, variables_ix),
+                CandidateMessageScanner::OperationFailed
+        );
+    }
+}
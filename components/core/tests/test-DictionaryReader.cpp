@@ -0,0 +1,257 @@
+#include <unistd.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <set>
+#include <string>
+#include <string_view>
+#include <unordered_set>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "../src/clp/ArrayBackedPosIntSet.hpp"
+#include "../src/clp/Defs.h"
+#include "../src/clp/VariableDictionaryEntry.hpp"
+#include "../src/clp/VariableDictionaryReader.hpp"
+#include "../src/clp/VariableDictionaryWriter.hpp"
+
+using clp::ArrayBackedPosIntSet;
+using clp::cVariableDictionaryIdMax;
+using clp::segment_id_t;
+using clp::variable_dictionary_id_t;
+using clp::VariableDictionaryEntry;
+using clp::VariableDictionaryReader;
+using clp::VariableDictionaryWriter;
+using std::set;
+using std::string;
+using std::unordered_set;
+using std::vector;
+
+namespace {
+constexpr char cVarDictPath[] = "dictionary-reader.var.dict";
+constexpr char cVarSegmentIndexPath[] = "dictionary-reader.var.segindex";
+
+/**
+ * Exposes which of the reader's entries have been decoded.
+ */
+class InspectableVariableDictionaryReader : public VariableDictionaryReader {
+public:
+    /**
+     * @return The number of entries that have been decoded.
+     */
+    [[nodiscard]] auto get_num_decoded_entries() const -> size_t {
+        size_t num_decoded_entries{0};
+        for (auto const& entry : m_entries) {
+            if (nullptr != entry) {
+                ++num_decoded_entries;
+            }
+        }
+        return num_decoded_entries;
+    }
+};
+
+/**
+ * Overwrites the header of a dictionary or segment index file, i.e., the number of entries or
+ * segments in it. This lets a test expose a complete dictionary to a reader in stages, the way an
+ * archive that's still being written would.
+ * @param path
+ * @param num_items
+ */
+auto write_header(char const* path, uint64_t num_items) -> void;
+
+/**
+ * Adds the given values to the dictionary and indexes them as belonging to the given segment.
+ * @param writer
+ * @param values
+ * @param segment_id
+ * @return The IDs of the values.
+ */
+auto add_values(
+        VariableDictionaryWriter& writer,
+        vector<string> const& values,
+        segment_id_t segment_id
+) -> vector<variable_dictionary_id_t>;
+
+/**
+ * @param entries
+ * @return The values of the given entries.
+ */
+auto get_values(vector<VariableDictionaryEntry const*> const& entries) -> set<string>;
+
+/**
+ * @param entries
+ * @return The values of the given entries.
+ */
+auto get_values(unordered_set<VariableDictionaryEntry const*> const& entries) -> set<string>;
+
+auto add_values(
+        VariableDictionaryWriter& writer,
+        vector<string> const& values,
+        segment_id_t segment_id
+) -> vector<variable_dictionary_id_t> {
+    vector<variable_dictionary_id_t> ids;
+    ArrayBackedPosIntSet<variable_dictionary_id_t> segment_ids;
+    for (auto const& value : values) {
+        variable_dictionary_id_t id{};
+        writer.add_entry(value, id);
+        ids.push_back(id);
+        segment_ids.insert(id);
+    }
+    writer.index_segment(segment_id, segment_ids);
+    return ids;
+}
+
+auto write_header(char const* path, uint64_t num_items) -> void {
+    std::fstream file{path, std::ios::binary | std::ios::in | std::ios::out};
+    REQUIRE(file.is_open());
+    file.write(reinterpret_cast<char const*>(&num_items), sizeof(num_items));
+    REQUIRE(file.good());
+}
+
+auto get_values(vector<VariableDictionaryEntry const*> const& entries) -> set<string> {
+    set<string> values;
+    for (auto const* entry : entries) {
+        values.emplace(entry->get_value());
+    }
+    return values;
+}
+
+auto get_values(unordered_set<VariableDictionaryEntry const*> const& entries) -> set<string> {
+    set<string> values;
+    for (auto const* entry : entries) {
+        values.emplace(entry->get_value());
+    }
+    return values;
+}
+}  // namespace
+
+TEST_CASE("DictionaryReader", "[DictionaryReader]") {
+    constexpr segment_id_t cFirstSegmentId{0};
+    constexpr segment_id_t cSecondSegmentId{1};
+    constexpr size_t cNumFillerValues{1000};
+
+    vector<string> first_values{"python2.7.3", "Python2.7.3", "PYTHON2.7.3", "java-17", ""};
+    for (size_t i{0}; i < cNumFillerValues; ++i) {
+        first_values.emplace_back("filler-" + std::to_string(i));
+    }
+    vector<string> const second_values{"python3.12", "rust-1.80", "java-17"};
+
+    // Write both segments' values, but only expose the first segment's to the reader at first
+    VariableDictionaryWriter writer;
+    writer.open(cVarDictPath, cVarSegmentIndexPath, cVariableDictionaryIdMax);
+    auto const first_ids{add_values(writer, first_values, cFirstSegmentId)};
+    auto const second_ids{add_values(writer, second_values, cSecondSegmentId)};
+    // Existing values keep their IDs
+    REQUIRE(first_ids[3] == second_ids[2]);
+    writer.close();
+    write_header(cVarDictPath, first_values.size());
+    write_header(cVarSegmentIndexPath, 1);
+
+    InspectableVariableDictionaryReader reader;
+    reader.open(cVarDictPath, cVarSegmentIndexPath);
+    reader.read_new_entries();
+    REQUIRE(first_values.size() == reader.get_num_entries());
+    REQUIRE(0 == reader.get_num_decoded_entries());
+
+    SECTION("Entries are decoded on first access") {
+        auto const id{first_ids[3]};
+        auto const& entry{reader.get_entry(id)};
+        REQUIRE(1 == reader.get_num_decoded_entries());
+        REQUIRE(id == entry.get_id());
+        REQUIRE(first_values[3] == entry.get_value());
+        REQUIRE(set<segment_id_t>{cFirstSegmentId}
+                == entry.get_ids_of_segments_containing_entry());
+
+        // Repeated accesses return the cached entry
+        REQUIRE(&entry == &reader.get_entry(id));
+        REQUIRE(&entry.get_value() == &reader.get_value(id));
+        REQUIRE(1 == reader.get_num_decoded_entries());
+
+        // Every entry decodes to its value
+        for (size_t i{0}; i < first_values.size(); ++i) {
+            REQUIRE(first_values[i] == reader.get_value(first_ids[i]));
+        }
+        REQUIRE(first_values.size() == reader.get_num_decoded_entries());
+
+        REQUIRE_THROWS_AS(
+                reader.get_entry(first_values.size()),
+                VariableDictionaryReader::OperationFailed
+        );
+    }
+
+    SECTION("Lookups only decode matching entries") {
+        auto const exact_entries{reader.get_entry_matching_value("Python2.7.3", false)};
+        REQUIRE(1 == exact_entries.size());
+        REQUIRE(first_ids[1] == exact_entries.front()->get_id());
+        REQUIRE(1 == reader.get_num_decoded_entries());
+
+        // Repeated lookups return the cached entry
+        REQUIRE(exact_entries == reader.get_entry_matching_value("Python2.7.3", false));
+        REQUIRE(1 == reader.get_num_decoded_entries());
+
+        REQUIRE(reader.get_entry_matching_value("python2.7", false).empty());
+        REQUIRE(reader.get_entry_matching_value("PyThOn2.7.3", false).empty());
+        REQUIRE(1 == reader.get_entry_matching_value("", false).size());
+
+        // The decoded entries are now the three case variants and the empty value
+        REQUIRE(set<string>{"python2.7.3", "Python2.7.3", "PYTHON2.7.3"}
+                == get_values(reader.get_entry_matching_value("PyThOn2.7.3", true)));
+        REQUIRE(3 + 1 == reader.get_num_decoded_entries());
+
+        unordered_set<VariableDictionaryEntry const*> wildcard_entries;
+        reader.get_entries_matching_wildcard_string("*2.7*", false, wildcard_entries);
+        REQUIRE(set<string>{"python2.7.3", "Python2.7.3", "PYTHON2.7.3"}
+                == get_values(wildcard_entries));
+
+        wildcard_entries.clear();
+        reader.get_entries_matching_wildcard_string("py?hon*", false, wildcard_entries);
+        REQUIRE(set<string>{"python2.7.3"} == get_values(wildcard_entries));
+
+        wildcard_entries.clear();
+        reader.get_entries_matching_wildcard_string("JAVA*", true, wildcard_entries);
+        REQUIRE(set<string>{"java-17"} == get_values(wildcard_entries));
+        REQUIRE(3 + 1 + 1 == reader.get_num_decoded_entries());
+
+        // A wildcard matching every entry decodes them all
+        wildcard_entries.clear();
+        reader.get_entries_matching_wildcard_string("*", false, wildcard_entries);
+        REQUIRE(first_values.size() == wildcard_entries.size());
+        REQUIRE(first_values.size() == reader.get_num_decoded_entries());
+    }
+
+    SECTION("Reading new entries extends the entries and lookups") {
+        // Decode an entry and build the value index before the dictionary grows
+        auto const& java_entry{reader.get_entry(first_ids[3])};
+        REQUIRE(1 == reader.get_entry_matching_value("filler-0", false).size());
+
+        write_header(cVarDictPath, first_values.size() + 2);
+        write_header(cVarSegmentIndexPath, 2);
+        reader.read_new_entries();
+        REQUIRE(first_values.size() + 2 == reader.get_num_entries());
+
+        auto const new_entries{reader.get_entry_matching_value("rust-1.80", false)};
+        REQUIRE(1 == new_entries.size());
+        REQUIRE(second_ids[1] == new_entries.front()->get_id());
+        REQUIRE(set<segment_id_t>{cSecondSegmentId}
+                == new_entries.front()->get_ids_of_segments_containing_entry());
+        REQUIRE(1 == reader.get_entry_matching_value("filler-0", false).size());
+
+        // Entries decoded before the refresh and after it both pick up the new segment
+        REQUIRE(set<segment_id_t>{cFirstSegmentId, cSecondSegmentId}
+                == java_entry.get_ids_of_segments_containing_entry());
+        auto const& python_entry{reader.get_entry(first_ids[0])};
+        REQUIRE(set<segment_id_t>{cFirstSegmentId}
+                == python_entry.get_ids_of_segments_containing_entry());
+
+        unordered_set<VariableDictionaryEntry const*> wildcard_entries;
+        reader.get_entries_matching_wildcard_string("python*", true, wildcard_entries);
+        REQUIRE(set<string>{"python2.7.3", "Python2.7.3", "PYTHON2.7.3", "python3.12"}
+                == get_values(wildcard_entries));
+    }
+
+    reader.close();
+    REQUIRE(0 == unlink(cVarDictPath));
+    REQUIRE(0 == unlink(cVarSegmentIndexPath));
+}
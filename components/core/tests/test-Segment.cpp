@@ -1,6 +1,10 @@
 #include <unistd.h>
 
+#include <algorithm>
+#include <cstddef>
 #include <cstring>
+#include <utility>
+#include <vector>
 
 #include <boost/filesystem.hpp>
 #include <catch2/catch_test_macros.hpp>
@@ -33,7 +37,7 @@ TEST_CASE("Test writing and reading a segment", "[Segment]") {
     // Test segment writing
     clp::streaming_archive::writer::Segment writer_segment;
 
-    writer_segment.open(segments_dir_path, 0, 0);
+    writer_segment.open(segments_dir_path, 0, 0, 0);
     auto segment_id = writer_segment.get_id();
 
     // Fill segment
@@ -65,3 +69,61 @@ TEST_CASE("Test writing and reading a segment", "[Segment]") {
     boost::filesystem::remove_all(segments_dir_path, boost_error_code);
     REQUIRE(!boost_error_code);
 }
+
+TEST_CASE("Test reading a segment written as multiple frames", "[Segment]") {
+    constexpr size_t cUncompressedDataSize{8L * 1024 * 1024};  // 8 MiB
+    constexpr size_t cFrameUncompressedSize{64L * 1024};  // 64 KiB
+
+    std::vector<char> uncompressed_data(cUncompressedDataSize);
+    for (size_t i = 0; i < cUncompressedDataSize; ++i) {
+        uncompressed_data[i] = static_cast<char>('a' + (i * 7 + i / 1024) % 26);
+    }
+
+    string segments_dir_path = "unit-test-segment-frames/";
+    REQUIRE(ErrorCode_Success == clp::create_directory_structure(segments_dir_path, 0700));
+
+    clp::streaming_archive::writer::Segment writer_segment;
+    writer_segment.open(segments_dir_path, 0, 0, cFrameUncompressedSize);
+    auto segment_id = writer_segment.get_id();
+
+    // Append in chunks that don't align with frame boundaries
+    constexpr size_t cChunkSize{100'000};
+    for (size_t pos = 0; pos < cUncompressedDataSize; pos += cChunkSize) {
+        uint64_t offset = 0;
+        writer_segment.append(
+                uncompressed_data.data() + pos,
+                std::min(cChunkSize, cUncompressedDataSize - pos),
+                offset
+        );
+        REQUIRE(pos == offset);
+    }
+    writer_segment.close();
+
+    clp::streaming_archive::reader::Segment reader_segment;
+    REQUIRE(ErrorCode_Success == reader_segment.try_open(segments_dir_path, segment_id));
+
+    // Read ranges out of order, including ones spanning frame boundaries
+    std::vector<char> decompressed_data(cUncompressedDataSize);
+    std::vector<std::pair<size_t, size_t>> const ranges{
+            {5 * cFrameUncompressedSize + 10, 3 * cFrameUncompressedSize},
+            {cFrameUncompressedSize - 1, 2},
+            {cUncompressedDataSize - 1000, 1000},
+            {5 * cFrameUncompressedSize + 10 + 3 * cFrameUncompressedSize, 100},
+            {0, cUncompressedDataSize}
+    };
+    for (auto const& [pos, size] : ranges) {
+        auto const error_code = reader_segment.try_read(pos, decompressed_data.data(), size);
+        REQUIRE(ErrorCode_Success == error_code);
+        REQUIRE(std::memcmp(uncompressed_data.data() + pos, decompressed_data.data(), size) == 0);
+    }
+
+    // Reading past the end of the segment should fail
+    REQUIRE(ErrorCode_Success
+            != reader_segment.try_read(cUncompressedDataSize - 10, decompressed_data.data(), 20));
+
+    reader_segment.close();
+
+    boost::system::error_code boost_error_code;
+    boost::filesystem::remove_all(segments_dir_path, boost_error_code);
+    REQUIRE(!boost_error_code);
+}
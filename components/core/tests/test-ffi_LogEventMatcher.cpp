@@ -0,0 +1,151 @@
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <vector>
+
+#include <catch2/catch_message.hpp>
+#include <catch2/catch_template_test_macros.hpp>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <string_utils/string_utils.hpp>
+
+#include "../src/clp/BufferReader.hpp"
+#include "../src/clp/ffi/ir_stream/decoding_methods.hpp"
+#include "../src/clp/ffi/ir_stream/encoding_methods.hpp"
+#include "../src/clp/ffi/ir_stream/protocol_constants.hpp"
+#include "../src/clp/ffi/search/LogEventMatcher.hpp"
+#include "../src/clp/ir/LogEventDeserializer.hpp"
+#include "../src/clp/ir/types.hpp"
+#include "../src/clp/type_utils.hpp"
+
+using clp::BufferReader;
+using clp::ffi::search::LogEventMatcher;
+using clp::ir::eight_byte_encoded_variable_t;
+using clp::ir::epoch_time_ms_t;
+using clp::ir::four_byte_encoded_variable_t;
+using clp::ir::LogEventDeserializer;
+using clp::size_checked_pointer_cast;
+using clp::string_utils::clean_up_wildcard_search_string;
+using clp::string_utils::wildcard_match_unsafe;
+using std::string;
+using std::vector;
+
+namespace {
+constexpr epoch_time_ms_t cReferenceTimestamp{1'700'000'000'000};
+
+/**
+ * Serializes the given messages into an unstructured IR stream.
+ * @tparam encoded_variable_t
+ * @param messages
+ * @param ir_buf Returns the IR stream.
+ */
+template <typename encoded_variable_t>
+auto serialize_messages(vector<string> const& messages, vector<int8_t>& ir_buf) -> void;
+
+template <typename encoded_variable_t>
+auto serialize_messages(vector<string> const& messages, vector<int8_t>& ir_buf) -> void {
+    constexpr char cTimestampPattern[] = "%Y-%m-%d %H:%M:%S,%3";
+    constexpr char cTimestampPatternSyntax[] = "yyyy-MM-dd HH:mm:ss";
+    constexpr char cTimeZoneId[] = "America/Toronto";
+
+    string logtype;
+    if constexpr (std::is_same_v<encoded_variable_t, eight_byte_encoded_variable_t>) {
+        namespace encoding = clp::ffi::ir_stream::eight_byte_encoding;
+        REQUIRE(encoding::serialize_preamble(
+                cTimestampPattern,
+                cTimestampPatternSyntax,
+                cTimeZoneId,
+                ir_buf
+        ));
+        for (size_t i{0}; i < messages.size(); ++i) {
+            auto const timestamp{cReferenceTimestamp + static_cast<epoch_time_ms_t>(i)};
+            REQUIRE(encoding::serialize_log_event(timestamp, messages[i], logtype, ir_buf));
+        }
+    } else {
+        namespace encoding = clp::ffi::ir_stream::four_byte_encoding;
+        REQUIRE(encoding::serialize_preamble(
+                cTimestampPattern,
+                cTimestampPatternSyntax,
+                cTimeZoneId,
+                cReferenceTimestamp,
+                ir_buf
+        ));
+        for (auto const& message : messages) {
+            REQUIRE(encoding::serialize_log_event(1, message, logtype, ir_buf));
+        }
+    }
+    ir_buf.push_back(clp::ffi::ir_stream::cProtocol::Eof);
+}
+}  // namespace
+
+TEMPLATE_TEST_CASE(
+        "ffi_search_LogEventMatcher",
+        "[clp][ffi][search][LogEventMatcher]",
+        four_byte_encoded_variable_t,
+        eight_byte_encoded_variable_t
+) {
+    vector<string> const messages{
+            "Task task_123 completed in 45 ms\n",
+            "Task task_124 completed in 4.5 ms\n",
+            "Task task_123 failed after 3 retries\n",
+            "Connected to 192.168.1.10:8080 as user Alice\n",
+            "Connected to 192.168.1.11:8080 as user bob\n",
+            "Disk usage at -12.75 percent on /dev/sda1\n",
+            "Static message without variables\n",
+            "Escaped \\ backslash and \x11 placeholder with value 7\n"
+    };
+    vector<int8_t> ir_buf;
+    serialize_messages<TestType>(messages, ir_buf);
+
+    auto const query{GENERATE(
+            "*",
+            "*task_123*",
+            "*completed in 45 ms*",
+            "*completed in 4? ms*",
+            "*in 4*",
+            "*retries*",
+            "*192.168.1.1?:8080*",
+            "*user alice*",
+            "*-12.75*",
+            "*12.7*",
+            "*sda?*",
+            "*without variables*",
+            "*\\\\ backslash*",
+            "*value 7*",
+            "*no such message*"
+    )};
+    bool const ignore_case{GENERATE(false, true)};
+    CAPTURE(query);
+    CAPTURE(ignore_case);
+
+    BufferReader reader{size_checked_pointer_cast<char const>(ir_buf.data()), ir_buf.size()};
+    REQUIRE_FALSE(clp::ffi::ir_stream::get_encoding_type(reader).has_error());
+    auto deserializer_result{LogEventDeserializer<TestType>::create(reader)};
+    REQUIRE_FALSE(deserializer_result.has_error());
+    auto& deserializer{deserializer_result.value()};
+
+    LogEventMatcher<TestType> matcher{query, ignore_case};
+    vector<string> matched_messages;
+    while (true) {
+        auto const result{matcher.find_next_match(deserializer)};
+        if (result.has_error()) {
+            REQUIRE((std::errc::no_message == result.error()));
+            break;
+        }
+        REQUIRE((result.value().first.get_message().decode_and_unparse().value()
+                 == result.value().second));
+        matched_messages.emplace_back(result.value().second);
+    }
+
+    auto const cleaned_query{clean_up_wildcard_search_string(query)};
+    vector<string> expected_messages;
+    for (auto const& message : messages) {
+        if (wildcard_match_unsafe(message, cleaned_query, false == ignore_case)) {
+            expected_messages.emplace_back(message);
+        }
+    }
+    REQUIRE((expected_messages == matched_messages));
+    REQUIRE((matcher.get_num_decoded_messages() >= matched_messages.size()));
+}
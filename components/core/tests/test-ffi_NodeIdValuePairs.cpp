@@ -0,0 +1,164 @@
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+#include <catch2/catch_test_macros.hpp>
+
+#include "../src/clp/ffi/NodeIdValuePairs.hpp"
+#include "../src/clp/ffi/SchemaTree.hpp"
+#include "../src/clp/ffi/Value.hpp"
+
+using clp::ffi::NodeIdValuePairs;
+using clp::ffi::SchemaTree;
+using clp::ffi::Value;
+using clp::ffi::value_int_t;
+
+namespace {
+/**
+ * @param pairs
+ * @return The node IDs of the given pairs, in iteration order.
+ */
+auto get_node_ids(NodeIdValuePairs const& pairs) -> std::vector<SchemaTree::Node::id_t>;
+
+/**
+ * Asserts that the given pair has an integer value equal to `expected`.
+ * @param value
+ * @param expected
+ */
+auto assert_int_value(std::optional<Value> const& value, value_int_t expected) -> void;
+
+auto get_node_ids(NodeIdValuePairs const& pairs) -> std::vector<SchemaTree::Node::id_t> {
+    std::vector<SchemaTree::Node::id_t> node_ids;
+    for (auto const& [node_id, value] : pairs) {
+        node_ids.push_back(node_id);
+    }
+    return node_ids;
+}
+
+auto assert_int_value(std::optional<Value> const& value, value_int_t expected) -> void {
+    REQUIRE(value.has_value());
+    REQUIRE(value->is<value_int_t>());
+    REQUIRE(expected == value->get_immutable_view<value_int_t>());
+}
+}  // namespace
+
+TEST_CASE("ffi_NodeIdValuePairs_emplace", "[ffi][NodeIdValuePairs]") {
+    NodeIdValuePairs pairs;
+    REQUIRE(pairs.empty());
+
+    SECTION("In-order insertion") {
+        for (SchemaTree::Node::id_t node_id{0}; node_id < 4; ++node_id) {
+            auto const [it, inserted]{pairs.emplace(node_id, Value{value_int_t{node_id}})};
+            REQUIRE(inserted);
+            REQUIRE(node_id == it->first);
+        }
+        REQUIRE(std::vector<SchemaTree::Node::id_t>{0, 1, 2, 3} == get_node_ids(pairs));
+    }
+
+    SECTION("Out-of-order insertion") {
+        for (SchemaTree::Node::id_t const node_id : {5, 1, 9, 3, 0, 7}) {
+            auto const [it, inserted]{pairs.emplace(node_id, Value{value_int_t{node_id}})};
+            REQUIRE(inserted);
+            REQUIRE(node_id == it->first);
+            assert_int_value(it->second, node_id);
+        }
+        REQUIRE(std::vector<SchemaTree::Node::id_t>{0, 1, 3, 5, 7, 9} == get_node_ids(pairs));
+        for (auto const& [node_id, value] : pairs) {
+            assert_int_value(value, node_id);
+        }
+    }
+
+    SECTION("Duplicate node IDs keep the first value") {
+        REQUIRE(pairs.emplace(2, Value{value_int_t{2}}).second);
+        REQUIRE(pairs.emplace(4, std::nullopt).second);
+
+        auto const [last_it, last_inserted]{pairs.emplace(4, Value{value_int_t{0}})};
+        REQUIRE_FALSE(last_inserted);
+        REQUIRE(4 == last_it->first);
+        REQUIRE_FALSE(last_it->second.has_value());
+
+        auto const [first_it, first_inserted]{pairs.emplace(2, Value{value_int_t{0}})};
+        REQUIRE_FALSE(first_inserted);
+        REQUIRE(2 == first_it->first);
+        assert_int_value(first_it->second, 2);
+
+        REQUIRE(2 == pairs.size());
+    }
+
+    SECTION("Initializer list") {
+        NodeIdValuePairs const initialized_pairs{
+                {3, Value{value_int_t{3}}},
+                {1, std::nullopt},
+                {3, Value{value_int_t{0}}},
+                {2, Value{value_int_t{2}}}
+        };
+        REQUIRE(std::vector<SchemaTree::Node::id_t>{1, 2, 3} == get_node_ids(initialized_pairs));
+        REQUIRE_FALSE(initialized_pairs.at(1).has_value());
+        assert_int_value(initialized_pairs.at(3), 3);
+    }
+
+    SECTION("Clearing allows reuse") {
+        REQUIRE(pairs.emplace(1, std::nullopt).second);
+        pairs.clear();
+        REQUIRE(pairs.empty());
+        REQUIRE_FALSE(pairs.contains(1));
+        REQUIRE(pairs.emplace(0, Value{value_int_t{0}}).second);
+        REQUIRE(std::vector<SchemaTree::Node::id_t>{0} == get_node_ids(pairs));
+    }
+}
+
+TEST_CASE("ffi_NodeIdValuePairs_lookup", "[ffi][NodeIdValuePairs]") {
+    NodeIdValuePairs const pairs{
+            {1, Value{value_int_t{1}}},
+            {4, std::nullopt},
+            {6, Value{value_int_t{6}}}
+    };
+
+    REQUIRE(pairs.contains(1));
+    REQUIRE(pairs.contains(4));
+    REQUIRE(pairs.end() != pairs.find(6));
+    assert_int_value(pairs.at(6), 6);
+    REQUIRE_FALSE(pairs.at(4).has_value());
+
+    for (SchemaTree::Node::id_t const missing_node_id : {0, 2, 5, 7}) {
+        REQUIRE_FALSE(pairs.contains(missing_node_id));
+        REQUIRE(pairs.end() == pairs.find(missing_node_id));
+        REQUIRE_THROWS_AS(pairs.at(missing_node_id), std::out_of_range);
+    }
+
+    NodeIdValuePairs const empty_pairs;
+    REQUIRE(empty_pairs.end() == empty_pairs.find(0));
+    REQUIRE_THROWS_AS(empty_pairs.at(0), std::out_of_range);
+}
+
+TEST_CASE("ffi_NodeIdValuePairs_matches_map", "[ffi][NodeIdValuePairs]") {
+    constexpr size_t cNumInsertions{1000};
+    constexpr SchemaTree::Node::id_t cMaxNodeId{300};
+    constexpr unsigned cSeed{42};
+
+    std::mt19937 generator{cSeed};
+    std::uniform_int_distribution<SchemaTree::Node::id_t> node_id_distribution{0, cMaxNodeId};
+
+    NodeIdValuePairs pairs;
+    std::map<SchemaTree::Node::id_t, value_int_t> expected_pairs;
+    for (size_t i{0}; i < cNumInsertions; ++i) {
+        auto const node_id{node_id_distribution(generator)};
+        auto const value{static_cast<value_int_t>(i)};
+        auto const inserted{pairs.emplace(node_id, Value{value}).second};
+        REQUIRE(expected_pairs.emplace(node_id, value).second == inserted);
+    }
+
+    REQUIRE(expected_pairs.size() == pairs.size());
+    auto expected_it{expected_pairs.cbegin()};
+    for (auto const& [node_id, value] : pairs) {
+        REQUIRE(expected_it->first == node_id);
+        assert_int_value(value, expected_it->second);
+        ++expected_it;
+    }
+    for (SchemaTree::Node::id_t node_id{0}; node_id <= cMaxNodeId; ++node_id) {
+        REQUIRE(expected_pairs.contains(node_id) == pairs.contains(node_id));
+    }
+}
@@ -1,8 +1,11 @@
+#include <algorithm>
+#include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <map>
 #include <memory>
 #include <optional>
+#include <span>
 #include <sstream>
 #include <string>
 #include <string_view>
@@ -18,6 +21,7 @@
 #include <msgpack.hpp>
 #include <nlohmann/json.hpp>
 
+#include "../src/clp/BufferedReader.hpp"
 #include "../src/clp/BufferReader.hpp"
 #include "../src/clp/ErrorCode.hpp"
 #include "../src/clp/ffi/encoding_methods.hpp"
@@ -1364,6 +1368,247 @@ TEMPLATE_TEST_CASE(
     REQUIRE((eof_result.has_error() && std::errc::operation_not_permitted == eof_result.error()));
 }
 
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEMPLATE_TEST_CASE(
+        "ffi_ir_stream_kv_pair_log_events_buffered_deserialization",
+        "[clp][ffi][ir_stream]",
+        four_byte_encoded_variable_t,
+        eight_byte_encoded_variable_t
+) {
+    // Serialize enough log events that they span many of the `BufferedReader`'s buffer refills, so
+    // that some IR units are deserialized from the reader's buffer and others cross its end.
+    constexpr size_t cNumLogEvents{1000};
+    constexpr size_t cMaxPaddingLength{300};
+
+    vector<int8_t> ir_buf;
+    auto serializer_result{Serializer<TestType>::create()};
+    REQUIRE_FALSE(serializer_result.has_error());
+    auto& serializer{serializer_result.value()};
+    flush_and_clear_serializer_buffer(serializer, ir_buf);
+
+    auto const empty_obj = nlohmann::json::parse("{}");
+    vector<nlohmann::json> expected_user_gen_json_objs;
+    for (size_t i{0}; i < cNumLogEvents; ++i) {
+        nlohmann::json const user_gen_json_obj
+                = {{"idx", i},
+                   {"message", "Task task_" + std::to_string(i) + " completed in 4.5 ms"},
+                   {"padding", string(i % cMaxPaddingLength, 'x')},
+                   {"nested", {{"is_even", 0 == i % 2}}}};
+        REQUIRE_FALSE(unpack_and_serialize_msgpack_bytes(
+                              nlohmann::json::to_msgpack(empty_obj),
+                              nlohmann::json::to_msgpack(user_gen_json_obj),
+                              serializer
+        )
+                              .has_error());
+        expected_user_gen_json_objs.emplace_back(user_gen_json_obj);
+    }
+    flush_and_clear_serializer_buffer(serializer, ir_buf);
+    ir_buf.push_back(clp::ffi::ir_stream::cProtocol::Eof);
+
+    clp::BufferedReader reader{
+            std::make_shared<BufferReader>(
+                    size_checked_pointer_cast<char>(ir_buf.data()),
+                    ir_buf.size()
+            ),
+            clp::BufferedReader::cMinBufferSize
+    };
+    auto deserializer_result{Deserializer<IrUnitHandler>::create(reader, IrUnitHandler{})};
+    REQUIRE_FALSE(deserializer_result.has_error());
+    auto& deserializer = deserializer_result.value();
+    while (true) {
+        auto const result{deserializer.deserialize_next_ir_unit(reader)};
+        REQUIRE_FALSE(result.has_error());
+        if (result.value() == clp::ffi::ir_stream::IrUnitType::EndOfStream) {
+            break;
+        }
+    }
+    REQUIRE((ir_buf.size() == reader.get_pos()));
+
+    auto const& deserialized_log_events{
+            deserializer.get_ir_unit_handler().get_deserialized_log_events()
+    };
+    REQUIRE((cNumLogEvents == deserialized_log_events.size()));
+    for (size_t idx{0}; idx < cNumLogEvents; ++idx) {
+        auto const serialized_json_result{deserialized_log_events.at(idx).serialize_to_json()};
+        REQUIRE_FALSE(serialized_json_result.has_error());
+        REQUIRE((expected_user_gen_json_objs.at(idx) == serialized_json_result.value().second));
+    }
+}
+
+// NOLINTNEXTLINE(readability-function-cognitive-complexity)
+TEMPLATE_TEST_CASE(
+        "ffi_ir_stream_Serializer_serialize_msgpack_maps",
+        "[clp][ffi][ir_stream][Serializer]",
+        four_byte_encoded_variable_t,
+        eight_byte_encoded_variable_t
+) {
+    using MsgpackMapPair = typename Serializer<TestType>::MsgpackMapPair;
+    constexpr size_t cNumLogEvents{100};
+    constexpr size_t cBatchSize{7};
+
+    auto unpack_json_obj = [](nlohmann::json const& json_obj) -> msgpack::object_handle {
+        auto const msgpack_bytes{nlohmann::json::to_msgpack(json_obj)};
+        return msgpack::unpack(
+                size_checked_pointer_cast<char const>(msgpack_bytes.data()),
+                msgpack_bytes.size()
+        );
+    };
+
+    // Generate log events whose key layouts repeat, change, and only partially overlap, so that
+    // serialization exercises both hits and misses in the serializer's schema shape caches.
+    auto const empty_obj = nlohmann::json::parse("{}");
+    vector<msgpack::object_handle> msgpack_obj_handles;
+    vector<MsgpackMapPair> msgpack_map_pairs;
+    for (size_t i{0}; i < cNumLogEvents; ++i) {
+        nlohmann::json const auto_gen_json_obj
+                = 0 == i % 2 ? nlohmann::json{{"timestamp", i}} : empty_obj;
+        nlohmann::json user_gen_json_obj
+                = {{"idx", i}, {"message", "Task task_" + std::to_string(i) + " completed"}};
+        if (0 == i % 3) {
+            user_gen_json_obj.emplace(
+                    "nested",
+                    nlohmann::json{{"is_even", 0 == i % 2}, {"empty", empty_obj}}
+            );
+        }
+        if (0 == i % 5) {
+            user_gen_json_obj.emplace("level", "INFO");
+        }
+        msgpack_obj_handles.emplace_back(unpack_json_obj(auto_gen_json_obj));
+        auto const auto_gen_obj{msgpack_obj_handles.back().get()};
+        msgpack_obj_handles.emplace_back(unpack_json_obj(user_gen_json_obj));
+        auto const user_gen_obj{msgpack_obj_handles.back().get()};
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
+        msgpack_map_pairs.emplace_back(auto_gen_obj.via.map, user_gen_obj.via.map);
+    }
+
+    // Serialize the log events one at a time and in batches, which should produce the same IR
+    auto serializer_result{Serializer<TestType>::create()};
+    REQUIRE_FALSE(serializer_result.has_error());
+    auto& serializer{serializer_result.value()};
+    auto batch_serializer_result{Serializer<TestType>::create()};
+    REQUIRE_FALSE(batch_serializer_result.has_error());
+    auto& batch_serializer{batch_serializer_result.value()};
+
+    for (auto const& [auto_gen_map, user_gen_map] : msgpack_map_pairs) {
+        REQUIRE_FALSE(serializer.serialize_msgpack_map(auto_gen_map, user_gen_map).has_error());
+    }
+    std::span<MsgpackMapPair const> const msgpack_map_pairs_view{msgpack_map_pairs};
+    for (size_t begin_idx{0}; begin_idx < msgpack_map_pairs_view.size(); begin_idx += cBatchSize) {
+        auto const batch{msgpack_map_pairs_view.subspan(
+                begin_idx,
+                std::min(cBatchSize, msgpack_map_pairs_view.size() - begin_idx)
+        )};
+        REQUIRE_FALSE(batch_serializer.serialize_msgpack_maps(batch).has_error());
+    }
+    auto const ir_buf_view{serializer.get_ir_buf_view()};
+    auto const batch_ir_buf_view{batch_serializer.get_ir_buf_view()};
+    REQUIRE(std::ranges::equal(ir_buf_view, batch_ir_buf_view));
+
+    // A batch that contains an unserializable log event shouldn't serialize any of its log events,
+    // including the schema tree nodes they added.
+    msgpack_obj_handles.emplace_back(unpack_json_obj({{"new_key", "value"}}));
+    auto const new_layout_obj{msgpack_obj_handles.back().get()};
+    msgpack_obj_handles.emplace_back(
+            unpack_json_obj({{"binary", nlohmann::json::binary({0, 1, 2})}})
+    );
+    auto const unserializable_obj{msgpack_obj_handles.back().get()};
+    // NOLINTBEGIN(cppcoreguidelines-pro-type-union-access)
+    vector<MsgpackMapPair> const failing_batch{
+            {msgpack_map_pairs.front().first, new_layout_obj.via.map},
+            {msgpack_map_pairs.front().first, unserializable_obj.via.map}
+    };
+    // NOLINTEND(cppcoreguidelines-pro-type-union-access)
+    auto const ir_buf_size{batch_serializer.get_ir_buf_view().size()};
+    REQUIRE(batch_serializer.serialize_msgpack_maps(failing_batch).has_error());
+    REQUIRE((ir_buf_size == batch_serializer.get_ir_buf_view().size()));
+
+    REQUIRE_FALSE(serializer
+                          .serialize_msgpack_map(
+                                  failing_batch.front().first,
+                                  failing_batch.front().second
+                          )
+                          .has_error());
+    REQUIRE_FALSE(batch_serializer
+                          .serialize_msgpack_maps(std::span{failing_batch}.first(1))
+                          .has_error());
+    REQUIRE(std::ranges::equal(serializer.get_ir_buf_view(), batch_serializer.get_ir_buf_view()));
+}
+
+// Hidden by default since it's a benchmark rather than a correctness test. Run it explicitly with
+// the `[benchmark]` tag.
+TEST_CASE(
+        "ffi_ir_stream_Serializer_serialize_msgpack_maps_throughput",
+        "[.][benchmark][clp][ffi][ir_stream][Serializer]"
+) {
+    using MsgpackMapPair = Serializer<four_byte_encoded_variable_t>::MsgpackMapPair;
+    constexpr size_t cNumLogEvents{200'000};
+    constexpr size_t cBatchSize{1024};
+
+    // Generate log events that share a handful of key layouts, like a typical structured log
+    vector<msgpack::object_handle> msgpack_obj_handles;
+    vector<MsgpackMapPair> msgpack_map_pairs;
+    msgpack_obj_handles.emplace_back(create_msgpack_empty_map_obj_handle());
+    auto const empty_obj{msgpack_obj_handles.back().get()};
+    for (size_t i{0}; i < cNumLogEvents; ++i) {
+        nlohmann::json user_gen_json_obj
+                = {{"timestamp", 1'700'000'000'000 + i},
+                   {"level", 0 == i % 10 ? "WARN" : "INFO"},
+                   {"message", "Request " + std::to_string(i) + " completed"},
+                   {"context",
+                    {{"thread_id", i % 16}, {"load", static_cast<double>(i % 100) / 100.0}}}};
+        if (0 == i % 4) {
+            user_gen_json_obj.emplace("success", 0 != i % 7);
+        }
+        auto const msgpack_bytes{nlohmann::json::to_msgpack(user_gen_json_obj)};
+        msgpack_obj_handles.emplace_back(msgpack::unpack(
+                size_checked_pointer_cast<char const>(msgpack_bytes.data()),
+                msgpack_bytes.size()
+        ));
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-type-union-access)
+        msgpack_map_pairs.emplace_back(empty_obj.via.map, msgpack_obj_handles.back().get().via.map);
+    }
+
+    auto serializer_result{Serializer<four_byte_encoded_variable_t>::create()};
+    REQUIRE_FALSE(serializer_result.has_error());
+    auto& serializer{serializer_result.value()};
+    auto batch_serializer_result{Serializer<four_byte_encoded_variable_t>::create()};
+    REQUIRE_FALSE(batch_serializer_result.has_error());
+    auto& batch_serializer{batch_serializer_result.value()};
+
+    // Clear the IR buffers after every `cBatchSize` log events in both cases, so neither of them
+    // pays for growing a large buffer.
+    auto const start_time{std::chrono::steady_clock::now()};
+    for (size_t i{0}; i < msgpack_map_pairs.size(); ++i) {
+        auto const& [auto_gen_map, user_gen_map]{msgpack_map_pairs[i]};
+        REQUIRE_FALSE(serializer.serialize_msgpack_map(auto_gen_map, user_gen_map).has_error());
+        if (0 == (i + 1) % cBatchSize) {
+            serializer.clear_ir_buf();
+        }
+    }
+    std::chrono::duration<double> const duration{std::chrono::steady_clock::now() - start_time};
+
+    std::span<MsgpackMapPair const> const msgpack_map_pairs_view{msgpack_map_pairs};
+    auto const batch_start_time{std::chrono::steady_clock::now()};
+    for (size_t begin_idx{0}; begin_idx < msgpack_map_pairs_view.size(); begin_idx += cBatchSize) {
+        auto const batch{msgpack_map_pairs_view.subspan(
+                begin_idx,
+                std::min(cBatchSize, msgpack_map_pairs_view.size() - begin_idx)
+        )};
+        REQUIRE_FALSE(batch_serializer.serialize_msgpack_maps(batch).has_error());
+        batch_serializer.clear_ir_buf();
+    }
+    std::chrono::duration<double> const batch_duration{
+            std::chrono::steady_clock::now() - batch_start_time
+    };
+
+    WARN("Serialized " << cNumLogEvents << " log events one at a time in " << duration.count()
+                       << " s (" << static_cast<double>(cNumLogEvents) / duration.count()
+                       << " events/s) and in batches of " << cBatchSize << " in "
+                       << batch_duration.count() << " s ("
+                       << static_cast<double>(cNumLogEvents) / batch_duration.count()
+                       << " events/s).");
+}
+
 TEMPLATE_TEST_CASE(
         "ffi_ir_stream_unstructured_log_events_serde",
         "[clp][ffi][ir_stream]",
@@ -1477,7 +1722,8 @@ TEMPLATE_TEST_CASE(
             = clp::ffi::ir_stream::deserialize_and_decode_schema_tree_node_id<
                     cOneByteLengthIndicatorTag,
                     cTwoByteLengthIndicatorTag,
-                    cFourByteLengthIndicatorTag
+                    cFourByteLengthIndicatorTag,
+                    clp::ReaderInterface
             >;
 
     std::vector<int8_t> output_buf;
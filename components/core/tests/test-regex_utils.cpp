@@ -1,13 +1,18 @@
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <catch2/catch_test_macros.hpp>
 #include <regex_utils/ErrorCode.hpp>
 #include <regex_utils/regex_translation_utils.hpp>
+#include <regex_utils/RegexMatcher.hpp>
 #include <regex_utils/RegexToWildcardTranslatorConfig.hpp>
+#include <string_utils/string_utils.hpp>
 
 using clp::regex_utils::ErrorCode;
 using clp::regex_utils::ErrorCodeEnum;
 using clp::regex_utils::regex_to_wildcard;
+using clp::regex_utils::RegexMatcher;
 using clp::regex_utils::RegexToWildcardTranslatorConfig;
 
 namespace {
@@ -131,3 +136,155 @@ TEST_CASE("regex_to_wildcard_anchor_config", "[regex_utils][re2wc][anchor_config
 
     test_translation_error("xyz$zyx$", ErrorCodeEnum::IllegalDollarSign, &config);
 }
+
+TEST_CASE("regex_to_wildcard_superset_config", "[regex_utils][re2wc][superset]") {
+    RegexToWildcardTranslatorConfig const config{false, false, /*translate_to_superset=*/true};
+    // Patterns with an exact translation are translated as usual
+    test_translation_value("x[y]z.*", "xyz*", &config);
+
+    // Quantifiers
+    test_translation_value("ab+c", "ab*c", &config);
+    test_translation_value("ab*c", "a*c", &config);
+    test_translation_value("ab?c", "a*c", &config);
+    test_translation_value("ab+?c", "ab*c", &config);
+    test_translation_value("a.?c", "a*c", &config);
+    test_translation_value("a[bc]{2}d", "a??d", &config);
+    test_translation_value("ab{2,}c", "abb*c", &config);
+    test_translation_value("ab{0,2}c", "a*c", &config);
+    test_translation_value("a{x}", "a{x}", &config);
+
+    // Character sets and classes
+    test_translation_value("[0-9]x[^a]", "?x?", &config);
+    test_translation_value("[]a]x", "?x", &config);
+    test_translation_value("\\d\\w\\S", "???", &config);
+    test_translation_value("\\t\\x41\\:", "\tA:", &config);
+
+    // Groups and alternations
+    test_translation_value("x(?:ab)+y", "xab*y", &config);
+    test_translation_value("x(ab|cd)y", "x*y", &config);
+    test_translation_value("x(a(b|c))?y", "x*y", &config);
+    test_translation_value("x(ab)y|z", "*", &config);
+
+    test_translation_error("x(ab", ErrorCodeEnum::UnmatchedParenthesis, &config);
+    test_translation_error("xab)", ErrorCodeEnum::UnmatchedParenthesis, &config);
+    test_translation_error("x(?=a)", ErrorCodeEnum::UnsupportedRegexFeature, &config);
+    test_translation_error("x\\1", ErrorCodeEnum::IllegalEscapeSequence, &config);
+    test_translation_error("a{2,1}", ErrorCodeEnum::InvalidQuantifier, &config);
+}
+
+TEST_CASE("RegexMatcher_matches", "[regex_utils][RegexMatcher][matches]") {
+    auto const matches = [](std::string const& regex_str, std::string const& str) -> bool {
+        auto const result{RegexMatcher::create(regex_str, false)};
+        REQUIRE_FALSE(result.has_error());
+        return result.value().matches(str);
+    };
+
+    // Unanchored regexes match any string containing a match
+    REQUIRE(matches("xyz", "axyzb"));
+    REQUIRE_FALSE(matches("xyz", "xy z"));
+    REQUIRE(matches("a[0-9]+b", "xa123b"));
+    REQUIRE_FALSE(matches("a[0-9]+b", "ab"));
+    REQUIRE(matches("(foo|bar){2}", "foobar"));
+    REQUIRE_FALSE(matches("(foo|bar){2}", "foo"));
+    REQUIRE(matches("\\d{3}-\\d{4}", "call 555-1234 now"));
+    REQUIRE_FALSE(matches("\\d{3}-\\d{4}", "call 555-123 now"));
+    REQUIRE(matches("colou?r", "color"));
+    REQUIRE(matches("colou?r", "colour"));
+    REQUIRE(matches("x\\*y", "x*y"));
+    REQUIRE_FALSE(matches("x\\*y", "xxy"));
+    REQUIRE(matches("[^a-z]", "abc1"));
+    REQUIRE_FALSE(matches("[^a-z]", "abc"));
+
+    // Anchors
+    REQUIRE(matches("^abc$", "abc"));
+    REQUIRE(matches("^abc$", "abc\n"));
+    REQUIRE_FALSE(matches("^abc$", "abcd"));
+    REQUIRE_FALSE(matches("^abc$", "zabc"));
+    REQUIRE(matches("^$", ""));
+    REQUIRE_FALSE(matches("^$", "a"));
+
+    // `.` doesn't match a newline
+    REQUIRE(matches("^a.c", "abc"));
+    REQUIRE_FALSE(matches("^a.c", "a\nc"));
+
+    // Case-insensitive matching
+    auto const case_insensitive_result{RegexMatcher::create("ErRoR [a-c]", true)};
+    REQUIRE_FALSE(case_insensitive_result.has_error());
+    auto const& case_insensitive_matcher{case_insensitive_result.value()};
+    REQUIRE(case_insensitive_matcher.is_case_insensitive());
+    REQUIRE(case_insensitive_matcher.matches("an error B occurred"));
+    REQUIRE_FALSE(case_insensitive_matcher.matches("an error d occurred"));
+    REQUIRE_FALSE(matches("ErRoR", "error"));
+}
+
+TEST_CASE("RegexMatcher_nfa_fallback", "[regex_utils][RegexMatcher][nfa_fallback]") {
+    // A DFA for this regex needs more than 2^12 states, so the matcher simulates the NFA instead
+    auto const result{RegexMatcher::create("(a|b)*a(a|b){12}", false)};
+    REQUIRE_FALSE(result.has_error());
+    auto const& matcher{result.value()};
+    REQUIRE_FALSE(matcher.uses_dfa());
+    REQUIRE(matcher.matches("bbab" + std::string(11, 'a')));
+    REQUIRE_FALSE(matcher.matches(std::string(12, 'b')));
+    REQUIRE_FALSE(matcher.matches("a" + std::string(11, 'b')));
+
+    REQUIRE(RegexMatcher::create("(foo|bar)+baz", false).value().uses_dfa());
+}
+
+TEST_CASE("RegexMatcher_wildcard_superset", "[regex_utils][RegexMatcher][wildcard_superset]") {
+    auto const get_superset = [](std::string const& regex_str, bool case_insensitive) {
+        auto const result{RegexMatcher::create(regex_str, case_insensitive)};
+        REQUIRE_FALSE(result.has_error());
+        return result.value().get_wildcard_superset();
+    };
+
+    REQUIRE((get_superset("xyz", false) == "*xyz*"));
+    REQUIRE((get_superset("^abc$", false) == "abc*"));
+    REQUIRE((get_superset("^a.c", false) == "a?c*"));
+    REQUIRE((get_superset("a[0-9]+b", false) == "*a?*b*"));
+    REQUIRE((get_superset("\\d{3}-\\d{4}", false) == "*???" "-????*"));
+    REQUIRE((get_superset("colou?r", false) == "*colo*r*"));
+    REQUIRE((get_superset("x\\*y", false) == "*x\\*y*"));
+    REQUIRE((get_superset("a|b", false) == "*"));
+    REQUIRE((get_superset("User \\w+ logged in", false) == "*User ?* logged in*"));
+    REQUIRE((get_superset("[Ee]rror: .*timeout", false) == "*?rror: *timeout*"));
+    REQUIRE((get_superset("[Ee]rror: .*timeout", true) == "*error: *timeout*"));
+
+    // Every string the regex matches must match its superset
+    std::vector<std::pair<std::string, std::string>> const regexes_and_matches{
+            {"(foo|bar){2}", "xfoobarx"},
+            {"x(ab|cd)+y", "xcdaby"},
+            {"^(?:ab)?c$", "c\n"},
+            {"a{2,3}b", "aaab"},
+            {"\\x41\\d\\.", "A1."},
+            {"[]x]y", "]y"}
+    };
+    for (auto const& [regex_str, str] : regexes_and_matches) {
+        auto const result{RegexMatcher::create(regex_str, false)};
+        REQUIRE_FALSE(result.has_error());
+        REQUIRE(result.value().matches(str));
+        REQUIRE(clp::string_utils::wildcard_match_unsafe(
+                str,
+                result.value().get_wildcard_superset()
+        ));
+    }
+}
+
+TEST_CASE("RegexMatcher_errors", "[regex_utils][RegexMatcher][errors]") {
+    auto const test_error = [](std::string const& regex_str, ErrorCodeEnum error) {
+        REQUIRE((RegexMatcher::create(regex_str, false).error() == ErrorCode{error}));
+    };
+
+    test_error("a^b", ErrorCodeEnum::IllegalCaret);
+    test_error("a$b", ErrorCodeEnum::IllegalDollarSign);
+    test_error("\\q", ErrorCodeEnum::IllegalEscapeSequence);
+    test_error("(ab", ErrorCodeEnum::UnmatchedParenthesis);
+    test_error("ab)", ErrorCodeEnum::UnmatchedParenthesis);
+    test_error("[ab", ErrorCodeEnum::IncompleteCharsetStructure);
+    test_error("[z-a]", ErrorCodeEnum::InvalidCharsetRange);
+    test_error("*a", ErrorCodeEnum::InvalidQuantifier);
+    test_error("a**", ErrorCodeEnum::InvalidQuantifier);
+    test_error("a{2,1}", ErrorCodeEnum::InvalidQuantifier);
+    test_error("(?=a)", ErrorCodeEnum::UnsupportedRegexFeature);
+    test_error("(a)\\1", ErrorCodeEnum::UnsupportedRegexFeature);
+    test_error("[[:alpha:]]", ErrorCodeEnum::UnsupportedRegexFeature);
+}